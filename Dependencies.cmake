@@ -1,8 +1,9 @@
 if (NOT TARGET seika)
     set(SEIKA_STATIC_LIB OFF)
 
-    # Setting to 10,000 as the default 200,000 is too much for our needs now
-    set(SKA_MAX_ENTITIES 10000 CACHE STRING "Maximum number of entities")
+    # Setting to 100,000 as the default 200,000 is more than we need, larger per entity data is paged so only entity id
+    # tables scale with this
+    set(SKA_MAX_ENTITIES 100000 CACHE STRING "Maximum number of entities")
     add_definitions(-DSKA_MAX_ENTITIES=${SKA_MAX_ENTITIES})
 
     include(FetchContent)
@@ -463,10 +463,12 @@ class Font:
 
 
 class InputAction:
-    def __init__(self, name: str, values: list, device_id=0):
+    def __init__(self, name: str, values: list, device_id=0, prediction="repeat_last", input_delay=0):
         self.name = name
         self.values = values
         self.device_id = device_id
+        self.prediction = prediction
+        self.input_delay = input_delay
 
 
 class AnimationFrame:
@@ -831,6 +833,15 @@ class NodeType:
     Parallax = 128
     Particles2D = 256
     Tilemap = 512
+    VisibilityNotifier2D = 1024
+
+
+# Whether a node's '_process', '_fixed_process', animations and particles run, nodes are still drawn either way
+class ProcessMode:
+    INHERIT = 0  # Same as the parent, roots are pausable
+    PAUSABLE = 1
+    ALWAYS = 2  # Keeps running while the scene tree is paused
+    DISABLED = 3
 
 
 class NodeEventSubscriber:
@@ -898,6 +909,18 @@ class Node:
     def get_child(self, child_name: str) -> Optional["Node"]:
         return crescent_internal.node_get_child(self.entity_id, child_name)
 
+    def get_node(self, node_path: str) -> Optional["Node"]:
+        return crescent_internal.node_get_node(self.entity_id, node_path)
+
+    def add_to_group(self, group: str) -> None:
+        crescent_internal.node_add_to_group(self.entity_id, group)
+
+    def remove_from_group(self, group: str) -> None:
+        crescent_internal.node_remove_from_group(self.entity_id, group)
+
+    def is_in_group(self, group: str) -> bool:
+        return crescent_internal.node_is_in_group(self.entity_id, group)
+
     def get_children(self) -> List["Node"]:
         return crescent_internal.node_get_children(self.entity_id)
 
@@ -910,6 +933,10 @@ class Node:
     def is_queued_for_deletion(self) -> bool:
         return crescent_internal.node_is_queued_for_deletion(self.entity_id)
 
+    # Only for nodes from 'PackedScene.acquire', returns the instance to its pool instead of deleting it
+    def release_to_pool(self) -> bool:
+        return crescent_internal.node_release_to_pool(self.entity_id)
+
     def get_time_dilation(self) -> float:
         return crescent_internal.node_get_time_dilation(self.entity_id)
 
@@ -927,6 +954,24 @@ class Node:
     def get_total_time_dilation(self) -> float:
         return crescent_internal.node_get_total_time_dilation(self.entity_id)
 
+    def get_process_mode(self) -> int:
+        return crescent_internal.node_get_process_mode(self.entity_id)
+
+    def set_process_mode(self, mode: int) -> None:
+        crescent_internal.node_set_process_mode(self.entity_id, mode)
+
+    @property
+    def process_mode(self) -> int:
+        return crescent_internal.node_get_process_mode(self.entity_id)
+
+    @process_mode.setter
+    def process_mode(self, value: int) -> None:
+        crescent_internal.node_set_process_mode(self.entity_id, value)
+
+    # False while pooled, disabled or pausable and the scene tree is paused
+    def can_process(self) -> bool:
+        return crescent_internal.node_can_process(self.entity_id)
+
     def __eq__(self, other: "Node") -> bool:
         return self.entity_id == other.entity_id
 
@@ -1380,15 +1425,101 @@ class Tilemap(Node2D):
         return crescent_internal.node_new(cls.__module__, cls.__name__, NodeType.Tilemap)
 
 
+# Tests its rect (relative to the node's global position) against the camera every frame.  When 'suspend_when_off_screen'
+# is set the node and its children stop processing while the rect is off screen.
+class VisibilityNotifier2D(Node2D):
+
+    def __init__(self, entity_id: int) -> None:
+        super().__init__(entity_id)
+        self.screen_entered = NodeEvent(self)
+        self.screen_exited = NodeEvent(self)
+
+    @classmethod
+    def new(cls) -> "VisibilityNotifier2D":
+        return crescent_internal.node_new(cls.__module__, cls.__name__, NodeType.VisibilityNotifier2D)
+
+    @property
+    def rect(self) -> Rect2:
+        x, y, w, h = crescent_internal.visibility_notifier2d_get_rect(self.entity_id)
+        return Rect2(x=x, y=y, w=w, h=h)
+
+    @rect.setter
+    def rect(self, value: Rect2) -> None:
+        crescent_internal.visibility_notifier2d_set_rect(self.entity_id, float(value.x), float(value.y), float(value.w), float(value.h))
+
+    @property
+    def suspend_when_off_screen(self) -> bool:
+        return crescent_internal.visibility_notifier2d_get_suspend_when_off_screen(self.entity_id)
+
+    @suspend_when_off_screen.setter
+    def suspend_when_off_screen(self, value: bool) -> None:
+        crescent_internal.visibility_notifier2d_set_suspend_when_off_screen(self.entity_id, value)
+
+    def is_on_screen(self) -> bool:
+        return crescent_internal.visibility_notifier2d_is_on_screen(self.entity_id)
+
+
 class SceneTree:
+    _on_async_scene_loaded_func: Optional[Callable[[], None]] = None
+
     @staticmethod
     def change_scene(path: str) -> None:
         crescent_internal.scene_tree_change_scene(path)
 
+    # Loads the scene in the background while the current scene keeps running, then changes to it once fully loaded
+    # Returns False if a scene change is already in progress
+    @staticmethod
+    def change_scene_async(path: str, on_loaded: Optional[Callable[[], None]] = None) -> bool:
+        if crescent_internal.scene_tree_change_scene_async(path):
+            SceneTree._on_async_scene_loaded_func = on_loaded
+            return True
+        return False
+
+    # From 0.0 to 1.0, 1.0 if there is no scene loading
+    @staticmethod
+    def get_async_load_progress() -> float:
+        return crescent_internal.scene_tree_get_async_load_progress()
+
+    @staticmethod
+    def is_async_loading() -> bool:
+        return crescent_internal.scene_tree_is_async_loading()
+
+    # Max time spent creating nodes of the loading scene each frame
+    @staticmethod
+    def set_async_load_frame_budget(budget_ms: float) -> None:
+        crescent_internal.scene_tree_set_async_load_frame_budget(float(budget_ms))
+
+    @staticmethod
+    def _on_async_scene_loaded() -> None:
+        on_loaded_func = SceneTree._on_async_scene_loaded_func
+        SceneTree._on_async_scene_loaded_func = None
+        if on_loaded_func:
+            on_loaded_func()
+
+    # Pausable nodes stop processing until the tree is unpaused, see 'ProcessMode'
+    @staticmethod
+    def set_paused(paused: bool) -> None:
+        crescent_internal.scene_tree_set_paused(paused)
+
+    @staticmethod
+    def is_paused() -> bool:
+        return crescent_internal.scene_tree_is_paused()
+
     @staticmethod
     def get_root() -> Optional[Node]:
         return crescent_internal.scene_tree_get_root()
 
+    @staticmethod
+    def get_nodes_in_group(group: str) -> List[Node]:
+        return crescent_internal.scene_tree_get_nodes_in_group(group)
+
+    # Calls the method on every node in the group that has it
+    @staticmethod
+    def call_group(group: str, method_name: str, *args) -> None:
+        for node in crescent_internal.scene_tree_get_nodes_in_group(group):
+            if hasattr(node, method_name):
+                getattr(node, method_name)(*args)
+
 
 class World:
     @staticmethod
@@ -1559,6 +1690,36 @@ class GameConfig:
         return json_dict
 
 
+class SceneCacheStats:
+    def __init__(self, hits: int, misses: int, evictions: int, resident_count: int, memory_used: int, memory_budget: int):
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+        self.resident_count = resident_count
+        self.memory_used = memory_used
+        self.memory_budget = memory_budget
+
+    def __str__(self):
+        return f"SceneCacheStats(hits: {self.hits}, misses: {self.misses}, evictions: {self.evictions}, resident_count: {self.resident_count}, memory_used: {self.memory_used}, memory_budget: {self.memory_budget})"
+
+    def __repr__(self):
+        return f"SceneCacheStats(hits: {self.hits}, misses: {self.misses}, evictions: {self.evictions}, resident_count: {self.resident_count}, memory_used: {self.memory_used}, memory_budget: {self.memory_budget})"
+
+
+class NodePoolStats:
+    def __init__(self, active_count: int, idle_count: int, created_count: int, reused_count: int):
+        self.active_count = active_count
+        self.idle_count = idle_count
+        self.created_count = created_count
+        self.reused_count = reused_count
+
+    def __str__(self):
+        return f"NodePoolStats(active_count: {self.active_count}, idle_count: {self.idle_count}, created_count: {self.created_count}, reused_count: {self.reused_count})"
+
+    def __repr__(self):
+        return f"NodePoolStats(active_count: {self.active_count}, idle_count: {self.idle_count}, created_count: {self.created_count}, reused_count: {self.reused_count})"
+
+
 class PackedScene:
     def __init__(self, scene_cache_id: int, path: str):
         self.scene_cache_id = scene_cache_id
@@ -1567,6 +1728,20 @@ class PackedScene:
     def create_instance(self) -> Node:
         return crescent_internal.packed_scene_create_instance(self.scene_cache_id)
 
+    # Creates 'count' instances at once, cheaper than calling 'create_instance' in a loop (e.g. spawning projectiles)
+    # If 'positions' are passed there must be one for each instance
+    def create_instances(self, count: int, positions: Optional[List[Vector2]] = None) -> List[Node]:
+        return crescent_internal.packed_scene_create_instances(self.scene_cache_id, count, positions if positions else [])
+
+    # Reuses an instance released with 'Node.release_to_pool' if there is one, reset to the scene's values but keeping its
+    # script state ('_start' is only called once per instance).  Add it as a child like a new instance
+    def acquire(self) -> Node:
+        return crescent_internal.packed_scene_acquire(self.scene_cache_id)
+
+    def get_pool_stats(self) -> NodePoolStats:
+        active_count, idle_count, created_count, reused_count = crescent_internal.packed_scene_get_pool_stats(self.scene_cache_id)
+        return NodePoolStats(active_count, idle_count, created_count, reused_count)
+
     @staticmethod
     def load(path: str) -> Optional["PackedScene"]:
         scene_cache_id = crescent_internal.packed_scene_load(path)
@@ -1574,6 +1749,16 @@ class PackedScene:
             return None
         return PackedScene(scene_cache_id, path)
 
+    # Scene templates are shared by scene changes and packed scenes, least recently used ones are evicted past the memory budget
+    @staticmethod
+    def get_cache_stats() -> SceneCacheStats:
+        hits, misses, evictions, resident_count, memory_used, memory_budget = crescent_internal.packed_scene_get_cache_stats()
+        return SceneCacheStats(hits, misses, evictions, resident_count, memory_used, memory_budget)
+
+    @staticmethod
+    def set_cache_memory_budget(memory_budget: int) -> None:
+        crescent_internal.packed_scene_set_cache_memory_budget(memory_budget)
+
 
 class Network:
     @staticmethod
@@ -1615,3 +1800,48 @@ class Client:
     @staticmethod
     def subscribe(event_name: str, listener_node: Node, listener_func: Callable) -> None:
         _node_event_manager.subscribe_to_event(-100, event_name, listener_node.entity_id, listener_func)
+
+
+class ReplayStats:
+    def __init__(self, keyframe_count: int, snapshot_memory_bytes: int, last_seek_frames_simulated: int, last_seek_time_ms: int, rollback_count: int, rollback_frames_resimulated: int):
+        self.keyframe_count = keyframe_count
+        self.snapshot_memory_bytes = snapshot_memory_bytes
+        self.last_seek_frames_simulated = last_seek_frames_simulated
+        self.last_seek_time_ms = last_seek_time_ms
+        self.rollback_count = rollback_count
+        self.rollback_frames_resimulated = rollback_frames_resimulated
+
+    def __str__(self):
+        return f"ReplayStats(keyframe_count: {self.keyframe_count}, snapshot_memory_bytes: {self.snapshot_memory_bytes}, last_seek_frames_simulated: {self.last_seek_frames_simulated}, last_seek_time_ms: {self.last_seek_time_ms}, rollback_count: {self.rollback_count}, rollback_frames_resimulated: {self.rollback_frames_resimulated})"
+
+    def __repr__(self):
+        return f"ReplayStats(keyframe_count: {self.keyframe_count}, snapshot_memory_bytes: {self.snapshot_memory_bytes}, last_seek_frames_simulated: {self.last_seek_frames_simulated}, last_seek_time_ms: {self.last_seek_time_ms}, rollback_count: {self.rollback_count}, rollback_frames_resimulated: {self.rollback_frames_resimulated})"
+
+
+class Replay:
+    # Seeks are processed at the start of the next frame, returns False if no replay is being played back
+    @staticmethod
+    def seek(frame: int) -> bool:
+        return crescent_internal.replay_seek(frame)
+
+    @staticmethod
+    def get_frame() -> int:
+        return crescent_internal.replay_get_frame()
+
+    @staticmethod
+    def get_frame_count() -> int:
+        return crescent_internal.replay_get_frame_count()
+
+    @staticmethod
+    def is_playing() -> bool:
+        return crescent_internal.replay_is_playing()
+
+    @staticmethod
+    def get_stats() -> ReplayStats:
+        keyframe_count, snapshot_memory_bytes, last_seek_frames_simulated, last_seek_time_ms, rollback_count, rollback_frames_resimulated = crescent_internal.replay_get_stats()
+        return ReplayStats(keyframe_count, snapshot_memory_bytes, last_seek_frames_simulated, last_seek_time_ms, rollback_count, rollback_frames_resimulated)
+
+    # Rollbacks caused by mispredicting the action during stream playback, for tuning its 'prediction' policy
+    @staticmethod
+    def get_action_rollback_count(name: str) -> int:
+        return crescent_internal.replay_get_action_rollback_count(name)
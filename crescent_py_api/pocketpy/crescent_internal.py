@@ -20,6 +20,22 @@ def node_get_child(parent_entity_id: int, child_entity_name: str) -> Optional["N
     return None
 
 
+def node_get_node(entity_id: int, node_path: str) -> Optional["Node"]:
+    return None
+
+
+def node_add_to_group(entity_id: int, group: str) -> None:
+    pass
+
+
+def node_remove_from_group(entity_id: int, group: str) -> None:
+    pass
+
+
+def node_is_in_group(entity_id: int, group: str) -> bool:
+    return False
+
+
 def node_get_children(entity_id: int) -> List["Node"]:
     return []
 
@@ -36,6 +52,10 @@ def node_is_queued_for_deletion(entity_id: int) -> bool:
     return False
 
 
+def node_release_to_pool(entity_id: int) -> bool:
+    return False
+
+
 def node_set_time_dilation(entity_id: int, dilation: float) -> None:
     pass
 
@@ -48,6 +68,18 @@ def node_get_total_time_dilation(entity_id: int) -> float:
     return 1.0
 
 
+def node_set_process_mode(entity_id: int, mode: int) -> None:
+    pass
+
+
+def node_get_process_mode(entity_id: int) -> int:
+    return 0
+
+
+def node_can_process(entity_id: int) -> bool:
+    return True
+
+
 # --- NODE2D --- #
 
 def node2d_set_position(entity_id: int, x: float, y: float) -> None:
@@ -361,6 +393,28 @@ def particles2d_set_spread(entity_id: int, spread: float) -> None:
     pass
 
 
+# --- VISIBILITY NOTIFIER 2D --- #
+
+def visibility_notifier2d_get_rect(entity_id: int) -> Tuple[float, float, float, float]:
+    return -16.0, -16.0, 32.0, 32.0
+
+
+def visibility_notifier2d_set_rect(entity_id: int, x: float, y: float, w: float, h: float) -> None:
+    pass
+
+
+def visibility_notifier2d_get_suspend_when_off_screen(entity_id: int) -> bool:
+    return False
+
+
+def visibility_notifier2d_set_suspend_when_off_screen(entity_id: int, suspend: bool) -> None:
+    pass
+
+
+def visibility_notifier2d_is_on_screen(entity_id: int) -> bool:
+    return False
+
+
 # --- SHADER INSTANCE --- #
 
 def shader_instance_delete(shader_id: int) -> bool:
@@ -538,9 +592,37 @@ def scene_tree_change_scene(path: str) -> None:
     pass
 
 
+def scene_tree_change_scene_async(path: str) -> bool:
+    return False
+
+
+def scene_tree_get_async_load_progress() -> float:
+    return 1.0
+
+
+def scene_tree_is_async_loading() -> bool:
+    return False
+
+
+def scene_tree_set_async_load_frame_budget(budget_ms: float) -> None:
+    pass
+
+
+def scene_tree_set_paused(paused: bool) -> None:
+    pass
+
+
+def scene_tree_is_paused() -> bool:
+    return False
+
+
 def scene_tree_get_root() -> Optional["Node"]:
     return None
 
+
+def scene_tree_get_nodes_in_group(group: str) -> List["Node"]:
+    return []
+
 # Exposed internal functions that should only be used for testing
 
 
@@ -667,10 +749,30 @@ def packed_scene_create_instance(scene_cache_id: int) -> "Node":
     return None
 
 
+def packed_scene_create_instances(scene_cache_id: int, count: int, positions: List["Vector2"]) -> List["Node"]:
+    return []
+
+
+def packed_scene_acquire(scene_cache_id: int) -> "Node":
+    return None
+
+
+def packed_scene_get_pool_stats(scene_cache_id: int) -> Tuple[int, int, int, int]:
+    return 0, 0, 0, 0
+
+
 def packed_scene_load(path: str) -> int:
     return 0
 
 
+def packed_scene_get_cache_stats() -> Tuple[int, int, int, int, int, int]:
+    return 0, 0, 0, 0, 0, 0
+
+
+def packed_scene_set_cache_memory_budget(memory_budget: int) -> None:
+    pass
+
+
 # --- Collision Handler --- #
 
 def collision_handler_process_collisions(entity_id: float) -> List["Node"]:
@@ -712,3 +814,28 @@ def client_stop() -> None:
 
 def client_send(message: str) -> None:
     pass
+
+# --- Replay --- #
+
+def replay_seek(frame: int) -> bool:
+    return False
+
+
+def replay_get_frame() -> int:
+    return 0
+
+
+def replay_get_frame_count() -> int:
+    return 0
+
+
+def replay_is_playing() -> bool:
+    return False
+
+
+def replay_get_stats() -> Tuple[int, int, int, int, int, int]:
+    return 0, 0, 0, 0, 0, 0
+
+
+def replay_get_action_rollback_count(name: str) -> int:
+    return 0
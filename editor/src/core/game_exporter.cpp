@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 
 #include <seika/file_system.h>
 #include <seika/platform.h>
@@ -38,6 +39,26 @@ namespace
         return std::move(fileName);
     }
 
+    // Compiles every json scene in the build directory with the editor's engine binary, the compiled scenes are written next to them
+    void CompileScenes(const std::filesystem::path& buildPath) {
+        ConsoleLogger* consoleLogger = ConsoleLogger::Get();
+        const std::string engineBinaryPath = EditorContext::Get()->GetEngineBinaryPath();
+        FileSystemHelper::ForEachFile(buildPath, [consoleLogger, &engineBinaryPath, &buildPath](const std::filesystem::directory_entry& entry) {
+            if (entry.path().extension() != ".cscn") {
+                return;
+            }
+            // Scene paths are relative to the project root, so compile from within the build directory
+            const std::string relativeScenePath = std::filesystem::relative(entry.path(), buildPath).generic_string();
+            std::string command = "\"" + engineBinaryPath + "\" -d \"" + buildPath.string() + "\" -compile-scene \"" + relativeScenePath + "\"";
+#ifdef _WIN32
+            command = "\"" + command + "\"";
+#endif
+            if (std::system(command.c_str()) != 0) {
+                consoleLogger->AddEntry("Failed to compile scene '" + relativeScenePath + "', it will be loaded from json");
+            }
+        });
+    }
+
     // MacOS stuff
 
     struct PListInfoData {
@@ -115,19 +136,21 @@ void GameExporter::Export(const GameExporter::ExportProperties& props) {
         consoleLogger->AddEntry(errorMessage);
     }
     FileSystemHelper::CopyFilesRecursively(props.projectPath, tempBuildPath);
-    // 4. Create .pck file from project files
+    // 4. Compile scenes so the runtime doesn't parse json on scene changes
+    CompileScenes(tempBuildPath);
+    // 5. Create .pck file from project files
     const std::string zipName = gameFileName + ".pck";
     FileSystemHelper::ZipDirectory(zipName, tempBuildPath);
-    // 5. Remove all project files (everything except .pck)
+    // 6. Remove all project files (everything except .pck)
     const std::filesystem::path zipPath = std::filesystem::path(tempBuildPath) / zipName;
     FileSystemHelper::DeleteAllInDirectory(tempBuildPath, { zipPath });
-    // 6. Create game binary (runtime) by copying the engine binary into the temp build folder
+    // 7. Create game binary (runtime) by copying the engine binary into the temp build folder
     const std::string runtimeBinaryExtension = platform == Platform::Windows ? ".exe" : "";
     const std::string engineBinaryName = "crescent_engine" + runtimeBinaryExtension;
     const auto engineBinaryPath = binPath / engineBinaryName;
     const auto gameBinaryDest = tempBuildPath / std::filesystem::path(gameFileName + runtimeBinaryExtension);
     FileSystemHelper::CopyFile(engineBinaryPath, gameBinaryDest);
-    // 7. OS specific stuff, Window need dlls and MacOS needs to create the app bundle
+    // 8. OS specific stuff, Window need dlls and MacOS needs to create the app bundle
     switch (platform) {
         case Platform::Undefined:
             // TODO: Error
@@ -158,13 +181,13 @@ void GameExporter::Export(const GameExporter::ExportProperties& props) {
             break;
         }
     }
-    // 8. Now that we have everything either create a zip or tar file and move it to specified archive path.
+    // 9. Now that we have everything either create a zip or tar file and move it to specified archive path.
     const std::filesystem::path exportArchivePath = props.exportArchivePath;
     const std::filesystem::path exportArchiveName = exportArchivePath.filename();
     const std::filesystem::path buildArchivePath = std::filesystem::path(tempBuildPath) / exportArchiveName;
     FileSystemHelper::ZipDirectory(exportArchiveName.string(), tempBuildPath);
     FileSystemHelper::MoveFile(buildArchivePath, exportArchivePath);
-    // 9. And finally we delete our temp build directory
+    // 10. And finally we delete our temp build directory
     FileSystemHelper::DeleteDirectory(tempBuildPath);
 }
 
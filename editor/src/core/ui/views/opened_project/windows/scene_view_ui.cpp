@@ -12,18 +12,14 @@
 #include "../../../../scene/scene_manager.h"
 
 namespace WindowRenderUtils {
-    EntityArray OnGetSelfAndParentEntitiesFunc(SkaEntity entity) {
+    SkaEntity OnGetParentEntityFunc(SkaEntity entity) {
         static auto* sceneManager = SceneManager::Get();
-        EntityArray combineModelResult = { .entityCount = 0 };
-        combineModelResult.entities[combineModelResult.entityCount++] = entity;
         if (auto* node = sceneManager->GetNode(sceneManager->selectedSceneFile, entity)) {
-            auto* parent = node->parent;
-            while (parent != nullptr) {
-                combineModelResult.entities[combineModelResult.entityCount++] = parent->GetUID();
-                parent = parent->parent;
+            if (node->parent != nullptr) {
+                return node->parent->GetUID();
             }
         }
-        return combineModelResult;
+        return SKA_NULL_ENTITY;
     }
 
     SkaTransform2D OnGetLocalTransformFunc(SkaEntity entity, int* zIndex, bool* success) {
@@ -193,7 +189,7 @@ ImGuiHelper::Window OpenedProjectUI::Windows::GetSceneViewWindow() {
                 static bool hasBindedSceneUtilsFuncs = false;
                 if (!hasBindedSceneUtilsFuncs) {
                     cre_scene_utils_override_on_get_local_transform_func(WindowRenderUtils::OnGetLocalTransformFunc);
-                    cre_scene_utils_override_on_get_self_and_parent_entities_func(WindowRenderUtils::OnGetSelfAndParentEntitiesFunc);
+                    cre_scene_utils_override_on_get_parent_entity_func(WindowRenderUtils::OnGetParentEntityFunc);
                     hasBindedSceneUtilsFuncs = true;
                 }
                 // Loop through and render all scene nodes starting from the root
@@ -0,0 +1,641 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include <SDL3/SDL_main.h>
+
+#include <seika/memory.h>
+#include <seika/file_system.h>
+#include <seika/asset/asset_manager.h>
+#include <seika/rendering/texture.h>
+#include <seika/ecs/ecs.h>
+#include <seika/data_structures/hash_map.h>
+
+#include "core/ecs/ecs_globals.h"
+#include "core/ecs/component_pool.h"
+#include "core/ecs/component_view.h"
+#include "core/ecs/components/node_component.h"
+#include "core/ecs/components/sprite_component.h"
+#include "core/ecs/components/transform2d_component.h"
+#include "core/ecs/ecs_manager.h"
+#include "core/json/json_file_loader.h"
+#include "core/game_properties.h"
+#include "core/engine_context.h"
+#include "core/scene/scene_manager.h"
+#include "core/scene/compiled_scene.h"
+#include "core/scene/node_pool.h"
+#include "core/scene/scene_template_cache.h"
+#include "core/snapshot/world_snapshot.h"
+#include "core/snapshot/snapshot_delta.h"
+
+// Timings for the engine's hot paths, most compared against the approach they replaced.  Not part of the unit tests since
+// the numbers depend on the machine, run from the same directory as the test exe so the test resources are found.
+
+#define TEST_SCENE_1_PATH "engine/test/resources/test_scene1.cscn"
+#define TEST_COMPILED_SCENE_1_PATH "engine/test/resources/test_scene1.cscnb"
+#define TEST_BALL_SCENE_PATH "engine/test/resources/ball.cscn"
+
+#define BENCHMARK_MS(START, END) ((f64)((END) - (START)) * 1000.0 / CLOCKS_PER_SEC)
+
+inline static SkaTexture* create_mock_texture() {
+    SkaTexture* texture = SKA_ALLOC_ZEROED(SkaTexture);
+    return texture;
+}
+
+static void benchmark_set_up() {
+    cre_game_props_initialize(cre_game_props_create());
+
+    cre_ecs_manager_initialize_ex(create_mock_texture(), create_mock_texture());
+
+    CREEngineContext* engineContext = cre_engine_context_initialize();
+    engineContext->engineRootDir = ska_fs_get_cwd();
+    engineContext->internalAssetsDir = ska_fs_get_cwd();
+}
+
+static void benchmark_tear_down() {
+    cre_ecs_manager_finalize();
+    cre_game_props_finalize();
+    cre_engine_context_finalize();
+}
+
+#define RUN_BENCHMARK(FUNC) \
+benchmark_set_up(); \
+FUNC(); \
+benchmark_tear_down()
+
+void cre_snapshot_delta_benchmark(void);
+void cre_tree_node_lookup_benchmark(void);
+void cre_scene_tree_benchmark(void);
+void cre_global_transform_benchmark(void);
+void cre_tree_deletion_benchmark(void);
+void cre_scene_load_benchmark(void);
+void cre_instantiate_many_benchmark(void);
+void cre_child_name_lookup_benchmark(void);
+void cre_group_query_benchmark(void);
+void cre_component_pool_benchmark(void);
+void cre_component_view_benchmark(void);
+void cre_entity_stress_benchmark(void);
+void cre_node_pool_benchmark(void);
+
+int32 main(int argv, char** args) {
+    RUN_BENCHMARK(cre_snapshot_delta_benchmark);
+    RUN_BENCHMARK(cre_tree_node_lookup_benchmark);
+    RUN_BENCHMARK(cre_scene_tree_benchmark);
+    RUN_BENCHMARK(cre_global_transform_benchmark);
+    RUN_BENCHMARK(cre_tree_deletion_benchmark);
+    RUN_BENCHMARK(cre_scene_load_benchmark);
+    RUN_BENCHMARK(cre_instantiate_many_benchmark);
+    RUN_BENCHMARK(cre_child_name_lookup_benchmark);
+    RUN_BENCHMARK(cre_group_query_benchmark);
+    RUN_BENCHMARK(cre_component_pool_benchmark);
+    RUN_BENCHMARK(cre_component_view_benchmark);
+    RUN_BENCHMARK(cre_entity_stress_benchmark);
+    RUN_BENCHMARK(cre_node_pool_benchmark);
+    return 0;
+}
+
+static SceneTreeNode* benchmark_create_node(SceneTreeNode* parent, const char* name) {
+    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+    if (parent) {
+        cre_scene_tree_node_add_child(parent, node);
+    }
+    ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, node_component_create_ex(name, NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(node);
+    return node;
+}
+
+static void benchmark_delete_tree(SceneTreeNode* root) {
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+}
+
+//--- Snapshot Delta Benchmark ---//
+#define SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT 1000
+#define SNAPSHOT_DELTA_BENCHMARK_ITERATIONS 100
+
+void cre_snapshot_delta_benchmark(void) {
+    static SkaEntity entities[SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT];
+    cre_scene_manager_initialize();
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT; i++) {
+        entities[i] = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL)->entity;
+        ska_ecs_component_manager_set_component(entities[i], NODE_COMPONENT_INDEX, node_component_create_ex("Node", NodeBaseType_NODE2D));
+        Transform2DComponent* transformComp = transform2d_component_create();
+        transformComp->localTransform.position = (SkaVector2){ .x = (f32)i, .y = (f32)(i * 2) };
+        ska_ecs_component_manager_set_component(entities[i], TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    }
+
+    CreWorldSnapshot* baseSnapshot = cre_world_snapshot_create();
+    CreWorldSnapshot* currentSnapshot = cre_world_snapshot_create();
+    CreWorldSnapshot* decodedSnapshot = cre_world_snapshot_create();
+    CreSnapshotDelta* delta = cre_snapshot_delta_create();
+    cre_world_snapshot_capture(baseSnapshot, 0);
+    // Move 10% of the entities, the rest of the stage is static
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT; i += 10) {
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entities[i], TRANSFORM2D_COMPONENT_INDEX);
+        transformComp->localTransform.position.x += 1.5f;
+    }
+    cre_world_snapshot_capture(currentSnapshot, 1);
+
+    const clock_t encodeStart = clock();
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ITERATIONS; i++) {
+        cre_snapshot_delta_encode(delta, baseSnapshot, currentSnapshot);
+    }
+    const clock_t decodeStart = clock();
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ITERATIONS; i++) {
+        cre_snapshot_delta_decode(delta, baseSnapshot, decodedSnapshot);
+    }
+    const clock_t decodeEnd = clock();
+    uint32 checksum = 0;
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ITERATIONS; i++) {
+        checksum ^= cre_world_snapshot_checksum(decodedSnapshot);
+    }
+    const clock_t checksumEnd = clock();
+    printf("Snapshot delta (%d entities): full = %zu bytes, delta = %zu bytes, encode = %.3f ms, decode = %.3f ms, checksum = %.3f ms (%u)\n",
+           SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT, currentSnapshot->size, delta->size,
+           BENCHMARK_MS(encodeStart, decodeStart) / SNAPSHOT_DELTA_BENCHMARK_ITERATIONS,
+           BENCHMARK_MS(decodeStart, decodeEnd) / SNAPSHOT_DELTA_BENCHMARK_ITERATIONS,
+           BENCHMARK_MS(decodeEnd, checksumEnd) / SNAPSHOT_DELTA_BENCHMARK_ITERATIONS, checksum);
+
+    cre_snapshot_delta_delete(delta);
+    cre_world_snapshot_delete(decodedSnapshot);
+    cre_world_snapshot_delete(currentSnapshot);
+    cre_world_snapshot_delete(baseSnapshot);
+    for (int32 i = 0; i < SNAPSHOT_DELTA_BENCHMARK_ENTITY_COUNT; i++) {
+        ska_ecs_component_manager_remove_all_components(entities[i]);
+        ska_ecs_entity_return(entities[i]);
+    }
+    cre_scene_manager_finalize();
+}
+
+//--- Tree Node Lookup Benchmark ---//
+#define TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT 1000
+#define TREE_NODE_LOOKUP_BENCHMARK_ITERATIONS 1000
+
+void cre_tree_node_lookup_benchmark(void) {
+    static SkaEntity entities[TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT];
+    cre_scene_manager_initialize();
+    // Hash map is what the scene manager used before
+    SkaHashMap* entityToTreeNodeMap = ska_hash_map_create(sizeof(SkaEntity), sizeof(SceneTreeNode**), SKA_HASH_MAP_MIN_CAPACITY);
+    for (int32 i = 0; i < TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT; i++) {
+        entities[i] = ska_ecs_entity_create();
+        SceneTreeNode* treeNode = cre_scene_tree_create_tree_node(entities[i], NULL);
+        cre_scene_manager_queue_node_for_creation(treeNode);
+        ska_hash_map_add(entityToTreeNodeMap, &entities[i], &treeNode);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    size_t checkSum = 0;
+    const clock_t hashMapStart = clock();
+    for (int32 iteration = 0; iteration < TREE_NODE_LOOKUP_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT; i++) {
+            checkSum += (*(SceneTreeNode**)ska_hash_map_get(entityToTreeNodeMap, &entities[i]))->entity;
+        }
+    }
+    const clock_t denseStart = clock();
+    for (int32 iteration = 0; iteration < TREE_NODE_LOOKUP_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT; i++) {
+            checkSum -= cre_scene_manager_get_entity_tree_node(entities[i])->entity;
+        }
+    }
+    const clock_t denseEnd = clock();
+    printf("Tree node lookups (%d x %d): hash map = %.3f ms, dense array = %.3f ms (%zu)\n", TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT,
+           TREE_NODE_LOOKUP_BENCHMARK_ITERATIONS, BENCHMARK_MS(hashMapStart, denseStart), BENCHMARK_MS(denseStart, denseEnd), checkSum);
+
+    for (int32 i = 0; i < TREE_NODE_LOOKUP_BENCHMARK_ENTITY_COUNT; i++) {
+        cre_scene_manager_queue_entity_for_deletion(entities[i]);
+    }
+    cre_scene_manager_process_queued_deletion_entities();
+    ska_hash_map_destroy(entityToTreeNodeMap);
+    cre_scene_manager_finalize();
+}
+
+//--- Scene Tree Benchmark ---//
+#define SCENE_TREE_BENCHMARK_BRANCH_COUNT 100
+#define SCENE_TREE_BENCHMARK_LEAVES_PER_BRANCH 99
+
+static size_t sceneTreeBenchmarkVisitCount = 0;
+
+static void scene_tree_benchmark_visit(SceneTreeNode* treeNode) {
+    sceneTreeBenchmarkVisitCount++;
+}
+
+static void scene_tree_benchmark_free(SceneTreeNode* treeNode) {
+    cre_scene_tree_node_pool_free(treeNode);
+}
+
+void cre_scene_tree_benchmark(void) {
+    SkaEntity nextEntity = 0;
+    const clock_t buildStart = clock();
+    SceneTreeNode* root = cre_scene_tree_node_pool_allocate();
+    root->entity = nextEntity++;
+    for (int32 branchIndex = 0; branchIndex < SCENE_TREE_BENCHMARK_BRANCH_COUNT; branchIndex++) {
+        SceneTreeNode* branch = cre_scene_tree_node_pool_allocate();
+        branch->entity = nextEntity++;
+        cre_scene_tree_node_add_child(root, branch);
+        for (int32 leafIndex = 0; leafIndex < SCENE_TREE_BENCHMARK_LEAVES_PER_BRANCH; leafIndex++) {
+            SceneTreeNode* leaf = cre_scene_tree_node_pool_allocate();
+            leaf->entity = nextEntity++;
+            cre_scene_tree_node_add_child(branch, leaf);
+        }
+    }
+    const clock_t traverseStart = clock();
+    cre_scene_execute_on_all_tree_nodes(root, scene_tree_benchmark_visit);
+    const clock_t traverseEnd = clock();
+    printf("Scene tree (%zu nodes, %zu bytes per node): build = %.3f ms, traverse = %.3f ms\n", sceneTreeBenchmarkVisitCount, sizeof(SceneTreeNode),
+           BENCHMARK_MS(buildStart, traverseStart), BENCHMARK_MS(traverseStart, traverseEnd));
+
+    cre_scene_execute_on_all_tree_nodes(root, scene_tree_benchmark_free);
+    cre_scene_tree_node_pool_finalize();
+}
+
+//--- Global Transform Benchmark ---//
+#define GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT 100
+#define GLOBAL_TRANSFORM_BENCHMARK_CHAIN_DEPTH 64
+#define GLOBAL_TRANSFORM_BENCHMARK_ITERATIONS 100
+
+void cre_global_transform_benchmark(void) {
+    static SceneTreeNode* chainRoots[GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT];
+    cre_scene_manager_initialize();
+    // Deep hierarchy, every frame the roots move and all transforms are recalculated
+    for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT; chainIndex++) {
+        SceneTreeNode* parent = NULL;
+        for (int32 depth = 0; depth < GLOBAL_TRANSFORM_BENCHMARK_CHAIN_DEPTH; depth++) {
+            SceneTreeNode* node = benchmark_create_node(parent, "Node");
+            Transform2DComponent* transformComp = transform2d_component_create();
+            transformComp->localTransform = (SkaTransform2D){ .position = { depth > 0 ? 1.0f : 0.0f, 0.0f }, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f };
+            ska_ecs_component_manager_set_component(node->entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+            if (parent == NULL) {
+                chainRoots[chainIndex] = node;
+            }
+            parent = node;
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    const clock_t updateStart = clock();
+    for (int32 iteration = 0; iteration < GLOBAL_TRANSFORM_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT; chainIndex++) {
+            Transform2DComponent* rootComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(chainRoots[chainIndex]->entity, TRANSFORM2D_COMPONENT_INDEX);
+            rootComp->localTransform.position.y = (f32)iteration;
+            cre_scene_manager_invalidate_global_transform(chainRoots[chainIndex]->entity, rootComp);
+        }
+        cre_scene_manager_update_global_transforms();
+    }
+    const clock_t updateEnd = clock();
+    printf("Global transforms (%d chains, depth %d): %.3f ms per frame\n", GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT, GLOBAL_TRANSFORM_BENCHMARK_CHAIN_DEPTH,
+           BENCHMARK_MS(updateStart, updateEnd) / GLOBAL_TRANSFORM_BENCHMARK_ITERATIONS);
+
+    for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_BENCHMARK_CHAIN_COUNT; chainIndex++) {
+        cre_queue_destroy_tree_node_entity_all(chainRoots[chainIndex]);
+    }
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Tree Deletion Benchmark ---//
+#define TREE_DELETION_BENCHMARK_BRANCH_COUNT 99
+#define TREE_DELETION_BENCHMARK_LEAVES_PER_BRANCH 100
+#define TREE_DELETION_BENCHMARK_NODE_COUNT (1 + TREE_DELETION_BENCHMARK_BRANCH_COUNT * (1 + TREE_DELETION_BENCHMARK_LEAVES_PER_BRANCH))
+
+void cre_tree_deletion_benchmark(void) {
+    static SkaEntity entities[TREE_DELETION_BENCHMARK_NODE_COUNT];
+    size_t entityCount = 0;
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    entities[entityCount++] = root->entity;
+    for (int32 branchIndex = 0; branchIndex < TREE_DELETION_BENCHMARK_BRANCH_COUNT; branchIndex++) {
+        SceneTreeNode* branch = benchmark_create_node(root, "Branch");
+        entities[entityCount++] = branch->entity;
+        for (int32 leafIndex = 0; leafIndex < TREE_DELETION_BENCHMARK_LEAVES_PER_BRANCH; leafIndex++) {
+            entities[entityCount++] = benchmark_create_node(branch, "Leaf")->entity;
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Linear scan dedup is what the deletion queue used before
+    static SkaEntity linearScanQueue[TREE_DELETION_BENCHMARK_NODE_COUNT];
+    size_t linearScanQueueSize = 0;
+    const clock_t linearScanStart = clock();
+    for (size_t i = 0; i < entityCount; i++) {
+        bool isQueued = false;
+        for (size_t j = 0; j < linearScanQueueSize; j++) {
+            if (linearScanQueue[j] == entities[i]) {
+                isQueued = true;
+                break;
+            }
+        }
+        if (!isQueued) {
+            linearScanQueue[linearScanQueueSize++] = entities[i];
+        }
+    }
+    const clock_t queueStart = clock();
+    cre_queue_destroy_tree_node_entity_all(root);
+    const clock_t processStart = clock();
+    cre_scene_manager_process_queued_deletion_entities();
+    const clock_t processEnd = clock();
+    printf("Tree deletion (%zu nodes): linear scan dedup = %.3f ms, queue = %.3f ms, process = %.3f ms\n", entityCount,
+           BENCHMARK_MS(linearScanStart, queueStart), BENCHMARK_MS(queueStart, processStart), BENCHMARK_MS(processStart, processEnd));
+    cre_scene_manager_finalize();
+}
+
+//--- Scene Load Benchmark ---//
+#define SCENE_LOAD_BENCHMARK_ITERATIONS 100
+
+void cre_scene_load_benchmark(void) {
+    if (!cre_compiled_scene_compile_next_to_source(TEST_SCENE_1_PATH)) {
+        printf("Scene load: failed to compile '%s', skipping\n", TEST_SCENE_1_PATH);
+        return;
+    }
+    const clock_t jsonStart = clock();
+    for (int32 i = 0; i < SCENE_LOAD_BENCHMARK_ITERATIONS; i++) {
+        cre_json_delete_json_scene_node(cre_json_load_scene_file(TEST_SCENE_1_PATH));
+    }
+    const clock_t compiledStart = clock();
+    for (int32 i = 0; i < SCENE_LOAD_BENCHMARK_ITERATIONS; i++) {
+        cre_compiled_scene_close(cre_compiled_scene_open(TEST_COMPILED_SCENE_1_PATH));
+    }
+    const clock_t compiledEnd = clock();
+    printf("Scene load (%d iterations): json parse = %.3f ms, compiled map = %.3f ms\n", SCENE_LOAD_BENCHMARK_ITERATIONS,
+           BENCHMARK_MS(jsonStart, compiledStart), BENCHMARK_MS(compiledStart, compiledEnd));
+    remove(TEST_COMPILED_SCENE_1_PATH);
+}
+
+//--- Instantiate Many Benchmark ---//
+#define INSTANTIATE_MANY_BENCHMARK_COUNT 200
+
+void cre_instantiate_many_benchmark(void) {
+    static SkaTransform2D transforms[INSTANTIATE_MANY_BENCHMARK_COUNT];
+    static SceneTreeNode* instanceRootNodes[INSTANTIATE_MANY_BENCHMARK_COUNT];
+    static SceneTreeNode* singleInstanceRootNodes[INSTANTIATE_MANY_BENCHMARK_COUNT];
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    cre_scene_manager_process_queued_creation_entities();
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene_by_path(TEST_BALL_SCENE_PATH);
+    for (int32 i = 0; i < INSTANTIATE_MANY_BENCHMARK_COUNT; i++) {
+        transforms[i] = (SkaTransform2D){ .position = { .x = (f32)i, .y = (f32)(i * 2) }, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f };
+    }
+
+    const clock_t singleStart = clock();
+    for (int32 i = 0; i < INSTANTIATE_MANY_BENCHMARK_COUNT; i++) {
+        singleInstanceRootNodes[i] = cre_scene_manager_stage_scene_nodes_from_template(sceneTemplate);
+    }
+    const clock_t manyStart = clock();
+    cre_scene_manager_instantiate_many(sceneTemplate, INSTANTIATE_MANY_BENCHMARK_COUNT, transforms, instanceRootNodes);
+    const clock_t manyEnd = clock();
+    printf("Scene instancing (%d instances): one at a time = %.3f ms, instantiate many = %.3f ms\n", INSTANTIATE_MANY_BENCHMARK_COUNT,
+           BENCHMARK_MS(singleStart, manyStart), BENCHMARK_MS(manyStart, manyEnd));
+
+    for (int32 i = 0; i < INSTANTIATE_MANY_BENCHMARK_COUNT; i++) {
+        cre_scene_manager_add_node_as_child(root->entity, singleInstanceRootNodes[i]->entity);
+        cre_scene_manager_add_node_as_child(root->entity, instanceRootNodes[i]->entity);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+    benchmark_delete_tree(root);
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
+
+//--- Child Name Lookup Benchmark ---//
+#define CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT 1000
+#define CHILD_NAME_LOOKUP_BENCHMARK_ITERATIONS 100
+
+void cre_child_name_lookup_benchmark(void) {
+    static char childNames[CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT][32];
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    for (int32 i = 0; i < CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT; i++) {
+        snprintf(childNames[i], sizeof(childNames[i]), "Child_%d", i);
+        benchmark_create_node(root, childNames[i]);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Linear scan over children is what the scene manager used before
+    size_t checkSum = 0;
+    const clock_t linearScanStart = clock();
+    for (int32 iteration = 0; iteration < CHILD_NAME_LOOKUP_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT; i++) {
+            for (const SceneTreeNode* childNode = root->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+                const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component(childNode->entity, NODE_COMPONENT_INDEX);
+                if (strcmp(nodeComponent->name, childNames[i]) == 0) {
+                    checkSum += childNode->entity;
+                    break;
+                }
+            }
+        }
+    }
+    const clock_t indexStart = clock();
+    for (int32 iteration = 0; iteration < CHILD_NAME_LOOKUP_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT; i++) {
+            checkSum -= cre_scene_manager_get_entity_child_by_name(root->entity, childNames[i]);
+        }
+    }
+    const clock_t indexEnd = clock();
+    printf("Child name lookups (%d children): linear scan = %.3f ms, name index = %.3f ms (%zu)\n", CHILD_NAME_LOOKUP_BENCHMARK_CHILD_COUNT,
+           BENCHMARK_MS(linearScanStart, indexStart), BENCHMARK_MS(indexStart, indexEnd), checkSum);
+
+    benchmark_delete_tree(root);
+    cre_scene_manager_finalize();
+}
+
+//--- Group Query Benchmark ---//
+#define GROUP_QUERY_BENCHMARK_NODE_COUNT 1000
+#define GROUP_QUERY_BENCHMARK_ITERATIONS 100
+
+static size_t groupQueryBenchmarkTreeWalkCount = 0;
+
+static void group_query_benchmark_count_enemies(SceneTreeNode* treeNode) {
+    if (cre_scene_manager_is_entity_in_group(treeNode->entity, "enemy")) {
+        groupQueryBenchmarkTreeWalkCount++;
+    }
+}
+
+void cre_group_query_benchmark(void) {
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    // Every other node is an enemy
+    for (int32 i = 0; i < GROUP_QUERY_BENCHMARK_NODE_COUNT; i++) {
+        SceneTreeNode* node = benchmark_create_node(root, "Node");
+        if (i % 2 == 0) {
+            cre_scene_manager_add_entity_to_group(node->entity, "enemy");
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Walking the tree is what scripts had to do before
+    const clock_t treeWalkStart = clock();
+    for (int32 iteration = 0; iteration < GROUP_QUERY_BENCHMARK_ITERATIONS; iteration++) {
+        cre_scene_execute_on_all_tree_nodes(root, group_query_benchmark_count_enemies);
+    }
+    const clock_t groupStart = clock();
+    size_t groupQueryCount = 0;
+    for (int32 iteration = 0; iteration < GROUP_QUERY_BENCHMARK_ITERATIONS; iteration++) {
+        size_t groupCount = 0;
+        cre_scene_manager_get_group_entities("enemy", &groupCount);
+        groupQueryCount += groupCount;
+    }
+    const clock_t groupEnd = clock();
+    printf("Group queries (%d nodes): tree walk = %.3f ms, group index = %.3f ms (%zu, %zu)\n", GROUP_QUERY_BENCHMARK_NODE_COUNT,
+           BENCHMARK_MS(treeWalkStart, groupStart), BENCHMARK_MS(groupStart, groupEnd), groupQueryBenchmarkTreeWalkCount, groupQueryCount);
+
+    benchmark_delete_tree(root);
+    cre_scene_manager_finalize();
+}
+
+//--- Component Pool Benchmark ---//
+#define COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT (CRE_COMPONENT_POOL_CHUNK_SIZE * 8)
+#define COMPONENT_POOL_BENCHMARK_ITERATIONS 20
+
+void cre_component_pool_benchmark(void) {
+    static SpriteComponent* sprites[COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT];
+    // Churning components through the pool compared to individual allocations
+    const clock_t heapStart = clock();
+    for (int32 iteration = 0; iteration < COMPONENT_POOL_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT; i++) {
+            sprites[i] = sprite_component_create();
+        }
+        for (int32 i = 0; i < COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT; i++) {
+            sprite_component_delete(sprites[i]);
+        }
+    }
+    const clock_t poolStart = clock();
+    for (int32 iteration = 0; iteration < COMPONENT_POOL_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT; i++) {
+            sprites[i] = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+        }
+        for (int32 i = 0; i < COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT; i++) {
+            cre_component_pool_free(SPRITE_COMPONENT_INDEX, sprites[i]);
+        }
+    }
+    const clock_t poolEnd = clock();
+    printf("Component churn (%d sprites x %d): heap = %.3f ms, pool = %.3f ms\n", COMPONENT_POOL_BENCHMARK_COMPONENT_COUNT,
+           COMPONENT_POOL_BENCHMARK_ITERATIONS, BENCHMARK_MS(heapStart, poolStart), BENCHMARK_MS(poolStart, poolEnd));
+}
+
+//--- Component View Benchmark ---//
+#define COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT 5000
+#define COMPONENT_VIEW_BENCHMARK_ITERATIONS 100
+
+void cre_component_view_benchmark(void) {
+    static SkaEntity spriteEntities[COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT];
+    CreComponentView view;
+    cre_component_view_initialize(&view, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, SPRITE_COMPONENT_INDEX }, 2);
+    for (int32 i = 0; i < COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT; i++) {
+        const SkaEntity entity = ska_ecs_entity_create();
+        ska_ecs_component_manager_set_component(entity, TRANSFORM2D_COMPONENT_INDEX, cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX));
+        ska_ecs_component_manager_set_component(entity, SPRITE_COMPONENT_INDEX, cre_component_pool_create(SPRITE_COMPONENT_INDEX));
+        cre_component_view_add_entity(&view, entity);
+        spriteEntities[i] = entity;
+    }
+
+    // Same reads the sprite render loop does, through the component manager and then through the view
+    f32 lookupSum = 0.0f;
+    const clock_t lookupStart = clock();
+    for (int32 iteration = 0; iteration < COMPONENT_VIEW_BENCHMARK_ITERATIONS; iteration++) {
+        for (int32 i = 0; i < COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT; i++) {
+            const Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(spriteEntities[i], TRANSFORM2D_COMPONENT_INDEX);
+            const SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(spriteEntities[i], SPRITE_COMPONENT_INDEX);
+            lookupSum += transformComp->localTransform.position.x + spriteComponent->drawSource.w;
+        }
+    }
+    const clock_t viewStart = clock();
+    f32 viewSum = 0.0f;
+    for (int32 iteration = 0; iteration < COMPONENT_VIEW_BENCHMARK_ITERATIONS; iteration++) {
+        CRE_COMPONENT_VIEW_FOR(&view, entry) {
+            const Transform2DComponent* transformComp = (Transform2DComponent*)entry->components[0];
+            const SpriteComponent* spriteComponent = (SpriteComponent*)entry->components[1];
+            viewSum += transformComp->localTransform.position.x + spriteComponent->drawSource.w;
+        }
+    }
+    const clock_t viewEnd = clock();
+    printf("Sprite component reads (%d sprites x %d): component manager = %.3f ms, view = %.3f ms (%.1f, %.1f)\n", COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT,
+           COMPONENT_VIEW_BENCHMARK_ITERATIONS, BENCHMARK_MS(lookupStart, viewStart), BENCHMARK_MS(viewStart, viewEnd), (f64)lookupSum, (f64)viewSum);
+
+    cre_component_view_finalize(&view);
+    for (int32 i = 0; i < COMPONENT_VIEW_BENCHMARK_SPRITE_COUNT; i++) {
+        cre_component_pool_release_entity_components(spriteEntities[i]);
+        ska_ecs_component_manager_remove_all_components(spriteEntities[i]);
+        ska_ecs_entity_return(spriteEntities[i]);
+    }
+}
+
+//--- Entity Stress Benchmark ---//
+#define ENTITY_STRESS_BENCHMARK_TOTAL_NODES 100000
+#define ENTITY_STRESS_BENCHMARK_BATCH_SIZE (SKA_MAX_ENTITIES / 2 < 25000 ? SKA_MAX_ENTITIES / 2 : 25000)
+
+void cre_entity_stress_benchmark(void) {
+    static SceneTreeNode* batchNodes[ENTITY_STRESS_BENCHMARK_BATCH_SIZE];
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    cre_scene_manager_process_queued_creation_entities();
+    // Create and destroy nodes in batches until the total is reached, batches stay under the entity limit
+    clock_t createTime = 0;
+    clock_t destroyTime = 0;
+    int32 createdNodeCount = 0;
+    while (createdNodeCount < ENTITY_STRESS_BENCHMARK_TOTAL_NODES) {
+        const clock_t createStart = clock();
+        for (int32 i = 0; i < ENTITY_STRESS_BENCHMARK_BATCH_SIZE; i++) {
+            SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), root);
+            cre_scene_tree_node_add_child(root, node);
+            NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
+            nodeComponent->type = NodeBaseType_NODE2D;
+            ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, nodeComponent);
+            ska_ecs_component_manager_set_component(node->entity, TRANSFORM2D_COMPONENT_INDEX, cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX));
+            cre_scene_manager_queue_node_for_creation(node);
+            batchNodes[i] = node;
+        }
+        cre_scene_manager_process_queued_creation_entities();
+        const clock_t destroyStart = clock();
+        for (int32 i = 0; i < ENTITY_STRESS_BENCHMARK_BATCH_SIZE; i++) {
+            cre_queue_destroy_tree_node_entity_all(batchNodes[i]);
+        }
+        cre_scene_manager_process_queued_deletion_entities();
+        const clock_t destroyEnd = clock();
+        createTime += destroyStart - createStart;
+        destroyTime += destroyEnd - destroyStart;
+        createdNodeCount += ENTITY_STRESS_BENCHMARK_BATCH_SIZE;
+    }
+    printf("Entity stress (%d nodes in batches of %d): create = %.3f ms, destroy = %.3f ms\n", createdNodeCount, ENTITY_STRESS_BENCHMARK_BATCH_SIZE,
+           BENCHMARK_MS(0, createTime), BENCHMARK_MS(0, destroyTime));
+    benchmark_delete_tree(root);
+    cre_scene_manager_finalize();
+}
+
+//--- Node Pool Benchmark ---//
+#define NODE_POOL_BENCHMARK_ITERATIONS 200
+
+void cre_node_pool_benchmark(void) {
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = benchmark_create_node(NULL, "Root");
+    cre_scene_manager_process_queued_creation_entities();
+    const CreSceneCacheId cacheId = cre_scene_template_cache_load_scene(TEST_BALL_SCENE_PATH);
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene(cacheId);
+    SceneTreeNode* ballNode = cre_node_pool_acquire(cacheId);
+    cre_scene_manager_add_node_as_child(root->entity, ballNode->entity);
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Spawning and freeing through the pool compared to creating and deleting instances
+    const clock_t createStart = clock();
+    for (int32 i = 0; i < NODE_POOL_BENCHMARK_ITERATIONS; i++) {
+        SceneTreeNode* instanceNode = cre_scene_manager_stage_scene_nodes_from_template(sceneTemplate);
+        cre_scene_manager_add_node_as_child(root->entity, instanceNode->entity);
+        cre_scene_manager_process_queued_creation_entities();
+        benchmark_delete_tree(instanceNode);
+    }
+    const clock_t poolStart = clock();
+    for (int32 i = 0; i < NODE_POOL_BENCHMARK_ITERATIONS; i++) {
+        cre_node_pool_release(ballNode->entity);
+        cre_node_pool_acquire(cacheId);
+        cre_scene_manager_add_node_as_child(root->entity, ballNode->entity);
+        cre_scene_manager_process_queued_creation_entities();
+    }
+    const clock_t poolEnd = clock();
+    printf("Scene instance spawn and free (%d times): create and delete = %.3f ms, pool = %.3f ms\n", NODE_POOL_BENCHMARK_ITERATIONS,
+           BENCHMARK_MS(createStart, poolStart), BENCHMARK_MS(poolStart, poolEnd));
+
+    benchmark_delete_tree(root);
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
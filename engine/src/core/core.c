@@ -1,5 +1,7 @@
 #include "core.h"
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 #include <string.h>
 
@@ -26,9 +28,15 @@
 #include "world.h"
 #include "utils/command_line_args_util.h"
 #include "ecs/ecs_manager.h"
+#include "ecs/component_versions.h"
+#include "ecs/systems/collision_ec_system.h"
 #include "scene/scene_manager.h"
+#include "scene/compiled_scene.h"
 #include "json/json_file_loader.h"
 #include "math/curve_float_manager.h"
+#include "math/random.h"
+#include "replay/replay.h"
+#include "networking/spectator.h"
 
 // The default project path if no directory override is provided
 #define CRE_PROJECT_CONFIG_FILE_NAME "project.ccfg"
@@ -37,15 +45,18 @@ static bool initialize_ecs();
 static bool load_built_in_assets();
 static bool load_assets_from_configuration();
 static void engine_render();
+static void engine_sync_collision_world();
 static void engine_update(f32 deltaTime);
 static void engine_fixed_update(f32 deltaTime);
+static void engine_replay_step();
+static void engine_replay_restart();
 
 CREGameProperties* gameProperties = NULL;
 CREEngineContext* engineContext = NULL;
 
 bool cre_initialize(int32 argv, char** args) {
     // Set random seed
-    srand((int32)time(NULL));
+    cre_random_seed((uint32)time(NULL));
 
     ska_logger_set_level(SkaLogLevel_ERROR);
 
@@ -71,6 +82,15 @@ bool cre_initialize(int32 argv, char** args) {
         ska_fs_chdir(DEFAULT_START_PROJECT_PATH);
         ska_fs_print_cwd();
     }
+    // Offline scene compilation (used when exporting), only needs the components registered so exits without starting the engine
+    if (strcmp(commandLineFlagResult.compileScenePath, "") != 0) {
+        ska_asset_file_loader_set_read_mode(SkaAssetFileLoaderReadMode_DISK);
+        cre_ecs_manager_initialize_editor();
+        const bool compiled = cre_compiled_scene_compile_next_to_source(commandLineFlagResult.compileScenePath);
+        cre_ecs_manager_finalize_editor();
+        cre_engine_context_finalize();
+        exit(compiled ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
     // Load project archive if it exists
 #ifdef _WIN32
     engineContext->projectArchivePath = ska_str_trim_and_replace(args[0], '.', ".pck");
@@ -145,6 +165,29 @@ bool cre_initialize(int32 argv, char** args) {
         .fixedUpdate = engine_fixed_update
     });
 
+    // Replay
+    cre_replay_initialize(engine_replay_step, engine_replay_restart, CRE_REPLAY_DEFAULT_KEYFRAME_INTERVAL);
+    if (strcmp(commandLineFlagResult.playReplayPath, "") != 0) {
+        if (cre_replay_start_playback(commandLineFlagResult.playReplayPath) && commandLineFlagResult.replaySeekFrame >= 0) {
+            cre_replay_queue_seek((uint32)commandLineFlagResult.replaySeekFrame);
+        }
+    } else if (strcmp(commandLineFlagResult.recordReplayPath, "") != 0) {
+        cre_replay_start_recording(commandLineFlagResult.recordReplayPath);
+    }
+
+    // Spectator
+    if (commandLineFlagResult.spectatorServerPort >= 0) {
+        cre_spectator_server_start(commandLineFlagResult.spectatorServerPort);
+    } else if (strcmp(commandLineFlagResult.spectateAddress, "") != 0) {
+        char spectateHost[256];
+        int32 spectatePort = 0;
+        if (sscanf(commandLineFlagResult.spectateAddress, "%255[^:]:%d", spectateHost, &spectatePort) == 2) {
+            cre_spectator_client_start(spectateHost, spectatePort);
+        } else {
+            ska_logger_error("Invalid spectate address '%s', expected 'host:port'!", commandLineFlagResult.spectateAddress);
+        }
+    }
+
     // Go to initial scene
     cre_scene_manager_queue_scene_change(gameProperties->initialScenePath);
 
@@ -205,15 +248,27 @@ bool load_assets_from_configuration() {
 void cre_update() {
     const uint32_t startFrameTime = ska_get_ticks();
 
+    // Component changes from here on are stamped with the new frame
+    cre_component_versions_advance_frame();
+
     // Process Scene change if exists
     cre_scene_manager_process_queued_scene_change();
 
+    // Create nodes of an asynchronously loading scene within the frame budget, swaps the scene in once done
+    cre_scene_manager_process_async_scene_load();
+
     // Clear out queued nodes for deletion
     cre_scene_manager_process_queued_deletion_entities();
 
     // Create nodes queued for creation a.k.a. '_start()'
     cre_scene_manager_process_queued_creation_entities();
 
+    // Receive spectator stream messages, may queue a seek to catch up
+    cre_spectator_update();
+
+    // Fast-forward or rewind replay if a seek was requested
+    cre_replay_process_queued_seek();
+
     // Main loop
     ska_input_new_frame();
     const bool shouldQuit = ska_sdl_update();
@@ -232,21 +287,65 @@ void cre_update() {
     cre_engine_context_update_stats(endFrameTime - startFrameTime);
 }
 
+// Moved colliders update their spatial hash entries when transform changed events are flushed, resized colliders aren't
+// covered by those so they're refreshed separately.  Done once before each phase that can query collisions.
+void engine_sync_collision_world() {
+    cre_scene_manager_flush_transform_changed_events();
+    cre_collision_ec_system_refresh_changed_colliders();
+}
+
 void engine_update(f32 deltaTime) {
     cre_world_set_frame_delta_time(deltaTime);
+    engine_sync_collision_world();
     ska_ecs_system_event_update_systems(deltaTime);
 }
 
 void engine_fixed_update(f32 deltaTime) {
+    // Spectators hold on the last received frame until more confirmed input arrives
+    if (cre_replay_is_waiting_for_input()) {
+        return;
+    }
+
     static f32 globalTime = 0.0f;
     globalTime += CRE_GLOBAL_PHYSICS_DELTA_TIME;
     ska_renderer_set_global_shader_param_time(globalTime);
 
+    cre_replay_pre_fixed_update();
+    engine_sync_collision_world();
     ska_ecs_system_event_fixed_update_systems(CRE_GLOBAL_PHYSICS_DELTA_TIME);
+    cre_replay_post_fixed_update();
+    cre_spectator_on_fixed_update_end();
     ska_input_new_frame();
 }
 
+// Simulates a single frame without rendering, used by the replay seeker to fast-forward
+void engine_replay_step() {
+    cre_component_versions_advance_frame();
+    cre_scene_manager_process_queued_scene_change();
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_process_queued_creation_entities();
+    ska_ecs_system_event_pre_update_all_systems();
+    engine_update(CRE_GLOBAL_PHYSICS_DELTA_TIME);
+    engine_fixed_update(CRE_GLOBAL_PHYSICS_DELTA_TIME);
+    ska_ecs_system_event_post_update_all_systems();
+    // Same as what 'engine_render' does before gathering render data, the next simulated frame reads these
+    cre_scene_manager_flush_transform_changed_events();
+    cre_scene_manager_update_global_transforms();
+}
+
+// Replays are started before the initial scene is loaded, so going back to their first frame is reloading it
+void engine_replay_restart() {
+    cre_scene_manager_queue_scene_change(gameProperties->initialScenePath);
+    cre_scene_manager_process_queued_scene_change();
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_process_queued_creation_entities();
+}
+
 void engine_render() {
+    // Notify observers (e.g. parallax, camera follow) of everything that moved since the last flush
+    cre_scene_manager_flush_transform_changed_events();
+    // Resolve global transforms once for everything that moved this frame
+    cre_scene_manager_update_global_transforms();
     // Gather render data from ec systems
     ska_ecs_system_event_render_systems();
     // Actually render
@@ -258,6 +357,8 @@ bool cre_is_running() {
 }
 
 int32 cre_shutdown() {
+    cre_spectator_stop();
+    cre_replay_finalize();
     ska_window_finalize();
     ska_input_finalize();
     ska_audio_finalize();
@@ -0,0 +1,192 @@
+#include "component_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+
+#include "component.h"
+
+// Slots are aligned so components keep the alignment they would get from malloc
+#define COMPONENT_POOL_SLOT_ALIGNMENT 16
+// Each slot starts with its slot index, the component follows at the next aligned address
+#define COMPONENT_POOL_SLOT_HEADER_SIZE COMPONENT_POOL_SLOT_ALIGNMENT
+
+typedef struct ComponentPool {
+    uint8** chunks;
+    uint32 chunkCount;
+    uint32 chunkCapacity;
+    uint32* freeSlots; // Stack of slot indices, popped from the end
+    uint32 freeSlotCount;
+    uint32 activeCount;
+    size_t componentSize;
+    size_t slotSize;
+    void* defaultComponent;
+    bool isRegistered;
+} ComponentPool;
+
+static ComponentPool componentPools[CRE_MAX_COMPONENTS] = {0};
+
+static inline ComponentPool* component_pool_get(SkaComponentIndex componentIndex) {
+    SKA_ASSERT_FMT(componentIndex < CRE_MAX_COMPONENTS, "Component index '%u' is out of range!", componentIndex);
+    ComponentPool* pool = &componentPools[componentIndex];
+    SKA_ASSERT_FMT(pool->isRegistered, "No component pool registered for component index '%u'!", componentIndex);
+    return pool;
+}
+
+static void component_pool_add_chunk(ComponentPool* pool) {
+    if (pool->chunkCount >= pool->chunkCapacity) {
+        pool->chunkCapacity = pool->chunkCapacity > 0 ? pool->chunkCapacity * 2 : 8;
+        pool->chunks = (uint8**)realloc(pool->chunks, sizeof(uint8*) * pool->chunkCapacity);
+        SKA_ASSERT(pool->chunks);
+        // Every slot can be free at once
+        pool->freeSlots = (uint32*)realloc(pool->freeSlots, sizeof(uint32) * pool->chunkCapacity * CRE_COMPONENT_POOL_CHUNK_SIZE);
+        SKA_ASSERT(pool->freeSlots);
+    }
+    uint8* chunk = (uint8*)malloc(pool->slotSize * CRE_COMPONENT_POOL_CHUNK_SIZE);
+    SKA_ASSERT_FMT(chunk, "Failed to allocate component pool chunk!");
+    const uint32 firstSlot = pool->chunkCount * CRE_COMPONENT_POOL_CHUNK_SIZE;
+    pool->chunks[pool->chunkCount++] = chunk;
+    for (uint32 i = 0; i < CRE_COMPONENT_POOL_CHUNK_SIZE; i++) {
+        const uint32 slot = firstSlot + i;
+        memcpy(chunk + (size_t)i * pool->slotSize, &slot, sizeof(uint32));
+    }
+    // Push in reverse so slots are handed out in memory order
+    for (uint32 i = CRE_COMPONENT_POOL_CHUNK_SIZE; i > 0; i--) {
+        pool->freeSlots[pool->freeSlotCount++] = firstSlot + i - 1;
+    }
+}
+
+static inline void* component_pool_get_slot_address(const ComponentPool* pool, uint32 slot) {
+    return pool->chunks[slot / CRE_COMPONENT_POOL_CHUNK_SIZE] + (size_t)(slot % CRE_COMPONENT_POOL_CHUNK_SIZE) * pool->slotSize + COMPONENT_POOL_SLOT_HEADER_SIZE;
+}
+
+// Reads the slot index stored in front of the component.  Components that weren't pooled come from malloc, so the header
+// bytes belong to the allocator and can hold anything, the slot only counts if it maps back to the same address.
+static uint32 component_pool_find_slot(const ComponentPool* pool, const void* component) {
+    if (pool->chunkCount == 0) {
+        return CRE_COMPONENT_POOL_INVALID_SLOT;
+    }
+    uint32 slot = CRE_COMPONENT_POOL_INVALID_SLOT;
+    memcpy(&slot, (const uint8*)component - COMPONENT_POOL_SLOT_HEADER_SIZE, sizeof(uint32));
+    if (slot >= pool->chunkCount * CRE_COMPONENT_POOL_CHUNK_SIZE || component_pool_get_slot_address(pool, slot) != component) {
+        return CRE_COMPONENT_POOL_INVALID_SLOT;
+    }
+    return slot;
+}
+
+static void* component_pool_allocate(ComponentPool* pool) {
+    if (pool->freeSlotCount == 0) {
+        component_pool_add_chunk(pool);
+    }
+    const uint32 slot = pool->freeSlots[--pool->freeSlotCount];
+    pool->activeCount++;
+    return component_pool_get_slot_address(pool, slot);
+}
+
+void cre_component_pool_register(SkaComponentIndex componentIndex, size_t componentSize, const void* defaultComponent) {
+    SKA_ASSERT_FMT(componentIndex < CRE_MAX_COMPONENTS, "Component index '%u' is out of range!", componentIndex);
+    ComponentPool* pool = &componentPools[componentIndex];
+    SKA_ASSERT_FMT(!pool->isRegistered, "Component pool already registered for component index '%u'!", componentIndex);
+    pool->componentSize = componentSize;
+    pool->slotSize = COMPONENT_POOL_SLOT_HEADER_SIZE + ((componentSize + COMPONENT_POOL_SLOT_ALIGNMENT - 1) & ~(size_t)(COMPONENT_POOL_SLOT_ALIGNMENT - 1));
+    pool->defaultComponent = calloc(1, componentSize);
+    SKA_ASSERT(pool->defaultComponent);
+    if (defaultComponent != NULL) {
+        memcpy(pool->defaultComponent, defaultComponent, componentSize);
+    }
+    pool->isRegistered = true;
+}
+
+void cre_component_pool_finalize() {
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        ComponentPool* pool = &componentPools[i];
+        for (uint32 chunkIndex = 0; chunkIndex < pool->chunkCount; chunkIndex++) {
+            free(pool->chunks[chunkIndex]);
+        }
+        free(pool->chunks);
+        free(pool->freeSlots);
+        free(pool->defaultComponent);
+        *pool = (ComponentPool){0};
+    }
+}
+
+bool cre_component_pool_is_registered(SkaComponentIndex componentIndex) {
+    return componentIndex < CRE_MAX_COMPONENTS && componentPools[componentIndex].isRegistered;
+}
+
+size_t cre_component_pool_get_component_size(SkaComponentIndex componentIndex) {
+    return component_pool_get(componentIndex)->componentSize;
+}
+
+void* cre_component_pool_create(SkaComponentIndex componentIndex) {
+    ComponentPool* pool = component_pool_get(componentIndex);
+    void* component = component_pool_allocate(pool);
+    memcpy(component, pool->defaultComponent, pool->componentSize);
+    return component;
+}
+
+void* cre_component_pool_copy(SkaComponentIndex componentIndex, const void* component) {
+    ComponentPool* pool = component_pool_get(componentIndex);
+    void* copiedComponent = component_pool_allocate(pool);
+    memcpy(copiedComponent, component, pool->componentSize);
+    return copiedComponent;
+}
+
+void cre_component_pool_free(SkaComponentIndex componentIndex, void* component) {
+    ComponentPool* pool = component_pool_get(componentIndex);
+    const uint32 slot = component_pool_find_slot(pool, component);
+    SKA_ASSERT_FMT(slot != CRE_COMPONENT_POOL_INVALID_SLOT, "Component for index '%u' wasn't allocated from its pool!", componentIndex);
+    SKA_ASSERT(pool->activeCount > 0);
+    pool->freeSlots[pool->freeSlotCount++] = slot;
+    pool->activeCount--;
+}
+
+bool cre_component_pool_owns(SkaComponentIndex componentIndex, const void* component) {
+    return cre_component_pool_get_slot(componentIndex, component) != CRE_COMPONENT_POOL_INVALID_SLOT;
+}
+
+uint32 cre_component_pool_get_slot(SkaComponentIndex componentIndex, const void* component) {
+    if (component == NULL || !cre_component_pool_is_registered(componentIndex)) {
+        return CRE_COMPONENT_POOL_INVALID_SLOT;
+    }
+    return component_pool_find_slot(&componentPools[componentIndex], component);
+}
+
+void* cre_component_pool_get_component_from_slot(SkaComponentIndex componentIndex, uint32 slot) {
+    const ComponentPool* pool = component_pool_get(componentIndex);
+    SKA_ASSERT_FMT(slot < pool->chunkCount * CRE_COMPONENT_POOL_CHUNK_SIZE, "Slot '%u' is out of range for component index '%u'!", slot, componentIndex);
+    return component_pool_get_slot_address(pool, slot);
+}
+
+void cre_component_pool_release_entity_components(SkaEntity entity) {
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        ComponentPool* pool = &componentPools[i];
+        if (!pool->isRegistered || pool->activeCount == 0) {
+            continue;
+        }
+        void* component = ska_ecs_component_manager_get_component_unchecked(entity, i);
+        if (component != NULL && component_pool_find_slot(pool, component) != CRE_COMPONENT_POOL_INVALID_SLOT) {
+            cre_component_pool_free(i, component);
+            // Clear the pointer so the component manager doesn't free pool memory
+            ska_ecs_component_manager_set_component(entity, i, NULL);
+        }
+    }
+}
+
+uint32 cre_component_pool_get_total_active_count() {
+    uint32 activeCount = 0;
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        activeCount += componentPools[i].activeCount;
+    }
+    return activeCount;
+}
+
+CreComponentPoolStats cre_component_pool_get_stats(SkaComponentIndex componentIndex) {
+    const ComponentPool* pool = component_pool_get(componentIndex);
+    return (CreComponentPoolStats){
+        .activeCount = pool->activeCount,
+        .capacity = pool->chunkCount * CRE_COMPONENT_POOL_CHUNK_SIZE,
+        .chunkCount = pool->chunkCount
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <seika/ecs/entity.h>
+#include <seika/ecs/component.h>
+
+// Typed pools for component memory.  Each registered component type gets contiguous chunks of fixed size slots and a free
+// list, so creating and destroying nodes doesn't hit the allocator for every component.  A component keeps the same slot
+// index until it's freed.  Seika's component manager frees the pointers it holds, so an entity's pooled components must be
+// released (see 'cre_component_pool_release_entity_components') before its components are removed.
+
+#define CRE_COMPONENT_POOL_CHUNK_SIZE 256
+#define CRE_COMPONENT_POOL_INVALID_SLOT ((uint32)-1)
+
+typedef struct CreComponentPoolStats {
+    uint32 activeCount;
+    uint32 capacity;
+    uint32 chunkCount;
+} CreComponentPoolStats;
+
+// 'defaultComponent' is copied into every component created from the pool, zeroed if NULL
+void cre_component_pool_register(SkaComponentIndex componentIndex, size_t componentSize, const void* defaultComponent);
+// Frees all chunks and unregisters every pool, components allocated from a pool are invalid afterwards
+void cre_component_pool_finalize();
+bool cre_component_pool_is_registered(SkaComponentIndex componentIndex);
+size_t cre_component_pool_get_component_size(SkaComponentIndex componentIndex);
+// Returns a component initialized with the pool's default component
+void* cre_component_pool_create(SkaComponentIndex componentIndex);
+// Returns a pooled shallow copy of 'component'
+void* cre_component_pool_copy(SkaComponentIndex componentIndex, const void* component);
+void cre_component_pool_free(SkaComponentIndex componentIndex, void* component);
+bool cre_component_pool_owns(SkaComponentIndex componentIndex, const void* component);
+// Returns 'CRE_COMPONENT_POOL_INVALID_SLOT' if the component wasn't allocated from the pool
+uint32 cre_component_pool_get_slot(SkaComponentIndex componentIndex, const void* component);
+void* cre_component_pool_get_component_from_slot(SkaComponentIndex componentIndex, uint32 slot);
+// Returns pooled components owned by the entity to their pools and clears them from the component manager, components
+// that weren't pooled are left for the component manager to free
+void cre_component_pool_release_entity_components(SkaEntity entity);
+CreComponentPoolStats cre_component_pool_get_stats(SkaComponentIndex componentIndex);
+// Components still allocated across every pool
+uint32 cre_component_pool_get_total_active_count();
+
+#ifdef __cplusplus
+}
+#endif
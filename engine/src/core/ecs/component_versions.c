@@ -0,0 +1,67 @@
+#include "component_versions.h"
+
+#include <seika/assert.h>
+
+#include "component.h"
+#include "../utils/entity_paged_array.h"
+
+static CreEntityPagedArray componentVersions[CRE_MAX_COMPONENTS];
+static uint32 componentTypeVersions[CRE_MAX_COMPONENTS];
+// Starts at 1 so components that were never marked (frame 0) aren't reported as changed
+static uint32 currentFrame = 1;
+
+void cre_component_versions_initialize() {
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        cre_entity_paged_array_initialize(&componentVersions[i], sizeof(CreComponentVersion), NULL);
+        componentTypeVersions[i] = 0;
+    }
+    currentFrame = 1;
+}
+
+void cre_component_versions_finalize() {
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        cre_entity_paged_array_finalize(&componentVersions[i]);
+    }
+}
+
+void cre_component_versions_advance_frame() {
+    currentFrame++;
+}
+
+uint32 cre_component_versions_get_frame() {
+    return currentFrame;
+}
+
+void cre_component_versions_mark_changed(SkaEntity entity, SkaComponentIndex componentIndex) {
+    SKA_ASSERT_FMT(componentIndex < CRE_MAX_COMPONENTS, "Invalid component index '%u'!", componentIndex);
+    CreComponentVersion* version = (CreComponentVersion*)cre_entity_paged_array_get_or_create(&componentVersions[componentIndex], entity);
+    version->version++;
+    version->changedFrame = currentFrame;
+    componentTypeVersions[componentIndex]++;
+}
+
+void cre_component_versions_mark_all_changed(SkaEntity entity) {
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        // Nothing to invalidate if the component type was never marked for the entity
+        CreComponentVersion* version = (CreComponentVersion*)cre_entity_paged_array_get(&componentVersions[i], entity);
+        if (version != NULL && version->version > 0) {
+            version->version++;
+            version->changedFrame = currentFrame;
+            componentTypeVersions[i]++;
+        }
+    }
+}
+
+CreComponentVersion cre_component_versions_get(SkaEntity entity, SkaComponentIndex componentIndex) {
+    const CreComponentVersion* version = (CreComponentVersion*)cre_entity_paged_array_get(&componentVersions[componentIndex], entity);
+    return version != NULL ? *version : (CreComponentVersion){0};
+}
+
+bool cre_component_versions_has_changed_since(SkaEntity entity, SkaComponentIndex componentIndex, uint32 frame) {
+    const CreComponentVersion* version = (CreComponentVersion*)cre_entity_paged_array_get(&componentVersions[componentIndex], entity);
+    return version != NULL && version->version > 0 && version->changedFrame >= frame;
+}
+
+uint32 cre_component_versions_get_type_version(SkaComponentIndex componentIndex) {
+    return componentTypeVersions[componentIndex];
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/ecs/entity.h>
+#include <seika/ecs/component.h>
+
+// Change tracking for components.  Every mutating setter (native and scripting api) marks the component it wrote, which
+// bumps the component's version and stamps it with the current frame.  Each component type also has a version that's
+// bumped with any of its components, so systems can skip a whole pass when nothing of that type changed since they last
+// looked.  Versions only ever go up, an entity's versions are bumped again when it's deleted so cached values from a
+// previous entity with the same id never match.
+
+typedef struct CreComponentVersion {
+    uint32 version; // 0 until the component is first marked
+    uint32 changedFrame;
+} CreComponentVersion;
+
+void cre_component_versions_initialize();
+void cre_component_versions_finalize();
+// Called once at the start of every frame
+void cre_component_versions_advance_frame();
+uint32 cre_component_versions_get_frame();
+void cre_component_versions_mark_changed(SkaEntity entity, SkaComponentIndex componentIndex);
+// Marks every component type of the entity, used when an entity is deleted or its components are reset as a whole
+void cre_component_versions_mark_all_changed(SkaEntity entity);
+CreComponentVersion cre_component_versions_get(SkaEntity entity, SkaComponentIndex componentIndex);
+// True if the component was marked during 'frame' or later.  Systems should pass the frame they last ran in, a change
+// made later in that same frame is then reported on the next run instead of being missed.
+bool cre_component_versions_has_changed_since(SkaEntity entity, SkaComponentIndex componentIndex, uint32 frame);
+uint32 cre_component_versions_get_type_version(SkaComponentIndex componentIndex);
+
+#ifdef __cplusplus
+}
+#endif
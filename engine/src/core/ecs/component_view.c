@@ -0,0 +1,94 @@
+#include "component_view.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+
+void cre_component_view_initialize(CreComponentView* view, const SkaComponentIndex* componentIndices, uint32 componentCount) {
+    SKA_ASSERT_FMT(componentCount <= CRE_COMPONENT_VIEW_MAX_COMPONENTS, "Component view can't hold '%u' components!", componentCount);
+    *view = (CreComponentView){0};
+    memcpy(view->componentIndices, componentIndices, sizeof(SkaComponentIndex) * componentCount);
+    view->componentCount = componentCount;
+    const uint32 invalidEntry = CRE_COMPONENT_VIEW_INVALID_ENTRY;
+    cre_entity_paged_array_initialize(&view->entityEntryIndices, sizeof(uint32), &invalidEntry);
+}
+
+static inline uint32 component_view_get_entry_index(const CreComponentView* view, SkaEntity entity) {
+    const uint32* entryIndex = (uint32*)cre_entity_paged_array_get(&view->entityEntryIndices, entity);
+    return entryIndex != NULL ? *entryIndex : CRE_COMPONENT_VIEW_INVALID_ENTRY;
+}
+
+void cre_component_view_finalize(CreComponentView* view) {
+    free(view->entries);
+    cre_entity_paged_array_finalize(&view->entityEntryIndices);
+    *view = (CreComponentView){0};
+}
+
+void cre_component_view_add_entity(CreComponentView* view, SkaEntity entity) {
+    uint32* entryIndex = (uint32*)cre_entity_paged_array_get_or_create(&view->entityEntryIndices, entity);
+    if (*entryIndex == CRE_COMPONENT_VIEW_INVALID_ENTRY) {
+        if (view->entryCount >= view->entryCapacity) {
+            view->entryCapacity = view->entryCapacity > 0 ? view->entryCapacity * 2 : 64;
+            view->entries = (CreComponentViewEntry*)realloc(view->entries, sizeof(CreComponentViewEntry) * view->entryCapacity);
+            SKA_ASSERT(view->entries);
+        }
+        *entryIndex = view->entryCount++;
+    }
+    CreComponentViewEntry* entry = &view->entries[*entryIndex];
+    entry->entity = entity;
+    for (uint32 i = 0; i < view->componentCount; i++) {
+        entry->components[i] = ska_ecs_component_manager_get_component(entity, view->componentIndices[i]);
+    }
+}
+
+void cre_component_view_remove_entity(CreComponentView* view, SkaEntity entity) {
+    const uint32 entryIndex = component_view_get_entry_index(view, entity);
+    if (entryIndex == CRE_COMPONENT_VIEW_INVALID_ENTRY) {
+        return;
+    }
+    if (entryIndex == view->entryCount - 1) {
+        view->entryCount--;
+    } else {
+        view->entries[entryIndex].entity = SKA_NULL_ENTITY;
+        view->tombstoneCount++;
+    }
+    cre_entity_paged_array_release(&view->entityEntryIndices, entity);
+}
+
+CreComponentViewEntry* cre_component_view_compact(CreComponentView* view) {
+    if (view->tombstoneCount == 0) {
+        return view->entries;
+    }
+    uint32 writeIndex = 0;
+    for (uint32 readIndex = 0; readIndex < view->entryCount; readIndex++) {
+        const SkaEntity entity = view->entries[readIndex].entity;
+        if (entity == SKA_NULL_ENTITY) {
+            continue;
+        }
+        if (writeIndex != readIndex) {
+            view->entries[writeIndex] = view->entries[readIndex];
+            *(uint32*)cre_entity_paged_array_get(&view->entityEntryIndices, entity) = writeIndex;
+        }
+        writeIndex++;
+    }
+    view->entryCount = writeIndex;
+    view->tombstoneCount = 0;
+    return view->entries;
+}
+
+bool cre_component_view_has_entity(const CreComponentView* view, SkaEntity entity) {
+    return component_view_get_entry_index(view, entity) != CRE_COMPONENT_VIEW_INVALID_ENTRY;
+}
+
+uint32 cre_component_view_get_entity_count(const CreComponentView* view) {
+    return view->entryCount - view->tombstoneCount;
+}
+
+CreComponentViewEntry* cre_component_view_get_entry(const CreComponentView* view, SkaEntity entity) {
+    const uint32 entryIndex = component_view_get_entry_index(view, entity);
+    if (entryIndex == CRE_COMPONENT_VIEW_INVALID_ENTRY) {
+        return NULL;
+    }
+    return &view->entries[entryIndex];
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/ecs/entity.h>
+#include <seika/ecs/component.h>
+
+#include "../utils/entity_paged_array.h"
+
+// Packed per system array of an entity's component pointers, filled in when the entity is registered to the system and
+// removed when it's unregistered (which is also when its signature changes).  Update and render loops iterate the entries
+// instead of looking up every component through the component manager per entity.  Entries keep the order entities were
+// registered in so draw order for the same z index doesn't change.  Removing an entity leaves a tombstone (a null entity)
+// that's compacted away the next time the view is iterated, so a frame's worth of removals costs one pass.
+
+#define CRE_COMPONENT_VIEW_MAX_COMPONENTS 3
+#define CRE_COMPONENT_VIEW_INVALID_ENTRY ((uint32)-1)
+
+typedef struct CreComponentViewEntry {
+    SkaEntity entity;
+    void* components[CRE_COMPONENT_VIEW_MAX_COMPONENTS]; // Same order as the view's component indices
+} CreComponentViewEntry;
+
+typedef struct CreComponentView {
+    SkaComponentIndex componentIndices[CRE_COMPONENT_VIEW_MAX_COMPONENTS];
+    uint32 componentCount;
+    CreComponentViewEntry* entries;
+    uint32 entryCount; // Includes tombstones
+    uint32 entryCapacity;
+    uint32 tombstoneCount;
+    CreEntityPagedArray entityEntryIndices; // Entity to entry index, 'CRE_COMPONENT_VIEW_INVALID_ENTRY' if not in the view
+} CreComponentView;
+
+// Entities removed while iterating are skipped
+#define CRE_COMPONENT_VIEW_FOR(VIEW, ENTRY) \
+for (CreComponentViewEntry* ENTRY = cre_component_view_compact(VIEW); ENTRY < (VIEW)->entries + (VIEW)->entryCount; ENTRY++) \
+if (ENTRY->entity == SKA_NULL_ENTITY) {} else
+
+void cre_component_view_initialize(CreComponentView* view, const SkaComponentIndex* componentIndices, uint32 componentCount);
+void cre_component_view_finalize(CreComponentView* view);
+// Reads the entity's component pointers, entities already in the view are refreshed in place
+void cre_component_view_add_entity(CreComponentView* view, SkaEntity entity);
+void cre_component_view_remove_entity(CreComponentView* view, SkaEntity entity);
+bool cre_component_view_has_entity(const CreComponentView* view, SkaEntity entity);
+uint32 cre_component_view_get_entity_count(const CreComponentView* view);
+// Removes tombstones while keeping registration order, returns the first entry
+CreComponentViewEntry* cre_component_view_compact(CreComponentView* view);
+// Returns NULL if the entity isn't in the view
+CreComponentViewEntry* cre_component_view_get_entry(const CreComponentView* view, SkaEntity entity);
+
+#ifdef __cplusplus
+}
+#endif
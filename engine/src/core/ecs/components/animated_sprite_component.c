@@ -9,6 +9,8 @@
 #include <seika/assert.h>
 #include <seika/time.h>
 
+#include "../../math/random.h"
+
 #define RBE_MAX_ANIMATIONS 16
 
 AnimatedSpriteComponent* animated_sprite_component_create() {
@@ -88,9 +90,7 @@ bool animated_sprite_component_play_animation(AnimatedSpriteComponent *animatedS
 
 void animated_sprite_component_refresh_random_stagger_animation_time(AnimatedSpriteComponent* animatedSpriteComponent) {
     if (animatedSpriteComponent->staggerStartAnimationTimes) {
-        uint32_t random_value = (rand() & 0xFFFF) << 16; // Generate random upper 16 bits
-        random_value |= (rand() & 0xFFFF);
-        animatedSpriteComponent->randomStaggerTime = random_value;
+        animatedSpriteComponent->randomStaggerTime = cre_random_next();
     } else {
         animatedSpriteComponent->randomStaggerTime = 0;
     }
@@ -109,6 +109,11 @@ void animated_sprite_component_data_delete(AnimatedSpriteComponentData* animated
 
 AnimatedSpriteComponent* animated_sprite_component_data_copy_to_animated_sprite(const AnimatedSpriteComponentData* animatedSpriteComponentData) {
     AnimatedSpriteComponent* copiedNode = SKA_ALLOC_ZEROED(AnimatedSpriteComponent);
+    animated_sprite_component_data_copy_into_animated_sprite(animatedSpriteComponentData, copiedNode);
+    return copiedNode;
+}
+
+void animated_sprite_component_data_copy_into_animated_sprite(const AnimatedSpriteComponentData* animatedSpriteComponentData, AnimatedSpriteComponent* copiedNode) {
     copiedNode->animationCount = animatedSpriteComponentData->animationCount;
     copiedNode->modulate = animatedSpriteComponentData->modulate;
     copiedNode->origin = animatedSpriteComponentData->origin;
@@ -137,8 +142,6 @@ AnimatedSpriteComponent* animated_sprite_component_data_copy_to_animated_sprite(
             copiedNode->currentAnimation = animation;
         }
     }
-
-    return copiedNode;
 }
 
 void animated_sprite_component_data_add_animation(AnimatedSpriteComponentData* animatedSpriteComponent, AnimationData animation) {
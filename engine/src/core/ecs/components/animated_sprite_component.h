@@ -91,6 +91,8 @@ void animated_sprite_component_refresh_random_stagger_animation_time(AnimatedSpr
 AnimatedSpriteComponentData* animated_sprite_component_data_create();
 void animated_sprite_component_data_delete(AnimatedSpriteComponentData* animatedSpriteComponent);
 AnimatedSpriteComponent* animated_sprite_component_data_copy_to_animated_sprite(const AnimatedSpriteComponentData* animatedSpriteComponent);
+// Same as above but writes into an already allocated component (e.g. from a component pool)
+void animated_sprite_component_data_copy_into_animated_sprite(const AnimatedSpriteComponentData* animatedSpriteComponentData, AnimatedSpriteComponent* animatedSpriteComponent);
 void animated_sprite_component_data_add_animation(AnimatedSpriteComponentData* animatedSpriteComponent, AnimationData animation);
 
 #ifdef __cplusplus
@@ -33,3 +33,6 @@
 #define DEFAULT_COMPONENT_PARTICLES2D_LIFE_TIME 4.0f
 #define DEFAULT_COMPONENT_PARTICLES2D_DAMPING 1.0f
 #define DEFAULT_COMPONENT_PARTICLES2D_EXPLOSIVENESS 0.0f
+
+#define DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_RECT (SkaRect2){ .x = -16.0f, .y = -16.0f, .w = 32.0f, .h = 32.0f }
+#define DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_SUSPEND_WHEN_OFF_SCREEN false
@@ -51,6 +51,8 @@ NodeBaseType node_get_base_type(const char* baseName) {
         return NodeBaseType_PARTICLES2D;
     } else if (strcmp(baseName, CRE_NODE_TILEMAP_STRING) == 0) {
         return NodeBaseType_TILEMAP;
+    } else if (strcmp(baseName, CRE_NODE_VISIBILITY_NOTIFIER2D_STRING) == 0) {
+        return NodeBaseType_VISIBILITY_NOTIFIER2D;
     }
     return NodeBaseType_INVALID;
 }
@@ -67,6 +69,7 @@ NodeBaseInheritanceType node_get_type_inheritance(NodeBaseType type) {
     case NodeBaseType_PARALLAX: return NodeBaseInheritanceType_PARALLAX;
     case NodeBaseType_PARTICLES2D: return NodeBaseInheritanceType_PARTICLES2D;
     case NodeBaseType_TILEMAP: return NodeBaseInheritanceType_TILEMAP;
+    case NodeBaseType_VISIBILITY_NOTIFIER2D: return NodeBaseInheritanceType_VISIBILITY_NOTIFIER2D;
     default: return NodeBaseInheritanceType_INVALID;
     }
 }
@@ -83,6 +86,7 @@ const char* node_get_base_type_string(NodeBaseType type) {
     case NodeBaseType_PARALLAX: return CRE_NODE_PARALLAX_STRING;
     case NodeBaseType_PARTICLES2D: return CRE_NODE_PARTICLES2D_STRING;
     case NodeBaseType_TILEMAP: return CRE_NODE_TILEMAP_STRING;
+    case NodeBaseType_VISIBILITY_NOTIFIER2D: return CRE_NODE_VISIBILITY_NOTIFIER2D_STRING;
     default: SKA_ASSERT_FMT(false, "Invalid node base type '%d'", type);
     }
     return NULL;
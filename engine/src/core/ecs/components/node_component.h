@@ -19,6 +19,7 @@ extern "C" {
 #define CRE_NODE_PARALLAX_STRING "Parallax"
 #define CRE_NODE_PARTICLES2D_STRING "Particles2D"
 #define CRE_NODE_TILEMAP_STRING "Tilemap"
+#define CRE_NODE_VISIBILITY_NOTIFIER2D_STRING "VisibilityNotifier2D"
 
 typedef enum NodeBaseType {
     NodeBaseType_INVALID = -1,
@@ -32,6 +33,7 @@ typedef enum NodeBaseType {
     NodeBaseType_PARALLAX = 1 << 7,
     NodeBaseType_PARTICLES2D = 1 << 8,
     NodeBaseType_TILEMAP = 1 << 9,
+    NodeBaseType_VISIBILITY_NOTIFIER2D = 1 << 10,
 } NodeBaseType;
 
 typedef enum NodeBaseInheritanceType {
@@ -46,6 +48,7 @@ typedef enum NodeBaseInheritanceType {
     NodeBaseInheritanceType_PARALLAX = NodeBaseInheritanceType_NODE2D | NodeBaseType_PARALLAX,
     NodeBaseInheritanceType_PARTICLES2D = NodeBaseInheritanceType_NODE2D | NodeBaseType_PARTICLES2D,
     NodeBaseInheritanceType_TILEMAP = NodeBaseInheritanceType_NODE2D | NodeBaseType_TILEMAP,
+    NodeBaseInheritanceType_VISIBILITY_NOTIFIER2D = NodeBaseInheritanceType_NODE2D | NodeBaseType_VISIBILITY_NOTIFIER2D,
 } NodeBaseInheritanceType;
 
 typedef struct NodeTimeDilation {
@@ -54,12 +57,21 @@ typedef struct NodeTimeDilation {
     bool cacheInvalid;
 } NodeTimeDilation;
 
+// Whether a node runs its update work (scripts '_process' and '_fixed_process', animations, particles), nodes always render
+typedef enum NodeProcessMode {
+    NodeProcessMode_INHERIT = 0, // Uses the parent's mode, roots are pausable
+    NodeProcessMode_PAUSABLE = 1, // Stops while the scene tree is paused
+    NodeProcessMode_ALWAYS = 2, // Keeps running while the scene tree is paused (e.g. pause menus)
+    NodeProcessMode_DISABLED = 3, // Never runs, scripts are removed from the update lists until the node is enabled again
+} NodeProcessMode;
+
 // AKA Scene Component
 typedef struct NodeComponent {
     char name[32];
     NodeBaseType type;
     bool queuedForDeletion;
     NodeTimeDilation timeDilation;
+    NodeProcessMode processMode;
     // Called after '_start' is called on an entity
     SkaEvent onSceneTreeEnter; // { data = entity (unsigned int), type = 0 (not used) }
     // Called before '_end' is called on an entity
@@ -5,6 +5,8 @@
 #include <seika/rendering/texture.h>
 #include <seika/memory.h>
 
+#include "../../math/random.h"
+
 static inline f32 math_vec2_length(const SkaVector2* vector) {
     return sqrtf(vector->x * vector->x + vector->y * vector->y);
 }
@@ -18,14 +20,14 @@ static inline void math_vec2_normalize(SkaVector2* vector) {
 }
 
 static inline f32 get_random_sign() {
-    return ((rand() % 2) == 0) ? 1.0f : -1.0f;
+    return ((cre_random_next() % 2) == 0) ? 1.0f : -1.0f;
 }
 
 static inline f32 get_random_spread_angle_in_radians(const SkaVector2* direction, f32 spreadDegrees) {
     const f32 dirAngle = ska_math_vec2_angle(direction);
     // Generate a random angle based on direction and spread
 //    const float randomAngle = SKA_DEG_2_RADF(fmodf((float)rand(), spreadDegrees / 2.0f)) * get_random_sign();
-    const float randomAngle = SKA_DEG_2_RADF(fmodf((float)rand(), spreadDegrees) - spreadDegrees / 2.0f) * get_random_sign();
+    const float randomAngle = SKA_DEG_2_RADF(fmodf((float)cre_random_next(), spreadDegrees) - spreadDegrees / 2.0f) * get_random_sign();
     const float finalAngle = dirAngle + randomAngle;
     // Ensure the result is within [0, 2π]
     if (finalAngle < 0.0f) {
@@ -16,8 +16,17 @@ void tilemap_component_delete(TilemapComponent* tilemapComponent) {
     SKA_FREE(tilemapComponent);
 }
 
+// Deep copies the tilemap, each component owns its tilemap (e.g. scene templates are instanced many times)
 TilemapComponent* tilemap_component_copy(const TilemapComponent* tilemapComponent) {
     TilemapComponent* copiedComp = tilemap_component_create();
-    memcpy(copiedComp, tilemapComponent, sizeof(TilemapComponent));
+    copiedComp->origin = tilemapComponent->origin;
+    const CreTilemap* sourceTilemap = tilemapComponent->tilemap;
+    copiedComp->tilemap->tileset = sourceTilemap->tileset;
+    copiedComp->tilemap->bitmaskMode = sourceTilemap->bitmaskMode;
+    for (size_t i = 0; i < sourceTilemap->activeTiles->size; i++) {
+        const CreTileData* tileData = *(CreTileData**)ska_array_list_get(sourceTilemap->activeTiles, i);
+        cre_tilemap_set_tile_render_coord(copiedComp->tilemap, &tileData->position, &tileData->renderCoords);
+    }
+    cre_tilemap_commit_active_tile_changes(copiedComp->tilemap);
     return copiedComp;
 }
@@ -0,0 +1,24 @@
+#include "visibility_notifier2d_component.h"
+
+#include <string.h>
+
+#include <seika/memory.h>
+
+#include "component_defaults.h"
+
+VisibilityNotifier2DComponent* visibility_notifier2d_component_create() {
+    VisibilityNotifier2DComponent* visibilityNotifier2DComponent = SKA_ALLOC_ZEROED(VisibilityNotifier2DComponent);
+    visibilityNotifier2DComponent->rect = DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_RECT;
+    visibilityNotifier2DComponent->suspendWhenOffScreen = DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_SUSPEND_WHEN_OFF_SCREEN;
+    return visibilityNotifier2DComponent;
+}
+
+void visibility_notifier2d_component_delete(VisibilityNotifier2DComponent* visibilityNotifier2DComponent) {
+    SKA_FREE(visibilityNotifier2DComponent);
+}
+
+VisibilityNotifier2DComponent* visibility_notifier2d_component_copy(const VisibilityNotifier2DComponent* visibilityNotifier2DComponent) {
+    VisibilityNotifier2DComponent* copiedNode = SKA_ALLOC(VisibilityNotifier2DComponent);
+    memcpy(copiedNode, visibilityNotifier2DComponent, sizeof(VisibilityNotifier2DComponent));
+    return copiedNode;
+}
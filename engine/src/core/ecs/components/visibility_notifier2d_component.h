@@ -0,0 +1,28 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/event.h>
+#include <seika/math/math.h>
+
+// Tests its rect against the current camera once per frame (see 'visibility_notifier_ec_system.h')
+typedef struct VisibilityNotifier2DComponent {
+    SkaRect2 rect; // Relative to the node's global position and scaled by its global scale, rotation is ignored
+    // Stops '_process' and '_fixed_process', animated sprite frames and particles of the node and its children while off screen
+    bool suspendWhenOffScreen;
+    bool isOnScreen;
+    SkaEvent onScreenEntered; // { data = entity (unsigned int), type = 0 (not used) }
+    SkaEvent onScreenExited; // { data = entity (unsigned int), type = 0 (not used) }
+} VisibilityNotifier2DComponent;
+
+VisibilityNotifier2DComponent* visibility_notifier2d_component_create();
+void visibility_notifier2d_component_delete(VisibilityNotifier2DComponent* visibilityNotifier2DComponent);
+VisibilityNotifier2DComponent* visibility_notifier2d_component_copy(const VisibilityNotifier2DComponent* visibilityNotifier2DComponent);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,6 +12,7 @@ SkaComponentIndex SCRIPT_COMPONENT_INDEX = 0;
 SkaComponentIndex TEXT_LABEL_COMPONENT_INDEX = 0;
 SkaComponentIndex COLLIDER2D_COMPONENT_INDEX = 0;
 SkaComponentIndex TILEMAP_COMPONENT_INDEX = 0;
+SkaComponentIndex VISIBILITY_NOTIFIER2D_COMPONENT_INDEX = 0;
 
 // type flags
 SkaComponentType ANIMATED_SPRITE_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
@@ -25,3 +26,4 @@ SkaComponentType SCRIPT_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
 SkaComponentType TEXT_LABEL_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
 SkaComponentType COLLIDER2D_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
 SkaComponentType TILEMAP_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
+SkaComponentType VISIBILITY_NOTIFIER2D_COMPONENT_TYPE = SKA_ECS_COMPONENT_TYPE_NONE;
@@ -18,6 +18,7 @@ extern SkaComponentIndex SCRIPT_COMPONENT_INDEX;
 extern SkaComponentIndex TEXT_LABEL_COMPONENT_INDEX;
 extern SkaComponentIndex COLLIDER2D_COMPONENT_INDEX;
 extern SkaComponentIndex TILEMAP_COMPONENT_INDEX;
+extern SkaComponentIndex VISIBILITY_NOTIFIER2D_COMPONENT_INDEX;
 
 // type flags
 extern SkaComponentType ANIMATED_SPRITE_COMPONENT_TYPE;
@@ -31,6 +32,7 @@ extern SkaComponentType SCRIPT_COMPONENT_TYPE;
 extern SkaComponentType TEXT_LABEL_COMPONENT_TYPE;
 extern SkaComponentType COLLIDER2D_COMPONENT_TYPE;
 extern SkaComponentType TILEMAP_COMPONENT_TYPE;
+extern SkaComponentType VISIBILITY_NOTIFIER2D_COMPONENT_TYPE;
 
 #ifdef __cplusplus
 }
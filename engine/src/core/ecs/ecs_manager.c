@@ -2,14 +2,19 @@
 
 #include <seika/rendering/renderer.h>
 #include <seika/ecs/ecs.h>
+#include <seika/memory.h>
 #include <seika/string.h>
 #include <seika/assert.h>
 #include <seika/asset/asset_manager.h>
 
 #include "ecs_globals.h"
+#include "component_pool.h"
+#include "component_versions.h"
+#include "entity_builder.h"
 #include "components/animated_sprite_component.h"
 #include "components/collider2d_component.h"
 #include "components/color_rect_component.h"
+#include "components/node_component.h"
 #include "components/parallax_component.h"
 #include "components/particles2d_component.h"
 #include "components/sprite_component.h"
@@ -17,6 +22,7 @@
 #include "components/text_label_component.h"
 #include "components/tilemap_component.h"
 #include "components/transform2d_component.h"
+#include "components/visibility_notifier2d_component.h"
 #include "systems/animated_sprite_rendering_ec_system.h"
 #include "systems/collision_ec_system.h"
 #include "systems/color_rect_ec_system.h"
@@ -26,11 +32,41 @@
 #include "systems/script_ec_system.h"
 #include "systems/sprite_rendering_ec_system.h"
 #include "systems/tilemap_ec_system.h"
+#include "systems/visibility_notifier_ec_system.h"
 #include "../scene/scene_manager.h"
 #include "../game_properties.h"
 
 static SceneTreeNode* fpsDisplayNode = NULL;
 
+// Registers a pool for the component type using the values set by its create function as the pool's default component
+static void register_component_pool(SkaComponentIndex componentIndex, size_t componentSize, void* defaultComponent) {
+    cre_component_pool_register(componentIndex, componentSize, defaultComponent);
+    SKA_FREE(defaultComponent);
+}
+
+// Tilemaps aren't pooled since each component owns a heap allocated tilemap that is deep copied
+static void register_component_pools() {
+    register_component_pool(ANIMATED_SPRITE_COMPONENT_INDEX, sizeof(AnimatedSpriteComponent), animated_sprite_component_create());
+    register_component_pool(COLLIDER2D_COMPONENT_INDEX, sizeof(Collider2DComponent), collider2d_component_create());
+    register_component_pool(COLOR_RECT_COMPONENT_INDEX, sizeof(ColorRectComponent), color_rect_component_create());
+    register_component_pool(NODE_COMPONENT_INDEX, sizeof(NodeComponent), node_component_create());
+    register_component_pool(PARALLAX_COMPONENT_INDEX, sizeof(ParallaxComponent), parallax_component_create());
+    register_component_pool(PARTICLES2D_COMPONENT_INDEX, sizeof(Particles2DComponent), particles2d_component_create());
+    register_component_pool(SCRIPT_COMPONENT_INDEX, sizeof(ScriptComponent), script_component_create("", ""));
+    register_component_pool(SPRITE_COMPONENT_INDEX, sizeof(SpriteComponent), sprite_component_create());
+    register_component_pool(TEXT_LABEL_COMPONENT_INDEX, sizeof(TextLabelComponent), text_label_component_create());
+    register_component_pool(TRANSFORM2D_COMPONENT_INDEX, sizeof(Transform2DComponent), transform2d_component_create());
+    register_component_pool(VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, sizeof(VisibilityNotifier2DComponent), visibility_notifier2d_component_create());
+}
+
+// Pooled components still set on entities have to be handed back before the component manager frees what it holds.  The
+// scene manager releases the ones on live nodes when it's finalized, so only entities that never became nodes are left.
+static void finalize_component_pools() {
+    for (SkaEntity entity = 0; entity < SKA_MAX_ENTITIES && cre_component_pool_get_total_active_count() > 0; entity++) {
+        cre_component_pool_release_entity_components(entity);
+    }
+}
+
 static void register_components() {
     const SkaComponentTypeInfo* animSpriteTypeInfo = SKA_ECS_REGISTER_COMPONENT(AnimatedSpriteComponent);
     const SkaComponentTypeInfo* collider2dTypeInfo = SKA_ECS_REGISTER_COMPONENT(Collider2DComponent);
@@ -43,6 +79,7 @@ static void register_components() {
     const SkaComponentTypeInfo* textLabelTypeInfo = SKA_ECS_REGISTER_COMPONENT(TextLabelComponent);
     const SkaComponentTypeInfo* transform2dTypeInfo = SKA_ECS_REGISTER_COMPONENT(Transform2DComponent);
     const SkaComponentTypeInfo* tilemapTypeInfo = SKA_ECS_REGISTER_COMPONENT(TilemapComponent);
+    const SkaComponentTypeInfo* visibilityNotifier2dTypeInfo = SKA_ECS_REGISTER_COMPONENT(VisibilityNotifier2DComponent);
     // Update globals
     ANIMATED_SPRITE_COMPONENT_INDEX = animSpriteTypeInfo->index;
     ANIMATED_SPRITE_COMPONENT_TYPE = animSpriteTypeInfo->type;
@@ -66,6 +103,10 @@ static void register_components() {
     TRANSFORM2D_COMPONENT_TYPE = transform2dTypeInfo->type;
     TILEMAP_COMPONENT_INDEX = tilemapTypeInfo->index;
     TILEMAP_COMPONENT_TYPE = tilemapTypeInfo->type;
+    VISIBILITY_NOTIFIER2D_COMPONENT_INDEX = visibilityNotifier2dTypeInfo->index;
+    VISIBILITY_NOTIFIER2D_COMPONENT_TYPE = visibilityNotifier2dTypeInfo->type;
+    register_component_pools();
+    cre_component_versions_initialize();
 }
 
 void cre_ecs_manager_initialize() {
@@ -82,6 +123,7 @@ void cre_ecs_manager_initialize() {
     cre_parallax_ec_system_create_and_register();
     cre_particle_ec_system_create_and_register();
     cre_tilemap_ec_system_create_and_register();
+    cre_visibility_notifier_ec_system_create_and_register();
     cre_script_ec_system_create_and_register();
 }
 
@@ -98,6 +140,7 @@ void cre_ecs_manager_initialize_ex(SkaTexture* colorRectTexture, SkaTexture* par
     cre_parallax_ec_system_create_and_register();
     cre_particle_ec_system_create_and_register_ex(particle2DSquareTexture);
     cre_tilemap_ec_system_create_and_register();
+    cre_visibility_notifier_ec_system_create_and_register();
     cre_script_ec_system_create_and_register();
 }
 
@@ -108,24 +151,26 @@ void cre_ecs_manager_enable_fps_display_entity(bool enabled, const char* fontUID
     if (!isEnabled && enabled) {
         fpsDisplayNode = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
         currentFpsEntity = fpsDisplayNode->entity;
+        CreEntityBuilder builder;
+        cre_entity_builder_begin(&builder, currentFpsEntity);
         // Transform 2D
         Transform2DComponent* transform2DComponent = transform2d_component_create();
         transform2DComponent->localTransform.position.x = positionX;
         transform2DComponent->localTransform.position.y = positionY;
         transform2DComponent->ignoreCamera = true;
         transform2DComponent->zIndex = SKA_RENDERER_MAX_Z_INDEX;
-        ska_ecs_component_manager_set_component(currentFpsEntity, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
+        cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
         // Text Label Component
         TextLabelComponent* textLabelComponent = text_label_component_create();
         textLabelComponent->font = ska_asset_manager_get_font(fontUID != NULL ? fontUID : CRE_DEFAULT_FONT_ASSET.uid);
         ska_strcpy(textLabelComponent->text, "FPS: ");
-        ska_ecs_component_manager_set_component(currentFpsEntity, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
+        cre_entity_builder_set_component(&builder, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
         // Script Component
         ScriptComponent* scriptComponent = script_component_create("main", "FpsDisplay");
         scriptComponent->contextType = CreScriptContextType_NATIVE;
-        ska_ecs_component_manager_set_component(currentFpsEntity, SCRIPT_COMPONENT_INDEX, scriptComponent);
-        // Update systems
-        ska_ecs_system_update_entity_signature_with_systems(currentFpsEntity);
+        cre_entity_builder_set_component(&builder, SCRIPT_COMPONENT_INDEX, scriptComponent);
+        // Systems are matched once the node is processed from the creation queue
+        cre_entity_builder_build(&builder);
         cre_scene_manager_queue_node_for_creation(fpsDisplayNode);
     } else if (isEnabled && !enabled) {
         SKA_ASSERT_FMT(currentFpsEntity != SKA_NULL_ENTITY, "Current fps entity is a null entity!?");
@@ -138,7 +183,10 @@ void cre_ecs_manager_enable_fps_display_entity(bool enabled, const char* fontUID
 }
 
 void cre_ecs_manager_finalize() {
+    finalize_component_pools();
     ska_ecs_finalize();
+    cre_component_pool_finalize();
+    cre_component_versions_finalize();
 }
 
 void cre_ecs_manager_initialize_editor() {
@@ -147,5 +195,8 @@ void cre_ecs_manager_initialize_editor() {
 }
 
 void cre_ecs_manager_finalize_editor() {
+    finalize_component_pools();
     ska_ecs_finalize();
+    cre_component_pool_finalize();
+    cre_component_versions_finalize();
 }
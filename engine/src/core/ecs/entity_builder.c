@@ -0,0 +1,24 @@
+#include "entity_builder.h"
+
+#include <seika/assert.h>
+#include <seika/ecs/ecs.h>
+
+void cre_entity_builder_begin(CreEntityBuilder* builder, SkaEntity entity) {
+    builder->entity = entity;
+    builder->componentMask = 0;
+}
+
+void cre_entity_builder_set_component(CreEntityBuilder* builder, SkaComponentIndex componentIndex, void* component) {
+    SKA_ASSERT_FMT(componentIndex < CRE_MAX_COMPONENTS, "Invalid component index '%u'!", componentIndex);
+    SKA_ASSERT_FMT((builder->componentMask & (1u << componentIndex)) == 0, "Component index '%u' already set for entity '%u'!", componentIndex, builder->entity);
+    builder->components[componentIndex] = component;
+    builder->componentMask |= 1u << componentIndex;
+}
+
+void cre_entity_builder_build(CreEntityBuilder* builder) {
+    for (SkaComponentIndex i = 0; builder->componentMask != 0; i++, builder->componentMask >>= 1) {
+        if ((builder->componentMask & 1u) != 0) {
+            ska_ecs_component_manager_set_component(builder->entity, i, builder->components[i]);
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <seika/ecs/entity.h>
+#include <seika/ecs/component.h>
+
+#include "component.h"
+
+// Gathers a new entity's components so they're handed to the component manager in one pass once all of them are known.
+// Nothing reads an entity's components while it's being built, and systems are only matched against the final signature
+// once, when the entity is processed from the scene manager's creation queue.  Entities shouldn't be matched with systems
+// before they're queued, doing both runs every system's signature check twice.
+
+typedef struct CreEntityBuilder {
+    SkaEntity entity;
+    uint32 componentMask; // Bit per component index that has been set
+    void* components[CRE_MAX_COMPONENTS];
+} CreEntityBuilder;
+
+void cre_entity_builder_begin(CreEntityBuilder* builder, SkaEntity entity);
+void cre_entity_builder_set_component(CreEntityBuilder* builder, SkaComponentIndex componentIndex, void* component);
+// Sets the gathered components on the entity in component index order
+void cre_entity_builder_build(CreEntityBuilder* builder);
+
+#ifdef __cplusplus
+}
+#endif
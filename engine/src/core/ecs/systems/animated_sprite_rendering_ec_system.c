@@ -7,24 +7,43 @@
 #include <seika/ecs/ecs.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../components/animated_sprite_component.h"
 #include "../components/transform2d_component.h"
 #include "../../scene/scene_manager.h"
 #include "../../camera/camera.h"
 #include "../../camera/camera_manager.h"
 
+static CreComponentView animatedSpriteView;
+static int32 lastRenderTickTime = 0;
+
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
 static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void animated_sprite_render(SkaECSSystem* system);
 
 void cre_animated_sprite_rendering_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Animated Sprite Rendering");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
     systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.render_func = animated_sprite_render;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, AnimatedSpriteComponent);
 }
 
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&animatedSpriteView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, ANIMATED_SPRITE_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&animatedSpriteView);
+}
+
 void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
-    AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
+    cre_component_view_add_entity(&animatedSpriteView, entity);
+    AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)cre_component_view_get_entry(&animatedSpriteView, entity)->components[1];
     SKA_ASSERT(animatedSpriteComponent != NULL);
     animated_sprite_component_refresh_random_stagger_animation_time(animatedSpriteComponent);
     if (animatedSpriteComponent->isPlaying) {
@@ -32,15 +51,28 @@ void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
     }
 }
 
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&animatedSpriteView, entity);
+}
+
 void animated_sprite_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
     const int32 currentTickTime = (int32)ska_get_ticks();
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* spriteTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
+    const int32 ticksSinceLastRender = lastRenderTickTime > 0 ? currentTickTime - lastRenderTickTime : 0;
+    lastRenderTickTime = currentTickTime;
+    CRE_COMPONENT_VIEW_FOR(&animatedSpriteView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* spriteTransformComp = (Transform2DComponent*)entry->components[0];
+        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)entry->components[1];
         CreAnimationFrame* currentFrame = &animatedSpriteComponent->currentAnimation->animationFrames[animatedSpriteComponent->currentAnimation->currentFrame];
-        if (animatedSpriteComponent->isPlaying) {
+        if (animatedSpriteComponent->isPlaying && !cre_scene_manager_can_entity_process(entity)) {
+            // Frames are picked from the time since the animation started, push the start back so it resumes where it stopped
+            animatedSpriteComponent->startAnimationTickTime += ticksSinceLastRender;
+        } else if (animatedSpriteComponent->isPlaying) {
             const f32 entityTimeDilation = cre_scene_manager_get_node_full_time_dilation(entity);
             const f32 spriteCurrentTickTime = (f32) currentTickTime + (f32) animatedSpriteComponent->randomStaggerTime;
             const int32 tickRate = (int32) (((spriteCurrentTickTime - (f32) animatedSpriteComponent->startAnimationTickTime) / (f32) animatedSpriteComponent->currentAnimation->speed) * entityTimeDilation);
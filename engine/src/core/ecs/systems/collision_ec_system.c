@@ -6,6 +6,8 @@
 #include <seika/assert.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
+#include "../component_versions.h"
 
 #include "../components/transform2d_component.h"
 #include "../components/collider2d_component.h"
@@ -14,6 +16,9 @@
 #include "../../game_properties.h"
 #include "../../camera/camera.h"
 #include "../../camera/camera_manager.h"
+#include "../../utils/entity_paged_array.h"
+
+#define COLLISION_NOT_BAKED_VERSION ((uint32)-1)
 
 static void collision_system_on_transform_update(SkaSubjectNotifyPayload* payload);
 
@@ -23,21 +28,25 @@ SkaRect2 colliderDrawSource = { .x=0.0f, .y=0.0f, .w=1.0f, .h=1.0f };
 
 SkaObserver collisionOnEntityTransformChangeObserver = { .on_notify = collision_system_on_transform_update };
 SkaSpatialHashMap* spatialHashMap = NULL;
+static CreComponentView colliderView;
+// Collider2D version each spatial hash rect was baked from, 'COLLISION_NOT_BAKED_VERSION' if the entity isn't in the hash
+static CreEntityPagedArray bakedColliderVersions;
+static uint32 bakedColliderTypeVersion = 0;
 
 static void on_ec_system_registered(SkaECSSystem* system);
 static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity);
-static void fixed_update(SkaECSSystem* system, f32 deltaTime);
 static void collision_render(SkaECSSystem* system);
 
 void cre_collision_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Collision");
     systemTemplate.on_ec_system_register = on_ec_system_registered;
     systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
     systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.on_entity_entered_scene_func = on_entity_entered_scene;
-    systemTemplate.fixed_update_func = fixed_update;
     // systemTemplate.render_func = collision_render; // TODO: Make it based on if collision debug is enabled
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, Collider2DComponent);
 }
@@ -55,12 +64,22 @@ void on_ec_system_registered(SkaECSSystem* system) {
     static const int32 initialCellSize = 64;
     spatialHashMap = ska_spatial_hash_map_create(initialCellSize);
     cre_collision_set_global_spatial_hash_map(spatialHashMap);
+    cre_component_view_initialize(&colliderView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, COLLIDER2D_COMPONENT_INDEX }, 2);
+    const uint32 notBakedVersion = COLLISION_NOT_BAKED_VERSION;
+    cre_entity_paged_array_initialize(&bakedColliderVersions, sizeof(uint32), &notBakedVersion);
+    bakedColliderTypeVersion = cre_component_versions_get_type_version(COLLIDER2D_COMPONENT_INDEX);
 }
 
 void on_ec_system_destroyed(SkaECSSystem* system) {
     ska_spatial_hash_map_destroy(spatialHashMap);
     spatialHashMap = NULL;
     collisionSystem = NULL;
+    cre_component_view_finalize(&colliderView);
+    cre_entity_paged_array_finalize(&bakedColliderVersions);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&colliderView, entity);
 }
 
 void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
@@ -69,6 +88,8 @@ void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity,TRANSFORM2D_COMPONENT_INDEX);
     SKA_ASSERT(transformComp != NULL);
     ska_event_unregister_observer(&transformComp->onTransformChanged, &collisionOnEntityTransformChangeObserver);
+    cre_component_view_remove_entity(&colliderView, entity);
+    cre_entity_paged_array_release(&bakedColliderVersions, entity);
 }
 
 void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
@@ -77,24 +98,22 @@ void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
     if (transformComp != NULL && colliderComp != NULL) {
         SkaRect2 collisionRect = cre_get_collision_rectangle(entity, transformComp, colliderComp);
         ska_spatial_hash_map_insert_or_update(spatialHashMap, entity, &collisionRect);
+        *(uint32*)cre_entity_paged_array_get_or_create(&bakedColliderVersions, entity) = cre_component_versions_get(entity, COLLIDER2D_COMPONENT_INDEX).version;
         // Register to entity's 'on transform changed' event
         ska_event_register_observer(&transformComp->onTransformChanged, &collisionOnEntityTransformChangeObserver);
     }
 }
 
-void fixed_update(SkaECSSystem* system, f32 deltaTime) {
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity,TRANSFORM2D_COMPONENT_INDEX);
-        transformComp->isGlobalTransformDirty = true;
-    }
-}
-
 void collision_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity,TRANSFORM2D_COMPONENT_INDEX);
-        const Collider2DComponent* colliderComp = (Collider2DComponent*)ska_ecs_component_manager_get_component(entity,COLLIDER2D_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&colliderView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* transformComp = (Transform2DComponent*)entry->components[0];
+        const Collider2DComponent* colliderComp = (Collider2DComponent*)entry->components[1];
         const CRECamera2D* renderCamera = transformComp->ignoreCamera ? defaultCamera : camera2D;
         const SceneNodeRenderResource renderResource = cre_scene_manager_get_scene_node_global_render_resource(entity, transformComp, &SKA_VECTOR2_ZERO);
         const SkaSize2D colliderDrawSize = {
@@ -128,6 +147,26 @@ void collision_system_on_transform_update(SkaSubjectNotifyPayload* payload) {
     }
 }
 
+void cre_collision_ec_system_refresh_changed_colliders() {
+    const uint32 colliderTypeVersion = cre_component_versions_get_type_version(COLLIDER2D_COMPONENT_INDEX);
+    if (colliderTypeVersion == bakedColliderTypeVersion) {
+        return;
+    }
+    bakedColliderTypeVersion = colliderTypeVersion;
+    CRE_COMPONENT_VIEW_FOR(&colliderView, entry) {
+        uint32* bakedVersion = (uint32*)cre_entity_paged_array_get(&bakedColliderVersions, entry->entity);
+        if (bakedVersion == NULL || *bakedVersion == COLLISION_NOT_BAKED_VERSION) {
+            continue;
+        }
+        const uint32 colliderVersion = cre_component_versions_get(entry->entity, COLLIDER2D_COMPONENT_INDEX).version;
+        if (colliderVersion != *bakedVersion) {
+            SkaRect2 collisionRect = cre_get_collision_rectangle(entry->entity, (Transform2DComponent*)entry->components[0], (Collider2DComponent*)entry->components[1]);
+            ska_spatial_hash_map_insert_or_update(spatialHashMap, entry->entity, &collisionRect);
+            *bakedVersion = colliderVersion;
+        }
+    }
+}
+
 SkaECSSystem* cre_collision_ec_system_get() {
     return collisionSystem;
 }
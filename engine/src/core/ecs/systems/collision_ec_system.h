@@ -1,4 +1,6 @@
 #pragma once
 
 void cre_collision_ec_system_create_and_register();
+// Re-inserts the spatial hash rects of colliders whose Collider2D component changed since they were last baked
+void cre_collision_ec_system_refresh_changed_colliders();
 struct SkaECSSystem* cre_collision_ec_system_get();
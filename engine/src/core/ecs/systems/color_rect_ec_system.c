@@ -6,6 +6,7 @@
 #include <seika/assert.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../components/transform2d_component.h"
 #include "../components/color_rect_component.h"
 #include "../../scene/scene_manager.h"
@@ -14,9 +15,12 @@
 
 static SkaTexture* colorRectTexture = NULL;
 static SkaRect2 colorRectDrawSource = { 0.0f, 0.0f, 1.0f, 1.0f };
+static CreComponentView colorRectView;
 
 static void on_ec_system_registered(SkaECSSystem* system);
 static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void color_rect_render(SkaECSSystem* system);
 
 void cre_color_rect_ec_system_create_and_register() {
@@ -29,6 +33,8 @@ void cre_color_rect_ec_system_create_and_register_ex(struct SkaTexture* rectText
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Collision");
     systemTemplate.on_ec_system_register = on_ec_system_registered;
     systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.render_func = color_rect_render;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, ColorRectComponent);
 }
@@ -37,6 +43,7 @@ void on_ec_system_registered(SkaECSSystem* system) {
     if (colorRectTexture == NULL) {
         colorRectTexture = ska_texture_create_solid_colored_texture(1, 1, 255);
     }
+    cre_component_view_initialize(&colorRectView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, COLOR_RECT_COMPONENT_INDEX }, 2);
 }
 
 void on_ec_system_destroyed(SkaECSSystem* system) {
@@ -44,15 +51,28 @@ void on_ec_system_destroyed(SkaECSSystem* system) {
         ska_texture_delete(colorRectTexture);
         colorRectTexture = NULL;
     }
+    cre_component_view_finalize(&colorRectView);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&colorRectView, entity);
+}
+
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&colorRectView, entity);
 }
 
 void color_rect_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
 
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        const ColorRectComponent* colorRectComponent = (ColorRectComponent*)ska_ecs_component_manager_get_component(entity, COLOR_RECT_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&colorRectView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* transformComp = (Transform2DComponent*)entry->components[0];
+        const ColorRectComponent* colorRectComponent = (ColorRectComponent*)entry->components[1];
         const CRECamera2D* renderCamera = transformComp->ignoreCamera ? defaultCamera : camera2D;
         const SceneNodeRenderResource renderResource = cre_scene_manager_get_scene_node_global_render_resource(entity, transformComp, &SKA_VECTOR2_ZERO);
         const SkaSize2D destinationSize = {
@@ -6,36 +6,62 @@
 #include <seika/assert.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../../engine_context.h"
 #include "../../scene/scene_manager.h"
 #include "../../camera/camera.h"
 #include "../../camera/camera_manager.h"
 #include "../components/text_label_component.h"
 
+static CreComponentView textLabelView;
+
 static void font_render(SkaECSSystem* system);
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
 static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 
 void cre_font_rendering_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Font Rendering");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
     systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.render_func = font_render;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, TextLabelComponent);
 }
 
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&textLabelView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, TEXT_LABEL_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&textLabelView);
+}
+
 void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
     // Set default font if none is set already
     TextLabelComponent* textLabelComponent = (TextLabelComponent*)ska_ecs_component_manager_get_component(entity, TEXT_LABEL_COMPONENT_INDEX);
     if (!textLabelComponent->font) {
         textLabelComponent->font = ska_asset_manager_get_font(CRE_DEFAULT_FONT_KEY);
     }
+    cre_component_view_add_entity(&textLabelView, entity);
+}
+
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&textLabelView, entity);
 }
 
 void font_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* fontTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        TextLabelComponent* textLabelComponent = (TextLabelComponent*)ska_ecs_component_manager_get_component(entity, TEXT_LABEL_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&textLabelView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* fontTransformComp = (Transform2DComponent*)entry->components[0];
+        const TextLabelComponent* textLabelComponent = (TextLabelComponent*)entry->components[1];
         const CRECamera2D* renderCamera = fontTransformComp->ignoreCamera ? defaultCamera : camera2D;
         const SceneNodeRenderResource renderResource = cre_scene_manager_get_scene_node_global_render_resource(entity, fontTransformComp, &SKA_VECTOR2_ZERO);
 
@@ -7,8 +7,15 @@
 #include "../components/parallax_component.h"
 #include "../../camera/camera.h"
 #include "../../camera/camera_manager.h"
+#include "../../scene/scene_manager.h"
 #include "../component.h"
+#include "../component_view.h"
 
+static CreComponentView parallaxView;
+
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void fixed_update(SkaECSSystem* system, f32 deltaTime);
@@ -21,12 +28,27 @@ SkaObserver parallaxOnEntityTransformChangeObserver = { .on_notify = on_entity_t
 
 void cre_parallax_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Parallax");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
     systemTemplate.on_entity_entered_scene_func = on_entity_entered_scene;
     systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.fixed_update_func = fixed_update;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, ParallaxComponent);
 }
 
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&parallaxView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, PARALLAX_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&parallaxView);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&parallaxView, entity);
+}
+
 void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     ParallaxComponent* parallaxComp = (ParallaxComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
@@ -41,14 +63,16 @@ void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
     // Remove observer
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     ska_event_unregister_observer(&transformComp->onTransformChanged, &parallaxOnEntityTransformChangeObserver);
+    cre_component_view_remove_entity(&parallaxView, entity);
 }
 
 void fixed_update(SkaECSSystem* system, f32 deltaTime) {
     CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        ParallaxComponent* parallaxComp = (ParallaxComponent*)ska_ecs_component_manager_get_component(entity, PARALLAX_COMPONENT_INDEX);
-        parallax_system_update_entity(entity, transformComp, parallaxComp, camera2D);
+    CRE_COMPONENT_VIEW_FOR(&parallaxView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        parallax_system_update_entity(entry->entity, (Transform2DComponent*)entry->components[0], (ParallaxComponent*)entry->components[1], camera2D);
     }
 }
 
@@ -59,6 +83,7 @@ void parallax_system_update_entity(SkaEntity entity, Transform2DComponent* trans
     };
     transformComp->localTransform.position.x = parallaxComp->cachedLocalPosition.x + offset.x;
     transformComp->localTransform.position.y = parallaxComp->cachedLocalPosition.y + offset.y;
+    cre_scene_manager_invalidate_global_transform(entity, transformComp);
 }
 
 // Observer callbacks
@@ -6,6 +6,7 @@
 #include <seika/assert.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../components/particles2d_component.h"
 #include "../components/transform2d_component.h"
 #include "../../camera/camera.h"
@@ -18,11 +19,15 @@ typedef struct CreParticleRenderItem {
 }CreParticleRenderItem;
 
 static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity);
 static void ec_system_update(SkaECSSystem* system, f32 deltaTime);
 static void ec_system_render(SkaECSSystem* system);
 
 SkaTexture* particleSquareTexture = NULL;
+static CreComponentView particlesView;
 
 void cre_particle_ec_system_create_and_register() {
     cre_particle_ec_system_create_and_register_ex(NULL);
@@ -33,6 +38,9 @@ void cre_particle_ec_system_create_and_register_ex(SkaTexture* squareTextureOver
 
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Particle Emitter");
     systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.on_entity_entered_scene_func = on_entity_entered_scene;
     systemTemplate.update_func = ec_system_update;
     systemTemplate.render_func = ec_system_render;
@@ -43,6 +51,19 @@ void on_ec_system_registered(SkaECSSystem* system) {
     if (particleSquareTexture == NULL) {
         particleSquareTexture = ska_texture_create_solid_colored_texture(1, 1, 255);
     }
+    cre_component_view_initialize(&particlesView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, PARTICLES2D_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&particlesView);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&particlesView, entity);
+}
+
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&particlesView, entity);
 }
 
 void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
@@ -52,9 +73,11 @@ void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
 }
 
 void ec_system_update(SkaECSSystem* system, float deltaTime) {
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Particles2DComponent* particles2DComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
-        cre_particle_emitter_ec_system_update_component(particles2DComponent, deltaTime);
+    CRE_COMPONENT_VIEW_FOR(&particlesView, entry) {
+        if (!cre_scene_manager_can_entity_process(entry->entity)) {
+            continue;
+        }
+        cre_particle_emitter_ec_system_update_component((Particles2DComponent*)entry->components[1], deltaTime);
     }
 }
 
@@ -62,9 +85,13 @@ void ec_system_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
 
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* particleTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        Particles2DComponent* particles2DComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&particlesView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* particleTransformComp = (Transform2DComponent*)entry->components[0];
+        Particles2DComponent* particles2DComponent = (Particles2DComponent*)entry->components[1];
         const CRECamera2D* renderCamera = particleTransformComp->ignoreCamera ? defaultCamera : camera2D;
 
         // Particle types can only be Particle2DComponentType_SQUARE (default) and Particle2DComponentType_TEXTURE for now
@@ -23,9 +23,11 @@ static void on_post_update_all(SkaECSSystem* system);
 static void script_system_instance_update(SkaECSSystem* system, f32 deltaTime);
 static void script_system_instance_fixed_update(SkaECSSystem* system, f32 deltaTime);
 static void network_callback(SkaECSSystem* system, const char* message);
+static void on_node_process_disabled_changed(SkaEntity entity, bool isDisabled);
 
 static CREScriptContext* scriptContexts[CreScriptContextType_TOTAL_TYPES];
 static size_t scriptContextsCount = 0;
+static size_t scriptInstanceCount = 0;
 
 void cre_script_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Script");
@@ -43,6 +45,10 @@ void cre_script_ec_system_create_and_register() {
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, ScriptComponent);
 }
 
+size_t cre_script_ec_system_get_instance_count() {
+    return scriptInstanceCount;
+}
+
 void on_ec_system_registered(SkaECSSystem* system) {
     CREScriptContextTemplate templates[8];
     size_t templateCount = 0;
@@ -60,6 +66,7 @@ void on_ec_system_registered(SkaECSSystem* system) {
         scriptContexts[template->contextType]->on_script_context_init(scriptContexts[template->contextType]);
         scriptContextsCount++;
     }
+    cre_scene_manager_set_process_disabled_changed_callback(on_node_process_disabled_changed);
 }
 
 void on_ec_system_destroyed(SkaECSSystem* system) {
@@ -69,6 +76,8 @@ void on_ec_system_destroyed(SkaECSSystem* system) {
         }
     }
     scriptContextsCount = 0;
+    scriptInstanceCount = 0;
+    cre_scene_manager_set_process_disabled_changed_callback(NULL);
 }
 
 void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
@@ -78,17 +87,23 @@ void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
     SKA_ASSERT(scriptContext != NULL);
     SKA_ASSERT(scriptContext->on_create_instance != NULL);
     scriptContext->on_create_instance(entity, scriptComponent->classPath, scriptComponent->className);
+    scriptInstanceCount++;
 }
 
 void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
     const ScriptComponent* scriptComponent = (ScriptComponent*)ska_ecs_component_manager_get_component(entity, SCRIPT_COMPONENT_INDEX);
     scriptContexts[scriptComponent->contextType]->on_delete_instance(entity);
+    scriptInstanceCount--;
 }
 
 void on_entity_start(SkaECSSystem* system, SkaEntity entity) {
     const ScriptComponent* scriptComponent = (ScriptComponent*)ska_ecs_component_manager_get_component(entity, SCRIPT_COMPONENT_INDEX);
     SKA_ASSERT_FMT(scriptComponent->contextType != CreScriptContextType_NONE, "Invalid context type '%d' for entity '%d'", scriptComponent->contextType, entity);
     scriptContexts[scriptComponent->contextType]->on_start(entity);
+    // Contexts add entities to the update lists when creating or starting instances, disabled nodes skip them from the start
+    if (cre_scene_manager_get_entity_process_mode(entity) == NodeProcessMode_DISABLED) {
+        cre_script_context_set_entity_update_enabled(scriptContexts[scriptComponent->contextType], entity, false);
+    }
 }
 
 void on_entity_end(SkaECSSystem* system, SkaEntity entity) {
@@ -116,6 +131,9 @@ void script_system_instance_update(SkaECSSystem* system, f32 deltaTime) {
     for (size_t i = 0; i < scriptContextsCount; i++) {
         for (size_t entityIndex = 0; entityIndex < scriptContexts[i]->updateEntityCount; entityIndex++) {
             const SkaEntity entity = scriptContexts[i]->updateEntities[entityIndex];
+            if (!cre_scene_manager_can_entity_process(entity)) {
+                continue;
+            }
             const f32 entityTimeDilation = cre_scene_manager_get_node_full_time_dilation(entity);
             scriptContexts[i]->on_update_instance(entity, deltaTime * entityTimeDilation);
         }
@@ -126,12 +144,22 @@ void script_system_instance_fixed_update(SkaECSSystem* system, f32 deltaTime) {
     for (size_t i = 0; i < scriptContextsCount; i++) {
         for (size_t entityIndex = 0; entityIndex < scriptContexts[i]->fixedUpdateEntityCount; entityIndex++) {
             const SkaEntity entity = scriptContexts[i]->fixedUpdateEntities[entityIndex];
+            if (!cre_scene_manager_can_entity_process(entity)) {
+                continue;
+            }
             const f32 entityTimeDilation = cre_scene_manager_get_node_full_time_dilation(entity);
             scriptContexts[i]->on_fixed_update_instance(entity, deltaTime * entityTimeDilation);
         }
     }
 }
 
+void on_node_process_disabled_changed(SkaEntity entity, bool isDisabled) {
+    const ScriptComponent* scriptComponent = (ScriptComponent*)ska_ecs_component_manager_get_component_unchecked(entity, SCRIPT_COMPONENT_INDEX);
+    if (scriptComponent != NULL && scriptComponent->contextType != CreScriptContextType_NONE && scriptContexts[scriptComponent->contextType] != NULL) {
+        cre_script_context_set_entity_update_enabled(scriptContexts[scriptComponent->contextType], entity, !isDisabled);
+    }
+}
+
 void network_callback(SkaECSSystem* system, const char* message) {
     // Hard coding python for now  TODO: Keep an array of script contexts that contain this callback
     scriptContexts[CreScriptContextType_PYTHON]->on_network_callback(message);
@@ -1,3 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 void cre_script_ec_system_create_and_register();
+// Number of script instances alive, their state lives in the script contexts and isn't part of world snapshots
+size_t cre_script_ec_system_get_instance_count();
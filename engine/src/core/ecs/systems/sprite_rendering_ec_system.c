@@ -5,27 +5,58 @@
 #include <seika/ecs/ecs.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../components/transform2d_component.h"
 #include "../components/sprite_component.h"
 #include "../../scene/scene_manager.h"
 #include "../../camera/camera.h"
 #include "../../camera/camera_manager.h"
 
+static CreComponentView spriteView;
+
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void sprite_render(SkaECSSystem* system);
 
 void cre_sprite_rendering_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Sprite Rendering");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.render_func = sprite_render;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, SpriteComponent);
 }
 
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&spriteView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, SPRITE_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&spriteView);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&spriteView, entity);
+}
+
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&spriteView, entity);
+}
+
 void sprite_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
 
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* spriteTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&spriteView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* spriteTransformComp = (Transform2DComponent*)entry->components[0];
+        const SpriteComponent* spriteComponent = (SpriteComponent*)entry->components[1];
         const CRECamera2D* renderCamera = spriteTransformComp->ignoreCamera ? defaultCamera : camera2D;
         const SceneNodeRenderResource renderResource = cre_scene_manager_get_scene_node_global_render_resource(entity, spriteTransformComp, &spriteComponent->origin);
         const SkaSize2D destinationSize = {
@@ -6,6 +6,7 @@
 #include <seika/assert.h>
 
 #include "../ecs_globals.h"
+#include "../component_view.h"
 #include "../../tilemap/tilemap.h"
 #include "../components/tilemap_component.h"
 #include "../components/transform2d_component.h"
@@ -13,17 +14,38 @@
 #include "../../camera/camera_manager.h"
 #include "../../scene/scene_manager.h"
 
+static CreComponentView tilemapView;
+
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
 static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
 static void tilemap_render(SkaECSSystem* system);
 
 void cre_tilemap_ec_system_create_and_register() {
     SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Tilemap");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
     systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
     systemTemplate.render_func = tilemap_render;
     SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, TilemapComponent);
 }
 
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&tilemapView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, TILEMAP_COMPONENT_INDEX }, 2);
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&tilemapView);
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&tilemapView, entity);
+}
+
 void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_remove_entity(&tilemapView, entity);
     TilemapComponent* tilemapComponent = (TilemapComponent*)ska_ecs_component_manager_get_component(entity, TILEMAP_COMPONENT_INDEX);
     SKA_ASSERT(tilemapComponent->tilemap);
     cre_tilemap_finalize(tilemapComponent->tilemap);
@@ -34,9 +56,13 @@ void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
 void tilemap_render(SkaECSSystem* system) {
     const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
     const CRECamera2D* defaultCamera = cre_camera_manager_get_default_camera();
-    SKA_ECS_SYSTEM_ENTITIES_FOR(system, entity) {
-        Transform2DComponent* tilemapTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
-        TilemapComponent* tilemapComponent = (TilemapComponent*)ska_ecs_component_manager_get_component(entity, TILEMAP_COMPONENT_INDEX);
+    CRE_COMPONENT_VIEW_FOR(&tilemapView, entry) {
+        if (cre_scene_manager_is_entity_pooled(entry->entity)) {
+            continue;
+        }
+        const SkaEntity entity = entry->entity;
+        Transform2DComponent* tilemapTransformComp = (Transform2DComponent*)entry->components[0];
+        TilemapComponent* tilemapComponent = (TilemapComponent*)entry->components[1];
         SKA_ASSERT(tilemapComponent->tilemap);
         SKA_ASSERT(tilemapComponent->tilemap->tilesArray);
         SKA_ASSERT(tilemapComponent->tilemap->tileset.texture);
@@ -0,0 +1,213 @@
+#include "visibility_notifier_ec_system.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <seika/ecs/ecs.h>
+#include <seika/assert.h>
+
+#include "../ecs_globals.h"
+#include "../component_view.h"
+#include "../components/transform2d_component.h"
+#include "../components/visibility_notifier2d_component.h"
+#include "../../camera/camera.h"
+#include "../../camera/camera_manager.h"
+#include "../../scene/scene_manager.h"
+#include "../../game_properties.h"
+#include "../../utils/spatial_grid.h"
+
+#define CRE_VISIBILITY_NOTIFIER_GRID_CELL_SIZE 256.0f
+
+static void on_ec_system_registered(SkaECSSystem* system);
+static void on_ec_system_destroyed(SkaECSSystem* system);
+static void on_entity_registered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity);
+static void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity);
+static void ec_system_update(SkaECSSystem* system, f32 deltaTime);
+static void visibility_notifier_on_transform_update(SkaSubjectNotifyPayload* payload);
+
+static SkaObserver visibilityNotifierOnTransformChangeObserver = { .on_notify = visibility_notifier_on_transform_update };
+static CreComponentView notifierView;
+static CreSpatialGrid notifierGrid;
+// Last update each notifier was found on screen, compared against 'currentFrameStamp' to find notifiers that left
+static CreEntityPagedArray notifierVisibleFrameStamps;
+static uint32 currentFrameStamp = 0;
+// Notifiers with 'isOnScreen' set, only these are checked for exits
+static SkaEntity* onScreenEntities = NULL;
+static uint32 onScreenEntityCount = 0;
+static uint32 onScreenEntityCapacity = 0;
+// Notifiers that came on screen during the current query, events are fired after the query so observers can't touch the grid mid query
+static SkaEntity* enteredEntities = NULL;
+static uint32 enteredEntityCount = 0;
+static uint32 enteredEntityCapacity = 0;
+
+void cre_visibility_notifier_ec_system_create_and_register() {
+    SkaECSSystemTemplate systemTemplate = ska_ecs_system_create_default_template("Visibility Notifier");
+    systemTemplate.on_ec_system_register = on_ec_system_registered;
+    systemTemplate.on_ec_system_destroy = on_ec_system_destroyed;
+    systemTemplate.on_entity_registered_func = on_entity_registered;
+    systemTemplate.on_entity_unregistered_func = on_entity_unregistered;
+    systemTemplate.on_entity_entered_scene_func = on_entity_entered_scene;
+    systemTemplate.update_func = ec_system_update;
+    SKA_ECS_SYSTEM_REGISTER_FROM_TEMPLATE(&systemTemplate, Transform2DComponent, VisibilityNotifier2DComponent);
+}
+
+static void visibility_notifier_push_entity(SkaEntity** entities, uint32* count, uint32* capacity, SkaEntity entity) {
+    if (*count >= *capacity) {
+        *capacity = *capacity > 0 ? *capacity * 2 : 64;
+        *entities = (SkaEntity*)realloc(*entities, sizeof(SkaEntity) * *capacity);
+        SKA_ASSERT(*entities);
+    }
+    (*entities)[(*count)++] = entity;
+}
+
+static void visibility_notifier_remove_on_screen_entity(SkaEntity entity) {
+    for (uint32 i = 0; i < onScreenEntityCount; i++) {
+        if (onScreenEntities[i] == entity) {
+            onScreenEntities[i] = onScreenEntities[--onScreenEntityCount];
+            return;
+        }
+    }
+}
+
+static SkaRect2 visibility_notifier_get_world_rect(SkaEntity entity, Transform2DComponent* transformComp, const VisibilityNotifier2DComponent* notifierComp) {
+    const SkaTransformModel2D* globalTransform = cre_scene_manager_get_scene_node_global_transform(entity, transformComp);
+    const f32 scaleX = fabsf(globalTransform->scale.x);
+    const f32 scaleY = fabsf(globalTransform->scale.y);
+    return (SkaRect2){
+        .x = globalTransform->position.x + notifierComp->rect.x * scaleX,
+        .y = globalTransform->position.y + notifierComp->rect.y * scaleY,
+        .w = notifierComp->rect.w * scaleX,
+        .h = notifierComp->rect.h * scaleY
+    };
+}
+
+static void visibility_notifier_update_grid_rect(SkaEntity entity, Transform2DComponent* transformComp, const VisibilityNotifier2DComponent* notifierComp) {
+    const SkaRect2 worldRect = visibility_notifier_get_world_rect(entity, transformComp, notifierComp);
+    cre_spatial_grid_insert_or_update(&notifierGrid, entity, &worldRect);
+}
+
+void on_ec_system_registered(SkaECSSystem* system) {
+    cre_component_view_initialize(&notifierView, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX }, 2);
+    cre_spatial_grid_initialize(&notifierGrid, CRE_VISIBILITY_NOTIFIER_GRID_CELL_SIZE);
+    cre_entity_paged_array_initialize(&notifierVisibleFrameStamps, sizeof(uint32), NULL);
+    currentFrameStamp = 0;
+}
+
+void on_ec_system_destroyed(SkaECSSystem* system) {
+    cre_component_view_finalize(&notifierView);
+    cre_spatial_grid_finalize(&notifierGrid);
+    cre_entity_paged_array_finalize(&notifierVisibleFrameStamps);
+    free(onScreenEntities);
+    onScreenEntities = NULL;
+    onScreenEntityCount = onScreenEntityCapacity = 0;
+    free(enteredEntities);
+    enteredEntities = NULL;
+    enteredEntityCount = enteredEntityCapacity = 0;
+}
+
+void on_entity_registered(SkaECSSystem* system, SkaEntity entity) {
+    cre_component_view_add_entity(&notifierView, entity);
+}
+
+void on_entity_unregistered(SkaECSSystem* system, SkaEntity entity) {
+    const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, entity);
+    SKA_ASSERT(entry != NULL);
+    Transform2DComponent* transformComp = (Transform2DComponent*)entry->components[0];
+    ska_event_unregister_observer(&transformComp->onTransformChanged, &visibilityNotifierOnTransformChangeObserver);
+    cre_spatial_grid_remove(&notifierGrid, entity);
+    visibility_notifier_remove_on_screen_entity(entity);
+    cre_entity_paged_array_release(&notifierVisibleFrameStamps, entity);
+    cre_scene_manager_set_node_off_screen_suspended(entity, false);
+    cre_component_view_remove_entity(&notifierView, entity);
+}
+
+void on_entity_entered_scene(SkaECSSystem* system, SkaEntity entity) {
+    const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, entity);
+    Transform2DComponent* transformComp = (Transform2DComponent*)entry->components[0];
+    VisibilityNotifier2DComponent* notifierComp = (VisibilityNotifier2DComponent*)entry->components[1];
+    visibility_notifier_update_grid_rect(entity, transformComp, notifierComp);
+    ska_event_register_observer(&transformComp->onTransformChanged, &visibilityNotifierOnTransformChangeObserver);
+    // Off screen until the first check finds it so the subtree doesn't process a frame it shouldn't
+    notifierComp->isOnScreen = false;
+    cre_scene_manager_set_node_off_screen_suspended(entity, notifierComp->suspendWhenOffScreen);
+}
+
+static void visibility_notifier_on_query_result(SkaEntity entity, void* userData) {
+    if (cre_scene_manager_is_entity_pooled(entity)) {
+        return;
+    }
+    *(uint32*)cre_entity_paged_array_get_or_create(&notifierVisibleFrameStamps, entity) = currentFrameStamp;
+    const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, entity);
+    if (!((VisibilityNotifier2DComponent*)entry->components[1])->isOnScreen) {
+        visibility_notifier_push_entity(&enteredEntities, &enteredEntityCount, &enteredEntityCapacity, entity);
+    }
+}
+
+void ec_system_update(SkaECSSystem* system, f32 deltaTime) {
+    if (cre_component_view_get_entity_count(&notifierView) == 0 && onScreenEntityCount == 0) {
+        return;
+    }
+    // Stamp 0 is what entities that were never on screen start with, skip it when wrapping around
+    currentFrameStamp = currentFrameStamp + 1 != 0 ? currentFrameStamp + 1 : 1;
+
+    const CRECamera2D* camera2D = cre_camera_manager_get_current_camera();
+    const CREGameProperties* gameProps = cre_game_props_get();
+    const SkaRect2 cameraRect = {
+        .x = camera2D->viewport.x - camera2D->offset.x,
+        .y = camera2D->viewport.y - camera2D->offset.y,
+        .w = (f32)gameProps->resolutionWidth / camera2D->zoom.x,
+        .h = (f32)gameProps->resolutionHeight / camera2D->zoom.y
+    };
+    enteredEntityCount = 0;
+    cre_spatial_grid_query(&notifierGrid, &cameraRect, visibility_notifier_on_query_result, NULL);
+
+    // Exits first, the entered entities are appended to the on screen list after
+    for (uint32 i = 0; i < onScreenEntityCount;) {
+        SkaEntity entity = onScreenEntities[i];
+        const uint32* visibleFrameStamp = (uint32*)cre_entity_paged_array_get(&notifierVisibleFrameStamps, entity);
+        if (visibleFrameStamp != NULL && *visibleFrameStamp == currentFrameStamp) {
+            i++;
+            continue;
+        }
+        onScreenEntities[i] = onScreenEntities[--onScreenEntityCount];
+        VisibilityNotifier2DComponent* notifierComp = (VisibilityNotifier2DComponent*)cre_component_view_get_entry(&notifierView, entity)->components[1];
+        notifierComp->isOnScreen = false;
+        if (notifierComp->suspendWhenOffScreen) {
+            cre_scene_manager_set_node_off_screen_suspended(entity, true);
+        }
+        ska_event_notify_observers(&notifierComp->onScreenExited, &(SkaSubjectNotifyPayload){ .data = &entity });
+    }
+
+    for (uint32 i = 0; i < enteredEntityCount; i++) {
+        SkaEntity entity = enteredEntities[i];
+        const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, entity);
+        // An observer of an earlier event could have removed the component
+        if (entry == NULL) {
+            continue;
+        }
+        VisibilityNotifier2DComponent* notifierComp = (VisibilityNotifier2DComponent*)entry->components[1];
+        notifierComp->isOnScreen = true;
+        visibility_notifier_push_entity(&onScreenEntities, &onScreenEntityCount, &onScreenEntityCapacity, entity);
+        cre_scene_manager_set_node_off_screen_suspended(entity, false);
+        ska_event_notify_observers(&notifierComp->onScreenEntered, &(SkaSubjectNotifyPayload){ .data = &entity });
+    }
+}
+
+void visibility_notifier_on_transform_update(SkaSubjectNotifyPayload* payload) {
+    CreComponentEntityUpdatePayload* updatePayload = (CreComponentEntityUpdatePayload*)payload->data;
+    const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, updatePayload->entity);
+    if (entry != NULL) {
+        visibility_notifier_update_grid_rect(updatePayload->entity, (Transform2DComponent*)entry->components[0], (VisibilityNotifier2DComponent*)entry->components[1]);
+    }
+}
+
+void cre_visibility_notifier_ec_system_refresh_notifier(SkaEntity entity) {
+    const CreComponentViewEntry* entry = cre_component_view_get_entry(&notifierView, entity);
+    if (entry == NULL || !cre_spatial_grid_has_entity(&notifierGrid, entity)) {
+        return;
+    }
+    VisibilityNotifier2DComponent* notifierComp = (VisibilityNotifier2DComponent*)entry->components[1];
+    visibility_notifier_update_grid_rect(entity, (Transform2DComponent*)entry->components[0], notifierComp);
+    cre_scene_manager_set_node_off_screen_suspended(entity, notifierComp->suspendWhenOffScreen && !notifierComp->isOnScreen);
+}
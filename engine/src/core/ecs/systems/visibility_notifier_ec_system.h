@@ -0,0 +1,11 @@
+#pragma once
+
+#include <seika/ecs/entity.h>
+
+// Tests every visibility notifier against the current camera once per update by querying a spatial grid of notifier rects
+// (kept up to date from transform changed events) with the camera's world rect.  Enter/exit events fire on changes and
+// notifiers with 'suspendWhenOffScreen' suspend their node's subtree while they're off screen.
+
+void cre_visibility_notifier_ec_system_create_and_register();
+// Call after changing a notifier's rect or 'suspendWhenOffScreen' outside a scene file
+void cre_visibility_notifier_ec_system_refresh_notifier(SkaEntity entity);
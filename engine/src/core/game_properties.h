@@ -42,12 +42,22 @@ static struct CreAssetFontDefault CRE_DEFAULT_FONT_ASSET = {
 };
 
 #define CRE_INPUT_VALUES_LIMIT 8
+#define CRE_INPUT_MAX_DELAY_FRAMES 15
+
+// How an action is predicted for frames whose input hasn't been confirmed yet
+typedef enum CREInputPredictionPolicy {
+    CREInputPredictionPolicy_REPEAT_LAST = 0, // Last confirmed state (good for directional inputs)
+    CREInputPredictionPolicy_NEUTRAL = 1, // Always released (good for attack buttons)
+    CREInputPredictionPolicy_HELD = 2, // Stays pressed only if it was held for more than one confirmed frame, taps are released
+} CREInputPredictionPolicy;
 
 typedef struct CREInputAction {
     char* name;
     int32 deviceId;
     size_t valueCount;
     char* values[CRE_INPUT_VALUES_LIMIT];
+    CREInputPredictionPolicy predictionPolicy;
+    int32 inputDelay; // Frames before local input takes effect
 } CREInputAction;
 
 #define CRE_PROPERTIES_ASSET_LIMIT 128
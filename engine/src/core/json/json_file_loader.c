@@ -1,5 +1,7 @@
 #include "json_file_loader.h"
 
+#include <string.h>
+
 #include <seika/string.h>
 #include <seika/logger.h>
 #include <seika/memory.h>
@@ -69,6 +71,18 @@ void cre_json_configure_inputs(cJSON* configJson, CREGameProperties* properties)
         inputAction->name = json_get_string_new(inputJson, "name");
         inputAction->deviceId = json_get_int_default(inputJson, "device_id", 0);
         ska_logger_debug("Input Action -  name: '%s', device_id: '%d'", inputAction->name, inputAction->deviceId);
+        char* predictionPolicy = json_get_string_default_new(inputJson, "prediction", "repeat_last");
+        if (strcmp(predictionPolicy, "neutral") == 0) {
+            inputAction->predictionPolicy = CREInputPredictionPolicy_NEUTRAL;
+        } else if (strcmp(predictionPolicy, "held") == 0) {
+            inputAction->predictionPolicy = CREInputPredictionPolicy_HELD;
+        } else {
+            SKA_ASSERT_FMT(strcmp(predictionPolicy, "repeat_last") == 0, "Invalid prediction '%s' for input action '%s', expected 'repeat_last', 'neutral' or 'held'", predictionPolicy, inputAction->name);
+            inputAction->predictionPolicy = CREInputPredictionPolicy_REPEAT_LAST;
+        }
+        SKA_FREE(predictionPolicy);
+        inputAction->inputDelay = ska_math_clamp_int(json_get_int_default(inputJson, "input_delay", 0), 0, CRE_INPUT_MAX_DELAY_FRAMES);
+        ska_logger_debug("Input Action -  prediction: '%d', input_delay: '%d'", inputAction->predictionPolicy, inputAction->inputDelay);
         cJSON* valuesJsonArray = cJSON_GetObjectItemCaseSensitive(inputJson, "values");
         cJSON* valueJson = NULL;
         cJSON_ArrayForEach(valueJson, valuesJsonArray) {
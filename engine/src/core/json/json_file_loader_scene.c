@@ -19,6 +19,7 @@
 #include "../ecs/components/parallax_component.h"
 #include "../ecs/components/particles2d_component.h"
 #include "../ecs/components/tilemap_component.h"
+#include "../ecs/components/visibility_notifier2d_component.h"
 
 typedef struct ShaderInstancePaths {
     char* shader;
@@ -57,6 +58,35 @@ void json_node_set_shader_instance_paths(JsonSceneNode* node, cJSON* componentJs
     }
 }
 
+// Returns NULL if the node doesn't list any tags (e.g. '"tags": null'), otherwise an array list of owned strings
+SkaArrayList* cre_json_load_tags(cJSON* nodeJson) {
+    cJSON* tagsJsonArray = cJSON_GetObjectItemCaseSensitive(nodeJson, "tags");
+    if (!cJSON_IsArray(tagsJsonArray) || cJSON_GetArraySize(tagsJsonArray) == 0) {
+        return NULL;
+    }
+    SkaArrayList* tags = ska_array_list_create(sizeof(char*), (size_t)cJSON_GetArraySize(tagsJsonArray));
+    cJSON* tagJson = NULL;
+    cJSON_ArrayForEach(tagJson, tagsJsonArray) {
+        if (cJSON_IsString(tagJson)) {
+            char* tag = ska_strdup(tagJson->valuestring);
+            ska_array_list_push_back(tags, &tag);
+        } else {
+            ska_logger_error("Node tags should be strings, skipping invalid tag!");
+        }
+    }
+    return tags;
+}
+
+void cre_json_delete_tags(SkaArrayList* tags) {
+    if (tags == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < tags->size; i++) {
+        SKA_FREE(*(char**)ska_array_list_get(tags, i));
+    }
+    ska_array_list_destroy(tags);
+}
+
 //--- Scene Files ---//
 
 /*
@@ -123,9 +153,16 @@ void cre_json_delete_json_scene_node(JsonSceneNode* node) {
         particles2d_component_delete(node->components[PARTICLES2D_COMPONENT_INDEX]);
     }
     if (node->components[TILEMAP_COMPONENT_INDEX]) {
-        tilemap_component_delete(node->components[TILEMAP_COMPONENT_INDEX]);
+        TilemapComponent* tilemapComponent = (TilemapComponent*)node->components[TILEMAP_COMPONENT_INDEX];
+        cre_tilemap_finalize(tilemapComponent->tilemap);
+        SKA_FREE(tilemapComponent->tilemap);
+        tilemap_component_delete(tilemapComponent);
+    }
+    if (node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX]) {
+        visibility_notifier2d_component_delete(node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX]);
     }
 
+    cre_json_delete_tags(node->tags);
     SKA_FREE(node->shaderInstanceShaderPath);
     SKA_FREE(node->shaderInstanceVertexPath);
     SKA_FREE(node->shaderInstanceFragmentPath);
@@ -421,6 +458,23 @@ static void cre_json_tilemap_create_or_set_default(JsonSceneNode* node, cJSON* c
     ska_logger_debug("Tilemap");
 }
 
+static void cre_json_visibility_notifier2d_create_or_set_default(JsonSceneNode* node, cJSON* componentJson) {
+    VisibilityNotifier2DComponent* visibilityNotifier2DComponent = NULL;
+    if (node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX] == NULL) {
+        visibilityNotifier2DComponent = visibility_notifier2d_component_create();
+        visibilityNotifier2DComponent->rect = json_get_rect2_default(componentJson, "rect", DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_RECT);
+        visibilityNotifier2DComponent->suspendWhenOffScreen = json_get_bool_default(componentJson, "suspend_when_off_screen", DEFAULT_COMPONENT_VISIBILITY_NOTIFIER2D_SUSPEND_WHEN_OFF_SCREEN);
+        node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX] = visibilityNotifier2DComponent;
+    } else {
+        visibilityNotifier2DComponent = (VisibilityNotifier2DComponent*)node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX];
+        visibilityNotifier2DComponent->rect = json_get_rect2_default(componentJson, "rect", visibilityNotifier2DComponent->rect);
+        visibilityNotifier2DComponent->suspendWhenOffScreen = json_get_bool_default(componentJson, "suspend_when_off_screen", visibilityNotifier2DComponent->suspendWhenOffScreen);
+    }
+    ska_logger_debug("VisibilityNotifier2D\nrect: (%f, %f, %f, %f)\nsuspend_when_off_screen: %s",
+                    visibilityNotifier2DComponent->rect.x, visibilityNotifier2DComponent->rect.y, visibilityNotifier2DComponent->rect.w,
+                    visibilityNotifier2DComponent->rect.h, visibilityNotifier2DComponent->suspendWhenOffScreen ? "true" : "false");
+}
+
 // Recursive
 void cre_json_set_all_child_nodes_from_external_source(JsonSceneNode* node) {
     node->fromExternalNodeSource = true;
@@ -445,7 +499,12 @@ JsonSceneNode* cre_json_load_scene_node(cJSON* nodeJson, JsonSceneNode* parentNo
     }
     node->name = json_get_string_new(nodeJson, "name");
     node->type = node_get_base_type(json_get_string(nodeJson, "type"));
-    node->tags = NULL;
+    // Tags from an external node source are kept unless this node lists its own
+    SkaArrayList* tags = cre_json_load_tags(nodeJson);
+    if (tags != NULL) {
+        cre_json_delete_tags(node->tags);
+        node->tags = tags;
+    }
     node->parent = parentNode;
     node->externalNodeSource = externalSceneNodeString;
     ska_logger_debug("Node Name: '%s', Base Type: '%s'", node->name, node_get_base_type_string(node->type));
@@ -481,6 +540,8 @@ JsonSceneNode* cre_json_load_scene_node(cJSON* nodeJson, JsonSceneNode* parentNo
             cre_json_particles2d_create_or_set_default(node, componentJson);
         } else if (strcmp(componentType, "tilemap") == 0) {
             cre_json_tilemap_create_or_set_default(node, componentJson);
+        } else if (strcmp(componentType, "visibility_notifier2d") == 0) {
+            cre_json_visibility_notifier2d_create_or_set_default(node, componentJson);
         } else {
             ska_logger_error("component type '%s' in invalid!", componentType);
         }
@@ -0,0 +1,31 @@
+#include "random.h"
+
+// Xorshift gets stuck on a zero state
+#define CRE_RANDOM_ZERO_SEED_STATE 0x9E3779B9u
+
+static uint32 randomState = CRE_RANDOM_ZERO_SEED_STATE;
+
+void cre_random_seed(uint32 seed) {
+    randomState = seed != 0 ? seed : CRE_RANDOM_ZERO_SEED_STATE;
+}
+
+uint32 cre_random_next() {
+    uint32 x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+uint32 cre_random_range(uint32 max) {
+    return max > 0 ? cre_random_next() % max : 0;
+}
+
+uint32 cre_random_get_state() {
+    return randomState;
+}
+
+void cre_random_set_state(uint32 state) {
+    cre_random_seed(state);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <seika/defines.h>
+
+// Engine owned random number generator (xorshift32).  Used instead of 'rand()' so the state can be saved in world
+// snapshots, restoring a keyframe brings back the same random numbers that straight playback would get.
+
+void cre_random_seed(uint32 seed);
+uint32 cre_random_next();
+// Returns a value in [0, max)
+uint32 cre_random_range(uint32 max);
+uint32 cre_random_get_state();
+void cre_random_set_state(uint32 state);
+
+#ifdef __cplusplus
+}
+#endif
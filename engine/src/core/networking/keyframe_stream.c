@@ -0,0 +1,164 @@
+#include "keyframe_stream.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/memory.h>
+#include <seika/logger.h>
+
+static size_t base64_encode(const uint8* data, size_t size, char* out);
+static size_t base64_decode(const char* text, uint8* out, size_t outCapacity);
+
+static inline size_t keyframe_stream_get_chunk_size(size_t encodedSize, uint32 chunkIndex) {
+    const size_t offset = (size_t)chunkIndex * CRE_KEYFRAME_STREAM_CHUNK_SIZE;
+    return encodedSize - offset < CRE_KEYFRAME_STREAM_CHUNK_SIZE ? encodedSize - offset : CRE_KEYFRAME_STREAM_CHUNK_SIZE;
+}
+
+uint32 cre_keyframe_stream_get_chunk_count(const CreSnapshotDelta* keyframe) {
+    return (uint32)((keyframe->size + CRE_KEYFRAME_STREAM_CHUNK_SIZE - 1) / CRE_KEYFRAME_STREAM_CHUNK_SIZE);
+}
+
+bool cre_keyframe_stream_write_chunk(const CreSnapshotDelta* keyframe, uint32 chunkIndex, const char* prefix, char* out, size_t outSize) {
+    const size_t offset = (size_t)chunkIndex * CRE_KEYFRAME_STREAM_CHUNK_SIZE;
+    const size_t chunkSize = keyframe_stream_get_chunk_size(keyframe->size, chunkIndex);
+    const int headerLength = snprintf(out, outSize, "%s %u %u %u %zu %zu %u %u ", prefix, keyframe->frame, keyframe->entityCount,
+                                      keyframe->randomState, keyframe->decodedSize, keyframe->size, chunkIndex, cre_keyframe_stream_get_chunk_count(keyframe));
+    // Base64 output plus null terminator
+    if (headerLength < 0 || (size_t)headerLength + (chunkSize + 2) / 3 * 4 + 1 > outSize) {
+        return false;
+    }
+    base64_encode(keyframe->data + offset, chunkSize, out + headerLength);
+    return true;
+}
+
+CreKeyframeAssembler* cre_keyframe_assembler_create() {
+    CreKeyframeAssembler* assembler = SKA_ALLOC_ZEROED(CreKeyframeAssembler);
+    assembler->keyframe = cre_snapshot_delta_create();
+    return assembler;
+}
+
+void cre_keyframe_assembler_delete(CreKeyframeAssembler* assembler) {
+    cre_snapshot_delta_delete(assembler->keyframe);
+    SKA_FREE(assembler);
+}
+
+void cre_keyframe_assembler_reset(CreKeyframeAssembler* assembler) {
+    assembler->chunkCount = 0;
+    assembler->chunksReceived = 0;
+}
+
+bool cre_keyframe_assembler_is_in_progress(const CreKeyframeAssembler* assembler) {
+    return assembler->chunkCount > 0;
+}
+
+CreKeyframeChunkResult cre_keyframe_assembler_add_chunk(CreKeyframeAssembler* assembler, const char* chunk) {
+    uint32 frame, entityCount, randomState, chunkIndex, chunkCount;
+    size_t decodedSize, encodedSize;
+    int payloadOffset = 0;
+    if (sscanf(chunk, "%u %u %u %zu %zu %u %u %n", &frame, &entityCount, &randomState, &decodedSize, &encodedSize, &chunkIndex, &chunkCount, &payloadOffset) != 7) {
+        ska_logger_warn("Received keyframe chunk with an invalid header!");
+        return CreKeyframeChunkResult_INVALID;
+    }
+    if (encodedSize == 0 || encodedSize > CRE_KEYFRAME_STREAM_MAX_ENCODED_SIZE || decodedSize > CRE_KEYFRAME_STREAM_MAX_DECODED_SIZE
+        || chunkCount != (encodedSize + CRE_KEYFRAME_STREAM_CHUNK_SIZE - 1) / CRE_KEYFRAME_STREAM_CHUNK_SIZE || chunkIndex >= chunkCount) {
+        ska_logger_warn("Received keyframe chunk '%u/%u' for frame '%u' with invalid sizes (encoded = %zu, decoded = %zu)!", chunkIndex, chunkCount, frame, encodedSize, decodedSize);
+        return CreKeyframeChunkResult_INVALID;
+    }
+    CreSnapshotDelta* keyframe = assembler->keyframe;
+    if (assembler->chunkCount > 0 && keyframe->frame == frame) {
+        if (keyframe->entityCount != entityCount || keyframe->randomState != randomState || keyframe->decodedSize != decodedSize || keyframe->size != encodedSize || assembler->chunkCount != chunkCount) {
+            ska_logger_warn("Received keyframe chunk for frame '%u' that doesn't match the keyframe being received!", frame);
+            return CreKeyframeChunkResult_INVALID;
+        }
+    } else {
+        // New keyframe, drops whatever was being put together
+        if (keyframe->capacity < encodedSize) {
+            uint8* newData = (uint8*)realloc(keyframe->data, encodedSize);
+            if (!newData) {
+                ska_logger_error("Failed to allocate '%zu' bytes for keyframe at frame '%u'!", encodedSize, frame);
+                cre_keyframe_assembler_reset(assembler);
+                return CreKeyframeChunkResult_INVALID;
+            }
+            keyframe->data = newData;
+            keyframe->capacity = encodedSize;
+        }
+        memset(assembler->chunkFlags, 0, sizeof(bool) * chunkCount);
+        assembler->chunkCount = chunkCount;
+        assembler->chunksReceived = 0;
+        keyframe->size = encodedSize;
+        keyframe->decodedSize = decodedSize;
+        keyframe->frame = frame;
+        keyframe->baseFrame = 0;
+        keyframe->entityCount = entityCount;
+        keyframe->randomState = randomState;
+    }
+    if (assembler->chunkFlags[chunkIndex]) {
+        return CreKeyframeChunkResult_INCOMPLETE;
+    }
+    // Payload has to decode to exactly the bytes this chunk covers
+    const char* payload = chunk + payloadOffset;
+    const size_t offset = (size_t)chunkIndex * CRE_KEYFRAME_STREAM_CHUNK_SIZE;
+    const size_t chunkSize = keyframe_stream_get_chunk_size(encodedSize, chunkIndex);
+    if (strlen(payload) != (chunkSize + 2) / 3 * 4 || base64_decode(payload, keyframe->data + offset, chunkSize) != chunkSize) {
+        ska_logger_warn("Received keyframe chunk '%u/%u' for frame '%u' with an invalid payload!", chunkIndex, chunkCount, frame);
+        return CreKeyframeChunkResult_INVALID;
+    }
+    assembler->chunkFlags[chunkIndex] = true;
+    assembler->chunksReceived++;
+    if (assembler->chunksReceived < assembler->chunkCount) {
+        return CreKeyframeChunkResult_INCOMPLETE;
+    }
+    cre_keyframe_assembler_reset(assembler);
+    return CreKeyframeChunkResult_COMPLETE;
+}
+
+//--- Base64 ---//
+
+static const char* base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+size_t base64_encode(const uint8* data, size_t size, char* out) {
+    size_t outIndex = 0;
+    for (size_t i = 0; i < size; i += 3) {
+        const uint32 octetA = data[i];
+        const uint32 octetB = i + 1 < size ? data[i + 1] : 0;
+        const uint32 octetC = i + 2 < size ? data[i + 2] : 0;
+        const uint32 triple = (octetA << 16) | (octetB << 8) | octetC;
+        out[outIndex++] = base64Chars[(triple >> 18) & 0x3F];
+        out[outIndex++] = base64Chars[(triple >> 12) & 0x3F];
+        out[outIndex++] = i + 1 < size ? base64Chars[(triple >> 6) & 0x3F] : '=';
+        out[outIndex++] = i + 2 < size ? base64Chars[triple & 0x3F] : '=';
+    }
+    out[outIndex] = '\0';
+    return outIndex;
+}
+
+static inline int32 base64_char_value(char c) {
+    if (c >= 'A' && c <= 'Z') { return c - 'A'; }
+    if (c >= 'a' && c <= 'z') { return c - 'a' + 26; }
+    if (c >= '0' && c <= '9') { return c - '0' + 52; }
+    if (c == '+') { return 62; }
+    if (c == '/') { return 63; }
+    return -1;
+}
+
+size_t base64_decode(const char* text, uint8* out, size_t outCapacity) {
+    size_t outIndex = 0;
+    uint32 accumulator = 0;
+    int32 bits = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        const int32 value = base64_char_value(*c);
+        if (value < 0) {
+            break;
+        }
+        accumulator = (accumulator << 6) | (uint32)value;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if (outIndex < outCapacity) {
+                out[outIndex++] = (uint8)((accumulator >> bits) & 0xFF);
+            }
+        }
+    }
+    return outIndex;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+#include "../snapshot/snapshot_delta.h"
+
+// Splits an encoded world keyframe into text chunks small enough for a single udp message and puts them back together.
+// Chunk layout is '<frame> <entityCount> <randomState> <decodedSize> <encodedSize> <chunkIndex> <chunkCount> <base64 bytes>', every
+// chunk repeats the header so they can arrive in any order.  Chunks come from the network so the assembler rejects
+// anything that doesn't match the keyframe being put together or would write out of bounds.
+
+// Raw keyframe bytes per chunk, base64 makes it ~4/3 the size on the wire
+#define CRE_KEYFRAME_STREAM_CHUNK_SIZE 512
+#define CRE_KEYFRAME_STREAM_MAX_CHUNKS 768
+#define CRE_KEYFRAME_STREAM_MAX_ENCODED_SIZE (CRE_KEYFRAME_STREAM_CHUNK_SIZE * CRE_KEYFRAME_STREAM_MAX_CHUNKS)
+#define CRE_KEYFRAME_STREAM_MAX_DECODED_SIZE (64 * 1024 * 1024)
+
+typedef enum CreKeyframeChunkResult {
+    CreKeyframeChunkResult_INVALID = 0,
+    CreKeyframeChunkResult_INCOMPLETE = 1,
+    CreKeyframeChunkResult_COMPLETE = 2,
+} CreKeyframeChunkResult;
+
+typedef struct CreKeyframeAssembler {
+    CreSnapshotDelta* keyframe;
+    uint32 chunkCount; // Zero when no keyframe is being put together
+    uint32 chunksReceived;
+    bool chunkFlags[CRE_KEYFRAME_STREAM_MAX_CHUNKS];
+} CreKeyframeAssembler;
+
+uint32 cre_keyframe_stream_get_chunk_count(const CreSnapshotDelta* keyframe);
+// Writes '<prefix> <chunk>' into 'out', returns false if it doesn't fit
+bool cre_keyframe_stream_write_chunk(const CreSnapshotDelta* keyframe, uint32 chunkIndex, const char* prefix, char* out, size_t outSize);
+
+CreKeyframeAssembler* cre_keyframe_assembler_create();
+void cre_keyframe_assembler_delete(CreKeyframeAssembler* assembler);
+// Drops the keyframe being put together
+void cre_keyframe_assembler_reset(CreKeyframeAssembler* assembler);
+bool cre_keyframe_assembler_is_in_progress(const CreKeyframeAssembler* assembler);
+// 'chunk' is the text following the message prefix.  Once complete the encoded keyframe is in 'assembler->keyframe'.
+CreKeyframeChunkResult cre_keyframe_assembler_add_chunk(CreKeyframeAssembler* assembler, const char* chunk);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,445 @@
+#include "spectator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL.h>
+
+#include <seika/assert.h>
+#include <seika/logger.h>
+#include <seika/networking/network.h>
+
+#include "../replay/replay.h"
+#include "../snapshot/world_snapshot.h"
+#include "../snapshot/snapshot_delta.h"
+#include "keyframe_stream.h"
+
+#define CRE_SPECTATOR_MESSAGE_SIZE 1024
+// Has to hold a whole keyframe (up to 'CRE_KEYFRAME_STREAM_MAX_CHUNKS' messages) plus the inputs received in the same frame
+#define CRE_SPECTATOR_MESSAGE_QUEUE_SIZE 1024
+
+#define CRE_SPECTATOR_MSG_JOIN "@spec:join"
+#define CRE_SPECTATOR_MSG_INPUT "@spec:in"
+#define CRE_SPECTATOR_MSG_KEYFRAME "@spec:kf"
+#define CRE_SPECTATOR_MSG_DESYNC "@spec:desync"
+// Checksums received ahead of the spectator simulating (and confirming) their frame
+#define CRE_SPECTATOR_PENDING_CHECKSUM_LIMIT 8
+
+typedef enum CreSpectatorRole {
+    CreSpectatorRole_NONE = 0,
+    CreSpectatorRole_BROADCASTER = 1,
+    CreSpectatorRole_SPECTATOR = 2,
+} CreSpectatorRole;
+
+typedef struct CreSpectatorMessageQueue {
+    char messages[CRE_SPECTATOR_MESSAGE_QUEUE_SIZE][CRE_SPECTATOR_MESSAGE_SIZE];
+    size_t head;
+    size_t count;
+    uint32 droppedCount; // Messages received while the queue was full since the last update
+    SDL_Mutex* mutex;
+} CreSpectatorMessageQueue;
+
+typedef struct CreSpectatorPendingChecksum {
+    uint32 frame;
+    uint32 checksum;
+} CreSpectatorPendingChecksum;
+
+typedef struct CreSpectator {
+    CreSpectatorRole role;
+    CreSpectatorMessageQueue queue;
+    // Broadcaster
+    uint32 nextFrameToSend;
+    CreWorldSnapshot* keyframeSnapshot;
+    CreSnapshotDelta* keyframeEncoded;
+    bool hasKeyframe;
+    // Spectator
+    CreKeyframeAssembler* keyframeAssembler;
+    CreWorldSnapshot* incomingSnapshot;
+    bool isCatchUpRefused;
+    bool isResyncRequested; // Asked for a keyframe after a rollback that couldn't be undone
+    CreSpectatorPendingChecksum pendingChecksums[CRE_SPECTATOR_PENDING_CHECKSUM_LIMIT];
+    size_t pendingChecksumCount;
+    CreSpectatorStats stats;
+} CreSpectator;
+
+static CreSpectator spectator = {0};
+
+static void spectator_on_network_message(const char* message);
+static void spectator_send(const char* message);
+static void spectator_reset();
+static void broadcaster_process_message(const char* message);
+static void broadcaster_capture_keyframe();
+static void broadcaster_send_keyframe();
+static void broadcaster_send_inputs(uint32 startFrame, uint32 endFrame);
+static void spectator_process_message(const char* message);
+static void spectator_process_input_message(const char* message);
+static void spectator_process_keyframe_message(const char* message);
+static void spectator_compare_pending_checksums();
+static void spectator_process_dropped_messages();
+
+bool cre_spectator_server_start(int32 port) {
+    cre_spectator_stop();
+    spectator.queue.mutex = SDL_CreateMutex();
+    spectator.role = CreSpectatorRole_BROADCASTER;
+    spectator.keyframeSnapshot = cre_world_snapshot_create();
+    spectator.keyframeEncoded = cre_snapshot_delta_create();
+    // Confirmed inputs come from the replay recording, keep one in memory if one isn't being written to disk
+    if (cre_replay_get_mode() != CreReplayMode_RECORDING) {
+        cre_replay_start_recording(NULL);
+    }
+    spectator.nextFrameToSend = cre_replay_get_frame_count();
+    cre_replay_set_checksums_enabled(true);
+    if (!ska_udp_server_initialize(port, spectator_on_network_message)) {
+        ska_logger_error("Failed to start spectator server on port '%d'!", port);
+        cre_spectator_stop();
+        return false;
+    }
+    ska_logger_info("Spectator server started on port '%d'", port);
+    return true;
+}
+
+bool cre_spectator_client_start(const char* host, int32 port) {
+    cre_spectator_stop();
+    spectator.queue.mutex = SDL_CreateMutex();
+    spectator.role = CreSpectatorRole_SPECTATOR;
+    spectator.keyframeAssembler = cre_keyframe_assembler_create();
+    spectator.incomingSnapshot = cre_world_snapshot_create();
+    cre_replay_start_stream_playback();
+    cre_replay_set_checksums_enabled(true);
+    if (!ska_udp_client_initialize(host, port, spectator_on_network_message)) {
+        ska_logger_error("Failed to connect spectator client to '%s:%d'!", host, port);
+        cre_spectator_stop();
+        return false;
+    }
+    spectator_send(CRE_SPECTATOR_MSG_JOIN);
+    ska_logger_info("Spectating '%s:%d'", host, port);
+    return true;
+}
+
+void cre_spectator_stop() {
+    if (spectator.role == CreSpectatorRole_BROADCASTER) {
+        ska_udp_server_finalize();
+    } else if (spectator.role == CreSpectatorRole_SPECTATOR) {
+        ska_udp_client_finalize();
+        cre_replay_stop();
+    }
+    spectator_reset();
+}
+
+bool cre_spectator_is_active() {
+    return spectator.role != CreSpectatorRole_NONE;
+}
+
+void cre_spectator_update() {
+    if (spectator.role == CreSpectatorRole_NONE) {
+        return;
+    }
+    static char message[CRE_SPECTATOR_MESSAGE_SIZE];
+    while (true) {
+        SDL_LockMutex(spectator.queue.mutex);
+        const bool hasMessage = spectator.queue.count > 0;
+        if (hasMessage) {
+            memcpy(message, spectator.queue.messages[spectator.queue.head], CRE_SPECTATOR_MESSAGE_SIZE);
+            spectator.queue.head = (spectator.queue.head + 1) % CRE_SPECTATOR_MESSAGE_QUEUE_SIZE;
+            spectator.queue.count--;
+        }
+        SDL_UnlockMutex(spectator.queue.mutex);
+        if (!hasMessage) {
+            break;
+        }
+        if (spectator.role == CreSpectatorRole_BROADCASTER) {
+            broadcaster_process_message(message);
+        } else {
+            spectator_process_message(message);
+        }
+    }
+    spectator_process_dropped_messages();
+    if (spectator.role == CreSpectatorRole_SPECTATOR) {
+        if (spectator.isCatchUpRefused) {
+            cre_spectator_stop();
+            return;
+        }
+        spectator_compare_pending_checksums();
+        if (cre_replay_is_waiting_for_resync() && !spectator.isResyncRequested) {
+            spectator_send(CRE_SPECTATOR_MSG_JOIN);
+            spectator.stats.resyncRequests++;
+            spectator.isResyncRequested = true;
+        }
+    }
+}
+
+void cre_spectator_on_fixed_update_end() {
+    if (spectator.role != CreSpectatorRole_BROADCASTER || cre_replay_is_seeking()) {
+        return;
+    }
+    const uint32 confirmedFrameCount = cre_replay_get_frame_count();
+    // Keyframe holds the state at the start of 'confirmedFrameCount'
+    if (confirmedFrameCount % CRE_SPECTATOR_KEYFRAME_INTERVAL == 0) {
+        broadcaster_capture_keyframe();
+        broadcaster_send_keyframe();
+    }
+    if (confirmedFrameCount - spectator.nextFrameToSend >= CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE) {
+        broadcaster_send_inputs(spectator.nextFrameToSend, confirmedFrameCount);
+        spectator.nextFrameToSend = confirmedFrameCount;
+    }
+}
+
+CreSpectatorStats cre_spectator_get_stats() {
+    return spectator.stats;
+}
+
+// Called from the network thread, only queue here
+void spectator_on_network_message(const char* message) {
+    if (strncmp(message, "@spec:", 6) != 0) {
+        return;
+    }
+    SDL_LockMutex(spectator.queue.mutex);
+    if (spectator.queue.count < CRE_SPECTATOR_MESSAGE_QUEUE_SIZE) {
+        const size_t tail = (spectator.queue.head + spectator.queue.count) % CRE_SPECTATOR_MESSAGE_QUEUE_SIZE;
+        strncpy(spectator.queue.messages[tail], message, CRE_SPECTATOR_MESSAGE_SIZE - 1);
+        spectator.queue.messages[tail][CRE_SPECTATOR_MESSAGE_SIZE - 1] = '\0';
+        spectator.queue.count++;
+    } else {
+        spectator.queue.droppedCount++;
+    }
+    SDL_UnlockMutex(spectator.queue.mutex);
+}
+
+void spectator_send(const char* message) {
+    if (spectator.role == CreSpectatorRole_BROADCASTER) {
+        ska_udp_server_send_message(message);
+    } else if (spectator.role == CreSpectatorRole_SPECTATOR) {
+        ska_udp_client_send_message(message);
+    }
+}
+
+void spectator_reset() {
+    if (spectator.queue.mutex) {
+        SDL_DestroyMutex(spectator.queue.mutex);
+    }
+    if (spectator.keyframeSnapshot) {
+        cre_world_snapshot_delete(spectator.keyframeSnapshot);
+    }
+    if (spectator.keyframeEncoded) {
+        cre_snapshot_delta_delete(spectator.keyframeEncoded);
+    }
+    if (spectator.keyframeAssembler) {
+        cre_keyframe_assembler_delete(spectator.keyframeAssembler);
+    }
+    if (spectator.incomingSnapshot) {
+        cre_world_snapshot_delete(spectator.incomingSnapshot);
+    }
+    spectator = (CreSpectator){0};
+}
+
+// Chunks of a keyframe that didn't make it into the queue won't be sent again unless asked for
+void spectator_process_dropped_messages() {
+    SDL_LockMutex(spectator.queue.mutex);
+    const uint32 droppedCount = spectator.queue.droppedCount;
+    spectator.queue.droppedCount = 0;
+    SDL_UnlockMutex(spectator.queue.mutex);
+    if (droppedCount == 0) {
+        return;
+    }
+    ska_logger_warn("Spectator message queue was full, dropped '%u' messages!", droppedCount);
+    spectator.stats.droppedMessages += droppedCount;
+    if (spectator.role == CreSpectatorRole_SPECTATOR && cre_keyframe_assembler_is_in_progress(spectator.keyframeAssembler)) {
+        cre_keyframe_assembler_reset(spectator.keyframeAssembler);
+        spectator_send(CRE_SPECTATOR_MSG_JOIN);
+        spectator.stats.resyncRequests++;
+    }
+}
+
+//--- Broadcaster ---//
+
+void broadcaster_process_message(const char* message) {
+    if (strcmp(message, CRE_SPECTATOR_MSG_JOIN) == 0) {
+        // Catch up, latest keyframe followed by every confirmed input since
+        if (!spectator.hasKeyframe) {
+            broadcaster_capture_keyframe();
+        }
+        broadcaster_send_keyframe();
+        broadcaster_send_inputs(spectator.keyframeSnapshot->frame, spectator.nextFrameToSend);
+        spectator.stats.resyncRequests++;
+    } else if (strncmp(message, CRE_SPECTATOR_MSG_DESYNC, strlen(CRE_SPECTATOR_MSG_DESYNC)) == 0) {
+        const uint32 frame = (uint32)strtoul(message + strlen(CRE_SPECTATOR_MSG_DESYNC), NULL, 10);
+        char dumpPath[64];
+        snprintf(dumpPath, sizeof(dumpPath), "desync_%u_broadcaster.crsnap", frame);
+        ska_logger_error("Spectator reported a desync at frame '%u'!", frame);
+        cre_replay_dump_checksum_frame(frame, dumpPath);
+        spectator.stats.desyncCount++;
+        spectator.stats.lastDesyncFrame = frame;
+    }
+}
+
+void broadcaster_capture_keyframe() {
+    cre_world_snapshot_capture(spectator.keyframeSnapshot, cre_replay_get_frame_count());
+    // Encoding against nothing still collapses the zero padding in component state
+    cre_snapshot_delta_encode(spectator.keyframeEncoded, NULL, spectator.keyframeSnapshot);
+    spectator.hasKeyframe = true;
+}
+
+void broadcaster_send_keyframe() {
+    static char message[CRE_SPECTATOR_MESSAGE_SIZE];
+    const CreSnapshotDelta* encoded = spectator.keyframeEncoded;
+    const uint32 chunkCount = cre_keyframe_stream_get_chunk_count(encoded);
+    if (chunkCount > CRE_KEYFRAME_STREAM_MAX_CHUNKS) {
+        ska_logger_error("Keyframe for frame '%u' is '%zu' bytes, over the '%u' bytes spectators can receive, not sending it!",
+                         encoded->frame, encoded->size, CRE_KEYFRAME_STREAM_MAX_ENCODED_SIZE);
+        return;
+    }
+    for (uint32 chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+        cre_keyframe_stream_write_chunk(encoded, chunkIndex, CRE_SPECTATOR_MSG_KEYFRAME, message, sizeof(message));
+        spectator_send(message);
+    }
+    spectator.stats.keyframesSent++;
+    spectator.stats.lastKeyframeBytes = encoded->size;
+}
+
+void broadcaster_send_inputs(uint32 startFrame, uint32 endFrame) {
+    static char message[CRE_SPECTATOR_MESSAGE_SIZE];
+    for (uint32 frame = startFrame; frame < endFrame; frame += CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE) {
+        const uint32 frameCount = endFrame - frame < CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE ? endFrame - frame : CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE;
+        int length = snprintf(message, sizeof(message), "%s %u %u", CRE_SPECTATOR_MSG_INPUT, frame, frameCount);
+        for (uint32 i = 0; i < frameCount; i++) {
+            length += snprintf(message + length, sizeof(message) - (size_t)length, " %llx", (unsigned long long)cre_replay_get_frame_input(frame + i));
+        }
+        // Piggyback the checksum of a confirmed frame covered by this message
+        const uint32 checksumFrame = (frame + CRE_REPLAY_CHECKSUM_INTERVAL - 1) / CRE_REPLAY_CHECKSUM_INTERVAL * CRE_REPLAY_CHECKSUM_INTERVAL;
+        uint32 checksum;
+        if (checksumFrame < frame + frameCount && cre_replay_get_checksum(checksumFrame, &checksum)) {
+            snprintf(message + length, sizeof(message) - (size_t)length, " c %u %x", checksumFrame, checksum);
+        }
+        spectator_send(message);
+        spectator.stats.inputMessagesSent++;
+    }
+}
+
+//--- Spectator ---//
+
+void spectator_process_message(const char* message) {
+    if (strncmp(message, CRE_SPECTATOR_MSG_INPUT, strlen(CRE_SPECTATOR_MSG_INPUT)) == 0) {
+        spectator_process_input_message(message);
+    } else if (strncmp(message, CRE_SPECTATOR_MSG_KEYFRAME, strlen(CRE_SPECTATOR_MSG_KEYFRAME)) == 0) {
+        spectator_process_keyframe_message(message);
+    }
+}
+
+void spectator_process_input_message(const char* message) {
+    const char* cursor = message + strlen(CRE_SPECTATOR_MSG_INPUT);
+    char* end = NULL;
+    const uint32 startFrame = (uint32)strtoul(cursor, &end, 10);
+    const bool hasStartFrame = end != cursor;
+    cursor = end;
+    const uint32 frameCount = (uint32)strtoul(cursor, &end, 10);
+    const bool hasFrameCount = end != cursor;
+    cursor = end;
+    if (!hasStartFrame || !hasFrameCount || frameCount == 0 || frameCount > CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE) {
+        ska_logger_warn("Received spectator input message with an invalid header!");
+        return;
+    }
+    // Messages come from the network, parse every announced mask before any of them are appended
+    uint64 inputMasks[CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE];
+    for (uint32 i = 0; i < frameCount; i++) {
+        inputMasks[i] = (uint64)strtoull(cursor, &end, 16);
+        if (end == cursor) {
+            ska_logger_warn("Received spectator input message for frame '%u' with '%u' of '%u' input masks!", startFrame, i, frameCount);
+            return;
+        }
+        cursor = end;
+    }
+    // Only the optional checksum may follow, a message short a mask would otherwise have read the checksum's 'c' as one
+    uint32 checksumFrame = 0;
+    uint32 checksum = 0;
+    bool hasChecksum = false;
+    while (*cursor == ' ') {
+        cursor++;
+    }
+    if (*cursor != '\0') {
+        int checksumLength = 0;
+        if (sscanf(cursor, "c %u %x%n", &checksumFrame, &checksum, &checksumLength) != 2 || cursor[checksumLength] != '\0') {
+            ska_logger_warn("Received spectator input message for frame '%u' with '%u' input masks and trailing data!", startFrame, frameCount);
+            return;
+        }
+        hasChecksum = true;
+    }
+    spectator.stats.inputMessagesReceived++;
+    const uint32 expectedFrame = cre_replay_get_frame_count();
+    if (startFrame + frameCount <= expectedFrame) {
+        return; // Already have these frames
+    }
+    if (startFrame > expectedFrame) {
+        // Missed a packet (or haven't loaded a keyframe yet), ask for a fresh keyframe to catch up from
+        if (!cre_keyframe_assembler_is_in_progress(spectator.keyframeAssembler)) {
+            spectator_send(CRE_SPECTATOR_MSG_JOIN);
+            spectator.stats.resyncRequests++;
+        }
+        return;
+    }
+    for (uint32 i = 0; i < frameCount; i++) {
+        cre_replay_append_frame_input(startFrame + i, inputMasks[i]);
+    }
+    if (hasChecksum && spectator.pendingChecksumCount < CRE_SPECTATOR_PENDING_CHECKSUM_LIMIT) {
+        spectator.pendingChecksums[spectator.pendingChecksumCount++] = (CreSpectatorPendingChecksum){ .frame = checksumFrame, .checksum = checksum };
+    }
+}
+
+void spectator_compare_pending_checksums() {
+    const uint32 currentFrame = cre_replay_get_current_frame();
+    size_t remainingCount = 0;
+    for (size_t i = 0; i < spectator.pendingChecksumCount; i++) {
+        const CreSpectatorPendingChecksum pending = spectator.pendingChecksums[i];
+        uint32 localChecksum;
+        if (!cre_replay_get_checksum(pending.frame, &localChecksum)) {
+            // Keep waiting unless it's already too old to ever be compared
+            if (pending.frame + CRE_REPLAY_CHECKSUM_INTERVAL * 2 > currentFrame) {
+                spectator.pendingChecksums[remainingCount++] = pending;
+            }
+            continue;
+        }
+        spectator.stats.checksumsCompared++;
+        if (localChecksum != pending.checksum) {
+            char message[64];
+            char dumpPath[64];
+            snprintf(dumpPath, sizeof(dumpPath), "desync_%u_spectator.crsnap", pending.frame);
+            ska_logger_error("Desync detected at frame '%u', local checksum '%08x' doesn't match broadcaster's '%08x'!", pending.frame, localChecksum, pending.checksum);
+            cre_replay_dump_checksum_frame(pending.frame, dumpPath);
+            snprintf(message, sizeof(message), "%s %u", CRE_SPECTATOR_MSG_DESYNC, pending.frame);
+            spectator_send(message);
+            spectator.stats.desyncCount++;
+            spectator.stats.lastDesyncFrame = pending.frame;
+        }
+    }
+    spectator.pendingChecksumCount = remainingCount;
+}
+
+void spectator_process_keyframe_message(const char* message) {
+    CreKeyframeAssembler* assembler = spectator.keyframeAssembler;
+    if (cre_keyframe_assembler_add_chunk(assembler, message + strlen(CRE_SPECTATOR_MSG_KEYFRAME)) != CreKeyframeChunkResult_COMPLETE) {
+        return;
+    }
+    const CreSnapshotDelta* keyframe = assembler->keyframe;
+    if (!cre_snapshot_delta_decode(keyframe, NULL, spectator.incomingSnapshot)) {
+        ska_logger_warn("Dropping corrupted spectator keyframe for frame '%u'!", keyframe->frame);
+        return;
+    }
+    // Runs decoded fine but the records they produced still came from the network
+    if (!cre_world_snapshot_validate(spectator.incomingSnapshot)) {
+        ska_logger_warn("Dropping spectator keyframe for frame '%u' with malformed records!", keyframe->frame);
+        return;
+    }
+    // Keyframes only hold component state, nodes the broadcaster spawned or deleted since the initial scene can't be mirrored
+    if (!cre_world_snapshot_has_same_entities(spectator.incomingSnapshot)) {
+        ska_logger_error("Unable to catch up to frame '%u', nodes were spawned or deleted since the initial scene!  Spectators have to join before that.", keyframe->frame);
+        spectator.isCatchUpRefused = true;
+        return;
+    }
+    cre_replay_restore_stream_keyframe(spectator.incomingSnapshot);
+    spectator.isResyncRequested = false;
+    // Fast-forward headless to the latest received frame
+    cre_replay_queue_seek(cre_replay_get_frame_count());
+    spectator.stats.keyframesReceived++;
+    spectator.stats.lastKeyframeBytes = keyframe->size;
+    ska_logger_debug("Spectator loaded keyframe for frame '%u' (%zu bytes)", keyframe->frame, keyframe->size);
+}
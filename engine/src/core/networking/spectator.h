@@ -0,0 +1,47 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+// Native spectator stream over seika's udp layer, scripts are not involved.
+// The broadcaster (a player instance) relays confirmed input frames plus a periodic compressed world keyframe.
+// Spectators send a join request, load the latest keyframe and fast-forward headless to live with the replay seeker.
+// Input messages also carry the broadcaster's checksum of confirmed frames, spectators compare it with their own and
+// both sides dump the frame's snapshot to 'desync_<frame>_<role>.crsnap' on mismatch.
+// Keyframes only hold component state, so a spectator can only catch up while the broadcaster has the same nodes alive
+// as its initial scene.  Joining after nodes were spawned or deleted is refused and stops spectating.
+
+#define CRE_SPECTATOR_KEYFRAME_INTERVAL 600
+#define CRE_SPECTATOR_INPUT_FRAMES_PER_MESSAGE 8
+
+typedef struct CreSpectatorStats {
+    uint32 keyframesSent;
+    uint32 keyframesReceived;
+    uint32 inputMessagesSent;
+    uint32 inputMessagesReceived;
+    uint32 resyncRequests;
+    uint32 droppedMessages;
+    size_t lastKeyframeBytes;
+    uint32 checksumsCompared;
+    uint32 desyncCount;
+    uint32 lastDesyncFrame;
+} CreSpectatorStats;
+
+bool cre_spectator_server_start(int32 port);
+bool cre_spectator_client_start(const char* host, int32 port);
+void cre_spectator_stop();
+bool cre_spectator_is_active();
+// Processes received messages on the main thread, called once per frame
+void cre_spectator_update();
+// Called after each fixed update, the broadcaster sends out newly confirmed frames here
+void cre_spectator_on_fixed_update_end();
+CreSpectatorStats cre_spectator_get_stats();
+
+#ifdef __cplusplus
+}
+#endif
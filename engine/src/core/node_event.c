@@ -1,5 +1,6 @@
 #include "node_event.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <seika/ecs/ecs.h>
@@ -12,9 +13,9 @@
 #include "ecs/ecs_globals.h"
 #include "ecs/components/node_component.h"
 #include "ecs/component.h"
+#include "utils/entity_paged_array.h"
 
 #define CRE_NODE_EVENT_MAX_OBSERVERS 8
-#define MAX_EVENT_OBSERVER_ENTRY_COUNT 100
 
 typedef struct NodeEventObserver {
     SkaEntity entity;
@@ -31,19 +32,16 @@ typedef struct NodeEvent {
     NodeEventObserver* observers[CRE_NODE_EVENT_MAX_OBSERVERS];
 } NodeEvent;
 
-typedef struct NodeEventObserverEntry {
-    size_t entryCount;
-    NodeEventObserver* observers[MAX_EVENT_OBSERVER_ENTRY_COUNT];
-} NodeEventObserverEntry;
-
-typedef struct NodeEventDatabase {
-    // Keeps tracks of an entity's events and observers
-    SkaStringHashMap* entityEventMaps[SKA_MAX_ENTITIES];
-    // Keeps tracks of observers to events
-    NodeEventObserverEntry nodeEventObserverEntry[SKA_MAX_ENTITIES];
-    // Booleans for if entity has registered to the 'on scene exit' callback (TODO: Should be done better...)
-    bool hasEntityRegisteredOnSceneExitCallback[SKA_MAX_ENTITIES];
-} NodeEventDatabase;
+typedef struct NodeEventEntityData {
+    // Keeps tracks of an entity's events
+    SkaStringHashMap* eventMap;
+    // Keeps tracks of the entity's observers to events
+    NodeEventObserver** observers;
+    size_t observerCount;
+    size_t observerCapacity;
+    // If entity has registered to the 'on scene exit' callback (TODO: Should be done better...)
+    bool hasRegisteredOnSceneExitCallback;
+} NodeEventEntityData;
 
 NodeEvent* node_event_create_event_internal(SkaEntity entity, const char* eventId);
 NodeEventObserver* node_create_observer_internal(SkaEntity entity, NodeEvent* event, NodeEventObserverCallback observerCallback, void* observerData, NodeEventObserverDataDeleteCallback dataDeleteCallback);
@@ -54,13 +52,40 @@ void unregister_entity_to_on_scene_exit_callback(SkaEntity entity);
 
 void cre_node_event_on_entity_exit_scene(SkaSubjectNotifyPayload* payload);
 
-static NodeEventDatabase eventDatabase = {
-    .entityEventMaps = {NULL},
-    .nodeEventObserverEntry = {{0}},
-    .hasEntityRegisteredOnSceneExitCallback = {false}
-};
+// Paged so entities that never use node events don't take any memory
+static CreEntityPagedArray eventDatabase = { .elementSize = sizeof(NodeEventEntityData) };
 static SkaObserver nodeEntityOnExitSceneObserver = { .on_notify = cre_node_event_on_entity_exit_scene };
 
+static inline NodeEventEntityData* node_event_get_entity_data(SkaEntity entity) {
+    return (NodeEventEntityData*)cre_entity_paged_array_get_or_create(&eventDatabase, entity);
+}
+
+// Returns NULL if the entity has never used node events
+static inline const NodeEventEntityData* node_event_find_entity_data(SkaEntity entity) {
+    return (const NodeEventEntityData*)cre_entity_paged_array_get(&eventDatabase, entity);
+}
+
+static void node_event_entity_data_remove_observer(NodeEventEntityData* entityData, const NodeEventObserver* observer) {
+    for (size_t i = 0; i < entityData->observerCount; i++) {
+        if (entityData->observers[i] == observer) {
+            memmove(&entityData->observers[i], &entityData->observers[i + 1], sizeof(NodeEventObserver*) * (entityData->observerCount - i - 1));
+            entityData->observerCount--;
+            return;
+        }
+    }
+}
+
+void node_event_initialize() {
+    cre_entity_paged_array_initialize(&eventDatabase, sizeof(NodeEventEntityData), NULL);
+}
+
+void node_event_finalize() {
+    for (SkaEntity entity = cre_entity_paged_array_find_next_created(&eventDatabase, 0); entity != SKA_NULL_ENTITY; entity = cre_entity_paged_array_find_next_created(&eventDatabase, entity + 1)) {
+        node_event_destroy_all_entity_events_and_observers(entity);
+    }
+    cre_entity_paged_array_finalize(&eventDatabase);
+}
+
 void node_event_create_event(SkaEntity entity, const char* eventId) {
     node_event_create_event_internal(entity, eventId);
 }
@@ -87,52 +112,55 @@ void node_event_notify_observers(SkaEntity entity, const char* eventId, NodeEven
 }
 
 void node_event_destroy_all_entity_events_and_observers(SkaEntity entity) {
+    if (node_event_find_entity_data(entity) == NULL) {
+        return;
+    }
+    NodeEventEntityData* entityData = node_event_get_entity_data(entity);
     // Remove all entity observers
-    NodeEventObserverEntry* observerEntry = &eventDatabase.nodeEventObserverEntry[entity];
-    for (size_t i = 0; i < observerEntry->entryCount; i++) {
-        NodeEventObserver* nodeEventObserver = observerEntry->observers[i];
+    for (size_t i = 0; i < entityData->observerCount; i++) {
+        NodeEventObserver* nodeEventObserver = entityData->observers[i];
         if (nodeEventObserver == NULL || nodeEventObserver->event == NULL) {
             continue;
         }
         NodeEvent* nodeEvent = nodeEventObserver->event;
         SKA_ARRAY_UTILS_REMOVE_ARRAY_ITEM(nodeEvent->observers, nodeEvent->observerCount, nodeEventObserver, NULL);
         node_observer_free(nodeEventObserver);
-        observerEntry->observers[i] = NULL;
+        entityData->observers[i] = NULL;
     }
-    observerEntry->entryCount = 0;
+    entityData->observerCount = 0;
+    free(entityData->observers);
+    entityData->observers = NULL;
+    entityData->observerCapacity = 0;
     // Remove all entity events
-    if (eventDatabase.entityEventMaps[entity] != NULL) {
-        SKA_STRING_HASH_MAP_FOR_EACH(eventDatabase.entityEventMaps[entity], iter) {
+    if (entityData->eventMap != NULL) {
+        SKA_STRING_HASH_MAP_FOR_EACH(entityData->eventMap, iter) {
             SkaStringHashMapNode* node = iter.pair;
             NodeEvent* nodeEvent = (NodeEvent*) *(NodeEvent**) node->value;
             // Remove all observers attached to event
             for (size_t i = 0; i < nodeEvent->observerCount; i++) {
-                SKA_ARRAY_UTILS_REMOVE_ARRAY_ITEM(
-                    eventDatabase.nodeEventObserverEntry[nodeEvent->observers[i]->entity].observers,
-                    eventDatabase.nodeEventObserverEntry[nodeEvent->observers[i]->entity].entryCount,
-                    nodeEvent->observers[i],
-                    NULL
-                );
+                node_event_entity_data_remove_observer(node_event_get_entity_data(nodeEvent->observers[i]->entity), nodeEvent->observers[i]);
                 node_observer_free(nodeEvent->observers[i]);
             }
             // Delete event
             SKA_FREE(nodeEvent->id);
             SKA_FREE(nodeEvent);
         }
-        ska_string_hash_map_destroy(eventDatabase.entityEventMaps[entity]);
-        eventDatabase.entityEventMaps[entity] = NULL;
+        ska_string_hash_map_destroy(entityData->eventMap);
+        entityData->eventMap = NULL;
     }
     unregister_entity_to_on_scene_exit_callback(entity);
-    eventDatabase.hasEntityRegisteredOnSceneExitCallback[entity] = false;
+    cre_entity_paged_array_release(&eventDatabase, entity);
 }
 
 // Queries
 size_t node_event_get_event_count(SkaEntity entity) {
-    return eventDatabase.entityEventMaps[entity] != NULL ? eventDatabase.entityEventMaps[entity]->size : 0;
+    const NodeEventEntityData* entityData = node_event_find_entity_data(entity);
+    return entityData != NULL && entityData->eventMap != NULL ? entityData->eventMap->size : 0;
 }
 
 size_t node_event_get_event_observer_count(SkaEntity entity, const char* eventId) {
-    if (eventDatabase.entityEventMaps[entity] != NULL) {
+    const NodeEventEntityData* entityData = node_event_find_entity_data(entity);
+    if (entityData != NULL && entityData->eventMap != NULL) {
         NodeEvent* event = node_event_create_event_internal(entity, eventId);
         return event->observerCount;
     }
@@ -140,23 +168,25 @@ size_t node_event_get_event_observer_count(SkaEntity entity, const char* eventId
 }
 
 size_t node_event_get_entity_observer_count(SkaEntity entity) {
-    return eventDatabase.nodeEventObserverEntry[entity].entryCount;
+    const NodeEventEntityData* entityData = node_event_find_entity_data(entity);
+    return entityData != NULL ? entityData->observerCount : 0;
 }
 
 // Internal
 NodeEvent* node_event_create_event_internal(SkaEntity entity, const char* eventId) {
-    if (eventDatabase.entityEventMaps[entity] == NULL) {
-        eventDatabase.entityEventMaps[entity] = ska_string_hash_map_create_default_capacity();
+    NodeEventEntityData* entityData = node_event_get_entity_data(entity);
+    if (entityData->eventMap == NULL) {
+        entityData->eventMap = ska_string_hash_map_create_default_capacity();
         register_entity_to_on_scene_exit_callback(entity);
     }
-    if (!ska_string_hash_map_has(eventDatabase.entityEventMaps[entity], eventId)) {
+    if (!ska_string_hash_map_has(entityData->eventMap, eventId)) {
         NodeEvent* event = SKA_ALLOC(NodeEvent);
         event->entity = entity;
         event->id = ska_strdup(eventId);
         event->observerCount = 0;
-        ska_string_hash_map_add(eventDatabase.entityEventMaps[entity], eventId, &event, sizeof(NodeEvent**));
+        ska_string_hash_map_add(entityData->eventMap, eventId, &event, sizeof(NodeEvent**));
     }
-    NodeEvent* event = (NodeEvent*) *(NodeEvent**)ska_string_hash_map_get(eventDatabase.entityEventMaps[entity], eventId);
+    NodeEvent* event = (NodeEvent*) *(NodeEvent**)ska_string_hash_map_get(entityData->eventMap, eventId);
     return event;
 }
 
@@ -167,10 +197,13 @@ NodeEventObserver* node_create_observer_internal(SkaEntity entity, NodeEvent* ev
     eventObserver->data = observerData;
     eventObserver->dataDeleteCallback = dataDeleteCallback;
     eventObserver->event = event;
-    // Get alias to shorten the expression
-    NodeEventObserverEntry* observerEntry = &eventDatabase.nodeEventObserverEntry[entity];
-    SKA_ASSERT(observerEntry->entryCount + 1 < MAX_EVENT_OBSERVER_ENTRY_COUNT);
-    observerEntry->observers[observerEntry->entryCount++] = eventObserver;
+    NodeEventEntityData* entityData = node_event_get_entity_data(entity);
+    if (entityData->observerCount >= entityData->observerCapacity) {
+        entityData->observerCapacity = entityData->observerCapacity > 0 ? entityData->observerCapacity * 2 : 4;
+        entityData->observers = (NodeEventObserver**)realloc(entityData->observers, sizeof(NodeEventObserver*) * entityData->observerCapacity);
+        SKA_ASSERT(entityData->observers);
+    }
+    entityData->observers[entityData->observerCount++] = eventObserver;
     register_entity_to_on_scene_exit_callback(entity);
     return eventObserver;
 }
@@ -183,8 +216,12 @@ void node_observer_free(NodeEventObserver* observer) {
 }
 
 bool does_entity_have_observer_event_already(SkaEntity observerEntity, NodeEvent* event) {
-    for (size_t i = 0; i < eventDatabase.nodeEventObserverEntry[observerEntity].entryCount; i++) {
-        const NodeEvent* observerEvent = eventDatabase.nodeEventObserverEntry[observerEntity].observers[i]->event;
+    const NodeEventEntityData* entityData = node_event_find_entity_data(observerEntity);
+    if (entityData == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < entityData->observerCount; i++) {
+        const NodeEvent* observerEvent = entityData->observers[i]->event;
         if (strcmp(observerEvent->id, event->id) == 0 && observerEvent->entity == event->entity) {
             return true;
         }
@@ -195,17 +232,19 @@ bool does_entity_have_observer_event_already(SkaEntity observerEntity, NodeEvent
 void register_entity_to_on_scene_exit_callback(SkaEntity entity) {
     ska_ecs_component_manager_reserve(entity);
     NodeComponent* nodeComp = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX);
-    if (nodeComp && !eventDatabase.hasEntityRegisteredOnSceneExitCallback[entity]) {
+    NodeEventEntityData* entityData = node_event_get_entity_data(entity);
+    if (nodeComp && !entityData->hasRegisteredOnSceneExitCallback) {
         ska_event_register_observer(&nodeComp->onSceneTreeExit, &nodeEntityOnExitSceneObserver);
-        eventDatabase.hasEntityRegisteredOnSceneExitCallback[entity] = true;
+        entityData->hasRegisteredOnSceneExitCallback = true;
     }
 }
 
 void unregister_entity_to_on_scene_exit_callback(SkaEntity entity) {
     NodeComponent* nodeComp = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX);
-    if (nodeComp && eventDatabase.hasEntityRegisteredOnSceneExitCallback[entity]) {
+    NodeEventEntityData* entityData = node_event_get_entity_data(entity);
+    if (nodeComp && entityData->hasRegisteredOnSceneExitCallback) {
         ska_event_unregister_observer(&nodeComp->onSceneTreeExit, &nodeEntityOnExitSceneObserver);
-        eventDatabase.hasEntityRegisteredOnSceneExitCallback[entity] = false;
+        entityData->hasRegisteredOnSceneExitCallback = false;
     }
 }
 
@@ -11,6 +11,9 @@ typedef struct NodeEventNotifyPayload {
 typedef void (*NodeEventObserverCallback)(void*, NodeEventNotifyPayload*); // (Event payload, observer data)
 typedef void (*NodeEventObserverDataDeleteCallback)(void*);
 
+void node_event_initialize();
+// Destroys the events and observers that are left
+void node_event_finalize();
 // Will only create if it doesn't exist
 void node_event_create_event(SkaEntity entity, const char* eventId);
 void node_event_subscribe_to_event(SkaEntity entity, const char* eventId, SkaEntity observerEntity, NodeEventObserverCallback observerCallback, void* observerData, NodeEventObserverDataDeleteCallback dataDeleteCallback);
@@ -15,9 +15,13 @@ SkaSpatialHashMap* globalSpatialHashMap = NULL;
 CollisionResult cre_collision_process_entity_collisions(SkaEntity entity) {
     Collider2DComponent* colliderComponent = (Collider2DComponent*)ska_ecs_component_manager_get_component(entity, COLLIDER2D_COMPONENT_INDEX);
     CollisionResult collisionResult = { .sourceEntity = entity, .collidedEntityCount = 0 };
+    // Idle pooled instances stay in the spatial hash but don't collide
+    if (cre_scene_manager_is_entity_pooled(entity)) {
+        return collisionResult;
+    }
     SkaSpatialHashMapCollisionResult hashMapCollisionResult = ska_spatial_hash_map_compute_collision(globalSpatialHashMap, entity);
     for (size_t i = 0; i < hashMapCollisionResult.collisionCount; i++) {
-        if (!is_entity_in_collision_exceptions(hashMapCollisionResult.collisions[i], colliderComponent)) {
+        if (!is_entity_in_collision_exceptions(hashMapCollisionResult.collisions[i], colliderComponent) && !cre_scene_manager_is_entity_pooled(hashMapCollisionResult.collisions[i])) {
             SKA_ASSERT_FMT(collisionResult.collidedEntityCount < CRE_MAX_ENTITY_COLLISION, "Collisions for entity '%d' beyond the limit of %d.  Consider increasing 'CRE_MAX_ENTITY_COLLISION'!", entity, CRE_MAX_ENTITY_COLLISION);
             collisionResult.collidedEntities[collisionResult.collidedEntityCount++] = hashMapCollisionResult.collisions[i];
         }
@@ -30,6 +34,9 @@ CollisionResult cre_collision_process_mouse_collisions(const SkaRect2* collision
     const SkaECSSystem* collisionSystem = cre_collision_ec_system_get();
     SKA_ARRAY_LIST_FOR_EACH(collisionSystem->entities, SkaEntity, entityPtr) {
         const SkaEntity otherEntity = *entityPtr;
+        if (cre_scene_manager_is_entity_pooled(otherEntity)) {
+            continue;
+        }
         Transform2DComponent* otherTransformComponent = (Transform2DComponent*)ska_ecs_component_manager_get_component(otherEntity,TRANSFORM2D_COMPONENT_INDEX);
         Collider2DComponent* otherColliderComponent = (Collider2DComponent*)ska_ecs_component_manager_get_component(otherEntity,COLLIDER2D_COMPONENT_INDEX);
         SkaRect2 otherCollisionRect = cre_get_collision_rectangle(otherEntity, otherTransformComponent, otherColliderComponent);
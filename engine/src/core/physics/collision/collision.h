@@ -18,6 +18,7 @@ typedef struct CollisionResult {
     SkaEntity collidedEntities[CRE_MAX_ENTITY_COLLISION];
 } CollisionResult;
 
+// Uses the spatial hash as of the last transform changed event flush, which the core loop does before each update phase
 CollisionResult cre_collision_process_entity_collisions(SkaEntity entity);
 CollisionResult cre_collision_process_mouse_collisions(const SkaRect2* collisionRect);
 void cre_collision_set_global_spatial_hash_map(SkaSpatialHashMap* hashMap);
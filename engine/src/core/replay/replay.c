@@ -0,0 +1,771 @@
+#include "replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/time.h>
+#include <seika/memory.h>
+#include <seika/assert.h>
+#include <seika/logger.h>
+#include <seika/string.h>
+#include <seika/input/input.h>
+
+#include "../game_properties.h"
+#include "../ecs/systems/script_ec_system.h"
+#include "../math/random.h"
+#include "../snapshot/world_snapshot.h"
+#include "../snapshot/snapshot_delta.h"
+
+#define CRE_REPLAY_FILE_MAGIC "CRRP"
+#define CRE_REPLAY_FILE_VERSION 2
+// Version 1 files have no random seed
+#define CRE_REPLAY_FILE_MIN_VERSION 1
+#define CRE_REPLAY_ACTION_NAME_SIZE 32
+// Every nth keyframe is stored in full, the ones in between are stored as deltas against it
+#define CRE_REPLAY_KEYFRAMES_PER_ANCHOR 10
+// Number of recent checksummed frames kept around for comparing and dumping
+#define CRE_REPLAY_CHECKSUM_HISTORY_SIZE 4
+
+typedef struct CreReplayAction {
+    char name[CRE_REPLAY_ACTION_NAME_SIZE];
+    int32 deviceId;
+} CreReplayAction;
+
+typedef struct CreReplayActionConfig {
+    CREInputPredictionPolicy predictionPolicy;
+    int32 inputDelay;
+} CreReplayActionConfig;
+
+typedef struct CreReplayKeyframe {
+    uint32 frame;
+    CreWorldSnapshot* snapshot; // Only set for anchor keyframes
+    CreSnapshotDelta* delta; // Only set for non anchor keyframes
+} CreReplayKeyframe;
+
+typedef struct CreReplayChecksum {
+    uint32 frame;
+    uint32 checksum;
+    CreWorldSnapshot* snapshot;
+} CreReplayChecksum;
+
+typedef struct CreReplay {
+    CreReplayMode mode;
+    CreReplayStepFunc stepFunc;
+    CreReplayRestartFunc restartFunc;
+    char* filePath;
+    bool isStream; // Frame inputs are appended live (e.g. from a spectator stream) instead of read from a file
+    // Input
+    CreReplayAction actions[CRE_REPLAY_MAX_INPUT_ACTIONS];
+    CreReplayActionConfig actionConfigs[CRE_REPLAY_MAX_INPUT_ACTIONS]; // From game properties, not part of the replay file
+    uint32 actionCount;
+    uint64 rawInputHistory[CRE_INPUT_MAX_DELAY_FRAMES + 1]; // Undelayed local input, index is 'localInputFrame % (CRE_INPUT_MAX_DELAY_FRAMES + 1)'
+    bool hasInputDelay;
+    // Local input after the delay was applied, sampled every fixed frame when recording or when any action has a delay
+    uint64 localInput;
+    uint64 previousLocalInput;
+    uint32 localInputFrame;
+    uint32 randomSeed;
+    bool hasRandomSeed;
+    uint64* frameInputs;
+    uint32 frameCount;
+    uint32 frameCapacity;
+    uint32 currentFrame;
+    // Keyframes are stored every 'keyframeInterval' frames from 'keyframeStartFrame', sorted by frame
+    uint32 keyframeInterval;
+    uint32 keyframeStartFrame;
+    CreReplayKeyframe* keyframes;
+    uint32 keyframeCount;
+    uint32 keyframeCapacity;
+    CreWorldSnapshot* scratchSnapshot;
+    // Prediction, only used by stream playback
+    uint64 predictedInputs[CRE_REPLAY_MAX_PREDICTION_FRAMES]; // Index is 'frame % CRE_REPLAY_MAX_PREDICTION_FRAMES'
+    CreWorldSnapshot* rollbackSnapshot; // State at the start of the first predicted frame
+    bool hasRollbackSnapshot;
+    uint32 rollbackFrame; // Earliest mispredicted frame
+    bool isWaitingForResync; // Rollback couldn't restore the predicted frames, the state is off until a stream keyframe arrives
+    uint32 actionRollbackCounts[CRE_REPLAY_MAX_INPUT_ACTIONS];
+    // Checksums, index is '(frame / CRE_REPLAY_CHECKSUM_INTERVAL) % CRE_REPLAY_CHECKSUM_HISTORY_SIZE'
+    bool areChecksumsEnabled;
+    CreReplayChecksum checksums[CRE_REPLAY_CHECKSUM_HISTORY_SIZE];
+    // Seeking
+    uint32 queuedSeekFrame;
+    bool isSeeking;
+    CreReplayStats stats;
+} CreReplay;
+
+static CreReplay replay = { .mode = CreReplayMode_NONE, .queuedSeekFrame = CRE_REPLAY_INVALID_FRAME, .rollbackFrame = CRE_REPLAY_INVALID_FRAME };
+
+static void replay_reset();
+static void replay_reset_keeping_callbacks();
+static void replay_setup_actions_from_game_properties();
+static void replay_push_frame_input(uint64 inputMask);
+static uint64 replay_sample_local_input();
+static uint64 replay_predict_frame_input();
+static void replay_process_rollback();
+static void replay_store_checksum();
+static void replay_clear_checksums();
+static void replay_clear_keyframes();
+static void replay_store_keyframe();
+static const CreWorldSnapshot* replay_decode_keyframe(uint32 keyframeIndex);
+static bool replay_restore_closest_keyframe(uint32 keyframeIndex, uint32 targetFrame);
+static bool replay_restore_keyframe_with_same_entities(uint32 frame);
+static bool replay_can_restart();
+static bool replay_restart(uint32 targetFrame);
+static uint64 replay_get_frame_input(uint32 frame);
+static bool replay_write_file(const char* filePath);
+static bool replay_read_file(const char* filePath);
+
+void cre_replay_initialize(CreReplayStepFunc stepFunc, CreReplayRestartFunc restartFunc, uint32 keyframeInterval) {
+    SKA_ASSERT(stepFunc != NULL);
+    replay_reset();
+    replay.stepFunc = stepFunc;
+    replay.restartFunc = restartFunc;
+    replay.keyframeInterval = keyframeInterval > 0 ? keyframeInterval : CRE_REPLAY_DEFAULT_KEYFRAME_INTERVAL;
+    // Input delay applies to normal play too, not only while recording
+    replay_setup_actions_from_game_properties();
+}
+
+void cre_replay_finalize() {
+    cre_replay_stop();
+    replay.stepFunc = NULL;
+    replay.restartFunc = NULL;
+}
+
+bool cre_replay_start_recording(const char* filePath) {
+    cre_replay_stop();
+    replay_setup_actions_from_game_properties();
+    replay.filePath = filePath != NULL ? ska_strdup(filePath) : NULL;
+    replay.mode = CreReplayMode_RECORDING;
+    // Reseed so playback can get the same random numbers (particles, animation staggering)
+    replay.randomSeed = cre_random_next();
+    replay.hasRandomSeed = true;
+    cre_random_seed(replay.randomSeed);
+    ska_logger_debug("Started recording replay to '%s' with '%u' input actions", filePath != NULL ? filePath : "memory", replay.actionCount);
+    return true;
+}
+
+bool cre_replay_start_playback(const char* filePath) {
+    cre_replay_stop();
+    if (!replay_read_file(filePath)) {
+        ska_logger_error("Failed to read replay file at '%s'!", filePath);
+        replay_reset_keeping_callbacks();
+        return false;
+    }
+    replay.filePath = ska_strdup(filePath);
+    replay.mode = CreReplayMode_PLAYBACK;
+    if (replay.hasRandomSeed) {
+        cre_random_seed(replay.randomSeed);
+    }
+    ska_logger_debug("Started replay playback of '%s' with '%u' frames", filePath, replay.frameCount);
+    return true;
+}
+
+bool cre_replay_start_stream_playback() {
+    cre_replay_stop();
+    replay_setup_actions_from_game_properties();
+    replay.isStream = true;
+    replay.mode = CreReplayMode_PLAYBACK;
+    ska_logger_debug("Started stream replay playback with '%u' input actions", replay.actionCount);
+    return true;
+}
+
+void cre_replay_stop() {
+    if (replay.mode == CreReplayMode_RECORDING && replay.filePath != NULL) {
+        if (!replay_write_file(replay.filePath)) {
+            ska_logger_error("Failed to write replay file to '%s'!", replay.filePath);
+        }
+    }
+    replay_reset_keeping_callbacks();
+}
+
+CreReplayMode cre_replay_get_mode() {
+    return replay.mode;
+}
+
+void cre_replay_pre_fixed_update() {
+    if (replay.mode == CreReplayMode_NONE) {
+        // Nothing to record, but delayed actions still take effect late
+        if (replay.hasInputDelay) {
+            replay_sample_local_input();
+        }
+        return;
+    }
+    if (replay.areChecksumsEnabled && replay.currentFrame % CRE_REPLAY_CHECKSUM_INTERVAL == 0) {
+        replay_store_checksum();
+    }
+    if (replay.mode == CreReplayMode_RECORDING) {
+        // Recorded before the systems update so delayed input is available to scripts this frame
+        replay_push_frame_input(replay_sample_local_input());
+        return;
+    }
+    // Keyframe holds the world state at the start of the frame.  Predicted state can still be rolled back so only
+    // frames with all prior input confirmed are stored.
+    const uint32 framesSinceKeyframeStart = replay.currentFrame - replay.keyframeStartFrame;
+    const bool isKeyframeFrame = framesSinceKeyframeStart % replay.keyframeInterval == 0
+        && (replay.keyframeCount == 0 || replay.keyframes[replay.keyframeCount - 1].frame < replay.currentFrame);
+    if (isKeyframeFrame && replay.currentFrame <= replay.frameCount) {
+        replay_store_keyframe();
+    }
+    if (replay.isStream && replay.currentFrame >= replay.frameCount) {
+        if (replay.currentFrame == replay.frameCount) {
+            if (replay.rollbackSnapshot == NULL) {
+                replay.rollbackSnapshot = cre_world_snapshot_create();
+            }
+            cre_world_snapshot_capture(replay.rollbackSnapshot, replay.currentFrame);
+            replay.hasRollbackSnapshot = true;
+        }
+        replay.predictedInputs[replay.currentFrame % CRE_REPLAY_MAX_PREDICTION_FRAMES] = replay_predict_frame_input();
+    }
+}
+
+void cre_replay_post_fixed_update() {
+    if (replay.mode != CreReplayMode_NONE) {
+        replay.currentFrame++;
+    }
+}
+
+void cre_replay_queue_seek(uint32 frame) {
+    replay.queuedSeekFrame = frame;
+}
+
+void cre_replay_process_queued_seek() {
+    replay_process_rollback();
+    if (replay.queuedSeekFrame != CRE_REPLAY_INVALID_FRAME) {
+        cre_replay_seek(replay.queuedSeekFrame);
+        replay.queuedSeekFrame = CRE_REPLAY_INVALID_FRAME;
+    }
+}
+
+bool cre_replay_seek(uint32 frame) {
+    if (replay.mode != CreReplayMode_PLAYBACK) {
+        ska_logger_warn("Can only seek while a replay is playing back!");
+        return false;
+    }
+    if (frame > replay.frameCount) {
+        ska_logger_warn("Seek frame '%u' is past the end of the replay, clamping to '%u'", frame, replay.frameCount);
+        frame = replay.frameCount;
+    }
+    const uint64 startTime = ska_get_ticks();
+    // Jump to the closest stored keyframe if going backwards or if it puts us closer to the target
+    if (replay.keyframeCount > 0 && frame >= replay.keyframes[0].frame) {
+        // Binary search for the last keyframe at or before the target
+        uint32 low = 0;
+        uint32 high = replay.keyframeCount - 1;
+        while (low < high) {
+            const uint32 mid = (low + high + 1) / 2;
+            if (replay.keyframes[mid].frame <= frame) {
+                low = mid;
+            } else {
+                high = mid - 1;
+            }
+        }
+        const uint32 keyframeIndex = low;
+        const uint32 keyframeFrame = replay.keyframes[keyframeIndex].frame;
+        if (frame < replay.currentFrame || keyframeFrame > replay.currentFrame) {
+            replay_restore_closest_keyframe(keyframeIndex, frame);
+        }
+    }
+    if (frame < replay.currentFrame && !replay_restart(frame)) {
+        return false;
+    }
+    const uint32 framesToSimulate = frame - replay.currentFrame;
+    replay.isSeeking = true;
+    while (replay.currentFrame < frame) {
+        replay.stepFunc();
+    }
+    replay.isSeeking = false;
+
+    replay.stats.lastSeekFrame = frame;
+    replay.stats.lastSeekFramesSimulated = framesToSimulate;
+    replay.stats.lastSeekTimeMilliseconds = (uint32)(ska_get_ticks() - startTime);
+    ska_logger_debug("Seeked to frame '%u', simulated '%u' frames in '%u' ms", frame, framesToSimulate, replay.stats.lastSeekTimeMilliseconds);
+    return true;
+}
+
+bool cre_replay_is_seeking() {
+    return replay.isSeeking;
+}
+
+uint32 cre_replay_get_current_frame() {
+    return replay.currentFrame;
+}
+
+uint32 cre_replay_get_frame_count() {
+    return replay.frameCount;
+}
+
+uint64 cre_replay_get_frame_input(uint32 frame) {
+    return frame < replay.frameCount ? replay.frameInputs[frame] : 0;
+}
+
+bool cre_replay_append_frame_input(uint32 frame, uint64 inputMask) {
+    SKA_ASSERT_FMT(replay.isStream, "Can only append frame inputs to a stream replay!");
+    if (frame != replay.frameCount) {
+        return false;
+    }
+    // Frame was already simulated with predicted input, roll back to it if the prediction was wrong
+    if (frame < replay.currentFrame) {
+        const uint64 mispredictedMask = inputMask ^ replay.predictedInputs[frame % CRE_REPLAY_MAX_PREDICTION_FRAMES];
+        if (mispredictedMask != 0 && replay.rollbackFrame == CRE_REPLAY_INVALID_FRAME) {
+            for (uint32 i = 0; i < replay.actionCount; i++) {
+                if ((mispredictedMask & ((uint64)1 << i)) != 0) {
+                    replay.actionRollbackCounts[i]++;
+                }
+            }
+            replay.rollbackFrame = frame;
+        }
+    }
+    replay_push_frame_input(inputMask);
+    return true;
+}
+
+void cre_replay_restore_stream_keyframe(const CreWorldSnapshot* snapshot) {
+    SKA_ASSERT_FMT(replay.isStream, "Can only restore external keyframes on a stream replay!");
+    // Local keyframes are no longer valid, start storing them again from the restored frame
+    replay_clear_keyframes();
+    replay.keyframeStartFrame = snapshot->frame;
+    // Inputs before the keyframe aren't needed, so pad them with neutral input
+    while (replay.frameCount < snapshot->frame) {
+        replay_push_frame_input(0);
+    }
+    cre_world_snapshot_restore(snapshot);
+    replay.currentFrame = snapshot->frame;
+    replay.hasRollbackSnapshot = false;
+    replay.rollbackFrame = CRE_REPLAY_INVALID_FRAME;
+    replay.isWaitingForResync = false;
+    replay_clear_checksums();
+}
+
+bool cre_replay_is_waiting_for_resync() {
+    return replay.isWaitingForResync;
+}
+
+bool cre_replay_is_waiting_for_input() {
+    return replay.mode == CreReplayMode_PLAYBACK && replay.isStream
+        && (replay.frameCount == 0 || replay.currentFrame >= replay.frameCount + CRE_REPLAY_MAX_PREDICTION_FRAMES);
+}
+
+bool cre_replay_get_action_state(const char* actionName, int32 deviceId, CreReplayActionState* outState) {
+    if (replay.mode != CreReplayMode_PLAYBACK) {
+        // Without a delay the sampled input is the same as the live input
+        if (!replay.hasInputDelay) {
+            return false;
+        }
+        // Every action is reported from the sampled input, undelayed actions falling back to live input would get ahead
+        // of the delayed ones
+        for (uint32 i = 0; i < replay.actionCount; i++) {
+            if (replay.actions[i].deviceId == deviceId && strcmp(replay.actions[i].name, actionName) == 0) {
+                const uint64 actionBit = (uint64)1 << i;
+                const bool isPressed = (replay.localInput & actionBit) != 0;
+                const bool wasPressed = (replay.previousLocalInput & actionBit) != 0;
+                *outState = (CreReplayActionState){ .pressed = isPressed, .justPressed = isPressed && !wasPressed, .justReleased = !isPressed && wasPressed };
+                return true;
+            }
+        }
+        *outState = (CreReplayActionState){ .pressed = false, .justPressed = false, .justReleased = false };
+        return true;
+    }
+    for (uint32 i = 0; i < replay.actionCount; i++) {
+        if (replay.actions[i].deviceId == deviceId && strcmp(replay.actions[i].name, actionName) == 0) {
+            const uint64 actionBit = (uint64)1 << i;
+            const bool isPressed = (replay_get_frame_input(replay.currentFrame) & actionBit) != 0;
+            const bool wasPressed = replay.currentFrame > 0 && (replay_get_frame_input(replay.currentFrame - 1) & actionBit) != 0;
+            *outState = (CreReplayActionState){ .pressed = isPressed, .justPressed = isPressed && !wasPressed, .justReleased = !isPressed && wasPressed };
+            return true;
+        }
+    }
+    // Actions not part of the recording are never pressed during playback
+    *outState = (CreReplayActionState){ .pressed = false, .justPressed = false, .justReleased = false };
+    return true;
+}
+
+void cre_replay_set_checksums_enabled(bool enabled) {
+    replay.areChecksumsEnabled = enabled;
+}
+
+bool cre_replay_get_checksum(uint32 frame, uint32* outChecksum) {
+    const CreReplayChecksum* checksum = &replay.checksums[(frame / CRE_REPLAY_CHECKSUM_INTERVAL) % CRE_REPLAY_CHECKSUM_HISTORY_SIZE];
+    // Only confirmed, predicted state that still has a rollback pending doesn't count
+    const bool isConfirmed = frame <= replay.frameCount && (replay.rollbackFrame == CRE_REPLAY_INVALID_FRAME || replay.rollbackFrame >= frame);
+    if (checksum->snapshot == NULL || checksum->frame != frame || !isConfirmed) {
+        return false;
+    }
+    *outChecksum = checksum->checksum;
+    return true;
+}
+
+bool cre_replay_dump_checksum_frame(uint32 frame, const char* filePath) {
+    const CreReplayChecksum* checksum = &replay.checksums[(frame / CRE_REPLAY_CHECKSUM_INTERVAL) % CRE_REPLAY_CHECKSUM_HISTORY_SIZE];
+    if (checksum->snapshot == NULL || checksum->frame != frame) {
+        ska_logger_warn("No checksummed snapshot for frame '%u' to dump!", frame);
+        return false;
+    }
+    if (!cre_world_snapshot_save_file(checksum->snapshot, filePath)) {
+        ska_logger_error("Failed to dump snapshot for frame '%u' to '%s'!", frame, filePath);
+        return false;
+    }
+    ska_logger_info("Dumped snapshot for frame '%u' (checksum '%08x') to '%s'", frame, checksum->checksum, filePath);
+    return true;
+}
+
+uint32 cre_replay_get_action_rollback_count(const char* actionName, int32 deviceId) {
+    for (uint32 i = 0; i < replay.actionCount; i++) {
+        if (replay.actions[i].deviceId == deviceId && strcmp(replay.actions[i].name, actionName) == 0) {
+            return replay.actionRollbackCounts[i];
+        }
+    }
+    return 0;
+}
+
+CreReplayStats cre_replay_get_stats() {
+    CreReplayStats stats = replay.stats;
+    stats.keyframeCount = replay.keyframeCount;
+    stats.snapshotMemoryBytes = 0;
+    for (uint32 i = 0; i < replay.keyframeCount; i++) {
+        const CreReplayKeyframe* keyframe = &replay.keyframes[i];
+        stats.snapshotMemoryBytes += keyframe->snapshot != NULL ? keyframe->snapshot->capacity : keyframe->delta->capacity;
+    }
+    return stats;
+}
+
+void replay_reset() {
+    replay_clear_keyframes();
+    free(replay.keyframes);
+    if (replay.scratchSnapshot) {
+        cre_world_snapshot_delete(replay.scratchSnapshot);
+    }
+    if (replay.rollbackSnapshot) {
+        cre_world_snapshot_delete(replay.rollbackSnapshot);
+    }
+    for (uint32 i = 0; i < CRE_REPLAY_CHECKSUM_HISTORY_SIZE; i++) {
+        if (replay.checksums[i].snapshot) {
+            cre_world_snapshot_delete(replay.checksums[i].snapshot);
+        }
+    }
+    free(replay.frameInputs);
+    if (replay.filePath) {
+        SKA_FREE(replay.filePath);
+    }
+    replay = (CreReplay){ .mode = CreReplayMode_NONE, .queuedSeekFrame = CRE_REPLAY_INVALID_FRAME, .rollbackFrame = CRE_REPLAY_INVALID_FRAME };
+}
+
+// Callbacks and the keyframe interval come from 'cre_replay_initialize()' and outlive each recording or playback
+void replay_reset_keeping_callbacks() {
+    const CreReplayStepFunc stepFunc = replay.stepFunc;
+    const CreReplayRestartFunc restartFunc = replay.restartFunc;
+    const uint32 keyframeInterval = replay.keyframeInterval;
+    replay_reset();
+    replay.stepFunc = stepFunc;
+    replay.restartFunc = restartFunc;
+    replay.keyframeInterval = keyframeInterval;
+    replay_setup_actions_from_game_properties();
+}
+
+void replay_setup_actions_from_game_properties() {
+    const CREGameProperties* gameProps = cre_game_props_get();
+    replay.actionCount = 0;
+    replay.hasInputDelay = false;
+    for (size_t i = 0; i < gameProps->inputActionCount; i++) {
+        if (replay.actionCount >= CRE_REPLAY_MAX_INPUT_ACTIONS) {
+            ska_logger_warn("Replay can only record up to '%d' input actions, ignoring the rest!", CRE_REPLAY_MAX_INPUT_ACTIONS);
+            break;
+        }
+        CreReplayAction* action = &replay.actions[replay.actionCount++];
+        strncpy(action->name, gameProps->inputActions[i].name, CRE_REPLAY_ACTION_NAME_SIZE - 1);
+        action->deviceId = gameProps->inputActions[i].deviceId;
+        CreReplayActionConfig* actionConfig = &replay.actionConfigs[replay.actionCount - 1];
+        actionConfig->predictionPolicy = gameProps->inputActions[i].predictionPolicy;
+        actionConfig->inputDelay = gameProps->inputActions[i].inputDelay;
+        replay.hasInputDelay |= actionConfig->inputDelay > 0;
+    }
+}
+
+void replay_push_frame_input(uint64 inputMask) {
+    if (replay.frameCount >= replay.frameCapacity) {
+        replay.frameCapacity = replay.frameCapacity > 0 ? replay.frameCapacity * 2 : 1024;
+        replay.frameInputs = (uint64*)realloc(replay.frameInputs, sizeof(uint64) * replay.frameCapacity);
+        SKA_ASSERT(replay.frameInputs);
+    }
+    replay.frameInputs[replay.frameCount++] = inputMask;
+}
+
+uint64 replay_sample_local_input() {
+    uint64 inputMask = 0;
+    for (uint32 i = 0; i < replay.actionCount; i++) {
+        const SkaInputActionHandle handle = ska_input_find_input_action_handle(replay.actions[i].name, replay.actions[i].deviceId);
+        if (handle != SKA_INPUT_INVALID_INPUT_ACTION_HANDLE && ska_input_is_input_action_pressed(handle, replay.actions[i].deviceId)) {
+            inputMask |= ((uint64)1 << i);
+        }
+    }
+    if (replay.hasInputDelay) {
+        // Each action takes effect 'inputDelay' frames after it was sampled
+        const uint32 historySize = CRE_INPUT_MAX_DELAY_FRAMES + 1;
+        const uint64 rawInputMask = inputMask;
+        replay.rawInputHistory[replay.localInputFrame % historySize] = rawInputMask;
+        inputMask = 0;
+        for (uint32 i = 0; i < replay.actionCount; i++) {
+            const uint32 inputDelay = (uint32)replay.actionConfigs[i].inputDelay;
+            if (replay.localInputFrame >= inputDelay) {
+                inputMask |= replay.rawInputHistory[(replay.localInputFrame - inputDelay) % historySize] & ((uint64)1 << i);
+            }
+        }
+    }
+    replay.previousLocalInput = replay.localInput;
+    replay.localInput = inputMask;
+    replay.localInputFrame++;
+    return inputMask;
+}
+
+// Predicts input for the next unconfirmed frame from the last confirmed ones
+uint64 replay_predict_frame_input() {
+    const uint64 lastInput = replay.frameCount > 0 ? replay.frameInputs[replay.frameCount - 1] : 0;
+    const uint64 previousInput = replay.frameCount > 1 ? replay.frameInputs[replay.frameCount - 2] : 0;
+    uint64 predictedMask = 0;
+    for (uint32 i = 0; i < replay.actionCount; i++) {
+        const uint64 actionBit = (uint64)1 << i;
+        switch (replay.actionConfigs[i].predictionPolicy) {
+            case CREInputPredictionPolicy_REPEAT_LAST:
+                predictedMask |= lastInput & actionBit;
+                break;
+            case CREInputPredictionPolicy_NEUTRAL:
+                break;
+            case CREInputPredictionPolicy_HELD:
+                predictedMask |= lastInput & previousInput & actionBit;
+                break;
+        }
+    }
+    return predictedMask;
+}
+
+// Restores the state before the first predicted frame and resimulates with the newly confirmed input
+void replay_process_rollback() {
+    if (replay.rollbackFrame == CRE_REPLAY_INVALID_FRAME) {
+        return;
+    }
+    // Nothing to roll back to until the stream keyframe arrives
+    if (replay.isWaitingForResync) {
+        replay.rollbackFrame = CRE_REPLAY_INVALID_FRAME;
+        return;
+    }
+    SKA_ASSERT_FMT(replay.hasRollbackSnapshot, "Rolling back to frame '%u' without a rollback snapshot!", replay.rollbackFrame);
+    const uint64 startTime = ska_get_ticks();
+    const uint32 targetFrame = replay.currentFrame;
+    const uint32 rollbackSnapshotFrame = replay.rollbackSnapshot->frame;
+    replay.rollbackFrame = CRE_REPLAY_INVALID_FRAME;
+    replay.hasRollbackSnapshot = false;
+    // Nodes spawned or deleted during the predicted frames would be left as they are, resync from a keyframe instead
+    if (cre_world_snapshot_has_same_entities(replay.rollbackSnapshot)) {
+        cre_world_snapshot_restore(replay.rollbackSnapshot);
+        replay.currentFrame = rollbackSnapshotFrame;
+    } else if (!replay_restore_keyframe_with_same_entities(rollbackSnapshotFrame)) {
+        ska_logger_warn("Unable to roll back to frame '%u', nodes were spawned or deleted during predicted frames!  Waiting for a stream keyframe.", rollbackSnapshotFrame);
+        replay.isWaitingForResync = true;
+        return;
+    }
+    const uint32 restoredFrame = replay.currentFrame;
+    replay.isSeeking = true;
+    while (replay.currentFrame < targetFrame) {
+        replay.stepFunc();
+    }
+    replay.isSeeking = false;
+
+    replay.stats.rollbackCount++;
+    replay.stats.rollbackFramesResimulated += targetFrame - restoredFrame;
+    ska_logger_debug("Rolled back to frame '%u', resimulated '%u' frames in '%u' ms", restoredFrame,
+                     targetFrame - restoredFrame, (uint32)(ska_get_ticks() - startTime));
+}
+
+void replay_store_checksum() {
+    CreReplayChecksum* checksum = &replay.checksums[(replay.currentFrame / CRE_REPLAY_CHECKSUM_INTERVAL) % CRE_REPLAY_CHECKSUM_HISTORY_SIZE];
+    if (checksum->snapshot == NULL) {
+        checksum->snapshot = cre_world_snapshot_create();
+    }
+    cre_world_snapshot_capture(checksum->snapshot, replay.currentFrame);
+    checksum->frame = replay.currentFrame;
+    checksum->checksum = cre_world_snapshot_checksum(checksum->snapshot);
+}
+
+void replay_clear_checksums() {
+    for (uint32 i = 0; i < CRE_REPLAY_CHECKSUM_HISTORY_SIZE; i++) {
+        replay.checksums[i].frame = CRE_REPLAY_INVALID_FRAME;
+    }
+}
+
+void replay_clear_keyframes() {
+    for (uint32 i = 0; i < replay.keyframeCount; i++) {
+        if (replay.keyframes[i].snapshot) {
+            cre_world_snapshot_delete(replay.keyframes[i].snapshot);
+        }
+        if (replay.keyframes[i].delta) {
+            cre_snapshot_delta_delete(replay.keyframes[i].delta);
+        }
+    }
+    replay.keyframeCount = 0;
+}
+
+void replay_store_keyframe() {
+    if (replay.keyframeCount >= replay.keyframeCapacity) {
+        replay.keyframeCapacity = replay.keyframeCapacity > 0 ? replay.keyframeCapacity * 2 : 64;
+        replay.keyframes = (CreReplayKeyframe*)realloc(replay.keyframes, sizeof(CreReplayKeyframe) * replay.keyframeCapacity);
+        SKA_ASSERT(replay.keyframes);
+    }
+    if (replay.scratchSnapshot == NULL) {
+        replay.scratchSnapshot = cre_world_snapshot_create();
+    }
+    const uint32 keyframeIndex = replay.keyframeCount++;
+    CreReplayKeyframe* keyframe = &replay.keyframes[keyframeIndex];
+    *keyframe = (CreReplayKeyframe){ .frame = replay.currentFrame, .snapshot = NULL, .delta = NULL };
+    if (keyframeIndex % CRE_REPLAY_KEYFRAMES_PER_ANCHOR == 0) {
+        keyframe->snapshot = cre_world_snapshot_create();
+        cre_world_snapshot_capture(keyframe->snapshot, replay.currentFrame);
+    } else {
+        const CreWorldSnapshot* anchorSnapshot = replay.keyframes[keyframeIndex - keyframeIndex % CRE_REPLAY_KEYFRAMES_PER_ANCHOR].snapshot;
+        cre_world_snapshot_capture(replay.scratchSnapshot, replay.currentFrame);
+        keyframe->delta = cre_snapshot_delta_create();
+        cre_snapshot_delta_encode(keyframe->delta, anchorSnapshot, replay.scratchSnapshot);
+    }
+}
+
+const CreWorldSnapshot* replay_decode_keyframe(uint32 keyframeIndex) {
+    const CreReplayKeyframe* keyframe = &replay.keyframes[keyframeIndex];
+    if (keyframe->snapshot != NULL) {
+        return keyframe->snapshot;
+    }
+    const CreWorldSnapshot* anchorSnapshot = replay.keyframes[keyframeIndex - keyframeIndex % CRE_REPLAY_KEYFRAMES_PER_ANCHOR].snapshot;
+    const bool isDecoded = cre_snapshot_delta_decode(keyframe->delta, anchorSnapshot, replay.scratchSnapshot);
+    SKA_ASSERT_FMT(isDecoded, "Failed to decode replay keyframe at frame '%u'!", keyframe->frame);
+    return replay.scratchSnapshot;
+}
+
+// Walks back from 'keyframeIndex' to the first keyframe that was taken with the nodes that are alive now, nodes spawned or
+// deleted since would otherwise be left as they are.  Keyframes that don't get closer to the target than the current frame
+// aren't worth restoring.  Returns false if there's no such keyframe, the current frame is left as is.
+bool replay_restore_closest_keyframe(uint32 keyframeIndex, uint32 targetFrame) {
+    // Keyframes don't hold script instance state, simulating from the current frame or restarting is the only way to get it
+    if (cre_script_ec_system_get_instance_count() > 0 && replay_can_restart()) {
+        return false;
+    }
+    const bool isSeekingBackwards = targetFrame < replay.currentFrame;
+    for (int64 i = (int64)keyframeIndex; i >= 0; i--) {
+        const uint32 keyframeFrame = replay.keyframes[i].frame;
+        if (!isSeekingBackwards && keyframeFrame <= replay.currentFrame) {
+            break;
+        }
+        const CreWorldSnapshot* snapshot = replay_decode_keyframe((uint32)i);
+        // Without a way to restart, restoring the closest keyframe is as good as it gets
+        if (cre_world_snapshot_has_same_entities(snapshot) || (isSeekingBackwards && !replay_can_restart())) {
+            cre_world_snapshot_restore(snapshot);
+            replay.currentFrame = keyframeFrame;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Restores the latest keyframe at or before 'frame' that was taken with the nodes that are alive now, unlike
+// 'replay_restore_closest_keyframe()' there's no fallback to a keyframe with different nodes
+bool replay_restore_keyframe_with_same_entities(uint32 frame) {
+    for (int64 i = (int64)replay.keyframeCount - 1; i >= 0; i--) {
+        if (replay.keyframes[i].frame > frame) {
+            continue;
+        }
+        const CreWorldSnapshot* snapshot = replay_decode_keyframe((uint32)i);
+        if (cre_world_snapshot_has_same_entities(snapshot)) {
+            cre_world_snapshot_restore(snapshot);
+            replay.currentFrame = replay.keyframes[i].frame;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Streams start from a received keyframe instead of the initial scene so they can't be restarted
+bool replay_can_restart() {
+    return replay.restartFunc != NULL && !replay.isStream;
+}
+
+// Goes back to the first frame of the replay, keyframes are taken again as the frames are resimulated
+bool replay_restart(uint32 targetFrame) {
+    if (!replay_can_restart()) {
+        ska_logger_error("Unable to seek backwards to frame '%u' without a keyframe!", targetFrame);
+        return false;
+    }
+    replay.restartFunc();
+    if (replay.hasRandomSeed) {
+        cre_random_seed(replay.randomSeed);
+    }
+    replay_clear_keyframes();
+    replay.keyframeStartFrame = 0;
+    replay.currentFrame = 0;
+    replay.hasRollbackSnapshot = false;
+    replay.rollbackFrame = CRE_REPLAY_INVALID_FRAME;
+    replay_clear_checksums();
+    return true;
+}
+
+uint64 replay_get_frame_input(uint32 frame) {
+    if (frame < replay.frameCount) {
+        return replay.frameInputs[frame];
+    }
+    // Frames past the confirmed input only get simulated by stream playback, use what was predicted for them
+    if (replay.isStream && frame < replay.frameCount + CRE_REPLAY_MAX_PREDICTION_FRAMES) {
+        return replay.predictedInputs[frame % CRE_REPLAY_MAX_PREDICTION_FRAMES];
+    }
+    return 0;
+}
+
+bool replay_write_file(const char* filePath) {
+    FILE* file = fopen(filePath, "wb");
+    if (!file) {
+        return false;
+    }
+    const uint32 version = CRE_REPLAY_FILE_VERSION;
+    fwrite(CRE_REPLAY_FILE_MAGIC, 1, 4, file);
+    fwrite(&version, sizeof(uint32), 1, file);
+    fwrite(&replay.actionCount, sizeof(uint32), 1, file);
+    fwrite(&replay.frameCount, sizeof(uint32), 1, file);
+    fwrite(&replay.randomSeed, sizeof(uint32), 1, file);
+    fwrite(replay.actions, sizeof(CreReplayAction), replay.actionCount, file);
+    fwrite(replay.frameInputs, sizeof(uint64), replay.frameCount, file);
+    fclose(file);
+    return true;
+}
+
+bool replay_read_file(const char* filePath) {
+    FILE* file = fopen(filePath, "rb");
+    if (!file) {
+        return false;
+    }
+    // Frame count is checked against what's left in the file before allocating for it
+    fseek(file, 0, SEEK_END);
+    const long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char magic[4];
+    uint32 version = 0;
+    bool success = fread(magic, 1, 4, file) == 4 && memcmp(magic, CRE_REPLAY_FILE_MAGIC, 4) == 0
+        && fread(&version, sizeof(uint32), 1, file) == 1 && version >= CRE_REPLAY_FILE_MIN_VERSION && version <= CRE_REPLAY_FILE_VERSION
+        && fread(&replay.actionCount, sizeof(uint32), 1, file) == 1 && replay.actionCount <= CRE_REPLAY_MAX_INPUT_ACTIONS
+        && fread(&replay.frameCount, sizeof(uint32), 1, file) == 1;
+    if (success && version >= 2) {
+        success = fread(&replay.randomSeed, sizeof(uint32), 1, file) == 1;
+        replay.hasRandomSeed = success;
+    }
+    success = success
+        && fread(replay.actions, sizeof(CreReplayAction), replay.actionCount, file) == replay.actionCount;
+    for (uint32 i = 0; success && i < replay.actionCount; i++) {
+        replay.actions[i].name[CRE_REPLAY_ACTION_NAME_SIZE - 1] = '\0';
+    }
+    if (success && replay.frameCount > 0) {
+        const long position = ftell(file);
+        success = fileSize >= 0 && position >= 0 && (uint64)replay.frameCount * sizeof(uint64) <= (uint64)(fileSize - position);
+    }
+    if (success && replay.frameCount > 0) {
+        replay.frameCapacity = replay.frameCount;
+        replay.frameInputs = (uint64*)malloc(sizeof(uint64) * replay.frameCapacity);
+        success = replay.frameInputs != NULL
+            && fread(replay.frameInputs, sizeof(uint64), replay.frameCount, file) == replay.frameCount;
+    }
+    fclose(file);
+    return success;
+}
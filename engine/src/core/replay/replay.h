@@ -0,0 +1,109 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+struct CreWorldSnapshot;
+
+// Replays are recorded as a per fixed frame bitmask of the input actions defined in the project's game properties.
+// During playback a full world snapshot is stored every 'keyframeInterval' frames.  Seeking restores the closest
+// keyframe at or before the target frame and fast-forwards headless (no rendering) until the target is reached.
+// Keyframes only hold component state, so one is only restored if the same nodes are alive as when it was taken.  When
+// seeking backwards past a spawn or deletion without such a keyframe, the replay restarts from its first frame.
+// Stream playback predicts up to 'CRE_REPLAY_MAX_PREDICTION_FRAMES' ahead of the confirmed input using each action's
+// prediction policy, then rolls back and resimulates when a prediction turns out wrong.  Actions with an input delay
+// take effect (are recorded and reported to scripts) 'inputDelay' frames after they are sampled, whether or not a replay
+// is recording.  Once any action has a delay, every action is reported from the sampled input instead of live input.
+// The engine random number generator ('math/random.h') is reseeded with a seed stored in the replay when recording and
+// playback start (and on restarts), keyframes hold its state.  What uses it (particles, animation staggering) is still
+// left out of checksums.  Script instances keep state keyframes can't hold, so while any node has a script the replay
+// restarts from its first frame instead of restoring a keyframe.
+
+#define CRE_REPLAY_DEFAULT_KEYFRAME_INTERVAL 60
+#define CRE_REPLAY_MAX_INPUT_ACTIONS 64
+#define CRE_REPLAY_INVALID_FRAME ((uint32)-1)
+#define CRE_REPLAY_MAX_PREDICTION_FRAMES 8
+#define CRE_REPLAY_CHECKSUM_INTERVAL 60
+
+// Simulates a single fixed frame without rendering, provided by the core
+typedef void (*CreReplayStepFunc)();
+// Puts the world back into the state it was in before the first frame of the replay, provided by the core
+typedef void (*CreReplayRestartFunc)();
+
+typedef enum CreReplayMode {
+    CreReplayMode_NONE = 0,
+    CreReplayMode_RECORDING = 1,
+    CreReplayMode_PLAYBACK = 2,
+} CreReplayMode;
+
+typedef struct CreReplayActionState {
+    bool pressed;
+    bool justPressed;
+    bool justReleased;
+} CreReplayActionState;
+
+typedef struct CreReplayStats {
+    uint32 keyframeCount;
+    size_t snapshotMemoryBytes;
+    uint32 lastSeekFrame;
+    uint32 lastSeekFramesSimulated;
+    uint32 lastSeekTimeMilliseconds;
+    uint32 rollbackCount;
+    uint32 rollbackFramesResimulated;
+} CreReplayStats;
+
+// 'restartFunc' can be NULL, keyframes are then restored even if nodes were spawned or deleted since
+void cre_replay_initialize(CreReplayStepFunc stepFunc, CreReplayRestartFunc restartFunc, uint32 keyframeInterval);
+void cre_replay_finalize();
+// 'filePath' can be NULL to only keep the recording in memory
+bool cre_replay_start_recording(const char* filePath);
+bool cre_replay_start_playback(const char* filePath);
+// Plays back inputs that are appended as they arrive, used by spectators
+bool cre_replay_start_stream_playback();
+// Writes out the recording (if recording) and goes back to 'CreReplayMode_NONE'
+void cre_replay_stop();
+CreReplayMode cre_replay_get_mode();
+// Called by the core around each fixed update
+void cre_replay_pre_fixed_update();
+void cre_replay_post_fixed_update();
+// Seeks (and rollbacks from mispredicted stream input) are queued and processed at the start of the next frame, like scene changes
+void cre_replay_queue_seek(uint32 frame);
+void cre_replay_process_queued_seek();
+bool cre_replay_seek(uint32 frame);
+// True while fast-forwarding to a seek target
+bool cre_replay_is_seeking();
+uint32 cre_replay_get_current_frame();
+uint32 cre_replay_get_frame_count();
+// Confirmed input only, 0 for frames that haven't been recorded or received yet
+uint64 cre_replay_get_frame_input(uint32 frame);
+// Stream playback, returns false if 'frame' isn't the next expected frame
+bool cre_replay_append_frame_input(uint32 frame, uint64 inputMask);
+// Restores a keyframe received from outside and continues playback from its frame
+void cre_replay_restore_stream_keyframe(const struct CreWorldSnapshot* snapshot);
+// True if a rollback found nodes spawned or deleted during predicted frames and had no keyframe to restore, the world
+// stays off from the confirmed input until 'cre_replay_restore_stream_keyframe()' is called
+bool cre_replay_is_waiting_for_resync();
+// True if stream playback has predicted as far ahead as allowed and needs to wait for more input
+bool cre_replay_is_waiting_for_input();
+// Returns true if the replay is driving input for the action (playback, or any action has an input delay), with the
+// recorded or delayed state written to 'outState'
+bool cre_replay_get_action_state(const char* actionName, int32 deviceId, CreReplayActionState* outState);
+// When enabled a checksum of the world state is taken at the start of every 'CRE_REPLAY_CHECKSUM_INTERVAL' frames for
+// desync detection between peers, resets when the replay is stopped
+void cre_replay_set_checksums_enabled(bool enabled);
+// Returns false if the frame wasn't checksummed, is no longer in the history or its state isn't confirmed yet
+bool cre_replay_get_checksum(uint32 frame, uint32* outChecksum);
+// Saves the snapshot taken for a checksummed frame to a file for offline diffing
+bool cre_replay_dump_checksum_frame(uint32 frame, const char* filePath);
+// Number of rollbacks caused by mispredicting the action, used for tuning its prediction policy
+uint32 cre_replay_get_action_rollback_count(const char* actionName, int32 deviceId);
+CreReplayStats cre_replay_get_stats();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,849 @@
+#include "compiled_scene.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <seika/memory.h>
+#include <seika/string.h>
+#include <seika/assert.h>
+#include <seika/logger.h>
+#include <seika/asset/asset_manager.h>
+#include <seika/asset/asset_file_loader.h>
+#include <seika/rendering/renderer.h>
+#include <seika/rendering/shader/shader_cache.h>
+#include <seika/ecs/ecs.h>
+
+#include "../game_properties.h"
+#include "../json/json_file_loader.h"
+#include "../tilemap/tilemap.h"
+#include "../ecs/ecs_globals.h"
+#include "../ecs/component_pool.h"
+#include "../ecs/entity_builder.h"
+#include "../ecs/components/node_component.h"
+#include "../ecs/components/transform2d_component.h"
+#include "../ecs/components/sprite_component.h"
+#include "../ecs/components/animated_sprite_component.h"
+#include "../ecs/components/text_label_component.h"
+#include "../ecs/components/script_component.h"
+#include "../ecs/components/collider2d_component.h"
+#include "../ecs/components/color_rect_component.h"
+#include "../ecs/components/parallax_component.h"
+#include "../ecs/components/particles2d_component.h"
+#include "../ecs/components/tilemap_component.h"
+#include "../ecs/components/visibility_notifier2d_component.h"
+
+#define CRE_COMPILED_SCENE_INITIAL_CAPACITY 4096
+#define CRE_COMPILED_SCENE_RECORD_ALIGNMENT 8
+
+// Component bits in 'CreCompiledSceneNode.componentMask', fixed so files don't depend on component registration order
+typedef enum CompiledSceneComponent {
+    CompiledSceneComponent_TRANSFORM2D = 0,
+    CompiledSceneComponent_SPRITE = 1,
+    CompiledSceneComponent_ANIMATED_SPRITE = 2,
+    CompiledSceneComponent_TEXT_LABEL = 3,
+    CompiledSceneComponent_SCRIPT = 4,
+    CompiledSceneComponent_COLLIDER2D = 5,
+    CompiledSceneComponent_COLOR_RECT = 6,
+    CompiledSceneComponent_PARALLAX = 7,
+    CompiledSceneComponent_PARTICLES2D = 8,
+    CompiledSceneComponent_TILEMAP = 9,
+    CompiledSceneComponent_VISIBILITY_NOTIFIER2D = 10,
+} CompiledSceneComponent;
+
+// --- Packed component records --- //
+typedef struct CompiledTransform2D {
+    SkaTransform2D localTransform;
+    int32 zIndex;
+    bool isZIndexRelativeToParent;
+    bool ignoreCamera;
+} CompiledTransform2D;
+
+typedef struct CompiledSprite {
+    SkaRect2 drawSource;
+    SkaVector2 origin;
+    SkaColor modulate;
+    bool flipH;
+    bool flipV;
+} CompiledSprite;
+
+// Followed by 'animationCount' animations, each followed by 'frameCount' frames
+typedef struct CompiledAnimatedSprite {
+    SkaColor modulate;
+    SkaVector2 origin;
+    uint32 animationCount;
+    uint32 currentAnimation;
+    bool isPlaying;
+    bool flipH;
+    bool flipV;
+    bool staggerStartAnimationTimes;
+} CompiledAnimatedSprite;
+
+typedef struct CompiledAnimation {
+    uint32 name;
+    int32 speed;
+    uint32 frameCount;
+    bool doesLoop;
+} CompiledAnimation;
+
+typedef struct CompiledAnimationFrame {
+    SkaRect2 drawSource;
+    int32 frame;
+    uint32 texturePath;
+} CompiledAnimationFrame;
+
+typedef struct CompiledTextLabel {
+    SkaColor color;
+    uint32 text;
+} CompiledTextLabel;
+
+typedef struct CompiledScript {
+    uint32 classPath;
+    uint32 className;
+    int32 contextType;
+} CompiledScript;
+
+typedef struct CompiledCollider2D {
+    SkaSize2D extents;
+    SkaColor color;
+} CompiledCollider2D;
+
+typedef struct CompiledColorRect {
+    SkaSize2D size;
+    SkaColor color;
+} CompiledColorRect;
+
+typedef struct CompiledParallax {
+    SkaVector2 scrollSpeed;
+} CompiledParallax;
+
+typedef struct CompiledParticles2D {
+    int32 amount;
+    SkaMinMaxVec2 initialVelocity;
+    SkaColor color;
+    f32 spread;
+    f32 lifeTime;
+    f32 damping;
+    f32 explosiveness;
+    int32 state;
+    int32 type;
+    SkaSize2D squareSize;
+} CompiledParticles2D;
+
+// Followed by 'activeTileCount' tiles
+typedef struct CompiledTilemap {
+    SkaSize2Di tileSize;
+    uint32 activeTileCount;
+} CompiledTilemap;
+
+typedef struct CompiledTile {
+    SkaVector2i position;
+    SkaVector2i renderCoords;
+} CompiledTile;
+
+typedef struct CompiledVisibilityNotifier2D {
+    SkaRect2 rect;
+    bool suspendWhenOffScreen;
+} CompiledVisibilityNotifier2D;
+
+static inline size_t compiled_scene_align(size_t size) {
+    return (size + CRE_COMPILED_SCENE_RECORD_ALIGNMENT - 1) & ~((size_t)CRE_COMPILED_SCENE_RECORD_ALIGNMENT - 1);
+}
+
+// Changes whenever a record layout changes so stale files fall back to json instead of being misread
+static uint32 compiled_scene_get_layout_hash() {
+    const size_t recordSizes[] = {
+        sizeof(CreCompiledSceneHeader), sizeof(CreCompiledSceneNode), sizeof(CompiledTransform2D), sizeof(CompiledSprite),
+        sizeof(CompiledAnimatedSprite), sizeof(CompiledAnimation), sizeof(CompiledAnimationFrame), sizeof(CompiledTextLabel),
+        sizeof(CompiledScript), sizeof(CompiledCollider2D), sizeof(CompiledColorRect), sizeof(CompiledParallax),
+        sizeof(CompiledParticles2D), sizeof(CompiledTilemap), sizeof(CompiledTile), sizeof(CompiledVisibilityNotifier2D),
+        sizeof(((NodeComponent*)NULL)->name),
+        TEXT_LABEL_BUFFER_SIZE, ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS, CRE_MAX_ANIMATION_FRAMES
+    };
+    uint32 hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(recordSizes) / sizeof(recordSizes[0]); i++) {
+        hash = (hash ^ (uint32)recordSizes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void cre_compiled_scene_get_path(const char* scenePath, char* buffer, size_t bufferSize) {
+    const char* extension = strrchr(scenePath, '.');
+    const size_t baseLength = extension ? (size_t)(extension - scenePath) : strlen(scenePath);
+    snprintf(buffer, bufferSize, "%.*s%s", (int)baseLength, scenePath, CRE_COMPILED_SCENE_FILE_EXTENSION);
+}
+
+//--- Compiler ---//
+typedef struct CompiledSceneBuffer {
+    uint8* data;
+    size_t size;
+    size_t capacity;
+} CompiledSceneBuffer;
+
+typedef struct CompiledSceneWriter {
+    CompiledSceneBuffer nodes;
+    CompiledSceneBuffer strings;
+    CompiledSceneBuffer componentBlob;
+    uint32 nodeCount;
+} CompiledSceneWriter;
+
+static void compiled_scene_buffer_reserve(CompiledSceneBuffer* buffer, size_t additionalSize) {
+    const size_t requiredCapacity = buffer->size + additionalSize;
+    if (requiredCapacity <= buffer->capacity) {
+        return;
+    }
+    size_t newCapacity = buffer->capacity > 0 ? buffer->capacity : CRE_COMPILED_SCENE_INITIAL_CAPACITY;
+    while (newCapacity < requiredCapacity) {
+        newCapacity *= 2;
+    }
+    uint8* newData = (uint8*)realloc(buffer->data, newCapacity);
+    SKA_ASSERT_FMT(newData, "Failed to allocate '%zu' bytes for compiled scene!", newCapacity);
+    buffer->data = newData;
+    buffer->capacity = newCapacity;
+}
+
+static void compiled_scene_buffer_write(CompiledSceneBuffer* buffer, const void* data, size_t size) {
+    compiled_scene_buffer_reserve(buffer, size);
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+}
+
+// Writes the record zero padded to the record alignment
+static void compiled_scene_buffer_write_record(CompiledSceneBuffer* buffer, const void* record, size_t size) {
+    const size_t alignedSize = compiled_scene_align(size);
+    compiled_scene_buffer_reserve(buffer, alignedSize);
+    memcpy(buffer->data + buffer->size, record, size);
+    memset(buffer->data + buffer->size + size, 0, alignedSize - size);
+    buffer->size += alignedSize;
+}
+
+// Strings are deduplicated (texture paths repeat a lot between animation frames), only runs offline so a scan is fine
+static uint32 compiled_scene_add_string(CompiledSceneWriter* writer, const char* string) {
+    if (string == NULL) {
+        return CRE_COMPILED_SCENE_NO_STRING;
+    }
+    size_t offset = 0;
+    while (offset < writer->strings.size) {
+        const char* existingString = (const char*)writer->strings.data + offset;
+        if (strcmp(existingString, string) == 0) {
+            return (uint32)offset;
+        }
+        offset += strlen(existingString) + 1;
+    }
+    const uint32 newOffset = (uint32)writer->strings.size;
+    compiled_scene_buffer_write(&writer->strings, string, strlen(string) + 1);
+    return newOffset;
+}
+
+static uint32 compiled_scene_add_tags(CompiledSceneWriter* writer, SkaArrayList* tags) {
+    if (tags == NULL || tags->size == 0) {
+        return CRE_COMPILED_SCENE_NO_STRING;
+    }
+    char joinedTags[1024] = {0};
+    size_t joinedLength = 0;
+    for (size_t i = 0; i < tags->size; i++) {
+        const char* tag = *(char**)ska_array_list_get(tags, i);
+        const int written = snprintf(joinedTags + joinedLength, sizeof(joinedTags) - joinedLength, i > 0 ? ",%s" : "%s", tag);
+        SKA_ASSERT_FMT(written > 0 && joinedLength + (size_t)written < sizeof(joinedTags), "Too many tags to compile for a node!");
+        joinedLength += (size_t)written;
+    }
+    return compiled_scene_add_string(writer, joinedTags);
+}
+
+static void compiled_scene_write_components(CompiledSceneWriter* writer, const JsonSceneNode* jsonNode, CreCompiledSceneNode* node) {
+    CompiledSceneBuffer* blob = &writer->componentBlob;
+    node->componentsOffset = (uint32)blob->size;
+    if (jsonNode->components[TRANSFORM2D_COMPONENT_INDEX]) {
+        const Transform2DComponent* transformComp = (Transform2DComponent*)jsonNode->components[TRANSFORM2D_COMPONENT_INDEX];
+        const CompiledTransform2D record = {
+            .localTransform = transformComp->localTransform,
+            .zIndex = transformComp->zIndex,
+            .isZIndexRelativeToParent = transformComp->isZIndexRelativeToParent,
+            .ignoreCamera = transformComp->ignoreCamera
+        };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_TRANSFORM2D;
+    }
+    if (jsonNode->components[SPRITE_COMPONENT_INDEX]) {
+        const SpriteComponent* spriteComp = (SpriteComponent*)jsonNode->components[SPRITE_COMPONENT_INDEX];
+        const CompiledSprite record = {
+            .drawSource = spriteComp->drawSource,
+            .origin = spriteComp->origin,
+            .modulate = spriteComp->modulate,
+            .flipH = spriteComp->flipH,
+            .flipV = spriteComp->flipV
+        };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_SPRITE;
+    }
+    if (jsonNode->components[ANIMATED_SPRITE_COMPONENT_INDEX]) {
+        const AnimatedSpriteComponentData* animSpriteData = (AnimatedSpriteComponentData*)jsonNode->components[ANIMATED_SPRITE_COMPONENT_INDEX];
+        CompiledAnimatedSprite record = {
+            .modulate = animSpriteData->modulate,
+            .origin = animSpriteData->origin,
+            .animationCount = (uint32)animSpriteData->animationCount,
+            .currentAnimation = CRE_COMPILED_SCENE_NO_STRING,
+            .isPlaying = animSpriteData->isPlaying,
+            .flipH = animSpriteData->flipH,
+            .flipV = animSpriteData->flipV,
+            .staggerStartAnimationTimes = animSpriteData->staggerStartAnimationTimes
+        };
+        for (size_t animationIndex = 0; animationIndex < animSpriteData->animationCount; animationIndex++) {
+            if (strcmp(animSpriteData->currentAnimation.name, animSpriteData->animations[animationIndex].name) == 0) {
+                record.currentAnimation = (uint32)animationIndex;
+            }
+        }
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        for (size_t animationIndex = 0; animationIndex < animSpriteData->animationCount; animationIndex++) {
+            const AnimationData* animationData = &animSpriteData->animations[animationIndex];
+            const CompiledAnimation animationRecord = {
+                .name = compiled_scene_add_string(writer, animationData->name),
+                .speed = animationData->speed,
+                .frameCount = (uint32)animationData->frameCount,
+                .doesLoop = animationData->doesLoop
+            };
+            compiled_scene_buffer_write_record(blob, &animationRecord, sizeof(animationRecord));
+            for (int32 frameIndex = 0; frameIndex < animationData->frameCount; frameIndex++) {
+                const AnimationFrameData* frameData = &animationData->animationFrames[frameIndex];
+                const CompiledAnimationFrame frameRecord = {
+                    .drawSource = frameData->drawSource,
+                    .frame = frameData->frame,
+                    .texturePath = compiled_scene_add_string(writer, frameData->texturePath)
+                };
+                compiled_scene_buffer_write_record(blob, &frameRecord, sizeof(frameRecord));
+            }
+        }
+        node->componentMask |= 1u << CompiledSceneComponent_ANIMATED_SPRITE;
+    }
+    if (jsonNode->components[TEXT_LABEL_COMPONENT_INDEX]) {
+        const TextLabelComponent* textLabelComp = (TextLabelComponent*)jsonNode->components[TEXT_LABEL_COMPONENT_INDEX];
+        const CompiledTextLabel record = { .color = textLabelComp->color, .text = compiled_scene_add_string(writer, textLabelComp->text) };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_TEXT_LABEL;
+    }
+    if (jsonNode->components[SCRIPT_COMPONENT_INDEX]) {
+        const ScriptComponent* scriptComp = (ScriptComponent*)jsonNode->components[SCRIPT_COMPONENT_INDEX];
+        const CompiledScript record = {
+            .classPath = compiled_scene_add_string(writer, scriptComp->classPath),
+            .className = compiled_scene_add_string(writer, scriptComp->className),
+            .contextType = (int32)scriptComp->contextType
+        };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_SCRIPT;
+    }
+    if (jsonNode->components[COLLIDER2D_COMPONENT_INDEX]) {
+        const Collider2DComponent* colliderComp = (Collider2DComponent*)jsonNode->components[COLLIDER2D_COMPONENT_INDEX];
+        const CompiledCollider2D record = { .extents = colliderComp->extents, .color = colliderComp->color };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_COLLIDER2D;
+    }
+    if (jsonNode->components[COLOR_RECT_COMPONENT_INDEX]) {
+        const ColorRectComponent* colorRectComp = (ColorRectComponent*)jsonNode->components[COLOR_RECT_COMPONENT_INDEX];
+        const CompiledColorRect record = { .size = colorRectComp->size, .color = colorRectComp->color };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_COLOR_RECT;
+    }
+    if (jsonNode->components[PARALLAX_COMPONENT_INDEX]) {
+        const ParallaxComponent* parallaxComp = (ParallaxComponent*)jsonNode->components[PARALLAX_COMPONENT_INDEX];
+        const CompiledParallax record = { .scrollSpeed = parallaxComp->scrollSpeed };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_PARALLAX;
+    }
+    if (jsonNode->components[PARTICLES2D_COMPONENT_INDEX]) {
+        const Particles2DComponent* particlesComp = (Particles2DComponent*)jsonNode->components[PARTICLES2D_COMPONENT_INDEX];
+        const CompiledParticles2D record = {
+            .amount = particlesComp->amount,
+            .initialVelocity = particlesComp->initialVelocity,
+            .color = particlesComp->color,
+            .spread = particlesComp->spread,
+            .lifeTime = particlesComp->lifeTime,
+            .damping = particlesComp->damping,
+            .explosiveness = particlesComp->explosiveness,
+            .state = (int32)particlesComp->state,
+            .type = (int32)particlesComp->type,
+            .squareSize = particlesComp->squareSize
+        };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_PARTICLES2D;
+    }
+    if (jsonNode->components[TILEMAP_COMPONENT_INDEX]) {
+        const TilemapComponent* tilemapComp = (TilemapComponent*)jsonNode->components[TILEMAP_COMPONENT_INDEX];
+        SkaArrayList* activeTiles = tilemapComp->tilemap->activeTiles;
+        const CompiledTilemap record = { .tileSize = tilemapComp->tilemap->tileset.tileSize, .activeTileCount = (uint32)activeTiles->size };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        for (size_t tileIndex = 0; tileIndex < activeTiles->size; tileIndex++) {
+            const CreTileData* tileData = *(CreTileData**)ska_array_list_get(activeTiles, tileIndex);
+            const CompiledTile tileRecord = { .position = tileData->position, .renderCoords = tileData->renderCoords };
+            compiled_scene_buffer_write_record(blob, &tileRecord, sizeof(tileRecord));
+        }
+        node->componentMask |= 1u << CompiledSceneComponent_TILEMAP;
+    }
+    if (jsonNode->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX]) {
+        const VisibilityNotifier2DComponent* visibilityNotifierComp = (VisibilityNotifier2DComponent*)jsonNode->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX];
+        const CompiledVisibilityNotifier2D record = { .rect = visibilityNotifierComp->rect, .suspendWhenOffScreen = visibilityNotifierComp->suspendWhenOffScreen };
+        compiled_scene_buffer_write_record(blob, &record, sizeof(record));
+        node->componentMask |= 1u << CompiledSceneComponent_VISIBILITY_NOTIFIER2D;
+    }
+    node->componentsSize = (uint32)blob->size - node->componentsOffset;
+}
+
+// Recursive, writes the node before its children so the node array ends up in pre-order
+static void compiled_scene_write_node(CompiledSceneWriter* writer, const JsonSceneNode* jsonNode, uint32 parentIndex) {
+    const uint32 nodeIndex = writer->nodeCount++;
+    CreCompiledSceneNode node = {
+        .name = compiled_scene_add_string(writer, jsonNode->name),
+        .parentIndex = parentIndex,
+        .type = (int32)jsonNode->type,
+        .componentMask = 0,
+        .texturePath = compiled_scene_add_string(writer, jsonNode->spriteTexturePath),
+        .fontUID = compiled_scene_add_string(writer, jsonNode->fontUID),
+        .shaderPath = compiled_scene_add_string(writer, jsonNode->shaderInstanceShaderPath),
+        .vertexShaderPath = compiled_scene_add_string(writer, jsonNode->shaderInstanceVertexPath),
+        .fragmentShaderPath = compiled_scene_add_string(writer, jsonNode->shaderInstanceFragmentPath),
+        .tags = compiled_scene_add_tags(writer, jsonNode->tags)
+    };
+    compiled_scene_write_components(writer, jsonNode, &node);
+    compiled_scene_buffer_write(&writer->nodes, &node, sizeof(node));
+
+    for (size_t i = 0; i < jsonNode->childrenCount; i++) {
+        compiled_scene_write_node(writer, jsonNode->children[i], nodeIndex);
+    }
+}
+
+bool cre_compiled_scene_compile(const char* scenePath, const char* outputPath) {
+    JsonSceneNode* rootJsonNode = cre_json_load_scene_file(scenePath);
+    if (rootJsonNode == NULL) {
+        ska_logger_error("Failed to compile scene, unable to load json scene at path '%s'!", scenePath);
+        return false;
+    }
+    CompiledSceneWriter writer = {0};
+    compiled_scene_write_node(&writer, rootJsonNode, CRE_COMPILED_SCENE_NO_PARENT);
+    cre_json_delete_json_scene_node(rootJsonNode);
+
+    CreCompiledSceneHeader header;
+    memcpy(header.magic, CRE_COMPILED_SCENE_FILE_MAGIC, 4);
+    header.version = CRE_COMPILED_SCENE_FILE_VERSION;
+    header.layoutHash = compiled_scene_get_layout_hash();
+    header.nodeCount = writer.nodeCount;
+    header.nodesOffset = (uint32)compiled_scene_align(sizeof(CreCompiledSceneHeader));
+    header.stringTableOffset = header.nodesOffset + (uint32)writer.nodes.size;
+    header.stringTableSize = (uint32)writer.strings.size;
+    header.componentBlobOffset = (uint32)compiled_scene_align(header.stringTableOffset + header.stringTableSize);
+    header.componentBlobSize = (uint32)writer.componentBlob.size;
+
+    bool success = false;
+    FILE* file = fopen(outputPath, "wb");
+    if (file) {
+        static const uint8 padding[CRE_COMPILED_SCENE_RECORD_ALIGNMENT] = {0};
+        success = fwrite(&header, sizeof(header), 1, file) == 1
+            && fwrite(padding, 1, header.nodesOffset - sizeof(header), file) == header.nodesOffset - sizeof(header)
+            && fwrite(writer.nodes.data, 1, writer.nodes.size, file) == writer.nodes.size
+            && fwrite(writer.strings.data, 1, writer.strings.size, file) == writer.strings.size
+            && fwrite(padding, 1, header.componentBlobOffset - (header.stringTableOffset + header.stringTableSize), file) == header.componentBlobOffset - (header.stringTableOffset + header.stringTableSize)
+            && fwrite(writer.componentBlob.data, 1, writer.componentBlob.size, file) == writer.componentBlob.size;
+        fclose(file);
+    }
+    if (success) {
+        ska_logger_info("Compiled scene '%s' to '%s' (%u nodes, %u bytes of components)", scenePath, outputPath, header.nodeCount, header.componentBlobSize);
+    } else {
+        ska_logger_error("Failed to write compiled scene to '%s'!", outputPath);
+    }
+    free(writer.nodes.data);
+    free(writer.strings.data);
+    free(writer.componentBlob.data);
+    return success;
+}
+
+bool cre_compiled_scene_compile_next_to_source(const char* scenePath) {
+    char compiledScenePath[512];
+    cre_compiled_scene_get_path(scenePath, compiledScenePath, sizeof(compiledScenePath));
+    return cre_compiled_scene_compile(scenePath, compiledScenePath);
+}
+
+//--- Loader ---//
+static bool compiled_scene_map_file(CreCompiledScene* compiledScene, const char* compiledScenePath) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(compiledScenePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    // The mapping keeps the file open
+    CloseHandle(file);
+    if (mapping == NULL) {
+        return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+    compiledScene->data = data;
+    compiledScene->dataSize = (size_t)fileSize.QuadPart;
+    compiledScene->mappingHandle = mapping;
+#else
+    const int file = open(compiledScenePath, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0) {
+        close(file);
+        return false;
+    }
+    void* data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping stays valid after closing the descriptor
+    close(file);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    compiledScene->data = data;
+    compiledScene->dataSize = (size_t)fileStat.st_size;
+#endif
+    compiledScene->isMapped = true;
+    return true;
+}
+
+static void compiled_scene_release_data(CreCompiledScene* compiledScene) {
+    if (compiledScene->data == NULL) {
+        return;
+    }
+    if (compiledScene->isMapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(compiledScene->data);
+        CloseHandle((HANDLE)compiledScene->mappingHandle);
+#else
+        munmap(compiledScene->data, compiledScene->dataSize);
+#endif
+    } else {
+        SKA_FREE(compiledScene->data);
+    }
+    compiledScene->data = NULL;
+}
+
+// Size of the fixed record every component writes, the variable length animations and tiles that follow are sized separately
+static size_t compiled_scene_get_record_size(CompiledSceneComponent component) {
+    switch (component) {
+        case CompiledSceneComponent_TRANSFORM2D: return sizeof(CompiledTransform2D);
+        case CompiledSceneComponent_SPRITE: return sizeof(CompiledSprite);
+        case CompiledSceneComponent_ANIMATED_SPRITE: return sizeof(CompiledAnimatedSprite);
+        case CompiledSceneComponent_TEXT_LABEL: return sizeof(CompiledTextLabel);
+        case CompiledSceneComponent_SCRIPT: return sizeof(CompiledScript);
+        case CompiledSceneComponent_COLLIDER2D: return sizeof(CompiledCollider2D);
+        case CompiledSceneComponent_COLOR_RECT: return sizeof(CompiledColorRect);
+        case CompiledSceneComponent_PARALLAX: return sizeof(CompiledParallax);
+        case CompiledSceneComponent_PARTICLES2D: return sizeof(CompiledParticles2D);
+        case CompiledSceneComponent_TILEMAP: return sizeof(CompiledTilemap);
+        case CompiledSceneComponent_VISIBILITY_NOTIFIER2D: return sizeof(CompiledVisibilityNotifier2D);
+    }
+    return 0;
+}
+
+// Returns the record at the cursor and moves the cursor past it, NULL if the record doesn't fit before 'end'
+static const void* compiled_scene_read_record_checked(const uint8** cursor, const uint8* end, size_t size) {
+    const size_t alignedSize = compiled_scene_align(size);
+    if ((size_t)(end - *cursor) < alignedSize) {
+        return NULL;
+    }
+    const void* record = *cursor;
+    *cursor += alignedSize;
+    return record;
+}
+
+// Walks the node's component records the same way 'cre_compiled_scene_set_node_components' reads them, so a corrupt file
+// is rejected when it's opened instead of overflowing a component while instancing
+static bool compiled_scene_is_node_valid(const CreCompiledScene* compiledScene, uint32 nodeIndex) {
+    const CreCompiledSceneHeader* header = compiledScene->header;
+    const CreCompiledSceneNode* node = &compiledScene->nodes[nodeIndex];
+    if ((size_t)node->componentsOffset + node->componentsSize > header->componentBlobSize
+        || (node->componentMask >> (CompiledSceneComponent_VISIBILITY_NOTIFIER2D + 1)) != 0
+        || (node->parentIndex != CRE_COMPILED_SCENE_NO_PARENT && node->parentIndex >= nodeIndex)) {
+        return false;
+    }
+    const uint8* cursor = compiledScene->componentBlob + node->componentsOffset;
+    const uint8* end = cursor + node->componentsSize;
+    for (uint32 component = CompiledSceneComponent_TRANSFORM2D; component <= CompiledSceneComponent_VISIBILITY_NOTIFIER2D; component++) {
+        if ((node->componentMask & (1u << component)) == 0) {
+            continue;
+        }
+        const void* record = compiled_scene_read_record_checked(&cursor, end, compiled_scene_get_record_size((CompiledSceneComponent)component));
+        if (record == NULL) {
+            return false;
+        }
+        if (component == CompiledSceneComponent_ANIMATED_SPRITE) {
+            const CompiledAnimatedSprite* animatedSpriteRecord = (const CompiledAnimatedSprite*)record;
+            if (animatedSpriteRecord->animationCount > ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS) {
+                return false;
+            }
+            for (uint32 animationIndex = 0; animationIndex < animatedSpriteRecord->animationCount; animationIndex++) {
+                const CompiledAnimation* animationRecord = compiled_scene_read_record_checked(&cursor, end, sizeof(CompiledAnimation));
+                if (animationRecord == NULL || animationRecord->frameCount > CRE_MAX_ANIMATION_FRAMES) {
+                    return false;
+                }
+                for (uint32 frameIndex = 0; frameIndex < animationRecord->frameCount; frameIndex++) {
+                    if (compiled_scene_read_record_checked(&cursor, end, sizeof(CompiledAnimationFrame)) == NULL) {
+                        return false;
+                    }
+                }
+            }
+        } else if (component == CompiledSceneComponent_TILEMAP) {
+            const CompiledTilemap* tilemapRecord = (const CompiledTilemap*)record;
+            if ((size_t)tilemapRecord->activeTileCount > (size_t)(end - cursor) / compiled_scene_align(sizeof(CompiledTile))) {
+                return false;
+            }
+            cursor += (size_t)tilemapRecord->activeTileCount * compiled_scene_align(sizeof(CompiledTile));
+        }
+    }
+    return cursor == end;
+}
+
+CreCompiledScene* cre_compiled_scene_open(const char* compiledScenePath) {
+    CreCompiledScene* compiledScene = SKA_ALLOC_ZEROED(CreCompiledScene);
+    // Loose files are mapped, otherwise it may be packed in the project archive which we can only read into memory
+    if (!compiled_scene_map_file(compiledScene, compiledScenePath)) {
+        size_t dataSize = 0;
+        char* data = ska_asset_file_loader_read_file_contents_as_string(compiledScenePath, &dataSize);
+        if (data == NULL) {
+            SKA_FREE(compiledScene);
+            return NULL;
+        }
+        compiledScene->data = data;
+        compiledScene->dataSize = dataSize;
+    }
+
+    const CreCompiledSceneHeader* header = (const CreCompiledSceneHeader*)compiledScene->data;
+    const bool isValid = compiledScene->dataSize >= sizeof(CreCompiledSceneHeader)
+        && memcmp(header->magic, CRE_COMPILED_SCENE_FILE_MAGIC, 4) == 0
+        && header->version == CRE_COMPILED_SCENE_FILE_VERSION
+        && header->layoutHash == compiled_scene_get_layout_hash()
+        && header->nodeCount > 0
+        && (size_t)header->nodesOffset + (size_t)header->nodeCount * sizeof(CreCompiledSceneNode) <= header->stringTableOffset
+        && (size_t)header->stringTableOffset + header->stringTableSize <= header->componentBlobOffset
+        && (size_t)header->componentBlobOffset + header->componentBlobSize <= compiledScene->dataSize;
+    if (!isValid) {
+        ska_logger_warn("Compiled scene at '%s' is invalid or from a different engine version, ignoring it", compiledScenePath);
+        compiled_scene_release_data(compiledScene);
+        SKA_FREE(compiledScene);
+        return NULL;
+    }
+    const uint8* data = (const uint8*)compiledScene->data;
+    compiledScene->header = header;
+    compiledScene->nodes = (const CreCompiledSceneNode*)(data + header->nodesOffset);
+    compiledScene->strings = (const char*)(data + header->stringTableOffset);
+    compiledScene->componentBlob = data + header->componentBlobOffset;
+    for (uint32 nodeIndex = 0; nodeIndex < header->nodeCount; nodeIndex++) {
+        if (!compiled_scene_is_node_valid(compiledScene, nodeIndex)) {
+            ska_logger_warn("Compiled scene at '%s' has an invalid node at index '%u', ignoring it", compiledScenePath, nodeIndex);
+            cre_compiled_scene_close(compiledScene);
+            return NULL;
+        }
+    }
+    return compiledScene;
+}
+
+CreCompiledScene* cre_compiled_scene_open_for_scene(const char* scenePath) {
+    char compiledScenePath[512];
+    cre_compiled_scene_get_path(scenePath, compiledScenePath, sizeof(compiledScenePath));
+    return cre_compiled_scene_open(compiledScenePath);
+}
+
+void cre_compiled_scene_close(CreCompiledScene* compiledScene) {
+    compiled_scene_release_data(compiledScene);
+    SKA_FREE(compiledScene);
+}
+
+const char* cre_compiled_scene_get_string(const CreCompiledScene* compiledScene, uint32 stringOffset) {
+    if (stringOffset == CRE_COMPILED_SCENE_NO_STRING) {
+        return NULL;
+    }
+    SKA_ASSERT_FMT(stringOffset < compiledScene->header->stringTableSize, "Invalid compiled scene string offset '%u'!", stringOffset);
+    return compiledScene->strings + stringOffset;
+}
+
+const char* cre_compiled_scene_get_node_tags(const CreCompiledScene* compiledScene, uint32 nodeIndex) {
+    SKA_ASSERT(nodeIndex < compiledScene->header->nodeCount);
+    return cre_compiled_scene_get_string(compiledScene, compiledScene->nodes[nodeIndex].tags);
+}
+
+static SkaShaderInstanceId compiled_scene_create_shader_instance(const CreCompiledScene* compiledScene, const CreCompiledSceneNode* node) {
+    const char* shaderPath = cre_compiled_scene_get_string(compiledScene, node->shaderPath);
+    const char* vertexPath = cre_compiled_scene_get_string(compiledScene, node->vertexShaderPath);
+    const char* fragmentPath = cre_compiled_scene_get_string(compiledScene, node->fragmentShaderPath);
+    SkaShaderInstanceId shaderInstanceId = SKA_SHADER_INSTANCE_INVALID_ID;
+    if (shaderPath) {
+        shaderInstanceId = ska_shader_cache_create_instance_and_add(shaderPath);
+    } else if (vertexPath && fragmentPath) {
+        shaderInstanceId = ska_shader_cache_create_instance_and_add_from_raw(vertexPath, fragmentPath);
+    } else {
+        return SKA_SHADER_INSTANCE_INVALID_ID;
+    }
+    SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(shaderInstanceId);
+    ska_renderer_set_sprite_shader_default_params(shaderInstance->shader);
+    return shaderInstanceId;
+}
+
+#define COMPILED_SCENE_HAS_COMPONENT(NODE, COMPONENT) (((NODE)->componentMask & (1u << (COMPONENT))) != 0)
+
+// Returns the record at the cursor and moves the cursor past it
+static inline const void* compiled_scene_read_record(const uint8** cursor, size_t size) {
+    const void* record = *cursor;
+    *cursor += compiled_scene_align(size);
+    return record;
+}
+
+void cre_compiled_scene_set_node_components(const CreCompiledScene* compiledScene, uint32 nodeIndex, SkaEntity entity) {
+    SKA_ASSERT(nodeIndex < compiledScene->header->nodeCount);
+    const CreCompiledSceneNode* node = &compiledScene->nodes[nodeIndex];
+    const uint8* cursor = compiledScene->componentBlob + node->componentsOffset;
+    CreEntityBuilder builder;
+    cre_entity_builder_begin(&builder, entity);
+
+    NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
+    ska_strcpy(nodeComponent->name, cre_compiled_scene_get_string(compiledScene, node->name));
+    nodeComponent->type = (NodeBaseType)node->type;
+    SKA_ASSERT_FMT(nodeComponent->type != NodeBaseType_INVALID, "Node '%s' has an invalid node type '%d'", nodeComponent->name, nodeComponent->type);
+    cre_entity_builder_set_component(&builder, NODE_COMPONENT_INDEX, nodeComponent);
+
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_TRANSFORM2D)) {
+        const CompiledTransform2D* record = compiled_scene_read_record(&cursor, sizeof(CompiledTransform2D));
+        Transform2DComponent* transform2DComponent = (Transform2DComponent*)cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX);
+        transform2DComponent->localTransform = record->localTransform;
+        transform2DComponent->zIndex = record->zIndex;
+        transform2DComponent->isZIndexRelativeToParent = record->isZIndexRelativeToParent;
+        transform2DComponent->ignoreCamera = record->ignoreCamera;
+        cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_SPRITE)) {
+        const CompiledSprite* record = compiled_scene_read_record(&cursor, sizeof(CompiledSprite));
+        SpriteComponent* spriteComponent = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+        spriteComponent->texture = ska_asset_manager_get_texture(cre_compiled_scene_get_string(compiledScene, node->texturePath));
+        spriteComponent->drawSource = record->drawSource;
+        spriteComponent->origin = record->origin;
+        spriteComponent->modulate = record->modulate;
+        spriteComponent->flipH = record->flipH;
+        spriteComponent->flipV = record->flipV;
+        spriteComponent->shaderInstanceId = compiled_scene_create_shader_instance(compiledScene, node);
+        cre_entity_builder_set_component(&builder, SPRITE_COMPONENT_INDEX, spriteComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_ANIMATED_SPRITE)) {
+        const CompiledAnimatedSprite* record = compiled_scene_read_record(&cursor, sizeof(CompiledAnimatedSprite));
+        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)cre_component_pool_create(ANIMATED_SPRITE_COMPONENT_INDEX);
+        animatedSpriteComponent->animationCount = record->animationCount;
+        animatedSpriteComponent->modulate = record->modulate;
+        animatedSpriteComponent->origin = record->origin;
+        animatedSpriteComponent->isPlaying = record->isPlaying;
+        animatedSpriteComponent->flipH = record->flipH;
+        animatedSpriteComponent->flipV = record->flipV;
+        animatedSpriteComponent->staggerStartAnimationTimes = record->staggerStartAnimationTimes;
+        for (uint32 animationIndex = 0; animationIndex < record->animationCount; animationIndex++) {
+            const CompiledAnimation* animationRecord = compiled_scene_read_record(&cursor, sizeof(CompiledAnimation));
+            CreAnimation* animation = &animatedSpriteComponent->animations[animationIndex];
+            ska_strcpy(animation->name, cre_compiled_scene_get_string(compiledScene, animationRecord->name));
+            animation->doesLoop = animationRecord->doesLoop;
+            animation->speed = animationRecord->speed;
+            animation->isValid = true;
+            animation->currentFrame = 0;
+            animation->frameCount = (int32)animationRecord->frameCount;
+            for (uint32 frameIndex = 0; frameIndex < animationRecord->frameCount; frameIndex++) {
+                const CompiledAnimationFrame* frameRecord = compiled_scene_read_record(&cursor, sizeof(CompiledAnimationFrame));
+                CreAnimationFrame* animationFrame = &animation->animationFrames[frameIndex];
+                animationFrame->texture = ska_asset_manager_get_texture(cre_compiled_scene_get_string(compiledScene, frameRecord->texturePath));
+                animationFrame->drawSource = frameRecord->drawSource;
+                animationFrame->frame = frameRecord->frame;
+            }
+            if (animationIndex == record->currentAnimation) {
+                animatedSpriteComponent->currentAnimation = animation;
+            }
+        }
+        animatedSpriteComponent->shaderInstanceId = compiled_scene_create_shader_instance(compiledScene, node);
+        cre_entity_builder_set_component(&builder, ANIMATED_SPRITE_COMPONENT_INDEX, animatedSpriteComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_TEXT_LABEL)) {
+        const CompiledTextLabel* record = compiled_scene_read_record(&cursor, sizeof(CompiledTextLabel));
+        TextLabelComponent* textLabelComponent = (TextLabelComponent*)cre_component_pool_create(TEXT_LABEL_COMPONENT_INDEX);
+        const char* fontUID = cre_compiled_scene_get_string(compiledScene, node->fontUID);
+        textLabelComponent->font = ska_asset_manager_get_font(fontUID != NULL ? fontUID : CRE_DEFAULT_FONT_ASSET.uid);
+        textLabelComponent->color = record->color;
+        ska_strcpy(textLabelComponent->text, cre_compiled_scene_get_string(compiledScene, record->text));
+        cre_entity_builder_set_component(&builder, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_SCRIPT)) {
+        const CompiledScript* record = compiled_scene_read_record(&cursor, sizeof(CompiledScript));
+        ScriptComponent* scriptComponent = (ScriptComponent*)cre_component_pool_create(SCRIPT_COMPONENT_INDEX);
+        ska_strcpy(scriptComponent->classPath, cre_compiled_scene_get_string(compiledScene, record->classPath));
+        ska_strcpy(scriptComponent->className, cre_compiled_scene_get_string(compiledScene, record->className));
+        scriptComponent->contextType = (CreScriptContextType)record->contextType;
+        cre_entity_builder_set_component(&builder, SCRIPT_COMPONENT_INDEX, scriptComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_COLLIDER2D)) {
+        const CompiledCollider2D* record = compiled_scene_read_record(&cursor, sizeof(CompiledCollider2D));
+        Collider2DComponent* collider2DComponent = (Collider2DComponent*)cre_component_pool_create(COLLIDER2D_COMPONENT_INDEX);
+        collider2DComponent->extents = record->extents;
+        collider2DComponent->color = record->color;
+        cre_entity_builder_set_component(&builder, COLLIDER2D_COMPONENT_INDEX, collider2DComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_COLOR_RECT)) {
+        const CompiledColorRect* record = compiled_scene_read_record(&cursor, sizeof(CompiledColorRect));
+        ColorRectComponent* colorRectComponent = (ColorRectComponent*)cre_component_pool_create(COLOR_RECT_COMPONENT_INDEX);
+        colorRectComponent->size = record->size;
+        colorRectComponent->color = record->color;
+        cre_entity_builder_set_component(&builder, COLOR_RECT_COMPONENT_INDEX, colorRectComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_PARALLAX)) {
+        const CompiledParallax* record = compiled_scene_read_record(&cursor, sizeof(CompiledParallax));
+        ParallaxComponent* parallaxComponent = (ParallaxComponent*)cre_component_pool_create(PARALLAX_COMPONENT_INDEX);
+        parallaxComponent->scrollSpeed = record->scrollSpeed;
+        cre_entity_builder_set_component(&builder, PARALLAX_COMPONENT_INDEX, parallaxComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_PARTICLES2D)) {
+        const CompiledParticles2D* record = compiled_scene_read_record(&cursor, sizeof(CompiledParticles2D));
+        Particles2DComponent* particles2DComponent = (Particles2DComponent*)cre_component_pool_create(PARTICLES2D_COMPONENT_INDEX);
+        particles2DComponent->amount = record->amount;
+        particles2DComponent->initialVelocity = record->initialVelocity;
+        particles2DComponent->color = record->color;
+        particles2DComponent->spread = record->spread;
+        particles2DComponent->lifeTime = record->lifeTime;
+        particles2DComponent->damping = record->damping;
+        particles2DComponent->explosiveness = record->explosiveness;
+        particles2DComponent->state = (Particle2DComponentState)record->state;
+        particles2DComponent->type = (Particle2DComponentType)record->type;
+        particles2DComponent->squareSize = record->squareSize;
+        cre_entity_builder_set_component(&builder, PARTICLES2D_COMPONENT_INDEX, particles2DComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_TILEMAP)) {
+        const CompiledTilemap* record = compiled_scene_read_record(&cursor, sizeof(CompiledTilemap));
+        TilemapComponent* tilemapComponent = tilemap_component_create();
+        tilemapComponent->tilemap->tileset.texture = ska_asset_manager_get_texture(cre_compiled_scene_get_string(compiledScene, node->texturePath));
+        tilemapComponent->tilemap->tileset.tileSize = record->tileSize;
+        for (uint32 tileIndex = 0; tileIndex < record->activeTileCount; tileIndex++) {
+            const CompiledTile* tileRecord = compiled_scene_read_record(&cursor, sizeof(CompiledTile));
+            cre_tilemap_set_tile_render_coord(tilemapComponent->tilemap, &tileRecord->position, &tileRecord->renderCoords);
+        }
+        cre_tilemap_commit_active_tile_changes(tilemapComponent->tilemap);
+        cre_entity_builder_set_component(&builder, TILEMAP_COMPONENT_INDEX, tilemapComponent);
+    }
+    if (COMPILED_SCENE_HAS_COMPONENT(node, CompiledSceneComponent_VISIBILITY_NOTIFIER2D)) {
+        const CompiledVisibilityNotifier2D* record = compiled_scene_read_record(&cursor, sizeof(CompiledVisibilityNotifier2D));
+        VisibilityNotifier2DComponent* visibilityNotifier2DComponent = (VisibilityNotifier2DComponent*)cre_component_pool_create(VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+        visibilityNotifier2DComponent->rect = record->rect;
+        visibilityNotifier2DComponent->suspendWhenOffScreen = record->suspendWhenOffScreen;
+        cre_entity_builder_set_component(&builder, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, visibilityNotifier2DComponent);
+    }
+    cre_entity_builder_build(&builder);
+    SKA_ASSERT_FMT(cursor == compiledScene->componentBlob + node->componentsOffset + node->componentsSize,
+                   "Compiled scene components for node '%u' weren't fully read!", nodeIndex);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include <seika/defines.h>
+#include <seika/ecs/entity.h>
+
+// Compiled scenes are a flat binary version of '.cscn' json scene files, produced offline (on export or with the
+// '-compile-scene' command line flag) so loading a scene doesn't need to parse json or build a 'JsonSceneNode' tree.
+// Layout: [header][node array in pre-order][string table][component blob]
+// Every node record points at its parent by index (parents always come before their children), strings are offsets into
+// the string table and each node's components are packed records in component index order within the component blob.
+// Records are tied to the engine build that compiled them, files with a different layout hash are rejected.
+
+#define CRE_COMPILED_SCENE_FILE_MAGIC "CSCB"
+#define CRE_COMPILED_SCENE_FILE_VERSION 3
+#define CRE_COMPILED_SCENE_FILE_EXTENSION ".cscnb"
+#define CRE_COMPILED_SCENE_NO_STRING ((uint32)-1)
+#define CRE_COMPILED_SCENE_NO_PARENT ((uint32)-1)
+
+typedef struct CreCompiledSceneHeader {
+    char magic[4];
+    uint32 version;
+    uint32 layoutHash;
+    uint32 nodeCount;
+    uint32 nodesOffset;
+    uint32 stringTableOffset;
+    uint32 stringTableSize;
+    uint32 componentBlobOffset;
+    uint32 componentBlobSize;
+} CreCompiledSceneHeader;
+
+typedef struct CreCompiledSceneNode {
+    uint32 name;
+    uint32 parentIndex; // 'CRE_COMPILED_SCENE_NO_PARENT' for the root
+    int32 type; // NodeBaseType
+    uint32 componentMask; // Bit per compiled component type, records are stored in bit order
+    uint32 componentsOffset; // Offset into the component blob
+    uint32 componentsSize;
+    uint32 texturePath;
+    uint32 fontUID;
+    uint32 shaderPath;
+    uint32 vertexShaderPath;
+    uint32 fragmentShaderPath;
+    uint32 tags; // Comma separated
+} CreCompiledSceneNode;
+
+typedef struct CreCompiledScene {
+    const CreCompiledSceneHeader* header;
+    const CreCompiledSceneNode* nodes;
+    const char* strings;
+    const uint8* componentBlob;
+    // Backing memory, either a read only file mapping or a heap copy when read from the project archive
+    void* data;
+    size_t dataSize;
+    bool isMapped;
+    void* mappingHandle; // Only used on windows
+} CreCompiledScene;
+
+// Compiles a json scene file (including external node sources) into a compiled scene file at 'outputPath'
+bool cre_compiled_scene_compile(const char* scenePath, const char* outputPath);
+// Same as above, writing next to the json scene with the compiled extension (e.g. 'main.cscn' -> 'main.cscnb')
+bool cre_compiled_scene_compile_next_to_source(const char* scenePath);
+// Writes the compiled scene path for a json scene path into 'buffer'
+void cre_compiled_scene_get_path(const char* scenePath, char* buffer, size_t bufferSize);
+// Maps the compiled scene file, returns NULL if it doesn't exist or was compiled by a different engine build
+CreCompiledScene* cre_compiled_scene_open(const char* compiledScenePath);
+// Opens the compiled version of a json scene path if there is one
+CreCompiledScene* cre_compiled_scene_open_for_scene(const char* scenePath);
+void cre_compiled_scene_close(CreCompiledScene* compiledScene);
+const char* cre_compiled_scene_get_string(const CreCompiledScene* compiledScene, uint32 stringOffset);
+// Returns the node's comma separated tags, NULL if it doesn't have any
+const char* cre_compiled_scene_get_node_tags(const CreCompiledScene* compiledScene, uint32 nodeIndex);
+// Creates and sets all components (including the node component) of a compiled node on the entity, resolving asset references
+void cre_compiled_scene_set_node_components(const CreCompiledScene* compiledScene, uint32 nodeIndex, SkaEntity entity);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,67 @@
+#include "node_name_table.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+#include <seika/data_structures/hash_map_string.h>
+
+typedef struct NodeName {
+    char value[CRE_NODE_NAME_MAX_LENGTH];
+} NodeName;
+
+static SkaStringHashMap* nameIdsByName = NULL;
+static NodeName* names = NULL; // Indexed by name id
+static uint32 nameCount = 0;
+static uint32 nameCapacity = 0;
+
+void cre_node_name_table_initialize() {
+    SKA_ASSERT(nameIdsByName == NULL);
+    nameIdsByName = ska_string_hash_map_create_default_capacity();
+    nameCount = 0;
+}
+
+void cre_node_name_table_finalize() {
+    SKA_ASSERT(nameIdsByName != NULL);
+    ska_string_hash_map_destroy(nameIdsByName);
+    nameIdsByName = NULL;
+    free(names);
+    names = NULL;
+    nameCount = 0;
+    nameCapacity = 0;
+}
+
+CreNodeNameId cre_node_name_table_intern(const char* name) {
+    const CreNodeNameId existingNameId = cre_node_name_table_find(name);
+    if (existingNameId != CRE_NODE_NAME_INVALID_ID) {
+        return existingNameId;
+    }
+    if (nameCount >= nameCapacity) {
+        nameCapacity = nameCapacity > 0 ? nameCapacity * 2 : 64;
+        names = (NodeName*)realloc(names, sizeof(NodeName) * nameCapacity);
+        SKA_ASSERT_FMT(names, "Failed to grow node name table to '%u' names!", nameCapacity);
+    }
+    CreNodeNameId nameId = nameCount++;
+    strncpy(names[nameId].value, name, CRE_NODE_NAME_MAX_LENGTH - 1);
+    names[nameId].value[CRE_NODE_NAME_MAX_LENGTH - 1] = '\0';
+    // Keyed by the truncated name so it always matches what's stored in node components
+    ska_string_hash_map_add(nameIdsByName, names[nameId].value, &nameId, sizeof(CreNodeNameId));
+    return nameId;
+}
+
+CreNodeNameId cre_node_name_table_find(const char* name) {
+    SKA_ASSERT(nameIdsByName != NULL);
+    if (ska_string_hash_map_has(nameIdsByName, name)) {
+        return *(CreNodeNameId*)ska_string_hash_map_get(nameIdsByName, name);
+    }
+    return CRE_NODE_NAME_INVALID_ID;
+}
+
+const char* cre_node_name_table_get_name(CreNodeNameId nameId) {
+    SKA_ASSERT_FMT(nameId < nameCount, "Invalid node name id '%u'!", nameId);
+    return names[nameId].value;
+}
+
+uint32 cre_node_name_table_get_count() {
+    return nameCount;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+// Global table of interned node names (and group tags), each distinct name gets a 32-bit id so name lookups can hash and
+// compare integers.
+// Ids stay valid until the table is finalized, names are capped to the size of 'NodeComponent::name'.
+
+#define CRE_NODE_NAME_MAX_LENGTH 32
+#define CRE_NODE_NAME_INVALID_ID ((CreNodeNameId)-1)
+
+typedef uint32 CreNodeNameId;
+
+void cre_node_name_table_initialize();
+void cre_node_name_table_finalize();
+// Returns the id for the name, adding it to the table if it hasn't been interned yet
+CreNodeNameId cre_node_name_table_intern(const char* name);
+// Returns the id for the name without adding it, 'CRE_NODE_NAME_INVALID_ID' if it was never interned
+CreNodeNameId cre_node_name_table_find(const char* name);
+const char* cre_node_name_table_get_name(CreNodeNameId nameId);
+uint32 cre_node_name_table_get_count();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,276 @@
+#include "node_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+#include <seika/ecs/ecs.h>
+
+#include "scene_manager.h"
+#include "../ecs/ecs_globals.h"
+#include "../ecs/component.h"
+#include "../ecs/component_pool.h"
+#include "../ecs/component_versions.h"
+#include "../ecs/components/node_component.h"
+#include "../ecs/components/transform2d_component.h"
+#include "../ecs/components/sprite_component.h"
+#include "../ecs/components/animated_sprite_component.h"
+#include "../ecs/components/visibility_notifier2d_component.h"
+#include "../utils/entity_paged_array.h"
+
+// Template component values of one node, in pre-order of the instance's tree
+typedef struct NodePoolSnapshotNode {
+    void* components[CRE_MAX_COMPONENTS]; // NULL if the node doesn't have the component or it isn't reset
+} NodePoolSnapshotNode;
+
+typedef struct NodePool {
+    SkaEntity* idleRoots;
+    uint32 idleCount;
+    uint32 idleCapacity;
+    NodePoolSnapshotNode* snapshotNodes;
+    uint32 snapshotNodeCount;
+    uint32 snapshotNodeCapacity;
+    bool hasSnapshot;
+    uint32 activeCount;
+    uint32 createdCount;
+    uint32 reusedCount;
+} NodePool;
+
+typedef struct NodePoolEntityData {
+    CreSceneCacheId cacheId; // 'CRE_SCENE_CACHE_INVALID_ID' if the entity isn't an instance root
+    uint32 idleIndex;
+    bool isIdle;
+} NodePoolEntityData;
+
+static NodePool nodePools[CRE_SCENE_CACHE_MAX_ITEMS];
+static CreEntityPagedArray poolEntityData = { .elementSize = sizeof(NodePoolEntityData) };
+
+static inline NodePool* node_pool_get(CreSceneCacheId cacheId) {
+    SKA_ASSERT_FMT(cacheId >= 0 && cacheId < CRE_SCENE_CACHE_MAX_ITEMS, "Invalid scene cache id '%d'!", cacheId);
+    return &nodePools[cacheId];
+}
+
+static NodePoolEntityData* node_pool_find_entity_data(SkaEntity entity) {
+    NodePoolEntityData* entityData = (NodePoolEntityData*)cre_entity_paged_array_get(&poolEntityData, entity);
+    if (entityData == NULL || entityData->cacheId == CRE_SCENE_CACHE_INVALID_ID) {
+        return NULL;
+    }
+    return entityData;
+}
+
+// Script components aren't reset as the script instance is kept, tilemaps aren't pooled components
+static bool node_pool_is_reset_component(SkaComponentIndex componentIndex) {
+    return componentIndex != SCRIPT_COMPONENT_INDEX && cre_component_pool_is_registered(componentIndex);
+}
+
+static void node_pool_snapshot_node(NodePool* pool, const SceneTreeNode* treeNode) {
+    if (pool->snapshotNodeCount >= pool->snapshotNodeCapacity) {
+        pool->snapshotNodeCapacity = pool->snapshotNodeCapacity > 0 ? pool->snapshotNodeCapacity * 2 : 8;
+        pool->snapshotNodes = (NodePoolSnapshotNode*)realloc(pool->snapshotNodes, sizeof(NodePoolSnapshotNode) * pool->snapshotNodeCapacity);
+        SKA_ASSERT(pool->snapshotNodes);
+    }
+    NodePoolSnapshotNode* snapshotNode = &pool->snapshotNodes[pool->snapshotNodeCount++];
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        const void* component = node_pool_is_reset_component(i) ? ska_ecs_component_manager_get_component_unchecked(treeNode->entity, i) : NULL;
+        snapshotNode->components[i] = NULL;
+        if (component != NULL) {
+            const size_t componentSize = cre_component_pool_get_component_size(i);
+            snapshotNode->components[i] = malloc(componentSize);
+            SKA_ASSERT(snapshotNode->components[i]);
+            memcpy(snapshotNode->components[i], component, componentSize);
+        }
+    }
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        node_pool_snapshot_node(pool, childNode);
+    }
+}
+
+// Copies the template values back, keeping event observers, shader instances and everything tied to the node's identity
+static void node_pool_reset_component(SkaEntity entity, SkaComponentIndex componentIndex, const void* templateComponent) {
+    void* component = ska_ecs_component_manager_get_component_unchecked(entity, componentIndex);
+    if (component == NULL) {
+        return;
+    }
+    if (componentIndex == NODE_COMPONENT_INDEX) {
+        NodeComponent* nodeComponent = (NodeComponent*)component;
+        nodeComponent->timeDilation.value = ((const NodeComponent*)templateComponent)->timeDilation.value;
+        nodeComponent->timeDilation.cacheInvalid = true;
+    } else if (componentIndex == TRANSFORM2D_COMPONENT_INDEX) {
+        Transform2DComponent* transformComp = (Transform2DComponent*)component;
+        const Transform2DComponent* templateTransformComp = (const Transform2DComponent*)templateComponent;
+        transformComp->localTransform = templateTransformComp->localTransform;
+        transformComp->zIndex = templateTransformComp->zIndex;
+        transformComp->isZIndexRelativeToParent = templateTransformComp->isZIndexRelativeToParent;
+        transformComp->ignoreCamera = templateTransformComp->ignoreCamera;
+        transformComp->isGlobalTransformDirty = true;
+    } else if (componentIndex == SPRITE_COMPONENT_INDEX) {
+        SpriteComponent* spriteComponent = (SpriteComponent*)component;
+        const SkaShaderInstanceId shaderInstanceId = spriteComponent->shaderInstanceId;
+        memcpy(spriteComponent, templateComponent, sizeof(SpriteComponent));
+        spriteComponent->shaderInstanceId = shaderInstanceId;
+    } else if (componentIndex == ANIMATED_SPRITE_COMPONENT_INDEX) {
+        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)component;
+        const AnimatedSpriteComponent* templateAnimatedSprite = (const AnimatedSpriteComponent*)templateComponent;
+        const SkaShaderInstanceId shaderInstanceId = animatedSpriteComponent->shaderInstanceId;
+        const SkaEvent onFrameChanged = animatedSpriteComponent->onFrameChanged;
+        const SkaEvent onAnimationFinished = animatedSpriteComponent->onAnimationFinished;
+        memcpy(animatedSpriteComponent, templateAnimatedSprite, sizeof(AnimatedSpriteComponent));
+        if (templateAnimatedSprite->currentAnimation != NULL) {
+            animatedSpriteComponent->currentAnimation = &animatedSpriteComponent->animations[templateAnimatedSprite->currentAnimation - templateAnimatedSprite->animations];
+        }
+        animatedSpriteComponent->shaderInstanceId = shaderInstanceId;
+        animatedSpriteComponent->onFrameChanged = onFrameChanged;
+        animatedSpriteComponent->onAnimationFinished = onAnimationFinished;
+    } else if (componentIndex == VISIBILITY_NOTIFIER2D_COMPONENT_INDEX) {
+        // 'isOnScreen' is owned by the visibility notifier system, pooled notifiers are reported as exited on its next update
+        VisibilityNotifier2DComponent* visibilityNotifierComp = (VisibilityNotifier2DComponent*)component;
+        const VisibilityNotifier2DComponent* templateVisibilityNotifierComp = (const VisibilityNotifier2DComponent*)templateComponent;
+        visibilityNotifierComp->rect = templateVisibilityNotifierComp->rect;
+        visibilityNotifierComp->suspendWhenOffScreen = templateVisibilityNotifierComp->suspendWhenOffScreen;
+    } else {
+        memcpy(component, templateComponent, cre_component_pool_get_component_size(componentIndex));
+    }
+}
+
+// Nodes added to the instance after it was created are past the snapshot and keep their values
+static void node_pool_reset_node(const NodePool* pool, const SceneTreeNode* treeNode, uint32* snapshotIndex) {
+    if (*snapshotIndex >= pool->snapshotNodeCount) {
+        return;
+    }
+    const NodePoolSnapshotNode* snapshotNode = &pool->snapshotNodes[(*snapshotIndex)++];
+    for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+        if (snapshotNode->components[i] != NULL) {
+            node_pool_reset_component(treeNode->entity, i, snapshotNode->components[i]);
+            cre_component_versions_mark_changed(treeNode->entity, i);
+        }
+    }
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        node_pool_reset_node(pool, childNode, snapshotIndex);
+    }
+}
+
+static void node_pool_destroy_snapshot(NodePool* pool) {
+    for (uint32 nodeIndex = 0; nodeIndex < pool->snapshotNodeCount; nodeIndex++) {
+        for (SkaComponentIndex i = 0; i < CRE_MAX_COMPONENTS; i++) {
+            free(pool->snapshotNodes[nodeIndex].components[i]);
+        }
+    }
+    free(pool->snapshotNodes);
+    pool->snapshotNodes = NULL;
+    pool->snapshotNodeCount = 0;
+    pool->snapshotNodeCapacity = 0;
+    pool->hasSnapshot = false;
+}
+
+void cre_node_pool_initialize() {
+    const NodePoolEntityData defaultEntityData = { .cacheId = CRE_SCENE_CACHE_INVALID_ID, .idleIndex = 0, .isIdle = false };
+    cre_entity_paged_array_initialize(&poolEntityData, sizeof(NodePoolEntityData), &defaultEntityData);
+    memset(nodePools, 0, sizeof(nodePools));
+}
+
+void cre_node_pool_finalize() {
+    for (CreSceneCacheId cacheId = 0; cacheId < CRE_SCENE_CACHE_MAX_ITEMS; cacheId++) {
+        NodePool* pool = &nodePools[cacheId];
+        node_pool_destroy_snapshot(pool);
+        free(pool->idleRoots);
+        *pool = (NodePool){0};
+    }
+    cre_entity_paged_array_finalize(&poolEntityData);
+}
+
+SceneTreeNode* cre_node_pool_acquire(CreSceneCacheId cacheId) {
+    NodePool* pool = node_pool_get(cacheId);
+    if (pool->idleCount > 0) {
+        const SkaEntity rootEntity = pool->idleRoots[--pool->idleCount];
+        NodePoolEntityData* entityData = node_pool_find_entity_data(rootEntity);
+        entityData->isIdle = false;
+        pool->activeCount++;
+        pool->reusedCount++;
+        return cre_scene_manager_get_entity_tree_node(rootEntity);
+    }
+
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene(cacheId);
+    if (sceneTemplate == NULL) {
+        return NULL;
+    }
+    SceneTreeNode* rootNode = cre_scene_manager_stage_scene_nodes_from_template(sceneTemplate);
+    // Freshly staged nodes hold the template's values
+    if (!pool->hasSnapshot) {
+        node_pool_snapshot_node(pool, rootNode);
+        pool->hasSnapshot = true;
+    }
+    NodePoolEntityData* entityData = (NodePoolEntityData*)cre_entity_paged_array_get_or_create(&poolEntityData, rootNode->entity);
+    *entityData = (NodePoolEntityData){ .cacheId = cacheId, .idleIndex = 0, .isIdle = false };
+    pool->activeCount++;
+    pool->createdCount++;
+    return rootNode;
+}
+
+bool cre_node_pool_release(SkaEntity rootEntity) {
+    NodePoolEntityData* entityData = node_pool_find_entity_data(rootEntity);
+    if (entityData == NULL || entityData->isIdle || !cre_scene_manager_has_entity_tree_node(rootEntity)) {
+        return false;
+    }
+    const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(rootEntity, NODE_COMPONENT_INDEX);
+    if (nodeComponent != NULL && nodeComponent->queuedForDeletion) {
+        return false;
+    }
+    NodePool* pool = node_pool_get(entityData->cacheId);
+    cre_scene_manager_detach_pooled_node(rootEntity);
+    uint32 snapshotIndex = 0;
+    node_pool_reset_node(pool, cre_scene_manager_get_entity_tree_node(rootEntity), &snapshotIndex);
+
+    if (pool->idleCount >= pool->idleCapacity) {
+        pool->idleCapacity = pool->idleCapacity > 0 ? pool->idleCapacity * 2 : 16;
+        pool->idleRoots = (SkaEntity*)realloc(pool->idleRoots, sizeof(SkaEntity) * pool->idleCapacity);
+        SKA_ASSERT(pool->idleRoots);
+    }
+    entityData->idleIndex = pool->idleCount;
+    entityData->isIdle = true;
+    pool->idleRoots[pool->idleCount++] = rootEntity;
+    pool->activeCount--;
+    return true;
+}
+
+bool cre_node_pool_is_instance_root(SkaEntity entity) {
+    return node_pool_find_entity_data(entity) != NULL;
+}
+
+void cre_node_pool_remove_entity(SkaEntity entity) {
+    NodePoolEntityData* entityData = node_pool_find_entity_data(entity);
+    if (entityData == NULL) {
+        return;
+    }
+    NodePool* pool = node_pool_get(entityData->cacheId);
+    if (entityData->isIdle) {
+        // Swap the last idle root into the removed root's place
+        const SkaEntity lastRoot = pool->idleRoots[--pool->idleCount];
+        if (lastRoot != entity) {
+            pool->idleRoots[entityData->idleIndex] = lastRoot;
+            node_pool_find_entity_data(lastRoot)->idleIndex = entityData->idleIndex;
+        }
+    } else {
+        pool->activeCount--;
+    }
+    cre_entity_paged_array_release(&poolEntityData, entity);
+}
+
+void cre_node_pool_clear() {
+    for (CreSceneCacheId cacheId = 0; cacheId < CRE_SCENE_CACHE_MAX_ITEMS; cacheId++) {
+        const NodePool* pool = &nodePools[cacheId];
+        // Idle roots are removed from the pool once their deletion is processed
+        for (uint32 i = 0; i < pool->idleCount; i++) {
+            cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_entity_tree_node(pool->idleRoots[i]));
+        }
+    }
+}
+
+CreNodePoolStats cre_node_pool_get_stats(CreSceneCacheId cacheId) {
+    const NodePool* pool = node_pool_get(cacheId);
+    return (CreNodePoolStats){
+        .activeCount = pool->activeCount,
+        .idleCount = pool->idleCount,
+        .createdCount = pool->createdCount,
+        .reusedCount = pool->reusedCount
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/ecs/entity.h>
+
+#include "scene_tree.h"
+#include "scene_template_cache.h"
+
+// Pools instances of scene templates that are spawned and freed often (projectiles, hit effects, etc...).  Released
+// instances aren't deleted, they're detached from their parent, skipped by systems and reset to the template's component
+// values until they're acquired again.  Reusing an instance skips entity creation, component set up, script instancing
+// and system registration.  Scripts keep their state between uses, '_start' is only called when an instance is created.
+
+typedef struct CreNodePoolStats {
+    uint32 activeCount; // Acquired and not released yet
+    uint32 idleCount; // Released and waiting to be acquired
+    uint32 createdCount;
+    uint32 reusedCount;
+} CreNodePoolStats;
+
+void cre_node_pool_initialize();
+void cre_node_pool_finalize();
+// Returns an idle instance if there is one, otherwise stages a new instance.  Either way the root is added to the scene
+// with 'cre_scene_manager_add_node_as_child'.  Returns NULL if the scene template can't be loaded
+SceneTreeNode* cre_node_pool_acquire(CreSceneCacheId cacheId);
+// Returns false if the entity isn't the root of an acquired instance that's in the scene tree
+bool cre_node_pool_release(SkaEntity rootEntity);
+bool cre_node_pool_is_instance_root(SkaEntity entity);
+// Called when an entity is deleted, forgets it if it's an instance root
+void cre_node_pool_remove_entity(SkaEntity entity);
+// Queues every idle instance for deletion, acquired instances are deleted along with the tree they're in
+void cre_node_pool_clear();
+CreNodePoolStats cre_node_pool_get_stats(CreSceneCacheId cacheId);
+
+#ifdef __cplusplus
+}
+#endif
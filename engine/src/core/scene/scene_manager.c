@@ -1,7 +1,10 @@
 #include "scene_manager.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+#include <SDL3/SDL.h>
+
 #include <seika/logger.h>
 #include <seika/string.h>
 #include <seika/assert.h>
@@ -11,14 +14,20 @@
 #include <seika/ecs/ecs.h>
 #include <seika/asset/asset_manager.h>
 #include <seika/data_structures/hash_map.h>
-#include <seika/data_structures/static_array.h>
 
 #include "scene_utils.h"
 #include "scene_template_cache.h"
+#include "compiled_scene.h"
+#include "node_name_table.h"
+#include "node_pool.h"
 #include "../world.h"
+#include "../node_event.h"
 #include "../game_properties.h"
 #include "../tilemap/tilemap.h"
 #include "../ecs/ecs_globals.h"
+#include "../ecs/component_pool.h"
+#include "../ecs/entity_builder.h"
+#include "../ecs/component_versions.h"
 #include "../ecs/components/sprite_component.h"
 #include "../ecs/components/animated_sprite_component.h"
 #include "../ecs/components/text_label_component.h"
@@ -28,30 +37,41 @@
 #include "../ecs/components/parallax_component.h"
 #include "../ecs/components/particles2d_component.h"
 #include "../ecs/components/tilemap_component.h"
+#include "../ecs/components/visibility_notifier2d_component.h"
 #include "../camera/camera_manager.h"
 #include "../camera/camera.h"
+#include "../utils/entity_paged_array.h"
 
 // --- Scene Tree --- //
 // Executes function on passed in tree node and all child tree nodes
+// Iterative post order walk over the sibling links so deep trees don't recurse, the next node is found before calling
+// 'func' in case it unlinks or frees the node.
 void cre_scene_execute_on_all_tree_nodes(SceneTreeNode* treeNode, ExecuteOnAllTreeNodesFunc func) {
-    for (size_t i = 0; i < treeNode->childCount; i++) {
-        cre_scene_execute_on_all_tree_nodes(treeNode->children[i], func);
+    SceneTreeNode* node = treeNode;
+    while (node->firstChild != NULL) {
+        node = node->firstChild;
+    }
+    while (node != NULL) {
+        SceneTreeNode* nextNode = NULL;
+        if (node != treeNode) {
+            if (node->nextSibling != NULL) {
+                nextNode = node->nextSibling;
+                while (nextNode->firstChild != NULL) {
+                    nextNode = nextNode->firstChild;
+                }
+            } else {
+                nextNode = node->parent;
+            }
+        }
+        func(node);
+        node = nextNode;
     }
-    func(treeNode);
 }
 
 typedef struct SceneTree {
     SceneTreeNode* root;
 } SceneTree;
 
-SceneTreeNode* cre_scene_tree_create_tree_node(SkaEntity entity, SceneTreeNode* parent) {
-    SceneTreeNode* treeNode = SKA_ALLOC_ZEROED(SceneTreeNode);
-    treeNode->entity = entity;
-    treeNode->parent = parent;
-    treeNode->childCount = 0;
-    return treeNode;
-}
-
 // --- Scene --- //
 typedef struct Scene {
     const char* scenePath;
@@ -67,58 +87,541 @@ Scene* cre_scene_create_scene(const char* scenePath) {
 }
 
 // --- Scene Manager --- //
-SkaEntity entitiesQueuedForCreation[SKA_MAX_ENTITIES];
-size_t entitiesQueuedForCreationSize = 0;
-SkaEntity entitiesQueuedForDeletion[SKA_MAX_ENTITIES];
-size_t entitiesQueuedForDeletionSize = 0;
+// Queues grow as needed and keep their capacity until the scene manager is finalized
+typedef struct SceneEntityQueue {
+    SkaEntity* entities;
+    size_t count;
+    size_t capacity;
+} SceneEntityQueue;
 
-SKA_STATIC_ARRAY_CREATE(SkaEntity, SKA_MAX_ENTITIES, entitiesToUnlinkParent);
+static SceneEntityQueue entitiesQueuedForCreation = { .entities = NULL, .count = 0, .capacity = 0 };
+static SceneEntityQueue entitiesQueuedForDeletion = { .entities = NULL, .count = 0, .capacity = 0 };
+// Bit per entity that's in 'entitiesQueuedForDeletion' so checking for duplicates doesn't scan the queue
+static uint32 entitiesQueuedForDeletionBits[(SKA_MAX_ENTITIES + 31) / 32];
+
+static SceneEntityQueue entitiesToUnlinkParent = { .entities = NULL, .count = 0, .capacity = 0 };
+// Roots of subtrees whose global transforms were invalidated since the last 'cre_scene_manager_update_global_transforms()'
+static SceneEntityQueue entitiesWithDirtyGlobalTransform = { .entities = NULL, .count = 0, .capacity = 0 };
+// Entities with a transform changed event waiting for 'cre_scene_manager_flush_transform_changed_events()'
+static SceneEntityQueue transformChangedEntities = { .entities = NULL, .count = 0, .capacity = 0 };
+static uint32 transformChangedEntityBits[(SKA_MAX_ENTITIES + 31) / 32];
+// Bit per entity in an idle pooled instance (see 'node_pool.h')
+static uint32 pooledEntityBits[(SKA_MAX_ENTITIES + 31) / 32];
+// Bit per disabled and pausable entity from the process modes resolved from the tree, only refreshed when modes change.
+// Pausing only flips 'isSceneTreePaused', the pausable bits are tested against it
+static uint32 processDisabledEntityBits[(SKA_MAX_ENTITIES + 31) / 32];
+static uint32 processPausableEntityBits[(SKA_MAX_ENTITIES + 31) / 32];
+static bool isSceneTreePaused = false;
+static CreOnNodeProcessDisabledChangedFunc onNodeProcessDisabledChangedFunc = NULL;
+// Bit per entity suspended by its own visibility notifier and bit per entity suspended by itself or an ancestor
+static uint32 offScreenSuspendedSelfBits[(SKA_MAX_ENTITIES + 31) / 32];
+static uint32 offScreenSuspendedEntityBits[(SKA_MAX_ENTITIES + 31) / 32];
 
 #ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
 // Will need a different mechanism for 3D (maybe just storing a vector3, but this is fine for now
-SKA_STATIC_ARRAY_CREATE(SkaTransform2D , SKA_MAX_ENTITIES, entityPrevGlobalTransforms);
+static CreEntityPagedArray entityPrevGlobalTransforms = { .elementSize = sizeof(SkaTransform2D) };
 #endif // CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
 
 Scene* activeScene = NULL;
 Scene* queuedSceneToChangeTo = NULL;
 
-static SkaHashMap* entityToTreeNodeMap = NULL;
-static SkaHashMap* entityToStagedTreeNodeMap = NULL;
+// Per entity scene state, paged so memory follows the live entities instead of 'SKA_MAX_ENTITIES'.  An entity's element is
+// released once it's deleted.
+typedef struct SceneEntityData {
+    SceneTreeNode* treeNode; // NULL if not in the tree
+    SceneTreeNode* stagedTreeNode;
+    CreNodeNameId nameId;
+    SkaEntity nameIndexParent; // Parent the entity is indexed under, 'SKA_NULL_ENTITY' for roots and entities that aren't in the tree
+    uint8 processMode; // Resolved from the tree, never 'NodeProcessMode_INHERIT'
+} SceneEntityData;
+
+static const SceneEntityData defaultSceneEntityData = { .treeNode = NULL, .stagedTreeNode = NULL, .nameId = CRE_NODE_NAME_INVALID_ID, .nameIndexParent = SKA_NULL_ENTITY, .processMode = NodeProcessMode_PAUSABLE };
+static CreEntityPagedArray sceneEntityData = { .elementSize = sizeof(SceneEntityData) };
+static bool isSceneManagerInitialized = false;
+// Shader instances shared between entities (e.g. from 'cre_scene_manager_instantiate_many'), destroyed once the last one is deleted
+static SkaHashMap* sharedShaderInstanceRefCounts = NULL;
+
+// Child name index
+// Children in the tree are hashed by (parent entity, interned name) so looking them up by name doesn't walk the children.
+// Siblings can share a name, the first one added is returned and the next one takes over when it's deleted
+typedef struct SceneChildNameKey {
+    SkaEntity parent;
+    CreNodeNameId nameId;
+} SceneChildNameKey;
+
+typedef struct SceneChildNameEntry {
+    SkaEntity child;
+    uint32 count; // Number of children of the parent with the name
+} SceneChildNameEntry;
+
+static SkaHashMap* childNameIndex = NULL;
+
+// Groups
+// Each group (interned tag) keeps a dense list of its entities, entities keep where they're stored in each of their groups
+// so adding and removing (swapping the last entity in) is O(1)
+typedef struct SceneGroup {
+    CreNodeNameId tagId;
+    SkaEntity* entities;
+    uint32 count;
+    uint32 capacity;
+} SceneGroup;
+
+typedef struct SceneGroupMembership {
+    uint32 groupIndex;
+    uint32 denseIndex;
+} SceneGroupMembership;
+
+static SceneGroup* sceneGroups = NULL;
+static uint32 sceneGroupCount = 0;
+static uint32 sceneGroupCapacity = 0;
+static SkaHashMap* sceneGroupIndicesByTag = NULL;
+typedef struct SceneEntityGroups {
+    SceneGroupMembership memberships[CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE];
+    uint8 count;
+} SceneEntityGroups;
+
+static CreEntityPagedArray entityGroups = { .elementSize = sizeof(SceneEntityGroups) };
+
+// Returns the default state for entities that were never written to
+static inline const SceneEntityData* scene_manager_find_entity_data(SkaEntity entity) {
+    const SceneEntityData* entityData = (SceneEntityData*)cre_entity_paged_array_get(&sceneEntityData, entity);
+    return entityData != NULL ? entityData : &defaultSceneEntityData;
+}
+
+static inline SceneEntityData* scene_manager_get_entity_data(SkaEntity entity) {
+    return (SceneEntityData*)cre_entity_paged_array_get_or_create(&sceneEntityData, entity);
+}
+
+static inline SceneTreeNode* scene_manager_find_tree_node(SkaEntity entity) {
+    return scene_manager_find_entity_data(entity)->treeNode;
+}
+
+// Defined after the scene entity data as every node gets an element once its tree node is created, that's what
+// 'cre_scene_manager_find_next_node_entity()' walks
+SceneTreeNode* cre_scene_tree_create_tree_node(SkaEntity entity, SceneTreeNode* parent) {
+    SceneTreeNode* treeNode = cre_scene_tree_node_pool_allocate();
+    treeNode->entity = entity;
+    treeNode->parent = parent;
+    if (isSceneManagerInitialized) {
+        scene_manager_get_entity_data(entity);
+    }
+    return treeNode;
+}
+
+SkaEntity cre_scene_manager_find_next_node_entity(SkaEntity startEntity) {
+    return cre_entity_paged_array_find_next_created(&sceneEntityData, startEntity);
+}
+
+static void scene_manager_entity_queue_push(SceneEntityQueue* queue, SkaEntity entity) {
+    if (queue->count >= queue->capacity) {
+        queue->capacity = queue->capacity > 0 ? queue->capacity * 2 : 64;
+        queue->entities = (SkaEntity*)realloc(queue->entities, sizeof(SkaEntity) * queue->capacity);
+    }
+    queue->entities[queue->count++] = entity;
+}
+
+static void scene_manager_entity_queue_free(SceneEntityQueue* queue) {
+    free(queue->entities);
+    *queue = (SceneEntityQueue){ .entities = NULL, .count = 0, .capacity = 0 };
+}
 
 SceneTreeNode* cre_scene_manager_pop_staged_entity_tree_node(SkaEntity entity);
+static void scene_manager_free_scratch_buffers();
 void cre_scene_manager_add_staged_node_children_to_scene(SceneTreeNode* treeNode);
 void cre_scene_manager_setup_scene_nodes_from_json(JsonSceneNode* jsonSceneNode);
+SceneTreeNode* cre_scene_manager_setup_scene_nodes_from_template(const CreSceneTemplate* sceneTemplate, bool isStagedNodes);
 
 void cre_scene_manager_initialize() {
-    SKA_ASSERT(entityToTreeNodeMap == NULL);
-    SKA_ASSERT(entityToStagedTreeNodeMap == NULL);
-    entityToTreeNodeMap = ska_hash_map_create(sizeof(SkaEntity), sizeof(SceneTreeNode**), SKA_HASH_MAP_MIN_CAPACITY);
-    entityToStagedTreeNodeMap = ska_hash_map_create(sizeof(SkaEntity), sizeof(SceneTreeNode**), SKA_HASH_MAP_MIN_CAPACITY);
+    SKA_ASSERT(!isSceneManagerInitialized);
+    cre_entity_paged_array_initialize(&sceneEntityData, sizeof(SceneEntityData), &defaultSceneEntityData);
+    node_event_initialize();
+    memset(transformChangedEntityBits, 0, sizeof(transformChangedEntityBits));
+    memset(entitiesQueuedForDeletionBits, 0, sizeof(entitiesQueuedForDeletionBits));
+    memset(pooledEntityBits, 0, sizeof(pooledEntityBits));
+    memset(processDisabledEntityBits, 0, sizeof(processDisabledEntityBits));
+    memset(processPausableEntityBits, 0, sizeof(processPausableEntityBits));
+    isSceneTreePaused = false;
+    memset(offScreenSuspendedSelfBits, 0, sizeof(offScreenSuspendedSelfBits));
+    memset(offScreenSuspendedEntityBits, 0, sizeof(offScreenSuspendedEntityBits));
+    sharedShaderInstanceRefCounts = ska_hash_map_create(sizeof(SkaShaderInstanceId), sizeof(uint32), SKA_HASH_MAP_MIN_CAPACITY);
+    cre_node_name_table_initialize();
+    childNameIndex = ska_hash_map_create(sizeof(SceneChildNameKey), sizeof(SceneChildNameEntry), SKA_HASH_MAP_MIN_CAPACITY);
+    sceneGroupIndicesByTag = ska_hash_map_create(sizeof(CreNodeNameId), sizeof(uint32), SKA_HASH_MAP_MIN_CAPACITY);
+    cre_entity_paged_array_initialize(&entityGroups, sizeof(SceneEntityGroups), NULL);
+#ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
+    const SkaTransform2D defaultPrevTransform = SKA_TRANSFORM_IDENTITY;
+    cre_entity_paged_array_initialize(&entityPrevGlobalTransforms, sizeof(SkaTransform2D), &defaultPrevTransform);
+#endif
+    isSceneManagerInitialized = true;
     cre_scene_template_cache_initialize();
+    cre_node_pool_initialize();
 }
 
+static void scene_manager_cancel_async_scene_load();
+
 void cre_scene_manager_finalize() {
-    SKA_ASSERT(entityToTreeNodeMap != NULL);
-    SKA_ASSERT(entityToStagedTreeNodeMap != NULL);
-    ska_hash_map_destroy(entityToTreeNodeMap);
-    ska_hash_map_destroy(entityToStagedTreeNodeMap);
+    SKA_ASSERT(isSceneManagerInitialized);
+    scene_manager_cancel_async_scene_load();
+    cre_node_pool_finalize();
+    cre_scene_tree_node_pool_finalize();
+    ska_hash_map_destroy(sharedShaderInstanceRefCounts);
+    sharedShaderInstanceRefCounts = NULL;
+    ska_hash_map_destroy(childNameIndex);
+    childNameIndex = NULL;
+    for (uint32 groupIndex = 0; groupIndex < sceneGroupCount; groupIndex++) {
+        free(sceneGroups[groupIndex].entities);
+    }
+    free(sceneGroups);
+    sceneGroups = NULL;
+    sceneGroupCount = 0;
+    sceneGroupCapacity = 0;
+    ska_hash_map_destroy(sceneGroupIndicesByTag);
+    sceneGroupIndicesByTag = NULL;
+    cre_entity_paged_array_finalize(&entityGroups);
+    // Hand back the pooled components of nodes that are still alive before the ECS is finalized
+    for (SkaEntity entity = cre_entity_paged_array_find_next_created(&sceneEntityData, 0); entity != SKA_NULL_ENTITY; entity = cre_entity_paged_array_find_next_created(&sceneEntityData, entity + 1)) {
+        cre_component_pool_release_entity_components(entity);
+    }
+    cre_entity_paged_array_finalize(&sceneEntityData);
+    node_event_finalize();
+    scene_manager_entity_queue_free(&entitiesQueuedForCreation);
+    scene_manager_entity_queue_free(&entitiesQueuedForDeletion);
+    scene_manager_entity_queue_free(&entitiesToUnlinkParent);
+    scene_manager_entity_queue_free(&entitiesWithDirtyGlobalTransform);
+    scene_manager_entity_queue_free(&transformChangedEntities);
+    scene_manager_free_scratch_buffers();
+    cre_node_name_table_finalize();
+#ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
+    cre_entity_paged_array_finalize(&entityPrevGlobalTransforms);
+#endif
+    // Tree nodes were returned to the pool above, don't keep a scene pointing at them around for the next initialize
+    if (activeScene != NULL) {
+        SKA_FREE(activeScene);
+        activeScene = NULL;
+    }
+    if (queuedSceneToChangeTo != NULL) {
+        SKA_FREE(queuedSceneToChangeTo);
+        queuedSceneToChangeTo = NULL;
+    }
+    isSceneManagerInitialized = false;
     cre_scene_template_cache_finalize();
 }
 
+// Called once the node is linked to its parent and has its node component (when queued for creation)
+static void scene_manager_index_child_name(const SceneTreeNode* treeNode) {
+    const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(treeNode->entity, NODE_COMPONENT_INDEX);
+    if (nodeComponent == NULL) {
+        return;
+    }
+    const CreNodeNameId nameId = cre_node_name_table_intern(nodeComponent->name);
+    SceneEntityData* entityData = scene_manager_get_entity_data(treeNode->entity);
+    entityData->nameId = nameId;
+    if (treeNode->parent == NULL) {
+        return;
+    }
+    const SceneChildNameKey key = { .parent = treeNode->parent->entity, .nameId = nameId };
+    if (ska_hash_map_has(childNameIndex, &key)) {
+        SceneChildNameEntry* entry = (SceneChildNameEntry*)ska_hash_map_get(childNameIndex, &key);
+        entry->count++;
+    } else {
+        const SceneChildNameEntry newEntry = { .child = treeNode->entity, .count = 1 };
+        ska_hash_map_add(childNameIndex, &key, &newEntry);
+    }
+    entityData->nameIndexParent = treeNode->parent->entity;
+}
+
+// Called for every entity queued for deletion before any of their tree nodes are freed
+static void scene_manager_unindex_child_name(SkaEntity entity) {
+    SceneEntityData* entityData = scene_manager_get_entity_data(entity);
+    const SkaEntity parent = entityData->nameIndexParent;
+    entityData->nameIndexParent = SKA_NULL_ENTITY;
+    if (parent == SKA_NULL_ENTITY) {
+        entityData->nameId = CRE_NODE_NAME_INVALID_ID;
+        return;
+    }
+    const SceneChildNameKey key = { .parent = parent, .nameId = entityData->nameId };
+    entityData->nameId = CRE_NODE_NAME_INVALID_ID;
+    SKA_ASSERT_FMT(ska_hash_map_has(childNameIndex, &key), "Entity '%u' missing from the child name index!", entity);
+    SceneChildNameEntry* entry = (SceneChildNameEntry*)ska_hash_map_get(childNameIndex, &key);
+    if (--entry->count == 0) {
+        ska_hash_map_erase(childNameIndex, &key);
+        return;
+    }
+    // A sibling with the same name takes over, no need to look for one if the parent is being deleted too
+    const bool isParentQueuedForDeletion = (entitiesQueuedForDeletionBits[parent / 32] & (1u << (parent % 32))) != 0;
+    if (entry->child != entity || isParentQueuedForDeletion) {
+        return;
+    }
+    for (const SceneTreeNode* siblingNode = scene_manager_find_tree_node(parent)->firstChild; siblingNode != NULL; siblingNode = siblingNode->nextSibling) {
+        const SkaEntity sibling = siblingNode->entity;
+        const bool isSiblingQueuedForDeletion = (entitiesQueuedForDeletionBits[sibling / 32] & (1u << (sibling % 32))) != 0;
+        const SceneEntityData* siblingData = scene_manager_find_entity_data(sibling);
+        if (!isSiblingQueuedForDeletion && siblingData->nameIndexParent == parent && siblingData->nameId == key.nameId) {
+            entry->child = sibling;
+            return;
+        }
+    }
+}
+
+static uint32 scene_manager_get_or_create_group(CreNodeNameId tagId) {
+    if (ska_hash_map_has(sceneGroupIndicesByTag, &tagId)) {
+        return *(uint32*)ska_hash_map_get(sceneGroupIndicesByTag, &tagId);
+    }
+    if (sceneGroupCount >= sceneGroupCapacity) {
+        sceneGroupCapacity = sceneGroupCapacity > 0 ? sceneGroupCapacity * 2 : 16;
+        sceneGroups = (SceneGroup*)realloc(sceneGroups, sizeof(SceneGroup) * sceneGroupCapacity);
+        SKA_ASSERT(sceneGroups);
+    }
+    const uint32 groupIndex = sceneGroupCount++;
+    sceneGroups[groupIndex] = (SceneGroup){ .tagId = tagId, .entities = NULL, .count = 0, .capacity = 0 };
+    ska_hash_map_add(sceneGroupIndicesByTag, &tagId, &groupIndex);
+    return groupIndex;
+}
+
+// Returns 'CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE' if the entity isn't in the group
+static uint32 scene_manager_find_group_membership(SkaEntity entity, uint32 groupIndex) {
+    const SceneEntityGroups* groups = (SceneEntityGroups*)cre_entity_paged_array_get(&entityGroups, entity);
+    if (groups == NULL) {
+        return CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE;
+    }
+    for (uint32 i = 0; i < groups->count; i++) {
+        if (groups->memberships[i].groupIndex == groupIndex) {
+            return i;
+        }
+    }
+    return CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE;
+}
+
+static bool scene_manager_add_entity_to_group_index(SkaEntity entity, uint32 groupIndex) {
+    if (scene_manager_find_group_membership(entity, groupIndex) != CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE) {
+        return false;
+    }
+    SceneGroup* group = &sceneGroups[groupIndex];
+    SceneEntityGroups* groups = (SceneEntityGroups*)cre_entity_paged_array_get_or_create(&entityGroups, entity);
+    if (groups->count >= CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE) {
+        ska_logger_warn("Entity '%u' is already in the max number of groups, not adding to group '%s'!", entity, cre_node_name_table_get_name(group->tagId));
+        return false;
+    }
+    if (group->count >= group->capacity) {
+        group->capacity = group->capacity > 0 ? group->capacity * 2 : 32;
+        group->entities = (SkaEntity*)realloc(group->entities, sizeof(SkaEntity) * group->capacity);
+        SKA_ASSERT(group->entities);
+    }
+    groups->memberships[groups->count++] = (SceneGroupMembership){ .groupIndex = groupIndex, .denseIndex = group->count };
+    group->entities[group->count++] = entity;
+    return true;
+}
+
+static void scene_manager_remove_entity_from_group_membership(SkaEntity entity, uint32 membershipIndex) {
+    SceneEntityGroups* groups = (SceneEntityGroups*)cre_entity_paged_array_get(&entityGroups, entity);
+    const SceneGroupMembership membership = groups->memberships[membershipIndex];
+    SceneGroup* group = &sceneGroups[membership.groupIndex];
+    // Swap the last entity of the group into the removed entity's place
+    const SkaEntity lastEntity = group->entities[--group->count];
+    if (lastEntity != entity) {
+        group->entities[membership.denseIndex] = lastEntity;
+        const uint32 lastMembershipIndex = scene_manager_find_group_membership(lastEntity, membership.groupIndex);
+        SceneEntityGroups* lastEntityGroups = (SceneEntityGroups*)cre_entity_paged_array_get(&entityGroups, lastEntity);
+        lastEntityGroups->memberships[lastMembershipIndex].denseIndex = membership.denseIndex;
+    }
+    groups->memberships[membershipIndex] = groups->memberships[--groups->count];
+}
+
+// Adds the entity to every group in a comma separated list of tags (as stored in compiled scenes)
+static void scene_manager_add_entity_to_tag_groups(SkaEntity entity, const char* tags) {
+    char tag[CRE_NODE_NAME_MAX_LENGTH];
+    while (tags != NULL && *tags != '\0') {
+        const char* tagEnd = strchr(tags, ',');
+        const size_t tagLength = tagEnd != NULL ? (size_t)(tagEnd - tags) : strlen(tags);
+        const size_t copyLength = tagLength < CRE_NODE_NAME_MAX_LENGTH ? tagLength : CRE_NODE_NAME_MAX_LENGTH - 1;
+        memcpy(tag, tags, copyLength);
+        tag[copyLength] = '\0';
+        if (copyLength > 0) {
+            cre_scene_manager_add_entity_to_group(entity, tag);
+        }
+        tags = tagEnd != NULL ? tagEnd + 1 : NULL;
+    }
+}
+
+bool cre_scene_manager_add_entity_to_group(SkaEntity entity, const char* group) {
+    SKA_ASSERT_FMT(entity < SKA_MAX_ENTITIES, "Invalid entity '%u'!", entity);
+    return scene_manager_add_entity_to_group_index(entity, scene_manager_get_or_create_group(cre_node_name_table_intern(group)));
+}
+
+bool cre_scene_manager_remove_entity_from_group(SkaEntity entity, const char* group) {
+    SKA_ASSERT_FMT(entity < SKA_MAX_ENTITIES, "Invalid entity '%u'!", entity);
+    const CreNodeNameId tagId = cre_node_name_table_find(group);
+    if (tagId == CRE_NODE_NAME_INVALID_ID || !ska_hash_map_has(sceneGroupIndicesByTag, &tagId)) {
+        return false;
+    }
+    const uint32 membershipIndex = scene_manager_find_group_membership(entity, *(uint32*)ska_hash_map_get(sceneGroupIndicesByTag, &tagId));
+    if (membershipIndex == CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE) {
+        return false;
+    }
+    scene_manager_remove_entity_from_group_membership(entity, membershipIndex);
+    return true;
+}
+
+bool cre_scene_manager_is_entity_in_group(SkaEntity entity, const char* group) {
+    const CreNodeNameId tagId = cre_node_name_table_find(group);
+    if (tagId == CRE_NODE_NAME_INVALID_ID || !ska_hash_map_has(sceneGroupIndicesByTag, &tagId)) {
+        return false;
+    }
+    return scene_manager_find_group_membership(entity, *(uint32*)ska_hash_map_get(sceneGroupIndicesByTag, &tagId)) != CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE;
+}
+
+const SkaEntity* cre_scene_manager_get_group_entities(const char* group, size_t* outCount) {
+    *outCount = 0;
+    const CreNodeNameId tagId = cre_node_name_table_find(group);
+    if (tagId == CRE_NODE_NAME_INVALID_ID || !ska_hash_map_has(sceneGroupIndicesByTag, &tagId)) {
+        return NULL;
+    }
+    const SceneGroup* sceneGroup = &sceneGroups[*(uint32*)ska_hash_map_get(sceneGroupIndicesByTag, &tagId)];
+    *outCount = sceneGroup->count;
+    return sceneGroup->count > 0 ? sceneGroup->entities : NULL;
+}
+
+// Process modes
+// Resolves a single entity's mode from its parent's resolved mode, returns the resolved mode
+static NodeProcessMode scene_manager_resolve_process_mode(SkaEntity entity, NodeProcessMode parentMode) {
+    const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX);
+    const NodeProcessMode mode = nodeComponent != NULL && nodeComponent->processMode != NodeProcessMode_INHERIT ? nodeComponent->processMode : parentMode;
+    SceneEntityData* entityData = scene_manager_get_entity_data(entity);
+    const NodeProcessMode prevMode = (NodeProcessMode)entityData->processMode;
+    entityData->processMode = (uint8)mode;
+    const uint32 entityBit = 1u << (entity % 32);
+    processDisabledEntityBits[entity / 32] &= ~entityBit;
+    processPausableEntityBits[entity / 32] &= ~entityBit;
+    if (mode == NodeProcessMode_DISABLED) {
+        processDisabledEntityBits[entity / 32] |= entityBit;
+    } else if (mode == NodeProcessMode_PAUSABLE) {
+        processPausableEntityBits[entity / 32] |= entityBit;
+    }
+    if ((prevMode == NodeProcessMode_DISABLED) != (mode == NodeProcessMode_DISABLED) && onNodeProcessDisabledChangedFunc != NULL) {
+        onNodeProcessDisabledChangedFunc(entity, mode == NodeProcessMode_DISABLED);
+    }
+    return mode;
+}
+
+static void scene_manager_resolve_process_modes_with_children(const SceneTreeNode* treeNode, NodeProcessMode parentMode) {
+    const NodeProcessMode mode = scene_manager_resolve_process_mode(treeNode->entity, parentMode);
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        scene_manager_resolve_process_modes_with_children(childNode, mode);
+    }
+}
+
+static NodeProcessMode scene_manager_get_parent_process_mode(const SceneTreeNode* treeNode) {
+    return treeNode->parent != NULL ? (NodeProcessMode)scene_manager_find_entity_data(treeNode->parent->entity)->processMode : NodeProcessMode_PAUSABLE;
+}
+
+void cre_scene_manager_set_node_process_mode(SkaEntity entity, NodeProcessMode processMode) {
+    NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component(entity, NODE_COMPONENT_INDEX);
+    if (nodeComponent->processMode == processMode) {
+        return;
+    }
+    nodeComponent->processMode = processMode;
+    cre_component_versions_mark_changed(entity, NODE_COMPONENT_INDEX);
+    // Staged nodes are resolved once they're queued for creation
+    if (cre_scene_manager_has_entity_tree_node(entity)) {
+        const SceneTreeNode* treeNode = scene_manager_find_tree_node(entity);
+        scene_manager_resolve_process_modes_with_children(treeNode, scene_manager_get_parent_process_mode(treeNode));
+    }
+}
+
+NodeProcessMode cre_scene_manager_get_entity_process_mode(SkaEntity entity) {
+    return (NodeProcessMode)scene_manager_find_entity_data(entity)->processMode;
+}
+
+void cre_scene_manager_set_paused(bool paused) {
+    isSceneTreePaused = paused;
+}
+
+bool cre_scene_manager_is_paused() {
+    return isSceneTreePaused;
+}
+
+bool cre_scene_manager_can_entity_process(SkaEntity entity) {
+    if (entity >= SKA_MAX_ENTITIES) {
+        return false;
+    }
+    const uint32 word = entity / 32;
+    const uint32 haltedBits = pooledEntityBits[word] | processDisabledEntityBits[word] | offScreenSuspendedEntityBits[word]
+        | (isSceneTreePaused ? processPausableEntityBits[word] : 0);
+    return (haltedBits & (1u << (entity % 32))) == 0;
+}
+
+void cre_scene_manager_set_process_disabled_changed_callback(CreOnNodeProcessDisabledChangedFunc onDisabledChangedFunc) {
+    onNodeProcessDisabledChangedFunc = onDisabledChangedFunc;
+}
+
+// Off screen suspension
+static inline bool scene_manager_is_entity_bit_set(const uint32* bits, SkaEntity entity) {
+    return (bits[entity / 32] & (1u << (entity % 32))) != 0;
+}
+
+static inline bool scene_manager_is_parent_off_screen_suspended(const SceneTreeNode* treeNode) {
+    return treeNode->parent != NULL && scene_manager_is_entity_bit_set(offScreenSuspendedEntityBits, treeNode->parent->entity);
+}
+
+// Returns whether the entity ended up suspended
+static bool scene_manager_resolve_off_screen_suspended(SkaEntity entity, bool isParentSuspended) {
+    const uint32 entityBit = 1u << (entity % 32);
+    const bool isSuspended = isParentSuspended || scene_manager_is_entity_bit_set(offScreenSuspendedSelfBits, entity);
+    if (isSuspended) {
+        offScreenSuspendedEntityBits[entity / 32] |= entityBit;
+    } else {
+        offScreenSuspendedEntityBits[entity / 32] &= ~entityBit;
+    }
+    return isSuspended;
+}
+
+static void scene_manager_resolve_off_screen_suspended_with_children(const SceneTreeNode* treeNode, bool isParentSuspended) {
+    const bool isSuspended = scene_manager_resolve_off_screen_suspended(treeNode->entity, isParentSuspended);
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        scene_manager_resolve_off_screen_suspended_with_children(childNode, isSuspended);
+    }
+}
+
+void cre_scene_manager_set_node_off_screen_suspended(SkaEntity entity, bool suspended) {
+    if (scene_manager_is_entity_bit_set(offScreenSuspendedSelfBits, entity) == suspended) {
+        return;
+    }
+    if (suspended) {
+        offScreenSuspendedSelfBits[entity / 32] |= 1u << (entity % 32);
+    } else {
+        offScreenSuspendedSelfBits[entity / 32] &= ~(1u << (entity % 32));
+    }
+    // Staged nodes are resolved once they're queued for creation
+    if (cre_scene_manager_has_entity_tree_node(entity)) {
+        const SceneTreeNode* treeNode = scene_manager_find_tree_node(entity);
+        scene_manager_resolve_off_screen_suspended_with_children(treeNode, scene_manager_is_parent_off_screen_suspended(treeNode));
+    }
+}
+
+bool cre_scene_manager_is_entity_off_screen_suspended(SkaEntity entity) {
+    return entity < SKA_MAX_ENTITIES && scene_manager_is_entity_bit_set(offScreenSuspendedEntityBits, entity);
+}
+
 void cre_scene_manager_queue_node_for_creation(SceneTreeNode* treeNode) {
-    entitiesQueuedForCreation[entitiesQueuedForCreationSize++] = treeNode->entity;
-    SKA_ASSERT_FMT(!ska_hash_map_has(entityToTreeNodeMap, &treeNode->entity), "Entity '%d' already in entity to tree map!", treeNode->entity);
-    ska_hash_map_add(entityToTreeNodeMap, &treeNode->entity, &treeNode);
+    scene_manager_entity_queue_push(&entitiesQueuedForCreation, treeNode->entity);
+    SceneEntityData* entityData = scene_manager_get_entity_data(treeNode->entity);
+    SKA_ASSERT_FMT(entityData->treeNode == NULL, "Entity '%d' already in entity to tree map!", treeNode->entity);
+    entityData->treeNode = treeNode;
+    scene_manager_index_child_name(treeNode);
+    // Parents are queued before their children so their mode is already resolved
+    scene_manager_resolve_process_mode(treeNode->entity, scene_manager_get_parent_process_mode(treeNode));
+    scene_manager_resolve_off_screen_suspended(treeNode->entity, scene_manager_is_parent_off_screen_suspended(treeNode));
 }
 
 void cre_scene_manager_stage_child_node_to_be_added_later(SceneTreeNode* treeNode) {
-    SKA_ASSERT_FMT(!ska_hash_map_has(entityToTreeNodeMap, &treeNode->entity), "Entity '%d' already staged to be added!", treeNode->entity);
-    ska_hash_map_add(entityToStagedTreeNodeMap, &treeNode->entity, &treeNode);
+    SceneEntityData* entityData = scene_manager_get_entity_data(treeNode->entity);
+    SKA_ASSERT_FMT(entityData->stagedTreeNode == NULL, "Entity '%d' already staged to be added!", treeNode->entity);
+    entityData->stagedTreeNode = treeNode;
 }
 
 void cre_scene_manager_process_queued_creation_entities() {
-    for (size_t i = 0; i < entitiesQueuedForCreationSize; i++) {
-        SkaEntity queuedEntity = entitiesQueuedForCreation[i];
+    for (size_t i = 0; i < entitiesQueuedForCreation.count; i++) {
+        SkaEntity queuedEntity = entitiesQueuedForCreation.entities[i];
         ska_ecs_system_update_entity_signature_with_systems(queuedEntity);
         ska_ecs_system_event_entity_start(queuedEntity);
 
@@ -133,28 +636,34 @@ void cre_scene_manager_process_queued_creation_entities() {
         ska_ecs_system_event_entity_entered_scene(queuedEntity);
         // broadcast to subscribers
 
+        Transform2DComponent* transformComponent = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(queuedEntity, TRANSFORM2D_COMPONENT_INDEX);
+        if (transformComponent) {
+            // The global transform may have been pulled while staged (without a parent), always recalculate once in the tree
+            transformComponent->isGlobalTransformDirty = true;
+            scene_manager_entity_queue_push(&entitiesWithDirtyGlobalTransform, queuedEntity);
+        }
 
 #ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
-        Transform2DComponent* transformComponent = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(queuedEntity, TRANSFORM2D_COMPONENT_INDEX);
         if (transformComponent) {
             SkaTransformModel2D* globalTransform = cre_scene_manager_get_scene_node_global_transform(queuedEntity, transformComponent);
-            entityPrevGlobalTransforms[queuedEntity] = ska_transform2d_model_convert_to_transform(globalTransform);
+            SkaTransform2D* prevTransform = (SkaTransform2D*)cre_entity_paged_array_get_or_create(&entityPrevGlobalTransforms, queuedEntity);
+            *prevTransform = ska_transform2d_model_convert_to_transform(globalTransform);
         }
 #endif
     }
-    entitiesQueuedForCreationSize = 0;
+    entitiesQueuedForCreation.count = 0;
 }
 
 void cre_scene_manager_queue_entity_for_deletion(SkaEntity entity) {
     // Check if entity is already queued exit out early if so
-    for (size_t i = 0; i < entitiesQueuedForDeletionSize; i++) {
-        if (entitiesQueuedForDeletion[i] == entity) {
-            ska_logger_warn("Entity '%d' already queued for deletion!", entity);
-            return;
-        }
+    const uint32 entityBit = 1u << (entity % 32);
+    if ((entitiesQueuedForDeletionBits[entity / 32] & entityBit) != 0) {
+        ska_logger_warn("Entity '%d' already queued for deletion!", entity);
+        return;
     }
     // Insert queued entity
-    entitiesQueuedForDeletion[entitiesQueuedForDeletionSize++] = entity;
+    entitiesQueuedForDeletionBits[entity / 32] |= entityBit;
+    scene_manager_entity_queue_push(&entitiesQueuedForDeletion, entity);
     // Clean up
     ska_ecs_system_event_entity_end(entity);
     // broadcast to subscribers
@@ -167,56 +676,96 @@ void cre_scene_manager_queue_entity_for_deletion(SkaEntity entity) {
     }
 }
 
+static void scene_manager_release_shader_instance(SkaShaderInstanceId shaderInstanceId) {
+    if (ska_hash_map_has(sharedShaderInstanceRefCounts, &shaderInstanceId)) {
+        uint32* refCount = (uint32*)ska_hash_map_get(sharedShaderInstanceRefCounts, &shaderInstanceId);
+        if (--(*refCount) > 0) {
+            return;
+        }
+        ska_hash_map_erase(sharedShaderInstanceRefCounts, &shaderInstanceId);
+    }
+    SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(shaderInstanceId);
+    if (shaderInstance) {
+        ska_shader_cache_remove_instance(shaderInstanceId);
+        ska_shader_instance_destroy(shaderInstance);
+    }
+}
+
+// Adds 'count' owners to a shader instance, an instance not in the map has a single owner
+static void scene_manager_share_shader_instance(SkaShaderInstanceId shaderInstanceId, uint32 count) {
+    if (ska_hash_map_has(sharedShaderInstanceRefCounts, &shaderInstanceId)) {
+        uint32* refCount = (uint32*)ska_hash_map_get(sharedShaderInstanceRefCounts, &shaderInstanceId);
+        *refCount += count;
+    } else {
+        const uint32 refCount = count + 1;
+        ska_hash_map_add(sharedShaderInstanceRefCounts, &shaderInstanceId, &refCount);
+    }
+}
+
 void cre_scene_manager_process_queued_deletion_entities() {
-    for (size_t i = 0; i < entitiesToUnlinkParent_count; i++) {
-        SceneTreeNode* treeNode = (SceneTreeNode*) *(SceneTreeNode**) ska_hash_map_get(entityToTreeNodeMap,&entitiesToUnlinkParent[i]);
+    for (size_t i = 0; i < entitiesQueuedForDeletion.count; i++) {
+        const SkaEntity entityToDelete = entitiesQueuedForDeletion.entities[i];
+        scene_manager_unindex_child_name(entityToDelete);
+        transformChangedEntityBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        pooledEntityBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        processDisabledEntityBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        processPausableEntityBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        cre_component_versions_mark_all_changed(entityToDelete);
+        offScreenSuspendedSelfBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        offScreenSuspendedEntityBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        cre_node_pool_remove_entity(entityToDelete);
+        const SceneEntityGroups* groups = (SceneEntityGroups*)cre_entity_paged_array_get(&entityGroups, entityToDelete);
+        while (groups != NULL && groups->count > 0) {
+            scene_manager_remove_entity_from_group_membership(entityToDelete, groups->count - 1);
+        }
+        cre_entity_paged_array_release(&entityGroups, entityToDelete);
+    }
+
+    for (size_t i = 0; i < entitiesToUnlinkParent.count; i++) {
+        SceneTreeNode* treeNode = scene_manager_find_tree_node(entitiesToUnlinkParent.entities[i]);
         SceneTreeNode* parentNode = treeNode->parent;
-        SKA_ARRAY_REMOVE_AND_CONDENSE(parentNode->children, parentNode->childCount, treeNode, NULL);
+        cre_scene_tree_node_remove_child(parentNode, treeNode);
     }
-    entitiesToUnlinkParent_count = 0;
+    entitiesToUnlinkParent.count = 0;
 
-    for (size_t i = 0; i < entitiesQueuedForDeletionSize; i++) {
-        // Remove entity from entity to tree node map
-        SkaEntity entityToDelete = entitiesQueuedForDeletion[i];
-        SKA_ASSERT_FMT(ska_hash_map_has(entityToTreeNodeMap, &entityToDelete), "Entity '%d' not in tree node map!?", entityToDelete);
-        SceneTreeNode* treeNode = (SceneTreeNode*) *(SceneTreeNode**) ska_hash_map_get(entityToTreeNodeMap,&entityToDelete);
-        SKA_FREE(treeNode);
-        ska_hash_map_erase(entityToTreeNodeMap, &entityToDelete);
+    for (size_t i = 0; i < entitiesQueuedForDeletion.count; i++) {
+        // Remove entity from entity to tree node map, which resets the rest of its scene state too
+        SkaEntity entityToDelete = entitiesQueuedForDeletion.entities[i];
+        entitiesQueuedForDeletionBits[entityToDelete / 32] &= ~(1u << (entityToDelete % 32));
+        SceneTreeNode* treeNode = scene_manager_find_tree_node(entityToDelete);
+        SKA_ASSERT_FMT(treeNode != NULL, "Entity '%d' not in tree node map!?", entityToDelete);
+        cre_scene_tree_node_pool_free(treeNode);
+        cre_entity_paged_array_release(&sceneEntityData, entityToDelete);
         // Remove entity from systems
         ska_ecs_system_remove_entity_from_all_systems(entityToDelete);
         // Remove shader instances if applicable
         SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component_unchecked(entityToDelete, SPRITE_COMPONENT_INDEX);
         if (spriteComponent != NULL && spriteComponent->shaderInstanceId != SKA_SHADER_INSTANCE_INVALID_ID) {
-            SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(spriteComponent->shaderInstanceId);
-            if (shaderInstance) {
-                ska_shader_cache_remove_instance(spriteComponent->shaderInstanceId);
-                ska_shader_instance_destroy(shaderInstance);
-            }
+            scene_manager_release_shader_instance(spriteComponent->shaderInstanceId);
         }
         AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component_unchecked(entityToDelete, ANIMATED_SPRITE_COMPONENT_INDEX);
         if (animatedSpriteComponent != NULL && animatedSpriteComponent->shaderInstanceId != SKA_SHADER_INSTANCE_INVALID_ID) {
-            SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(animatedSpriteComponent->shaderInstanceId);
-            if (shaderInstance) {
-                ska_shader_cache_remove_instance(animatedSpriteComponent->shaderInstanceId);
-                ska_shader_instance_destroy(shaderInstance);
-            }
+            scene_manager_release_shader_instance(animatedSpriteComponent->shaderInstanceId);
         }
-        // Remove all components
+        // Remove all components, pooled ones are returned to their pools first
+        cre_component_pool_release_entity_components(entityToDelete);
         ska_ecs_component_manager_remove_all_components(entityToDelete);
         // Return entity id to pool
         ska_ecs_entity_return(entityToDelete);
 
 #ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
         // Reset entity previous position
-        entityPrevGlobalTransforms[entityToDelete] = SKA_TRANSFORM_IDENTITY;
+        cre_entity_paged_array_release(&entityPrevGlobalTransforms, entityToDelete);
 #endif
 
     }
-    entitiesQueuedForDeletionSize = 0;
+    entitiesQueuedForDeletion.count = 0;
 }
 
 void cre_scene_manager_queue_scene_change(const char* scenePath) {
-    if (queuedSceneToChangeTo == NULL) {
+    if (cre_scene_manager_is_async_scene_loading()) {
+        ska_logger_warn("Scene is being loaded asynchronously, not loading '%s'", scenePath);
+    } else if (queuedSceneToChangeTo == NULL) {
         queuedSceneToChangeTo = cre_scene_create_scene(scenePath);
     } else {
         ska_logger_warn("Scene already queued, not loading '%s'", scenePath);
@@ -238,13 +787,14 @@ void cre_queue_destroy_tree_node_entity_all(SceneTreeNode* treeNode) {
     }
     cre_scene_execute_on_all_tree_nodes(treeNode, cre_queue_destroy_tree_node_entity);
     if (treeNode->parent != NULL) {
-        SKA_STATIC_ARRAY_ADD(entitiesToUnlinkParent, treeNode->entity);
+        scene_manager_entity_queue_push(&entitiesToUnlinkParent, treeNode->entity);
     }
 }
 
 void cre_scene_manager_process_queued_scene_change() {
     if (queuedSceneToChangeTo != NULL) {
-        // Destroy old scene
+        // Destroy old scene, idle pooled instances aren't in its tree so they're deleted separately
+        cre_node_pool_clear();
         if (activeScene != NULL) {
             cre_queue_destroy_tree_node_entity_all(activeScene->sceneTree->root);
             SKA_FREE(activeScene);
@@ -257,11 +807,10 @@ void cre_scene_manager_process_queued_scene_change() {
         activeScene = queuedSceneToChangeTo;
         queuedSceneToChangeTo = NULL;
         SKA_ASSERT(activeScene->scenePath != NULL);
-        // Load scene file
-        JsonSceneNode* rootJsonSceneNode = cre_json_load_scene_file(activeScene->scenePath);
-        SKA_ASSERT_FMT(rootJsonSceneNode != NULL, "Root scene file at path '%s' is NULL!", activeScene->scenePath);
-        cre_scene_manager_setup_scene_nodes_from_json(rootJsonSceneNode);
-        cre_json_delete_json_scene_node(rootJsonSceneNode);
+        // Load scene template, previously visited scenes are already cached
+        const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene_by_path(activeScene->scenePath);
+        SKA_ASSERT_FMT(sceneTemplate != NULL, "Root scene file at path '%s' is NULL!", activeScene->scenePath);
+        cre_scene_manager_setup_scene_nodes_from_template(sceneTemplate, false);
     }
 }
 
@@ -278,29 +827,101 @@ SceneTreeNode* cre_scene_manager_get_active_scene_root() {
     return NULL;
 }
 
-// TODO: Make function to update flags for all children
+// Returns the global transform of the closest ancestor with a transform, identity if there isn't one
+static const SkaTransformModel2D* scene_manager_get_parent_global_transform(SkaEntity entity) {
+    static const SkaTransformModel2D identityTransform = SKA_TRANSFORM_MODEL_IDENTITY;
+    if (!cre_scene_manager_has_entity_tree_node(entity)) {
+        return &identityTransform;
+    }
+    for (const SceneTreeNode* parentNode = scene_manager_find_tree_node(entity)->parent; parentNode != NULL; parentNode = parentNode->parent) {
+        Transform2DComponent* parentTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(parentNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+        if (parentTransformComp) {
+            return cre_scene_manager_get_scene_node_global_transform(parentNode->entity, parentTransformComp);
+        }
+    }
+    return &identityTransform;
+}
+
 SkaTransformModel2D* cre_scene_manager_get_scene_node_global_transform(SkaEntity entity, Transform2DComponent* transform2DComponent) {
     SKA_ASSERT_FMT(transform2DComponent != NULL, "Transform Model is NULL for entity '%d'", entity);
     if (transform2DComponent->isGlobalTransformDirty) {
-        // Walk up scene to root node and calculate global transform
-        cre_scene_utils_update_global_transform_model(entity, &transform2DComponent->globalTransform);
+        // A dirty node's whole subtree is dirty, so only the dirty ancestors are recalculated (each once) on the way up
+        const SkaTransformModel2D* parentGlobalTransform = scene_manager_get_parent_global_transform(entity);
+        cre_scene_utils_compose_global_transform(&transform2DComponent->globalTransform, parentGlobalTransform, &transform2DComponent->localTransform, transform2DComponent->zIndex);
         // Flag is no longer dirty since the global transform is up to date
         transform2DComponent->isGlobalTransformDirty = false;
     }
     return &transform2DComponent->globalTransform;
 }
 
-SceneNodeRenderResource cre_scene_manager_get_scene_node_global_render_resource(SkaEntity entity, Transform2DComponent* transform2DComponent, const SkaVector2* origin) {
-    SkaTransformModel2D* globalTransform = cre_scene_manager_get_scene_node_global_transform(entity, transform2DComponent);
+// Marks all transforms under the node dirty, stops at already dirty nodes as their subtrees are already dirty
+static void scene_manager_invalidate_child_global_transforms(const SceneTreeNode* treeNode) {
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        Transform2DComponent* childTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(childNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+        if (childTransformComp) {
+            if (childTransformComp->isGlobalTransformDirty) {
+                continue;
+            }
+            childTransformComp->isGlobalTransformDirty = true;
+        }
+        scene_manager_invalidate_child_global_transforms(childNode);
+    }
+}
+
+void cre_scene_manager_invalidate_global_transform(SkaEntity entity, Transform2DComponent* transform2DComponent) {
+    cre_component_versions_mark_changed(entity, TRANSFORM2D_COMPONENT_INDEX);
+    if (transform2DComponent->isGlobalTransformDirty) {
+        return;
+    }
+    transform2DComponent->isGlobalTransformDirty = true;
+    if (cre_scene_manager_has_entity_tree_node(entity)) {
+        // Entries can repeat if the transform is pulled and invalidated again within a frame
+        scene_manager_entity_queue_push(&entitiesWithDirtyGlobalTransform, entity);
+        scene_manager_invalidate_child_global_transforms(scene_manager_find_tree_node(entity));
+    }
+}
+
+// Top down, computes each dirty child from its parent's cached global transform
+static void scene_manager_update_child_global_transforms(const SceneTreeNode* treeNode, const SkaTransformModel2D* parentGlobalTransform) {
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        Transform2DComponent* childTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(childNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+        if (childTransformComp == NULL) {
+            // Nodes without a transform pass their parent's through
+            scene_manager_update_child_global_transforms(childNode, parentGlobalTransform);
+        } else if (childTransformComp->isGlobalTransformDirty) {
+            cre_scene_utils_compose_global_transform(&childTransformComp->globalTransform, parentGlobalTransform, &childTransformComp->localTransform, childTransformComp->zIndex);
+            childTransformComp->isGlobalTransformDirty = false;
+            scene_manager_update_child_global_transforms(childNode, &childTransformComp->globalTransform);
+        }
+    }
+}
+
+void cre_scene_manager_update_global_transforms() {
+    for (size_t i = 0; i < entitiesWithDirtyGlobalTransform.count; i++) {
+        const SkaEntity entity = entitiesWithDirtyGlobalTransform.entities[i];
+        if (!cre_scene_manager_has_entity_tree_node(entity)) {
+            continue;
+        }
+        // Entry may have already been pulled this frame, its children can still be dirty
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
+        const SkaTransformModel2D* globalTransform = transformComp != NULL ? cre_scene_manager_get_scene_node_global_transform(entity, transformComp) : scene_manager_get_parent_global_transform(entity);
+        scene_manager_update_child_global_transforms(scene_manager_find_tree_node(entity), globalTransform);
+    }
+    entitiesWithDirtyGlobalTransform.count = 0;
+}
 
+SceneNodeRenderResource cre_scene_manager_get_scene_node_global_render_resource(SkaEntity entity, Transform2DComponent* transform2DComponent, const SkaVector2* origin) {
+    // Camera and origin are applied to a copy so the cached global transform stays valid between frames
+    SkaTransformModel2D renderTransform = *cre_scene_manager_get_scene_node_global_transform(entity, transform2DComponent);
+    SkaTransformModel2D* globalTransform = &renderTransform;
     cre_scene_utils_apply_camera_and_origin_translation(globalTransform, origin, transform2DComponent->ignoreCamera);
-    transform2DComponent->isGlobalTransformDirty = true; // TODO: Make global transform const
     const SkaTransform2D transform2D = ska_transform2d_model_convert_to_transform(globalTransform);
 #ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
-    const SkaTransform2D prevTransform2D = entityPrevGlobalTransforms[entity];
+    SkaTransform2D* prevTransform = (SkaTransform2D*)cre_entity_paged_array_get_or_create(&entityPrevGlobalTransforms, entity);
+    const SkaTransform2D prevTransform2D = *prevTransform;
     // Favor keeping most of the previous value as that seems to look best especially when changes are done in '_fixed_process'
     const SkaTransform2D lerpedTransform2D = ska_transform2d_lerp(&prevTransform2D, &transform2D, CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA);
-    entityPrevGlobalTransforms[entity] = lerpedTransform2D; // Store prev
+    *prevTransform = lerpedTransform2D; // Store prev
     return (SceneNodeRenderResource){
         .transform2D = lerpedTransform2D,
         .globalZIndex = globalTransform->zIndex
@@ -336,57 +957,172 @@ f32 cre_scene_manager_get_node_full_time_dilation(SkaEntity entity) {
 }
 
 SceneTreeNode* cre_scene_manager_get_entity_tree_node(SkaEntity entity) {
-    SKA_ASSERT_FMT(ska_hash_map_has(entityToTreeNodeMap, &entity), "Doesn't have entity '%d' in scene tree!", entity);
-    SceneTreeNode* treeNode = (SceneTreeNode*) *(SceneTreeNode**) ska_hash_map_get(entityToTreeNodeMap, &entity);
-    SKA_ASSERT_FMT(treeNode != NULL, "Failed to get tree node for entity '%d'", entity);
+    SceneTreeNode* treeNode = scene_manager_find_tree_node(entity);
+    SKA_ASSERT_FMT(treeNode != NULL, "Doesn't have entity '%d' in scene tree!", entity);
     return treeNode;
 }
 
 SceneTreeNode* cre_scene_manager_pop_staged_entity_tree_node(SkaEntity entity) {
-    SKA_ASSERT_FMT(ska_hash_map_has(entityToStagedTreeNodeMap, &entity), "Doesn't have entity '%d' in scene tree!", entity);
-    SceneTreeNode* treeNode = (SceneTreeNode*) *(SceneTreeNode**) ska_hash_map_get(entityToStagedTreeNodeMap, &entity);
-    SKA_ASSERT_FMT(treeNode != NULL, "Failed to get tree node for entity '%d'", entity);
-    // Now that we have the staged tree node, remove the reference from the staged hash map
-    ska_hash_map_erase(entityToStagedTreeNodeMap, &entity);
+    SceneEntityData* entityData = scene_manager_get_entity_data(entity);
+    SceneTreeNode* treeNode = entityData->stagedTreeNode;
+    SKA_ASSERT_FMT(treeNode != NULL, "Doesn't have entity '%d' in scene tree!", entity);
+    // Now that we have the staged tree node, remove the reference from the staged array
+    entityData->stagedTreeNode = NULL;
     return treeNode;
 }
 
+SkaEntity cre_scene_manager_get_entity_child_by_name_id(SkaEntity parent, CreNodeNameId childNameId) {
+    SKA_ASSERT_FMT(cre_scene_manager_has_entity_tree_node(parent), "Doesn't have entity '%d' in scene tree!", parent);
+    const SceneChildNameKey key = { .parent = parent, .nameId = childNameId };
+    if (ska_hash_map_has(childNameIndex, &key)) {
+        return ((SceneChildNameEntry*)ska_hash_map_get(childNameIndex, &key))->child;
+    }
+    return SKA_NULL_ENTITY;
+}
+
 SkaEntity cre_scene_manager_get_entity_child_by_name(SkaEntity parent, const char* childName) {
-    SceneTreeNode* parentNode = cre_scene_manager_get_entity_tree_node(parent);
-    for (size_t childIndex = 0; childIndex < parentNode->childCount; childIndex++) {
-        const SkaEntity childEntity = parentNode->children[childIndex]->entity;
-        if (ska_ecs_component_manager_has_component(childEntity, NODE_COMPONENT_INDEX)) {
-            NodeComponent* childNodeComponent = (NodeComponent*) ska_ecs_component_manager_get_component(childEntity,NODE_COMPONENT_INDEX);
-            if (strcmp(childNodeComponent->name, childName) == 0) {
-                return childEntity;
-            }
+    // A name that was never interned can't belong to any node
+    const CreNodeNameId childNameId = cre_node_name_table_find(childName);
+    if (childNameId == CRE_NODE_NAME_INVALID_ID) {
+        SKA_ASSERT_FMT(cre_scene_manager_has_entity_tree_node(parent), "Doesn't have entity '%d' in scene tree!", parent);
+        return SKA_NULL_ENTITY;
+    }
+    return cre_scene_manager_get_entity_child_by_name_id(parent, childNameId);
+}
+
+SkaEntity cre_scene_manager_get_entity_by_path(SkaEntity entity, const char* path) {
+    SkaEntity currentEntity = entity;
+    const char* segment = path;
+    // Absolute paths start from the active scene root, which is the first segment
+    if (*segment == '/') {
+        SceneTreeNode* rootNode = cre_scene_manager_get_active_scene_root();
+        if (rootNode == NULL || scene_manager_find_entity_data(rootNode->entity)->nameId == CRE_NODE_NAME_INVALID_ID) {
+            return SKA_NULL_ENTITY;
         }
+        segment++;
+        const char* segmentEnd = strchr(segment, '/');
+        const size_t segmentLength = segmentEnd != NULL ? (size_t)(segmentEnd - segment) : strlen(segment);
+        const char* rootName = cre_node_name_table_get_name(scene_manager_find_entity_data(rootNode->entity)->nameId);
+        if (segmentLength != strlen(rootName) || strncmp(segment, rootName, segmentLength) != 0) {
+            return SKA_NULL_ENTITY;
+        }
+        currentEntity = rootNode->entity;
+        segment += segmentLength;
     }
-    return SKA_NULL_ENTITY;
+    char segmentName[CRE_NODE_NAME_MAX_LENGTH];
+    while (*segment != '\0' && currentEntity != SKA_NULL_ENTITY) {
+        if (*segment == '/') {
+            segment++;
+            continue;
+        }
+        const char* segmentEnd = strchr(segment, '/');
+        const size_t segmentLength = segmentEnd != NULL ? (size_t)(segmentEnd - segment) : strlen(segment);
+        if (segmentLength >= CRE_NODE_NAME_MAX_LENGTH) {
+            return SKA_NULL_ENTITY;
+        }
+        memcpy(segmentName, segment, segmentLength);
+        segmentName[segmentLength] = '\0';
+        segment += segmentLength;
+        if (strcmp(segmentName, ".") == 0) {
+            continue;
+        } else if (strcmp(segmentName, "..") == 0) {
+            const SceneTreeNode* parentNode = cre_scene_manager_get_entity_tree_node(currentEntity)->parent;
+            currentEntity = parentNode != NULL ? parentNode->entity : SKA_NULL_ENTITY;
+        } else {
+            currentEntity = cre_scene_manager_get_entity_child_by_name(currentEntity, segmentName);
+        }
+    }
+    return currentEntity;
 }
 
 bool cre_scene_manager_has_entity_tree_node(SkaEntity entity) {
-    return ska_hash_map_has(entityToTreeNodeMap, &entity);
+    return entity < SKA_MAX_ENTITIES && scene_manager_find_tree_node(entity) != NULL;
+}
+
+// Node pools
+static void scene_manager_set_pooled_bits(const SceneTreeNode* treeNode, bool isPooled) {
+    if (isPooled) {
+        pooledEntityBits[treeNode->entity / 32] |= 1u << (treeNode->entity % 32);
+    } else {
+        pooledEntityBits[treeNode->entity / 32] &= ~(1u << (treeNode->entity % 32));
+    }
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        scene_manager_set_pooled_bits(childNode, isPooled);
+    }
+}
+
+#ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
+// Reattached nodes shouldn't be interpolated from where they were released
+static void scene_manager_reset_prev_global_transforms(const SceneTreeNode* treeNode) {
+    Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(treeNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+    if (transformComp) {
+        SkaTransformModel2D* globalTransform = cre_scene_manager_get_scene_node_global_transform(treeNode->entity, transformComp);
+        SkaTransform2D* prevTransform = (SkaTransform2D*)cre_entity_paged_array_get_or_create(&entityPrevGlobalTransforms, treeNode->entity);
+        *prevTransform = ska_transform2d_model_convert_to_transform(globalTransform);
+    }
+    for (const SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        scene_manager_reset_prev_global_transforms(childNode);
+    }
+}
+#endif
+
+static void scene_manager_attach_pooled_node(SceneTreeNode* parentNode, SceneTreeNode* treeNode) {
+    SKA_ASSERT_FMT(treeNode->parent == NULL, "Pooled entity '%u' is already attached!", treeNode->entity);
+    cre_scene_tree_node_add_child(parentNode, treeNode);
+    scene_manager_index_child_name(treeNode);
+    scene_manager_set_pooled_bits(treeNode, false);
+    scene_manager_resolve_process_modes_with_children(treeNode, scene_manager_get_parent_process_mode(treeNode));
+    scene_manager_resolve_off_screen_suspended_with_children(treeNode, scene_manager_is_parent_off_screen_suspended(treeNode));
+    cre_scene_manager_invalidate_time_dilation_nodes_with_children(treeNode->entity);
+    Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(treeNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+    if (transformComp) {
+        // Pooled transforms were left dirty when reset, clear the root's flag so the subtree is queued for the next update
+        transformComp->isGlobalTransformDirty = false;
+        cre_scene_manager_invalidate_global_transform(treeNode->entity, transformComp);
+        // Lets colliders move to where the instance was placed
+        cre_scene_manager_queue_transform_changed_event(treeNode->entity);
+    }
+#ifdef CRE_SCENE_MANAGER_RENDER_INTERPOLATE_TRANSFORM2D_ALPHA
+    scene_manager_reset_prev_global_transforms(treeNode);
+#endif
+}
+
+void cre_scene_manager_detach_pooled_node(SkaEntity entity) {
+    SKA_ASSERT_FMT(cre_scene_manager_has_entity_tree_node(entity), "Pooled entity '%u' isn't in the scene tree!", entity);
+    SceneTreeNode* treeNode = scene_manager_find_tree_node(entity);
+    scene_manager_set_pooled_bits(treeNode, true);
+    if (treeNode->parent != NULL) {
+        // Unindexed while still linked so a sibling with the same name can take over
+        scene_manager_unindex_child_name(entity);
+        cre_scene_tree_node_remove_child(treeNode->parent, treeNode);
+        treeNode->parent = NULL;
+    }
+}
+
+bool cre_scene_manager_is_entity_pooled(SkaEntity entity) {
+    return entity < SKA_MAX_ENTITIES && (pooledEntityBits[entity / 32] & (1u << (entity % 32))) != 0;
 }
 
 void cre_scene_manager_add_node_as_child(SkaEntity parentEntity, SkaEntity childEntity) {
     SceneTreeNode* parentNode = cre_scene_manager_get_entity_tree_node(parentEntity);
+    if (cre_scene_manager_is_entity_pooled(childEntity)) {
+        scene_manager_attach_pooled_node(parentNode, scene_manager_find_tree_node(childEntity));
+        return;
+    }
     SceneTreeNode* node = cre_scene_manager_pop_staged_entity_tree_node(childEntity);
-    node->parent = parentNode;
-    SKA_ASSERT(parentNode->childCount + 1 < SCENE_TREE_NODE_MAX_CHILDREN);
-    parentNode->children[parentNode->childCount++] = node;
+    cre_scene_tree_node_add_child(parentNode, node);
     cre_scene_manager_queue_node_for_creation(node);
     // If there are child nodes, they are already parented to the current child entity
-    for (size_t i = 0; i < node->childCount; i++) {
-        cre_scene_manager_add_staged_node_children_to_scene(node->children[i]);
+    for (SceneTreeNode* childNode = node->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        cre_scene_manager_add_staged_node_children_to_scene(childNode);
     }
 }
 
 // A recursive functions to add already setup child nodes to the scene
 void cre_scene_manager_add_staged_node_children_to_scene(SceneTreeNode* treeNode) {
     cre_scene_manager_queue_node_for_creation(treeNode);
-    for (size_t i = 0; i < treeNode->childCount; i++) {
-        cre_scene_manager_add_staged_node_children_to_scene(treeNode->children[i]);
+    for (SceneTreeNode* childNode = treeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+        cre_scene_manager_add_staged_node_children_to_scene(childNode);
     }
 }
 
@@ -408,27 +1144,82 @@ void cre_scene_manager_invalidate_time_dilation_nodes_with_children(SkaEntity en
     nodeComponent->timeDilation.cacheInvalid = true;
     if (cre_scene_manager_has_entity_tree_node(entity)) {
         SceneTreeNode* sceneTreeNode = cre_scene_manager_get_entity_tree_node(entity);
-        for (size_t i = 0; i < sceneTreeNode->childCount; i++) {
-            cre_scene_manager_invalidate_time_dilation_nodes_with_children(sceneTreeNode->children[i]->entity);
+        for (const SceneTreeNode* childNode = sceneTreeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+            cre_scene_manager_invalidate_time_dilation_nodes_with_children(childNode->entity);
         }
     }
 }
 
-void cre_scene_manager_notify_all_on_transform_events(SkaEntity entity, Transform2DComponent* transformComp) {
+static inline void scene_manager_notify_transform_changed(SkaEntity entity, Transform2DComponent* transformComp) {
     ska_event_notify_observers(&transformComp->onTransformChanged, &(SkaSubjectNotifyPayload) {
             .data = &(CreComponentEntityUpdatePayload) {.entity = entity, .component = transformComp, .componentType = TRANSFORM2D_COMPONENT_TYPE}
     });
-    // Notify children by recursion
-    if (cre_scene_manager_has_entity_tree_node(entity)) {
-        SceneTreeNode* sceneTreeNode = cre_scene_manager_get_entity_tree_node(entity);
-        for (size_t i = 0; i < sceneTreeNode->childCount; i++) {
-            const SkaEntity childEntity = sceneTreeNode->children[i]->entity;
-            Transform2DComponent* childTransformComp = (Transform2DComponent*) ska_ecs_component_manager_get_component(childEntity, TRANSFORM2D_COMPONENT_INDEX);
-            if (childTransformComp != NULL) {
-                cre_scene_manager_notify_all_on_transform_events(childEntity, childTransformComp);
+}
+
+static inline bool scene_manager_is_transform_changed_queued(SkaEntity entity) {
+    return (transformChangedEntityBits[entity / 32] & (1u << (entity % 32))) != 0;
+}
+
+void cre_scene_manager_queue_transform_changed_event(SkaEntity entity) {
+    if (scene_manager_is_transform_changed_queued(entity)) {
+        return;
+    }
+    transformChangedEntityBits[entity / 32] |= 1u << (entity % 32);
+    scene_manager_entity_queue_push(&transformChangedEntities, entity);
+}
+
+// Pre-order walk so parents are notified before their children, children without a transform (and their subtrees) are skipped
+static void scene_manager_notify_transform_changed_subtree(const SceneTreeNode* rootNode) {
+    const SceneTreeNode* node = rootNode;
+    while (node != NULL) {
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(node->entity, TRANSFORM2D_COMPONENT_INDEX);
+        if (transformComp != NULL) {
+            scene_manager_notify_transform_changed(node->entity, transformComp);
+            if (node->firstChild != NULL) {
+                node = node->firstChild;
+                continue;
+            }
+        }
+        while (node != rootNode && node->nextSibling == NULL) {
+            node = node->parent;
+        }
+        node = node != rootNode ? node->nextSibling : NULL;
+    }
+}
+
+void cre_scene_manager_flush_transform_changed_events() {
+    // Entities queued by observers while flushing are picked up by this flush too
+    for (size_t i = 0; i < transformChangedEntities.count; i++) {
+        const SkaEntity entity = transformChangedEntities.entities[i];
+        if (!scene_manager_is_transform_changed_queued(entity)) {
+            continue; // Deleted since it was queued
+        }
+        if (!cre_scene_manager_has_entity_tree_node(entity)) {
+            // Staged nodes aren't linked to the tree yet, only notify the node itself
+            Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
+            if (transformComp != NULL) {
+                scene_manager_notify_transform_changed(entity, transformComp);
+            }
+            continue;
+        }
+        // A queued ancestor already covers the whole subtree, so every entity is only notified once
+        const SceneTreeNode* treeNode = scene_manager_find_tree_node(entity);
+        bool hasQueuedAncestor = false;
+        for (const SceneTreeNode* parentNode = treeNode->parent; parentNode != NULL; parentNode = parentNode->parent) {
+            if (scene_manager_is_transform_changed_queued(parentNode->entity)) {
+                hasQueuedAncestor = true;
+                break;
             }
         }
+        if (!hasQueuedAncestor) {
+            scene_manager_notify_transform_changed_subtree(treeNode);
+        }
+    }
+    for (size_t i = 0; i < transformChangedEntities.count; i++) {
+        const SkaEntity entity = transformChangedEntities.entities[i];
+        transformChangedEntityBits[entity / 32] &= ~(1u << (entity % 32));
     }
+    transformChangedEntities.count = 0;
 }
 
 void cre_scene_manager_execute_on_root_and_child_nodes(ExecuteOnAllTreeNodesFunc func) {
@@ -450,32 +1241,27 @@ SceneTreeNode* cre_scene_manager_stage_scene_nodes_from_json(JsonSceneNode* json
     return cre_scene_manager_setup_json_scene_node(jsonSceneNode, NULL, true);
 }
 
-// Recursive
-SceneTreeNode* cre_scene_manager_setup_json_scene_node(JsonSceneNode* jsonSceneNode, SceneTreeNode* parent, bool isStagedNodes) {
-    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
-
-    const bool isRoot = parent == NULL;
-    if (isRoot && !isStagedNodes) {
-        cre_scene_manager_set_active_scene_root(node);
-    }  else if (parent) {
-        SKA_ASSERT(parent->childCount + 1 < SCENE_TREE_NODE_MAX_CHILDREN);
-        parent->children[parent->childCount++] = node;
-    }
-
-    // Components
-    NodeComponent* nodeComponent = node_component_create();
+static void scene_manager_set_json_scene_node_components(const JsonSceneNode* jsonSceneNode, SceneTreeNode* node) {
+    CreEntityBuilder builder;
+    cre_entity_builder_begin(&builder, node->entity);
+    NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
     ska_strcpy(nodeComponent->name, jsonSceneNode->name);
     nodeComponent->type = jsonSceneNode->type;
     SKA_ASSERT_FMT(nodeComponent->type != NodeBaseType_INVALID, "Node '%s' has an invalid node type '%d'", nodeComponent->name, nodeComponent->type);
-    ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, nodeComponent);
+    cre_entity_builder_set_component(&builder, NODE_COMPONENT_INDEX, nodeComponent);
     ska_logger_info("Creating entity - name: '%s', entity_id = '%d', type: '%s'", nodeComponent->name, node->entity, node_get_base_type_string(nodeComponent->type));
+    if (jsonSceneNode->tags != NULL) {
+        for (size_t i = 0; i < jsonSceneNode->tags->size; i++) {
+            cre_scene_manager_add_entity_to_group(node->entity, *(char**)ska_array_list_get(jsonSceneNode->tags, i));
+        }
+    }
 
     if (jsonSceneNode->components[TRANSFORM2D_COMPONENT_INDEX] != NULL) {
-        Transform2DComponent* transform2DComponent = transform2d_component_copy((Transform2DComponent*) jsonSceneNode->components[TRANSFORM2D_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
+        Transform2DComponent* transform2DComponent = (Transform2DComponent*)cre_component_pool_copy(TRANSFORM2D_COMPONENT_INDEX, jsonSceneNode->components[TRANSFORM2D_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
     }
     if (jsonSceneNode->components[SPRITE_COMPONENT_INDEX] != NULL) {
-        SpriteComponent* spriteComponent = sprite_component_copy((SpriteComponent*) jsonSceneNode->components[SPRITE_COMPONENT_INDEX]);
+        SpriteComponent* spriteComponent = (SpriteComponent*)cre_component_pool_copy(SPRITE_COMPONENT_INDEX, jsonSceneNode->components[SPRITE_COMPONENT_INDEX]);
         spriteComponent->texture = ska_asset_manager_get_texture(jsonSceneNode->spriteTexturePath);
         if (jsonSceneNode->shaderInstanceShaderPath) {
             spriteComponent->shaderInstanceId = ska_shader_cache_create_instance_and_add(jsonSceneNode->shaderInstanceShaderPath);
@@ -489,10 +1275,11 @@ SceneTreeNode* cre_scene_manager_setup_json_scene_node(JsonSceneNode* jsonSceneN
         } else {
             spriteComponent->shaderInstanceId = SKA_SHADER_INSTANCE_INVALID_ID;
         }
-        ska_ecs_component_manager_set_component(node->entity, SPRITE_COMPONENT_INDEX, spriteComponent);
+        cre_entity_builder_set_component(&builder, SPRITE_COMPONENT_INDEX, spriteComponent);
     }
     if (jsonSceneNode->components[ANIMATED_SPRITE_COMPONENT_INDEX] != NULL) {
-        AnimatedSpriteComponent* animatedSpriteComponent = animated_sprite_component_data_copy_to_animated_sprite((AnimatedSpriteComponentData*)jsonSceneNode->components[ANIMATED_SPRITE_COMPONENT_INDEX]);
+        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)cre_component_pool_create(ANIMATED_SPRITE_COMPONENT_INDEX);
+        animated_sprite_component_data_copy_into_animated_sprite((AnimatedSpriteComponentData*)jsonSceneNode->components[ANIMATED_SPRITE_COMPONENT_INDEX], animatedSpriteComponent);
         if (jsonSceneNode->shaderInstanceShaderPath) {
             animatedSpriteComponent->shaderInstanceId = ska_shader_cache_create_instance_and_add(jsonSceneNode->shaderInstanceShaderPath);
             SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(animatedSpriteComponent->shaderInstanceId);
@@ -505,42 +1292,61 @@ SceneTreeNode* cre_scene_manager_setup_json_scene_node(JsonSceneNode* jsonSceneN
         } else {
             animatedSpriteComponent->shaderInstanceId = SKA_SHADER_INSTANCE_INVALID_ID;
         }
-        ska_ecs_component_manager_set_component(node->entity, ANIMATED_SPRITE_COMPONENT_INDEX, animatedSpriteComponent);
+        cre_entity_builder_set_component(&builder, ANIMATED_SPRITE_COMPONENT_INDEX, animatedSpriteComponent);
     }
     if (jsonSceneNode->components[TEXT_LABEL_COMPONENT_INDEX] != NULL) {
-        TextLabelComponent* textLabelComponent = text_label_component_copy((TextLabelComponent*) jsonSceneNode->components[TEXT_LABEL_COMPONENT_INDEX]);
+        TextLabelComponent* textLabelComponent = (TextLabelComponent*)cre_component_pool_copy(TEXT_LABEL_COMPONENT_INDEX, jsonSceneNode->components[TEXT_LABEL_COMPONENT_INDEX]);
         if (jsonSceneNode->fontUID != NULL) {
             textLabelComponent->font = ska_asset_manager_get_font(jsonSceneNode->fontUID);
         } else {
             textLabelComponent->font = ska_asset_manager_get_font(CRE_DEFAULT_FONT_ASSET.uid);
         }
-        ska_ecs_component_manager_set_component(node->entity, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
+        cre_entity_builder_set_component(&builder, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
     }
     if (jsonSceneNode->components[SCRIPT_COMPONENT_INDEX] != NULL) {
-        ScriptComponent* scriptComponent = script_component_copy(jsonSceneNode->components[SCRIPT_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, SCRIPT_COMPONENT_INDEX, scriptComponent);
+        ScriptComponent* scriptComponent = (ScriptComponent*)cre_component_pool_copy(SCRIPT_COMPONENT_INDEX, jsonSceneNode->components[SCRIPT_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, SCRIPT_COMPONENT_INDEX, scriptComponent);
     }
     if (jsonSceneNode->components[COLLIDER2D_COMPONENT_INDEX] != NULL) {
-        Collider2DComponent* collider2DComponent = collider2d_component_copy(jsonSceneNode->components[COLLIDER2D_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, COLLIDER2D_COMPONENT_INDEX, collider2DComponent);
+        Collider2DComponent* collider2DComponent = (Collider2DComponent*)cre_component_pool_copy(COLLIDER2D_COMPONENT_INDEX, jsonSceneNode->components[COLLIDER2D_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, COLLIDER2D_COMPONENT_INDEX, collider2DComponent);
     }
     if (jsonSceneNode->components[COLOR_RECT_COMPONENT_INDEX] != NULL) {
-        ColorRectComponent* colorSquareComponent = color_rect_component_copy(jsonSceneNode->components[COLOR_RECT_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, COLOR_RECT_COMPONENT_INDEX, colorSquareComponent);
+        ColorRectComponent* colorSquareComponent = (ColorRectComponent*)cre_component_pool_copy(COLOR_RECT_COMPONENT_INDEX, jsonSceneNode->components[COLOR_RECT_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, COLOR_RECT_COMPONENT_INDEX, colorSquareComponent);
     }
     if (jsonSceneNode->components[PARALLAX_COMPONENT_INDEX] != NULL) {
-        ParallaxComponent* parallaxComponent = parallax_component_copy(jsonSceneNode->components[PARALLAX_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, PARALLAX_COMPONENT_INDEX, parallaxComponent);
+        ParallaxComponent* parallaxComponent = (ParallaxComponent*)cre_component_pool_copy(PARALLAX_COMPONENT_INDEX, jsonSceneNode->components[PARALLAX_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, PARALLAX_COMPONENT_INDEX, parallaxComponent);
     }
     if (jsonSceneNode->components[PARTICLES2D_COMPONENT_INDEX] != NULL) {
-        Particles2DComponent* particles2DComponent = particles2d_component_copy(jsonSceneNode->components[PARTICLES2D_COMPONENT_INDEX]);
-        ska_ecs_component_manager_set_component(node->entity, PARTICLES2D_COMPONENT_INDEX, particles2DComponent);
+        Particles2DComponent* particles2DComponent = (Particles2DComponent*)cre_component_pool_copy(PARTICLES2D_COMPONENT_INDEX, jsonSceneNode->components[PARTICLES2D_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, PARTICLES2D_COMPONENT_INDEX, particles2DComponent);
     }
     if (jsonSceneNode->components[TILEMAP_COMPONENT_INDEX] != NULL) {
         TilemapComponent* tilemapComponent = tilemap_component_copy(jsonSceneNode->components[TILEMAP_COMPONENT_INDEX]);
         tilemapComponent->tilemap->tileset.texture = ska_asset_manager_get_texture(jsonSceneNode->spriteTexturePath);
-        ska_ecs_component_manager_set_component(node->entity, TILEMAP_COMPONENT_INDEX, tilemapComponent);
+        cre_entity_builder_set_component(&builder, TILEMAP_COMPONENT_INDEX, tilemapComponent);
+    }
+    if (jsonSceneNode->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX] != NULL) {
+        VisibilityNotifier2DComponent* visibilityNotifier2DComponent = (VisibilityNotifier2DComponent*)cre_component_pool_copy(VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, jsonSceneNode->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX]);
+        cre_entity_builder_set_component(&builder, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, visibilityNotifier2DComponent);
     }
+    cre_entity_builder_build(&builder);
+}
+
+// Recursive
+SceneTreeNode* cre_scene_manager_setup_json_scene_node(JsonSceneNode* jsonSceneNode, SceneTreeNode* parent, bool isStagedNodes) {
+    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+
+    const bool isRoot = parent == NULL;
+    if (isRoot && !isStagedNodes) {
+        cre_scene_manager_set_active_scene_root(node);
+    }  else if (parent) {
+        cre_scene_tree_node_add_child(parent, node);
+    }
+
+    scene_manager_set_json_scene_node_components(jsonSceneNode, node);
 
     if (!isStagedNodes) {
         cre_scene_manager_queue_node_for_creation(node);
@@ -556,3 +1362,470 @@ SceneTreeNode* cre_scene_manager_setup_json_scene_node(JsonSceneNode* jsonSceneN
 
     return node;
 }
+
+// Nodes are stored in pre-order so a node's parent has always been created before it.  Grown to the largest scene set up.
+static SceneTreeNode** compiledSceneTreeNodes = NULL;
+static uint32 compiledSceneTreeNodeCapacity = 0;
+
+static SceneTreeNode* cre_scene_manager_setup_compiled_scene_nodes(const CreCompiledScene* compiledScene, bool isStagedNodes) {
+    const uint32 nodeCount = compiledScene->header->nodeCount;
+    SKA_ASSERT_FMT(nodeCount > 0 && nodeCount <= SKA_MAX_ENTITIES, "Compiled scene has '%u' nodes which exceeds the entity limit!", nodeCount);
+    if (nodeCount > compiledSceneTreeNodeCapacity) {
+        compiledSceneTreeNodeCapacity = nodeCount;
+        compiledSceneTreeNodes = (SceneTreeNode**)realloc(compiledSceneTreeNodes, sizeof(SceneTreeNode*) * compiledSceneTreeNodeCapacity);
+    }
+    for (uint32 nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+        const CreCompiledSceneNode* compiledNode = &compiledScene->nodes[nodeIndex];
+        const bool isRoot = compiledNode->parentIndex == CRE_COMPILED_SCENE_NO_PARENT;
+        SKA_ASSERT_FMT(isRoot || compiledNode->parentIndex < nodeIndex, "Compiled scene node '%u' is stored before its parent!", nodeIndex);
+        SceneTreeNode* parent = isRoot ? NULL : compiledSceneTreeNodes[compiledNode->parentIndex];
+        SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+        compiledSceneTreeNodes[nodeIndex] = node;
+        if (isRoot && !isStagedNodes) {
+            cre_scene_manager_set_active_scene_root(node);
+        } else if (parent) {
+            cre_scene_tree_node_add_child(parent, node);
+        }
+        cre_compiled_scene_set_node_components(compiledScene, nodeIndex, node->entity);
+        scene_manager_add_entity_to_tag_groups(node->entity, cre_compiled_scene_get_node_tags(compiledScene, nodeIndex));
+        if (!isStagedNodes) {
+            cre_scene_manager_queue_node_for_creation(node);
+        } else if (isRoot) {
+            // Same as json, only the staged root is tracked and its children are added along with it
+            cre_scene_manager_stage_child_node_to_be_added_later(node);
+        }
+    }
+    return compiledSceneTreeNodes[0];
+}
+
+SceneTreeNode* cre_scene_manager_setup_scene_nodes_from_template(const CreSceneTemplate* sceneTemplate, bool isStagedNodes) {
+    if (sceneTemplate->compiledScene) {
+        return cre_scene_manager_setup_compiled_scene_nodes(sceneTemplate->compiledScene, isStagedNodes);
+    }
+    return cre_scene_manager_setup_json_scene_node(sceneTemplate->rootNode, NULL, isStagedNodes);
+}
+
+SceneTreeNode* cre_scene_manager_stage_scene_nodes_from_template(const CreSceneTemplate* sceneTemplate) {
+    return cre_scene_manager_setup_scene_nodes_from_template(sceneTemplate, true);
+}
+
+// Bulk instantiation
+// The first instance is set up from the template as usual (resolving assets and creating shader instances), every other
+// instance copies its components from the first with the flattened layout below so the template is only walked once
+typedef enum ScenePrefabComponent {
+    ScenePrefabComponent_TRANSFORM2D = 1 << 0,
+    ScenePrefabComponent_SPRITE = 1 << 1,
+    ScenePrefabComponent_ANIMATED_SPRITE = 1 << 2,
+    ScenePrefabComponent_TEXT_LABEL = 1 << 3,
+    ScenePrefabComponent_SCRIPT = 1 << 4,
+    ScenePrefabComponent_COLLIDER2D = 1 << 5,
+    ScenePrefabComponent_COLOR_RECT = 1 << 6,
+    ScenePrefabComponent_PARALLAX = 1 << 7,
+    ScenePrefabComponent_PARTICLES2D = 1 << 8,
+    ScenePrefabComponent_TILEMAP = 1 << 9,
+    ScenePrefabComponent_VISIBILITY_NOTIFIER2D = 1 << 10,
+} ScenePrefabComponent;
+
+typedef struct ScenePrefabNode {
+    SkaEntity prototypeEntity;
+    uint32 parentIndex; // Only valid for non root nodes
+    uint32 componentMask;
+    SceneTreeNode* instanceTreeNode; // Node of the instance being created, the prototype's while the layout is built
+} ScenePrefabNode;
+
+// Grown to the largest prototype instanced
+static ScenePrefabNode* prefabNodes = NULL;
+static uint32 prefabNodeCapacity = 0;
+
+static uint32 scene_manager_get_prefab_component_mask(SkaEntity entity) {
+    uint32 componentMask = 0;
+    if (ska_ecs_component_manager_has_component(entity, TRANSFORM2D_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_TRANSFORM2D; }
+    if (ska_ecs_component_manager_has_component(entity, SPRITE_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_SPRITE; }
+    if (ska_ecs_component_manager_has_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_ANIMATED_SPRITE; }
+    if (ska_ecs_component_manager_has_component(entity, TEXT_LABEL_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_TEXT_LABEL; }
+    if (ska_ecs_component_manager_has_component(entity, SCRIPT_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_SCRIPT; }
+    if (ska_ecs_component_manager_has_component(entity, COLLIDER2D_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_COLLIDER2D; }
+    if (ska_ecs_component_manager_has_component(entity, COLOR_RECT_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_COLOR_RECT; }
+    if (ska_ecs_component_manager_has_component(entity, PARALLAX_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_PARALLAX; }
+    if (ska_ecs_component_manager_has_component(entity, PARTICLES2D_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_PARTICLES2D; }
+    if (ska_ecs_component_manager_has_component(entity, TILEMAP_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_TILEMAP; }
+    if (ska_ecs_component_manager_has_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX)) { componentMask |= ScenePrefabComponent_VISIBILITY_NOTIFIER2D; }
+    return componentMask;
+}
+
+static void scene_manager_set_prefab_node(uint32 nodeIndex, SceneTreeNode* prototypeNode, uint32 parentIndex) {
+    if (nodeIndex >= prefabNodeCapacity) {
+        prefabNodeCapacity = prefabNodeCapacity > 0 ? prefabNodeCapacity * 2 : 64;
+        prefabNodes = (ScenePrefabNode*)realloc(prefabNodes, sizeof(ScenePrefabNode) * prefabNodeCapacity);
+    }
+    prefabNodes[nodeIndex] = (ScenePrefabNode){ .prototypeEntity = prototypeNode->entity, .parentIndex = parentIndex, .componentMask = scene_manager_get_prefab_component_mask(prototypeNode->entity), .instanceTreeNode = prototypeNode };
+}
+
+// Flattens the prototype tree breadth first so parents always come before their children, returns the node count
+static uint32 scene_manager_build_prefab_layout(SceneTreeNode* prototypeRoot) {
+    uint32 nodeCount = 0;
+    scene_manager_set_prefab_node(nodeCount++, prototypeRoot, 0);
+    for (uint32 nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+        for (SceneTreeNode* childNode = prefabNodes[nodeIndex].instanceTreeNode->firstChild; childNode != NULL; childNode = childNode->nextSibling) {
+            scene_manager_set_prefab_node(nodeCount++, childNode, nodeIndex);
+        }
+    }
+    return nodeCount;
+}
+
+static void scene_manager_copy_prefab_components(const ScenePrefabNode* prefabNode, SkaEntity entity) {
+    const SkaEntity prototypeEntity = prefabNode->prototypeEntity;
+    CreEntityBuilder builder;
+    cre_entity_builder_begin(&builder, entity);
+    NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_copy(NODE_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, NODE_COMPONENT_INDEX));
+    cre_entity_builder_set_component(&builder, NODE_COMPONENT_INDEX, nodeComponent);
+    // Pages are never moved once allocated so the prototype's groups stay valid while adding the new entity's
+    const SceneEntityGroups* prototypeGroups = (SceneEntityGroups*)cre_entity_paged_array_get(&entityGroups, prototypeEntity);
+    for (uint32 i = 0; prototypeGroups != NULL && i < prototypeGroups->count; i++) {
+        scene_manager_add_entity_to_group_index(entity, prototypeGroups->memberships[i].groupIndex);
+    }
+
+    if (prefabNode->componentMask & ScenePrefabComponent_TRANSFORM2D) {
+        Transform2DComponent* transform2DComponent = (Transform2DComponent*)cre_component_pool_copy(TRANSFORM2D_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, TRANSFORM2D_COMPONENT_INDEX));
+        transform2DComponent->isGlobalTransformDirty = true;
+        cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, transform2DComponent);
+    }
+    // Textures, fonts and shader instances are shared with the prototype
+    if (prefabNode->componentMask & ScenePrefabComponent_SPRITE) {
+        SpriteComponent* spriteComponent = (SpriteComponent*)cre_component_pool_copy(SPRITE_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, SPRITE_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, SPRITE_COMPONENT_INDEX, spriteComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_ANIMATED_SPRITE) {
+        const AnimatedSpriteComponent* prototypeAnimatedSprite = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(prototypeEntity, ANIMATED_SPRITE_COMPONENT_INDEX);
+        AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)cre_component_pool_copy(ANIMATED_SPRITE_COMPONENT_INDEX, prototypeAnimatedSprite);
+        if (prototypeAnimatedSprite->currentAnimation != NULL) {
+            animatedSpriteComponent->currentAnimation = &animatedSpriteComponent->animations[prototypeAnimatedSprite->currentAnimation - prototypeAnimatedSprite->animations];
+        }
+        cre_entity_builder_set_component(&builder, ANIMATED_SPRITE_COMPONENT_INDEX, animatedSpriteComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_TEXT_LABEL) {
+        TextLabelComponent* textLabelComponent = (TextLabelComponent*)cre_component_pool_copy(TEXT_LABEL_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, TEXT_LABEL_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, TEXT_LABEL_COMPONENT_INDEX, textLabelComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_SCRIPT) {
+        ScriptComponent* scriptComponent = (ScriptComponent*)cre_component_pool_copy(SCRIPT_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, SCRIPT_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, SCRIPT_COMPONENT_INDEX, scriptComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_COLLIDER2D) {
+        Collider2DComponent* collider2DComponent = (Collider2DComponent*)cre_component_pool_copy(COLLIDER2D_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, COLLIDER2D_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, COLLIDER2D_COMPONENT_INDEX, collider2DComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_COLOR_RECT) {
+        ColorRectComponent* colorRectComponent = (ColorRectComponent*)cre_component_pool_copy(COLOR_RECT_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, COLOR_RECT_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, COLOR_RECT_COMPONENT_INDEX, colorRectComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_PARALLAX) {
+        ParallaxComponent* parallaxComponent = (ParallaxComponent*)cre_component_pool_copy(PARALLAX_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, PARALLAX_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, PARALLAX_COMPONENT_INDEX, parallaxComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_PARTICLES2D) {
+        Particles2DComponent* particles2DComponent = (Particles2DComponent*)cre_component_pool_copy(PARTICLES2D_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, PARTICLES2D_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, PARTICLES2D_COMPONENT_INDEX, particles2DComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_TILEMAP) {
+        // Each instance owns its tilemap
+        TilemapComponent* tilemapComponent = tilemap_component_copy(ska_ecs_component_manager_get_component(prototypeEntity, TILEMAP_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, TILEMAP_COMPONENT_INDEX, tilemapComponent);
+    }
+    if (prefabNode->componentMask & ScenePrefabComponent_VISIBILITY_NOTIFIER2D) {
+        VisibilityNotifier2DComponent* visibilityNotifier2DComponent = (VisibilityNotifier2DComponent*)cre_component_pool_copy(VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, ska_ecs_component_manager_get_component(prototypeEntity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX));
+        cre_entity_builder_set_component(&builder, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, visibilityNotifier2DComponent);
+    }
+    cre_entity_builder_build(&builder);
+}
+
+static void scene_manager_set_prefab_root_transform(SkaEntity entity, const SkaTransform2D* transform) {
+    Transform2DComponent* transform2DComponent = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
+    if (transform2DComponent) {
+        transform2DComponent->localTransform = *transform;
+        transform2DComponent->isGlobalTransformDirty = true;
+    }
+}
+
+size_t cre_scene_manager_instantiate_many(const CreSceneTemplate* sceneTemplate, size_t count, const SkaTransform2D* transforms, SceneTreeNode** outRootNodes) {
+    if (count == 0) {
+        return 0;
+    }
+    SceneTreeNode* prototypeRoot = cre_scene_manager_setup_scene_nodes_from_template(sceneTemplate, true);
+    const uint32 nodeCount = scene_manager_build_prefab_layout(prototypeRoot);
+    SKA_ASSERT_FMT((size_t)nodeCount * count <= SKA_MAX_ENTITIES, "Instancing '%zu' scenes with '%u' nodes each exceeds the entity limit!", count, nodeCount);
+    if (transforms) {
+        scene_manager_set_prefab_root_transform(prototypeRoot->entity, &transforms[0]);
+    }
+    outRootNodes[0] = prototypeRoot;
+
+    // Every instance shares the prototype's shader instances
+    for (uint32 nodeIndex = 0; nodeIndex < nodeCount && count > 1; nodeIndex++) {
+        const ScenePrefabNode* prefabNode = &prefabNodes[nodeIndex];
+        if (prefabNode->componentMask & ScenePrefabComponent_SPRITE) {
+            const SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(prefabNode->prototypeEntity, SPRITE_COMPONENT_INDEX);
+            if (spriteComponent->shaderInstanceId != SKA_SHADER_INSTANCE_INVALID_ID) {
+                scene_manager_share_shader_instance(spriteComponent->shaderInstanceId, (uint32)count - 1);
+            }
+        }
+        if (prefabNode->componentMask & ScenePrefabComponent_ANIMATED_SPRITE) {
+            const AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(prefabNode->prototypeEntity, ANIMATED_SPRITE_COMPONENT_INDEX);
+            if (animatedSpriteComponent->shaderInstanceId != SKA_SHADER_INSTANCE_INVALID_ID) {
+                scene_manager_share_shader_instance(animatedSpriteComponent->shaderInstanceId, (uint32)count - 1);
+            }
+        }
+    }
+
+    for (size_t instanceIndex = 1; instanceIndex < count; instanceIndex++) {
+        for (uint32 nodeIndex = 0; nodeIndex < nodeCount; nodeIndex++) {
+            const ScenePrefabNode* prefabNode = &prefabNodes[nodeIndex];
+            SceneTreeNode* parent = nodeIndex == 0 ? NULL : prefabNodes[prefabNode->parentIndex].instanceTreeNode;
+            SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+            if (parent) {
+                cre_scene_tree_node_add_child(parent, node);
+            }
+            prefabNodes[nodeIndex].instanceTreeNode = node;
+            scene_manager_copy_prefab_components(prefabNode, node->entity);
+        }
+        SceneTreeNode* rootNode = prefabNodes[0].instanceTreeNode;
+        if (transforms) {
+            scene_manager_set_prefab_root_transform(rootNode->entity, &transforms[instanceIndex]);
+        }
+        cre_scene_manager_stage_child_node_to_be_added_later(rootNode);
+        outRootNodes[instanceIndex] = rootNode;
+    }
+    ska_logger_debug("Instantiated '%zu' instances of a '%u' node scene", count, nodeCount);
+    return count;
+}
+
+// Async scene change
+typedef enum AsyncSceneLoadState {
+    AsyncSceneLoadState_NONE,
+    AsyncSceneLoadState_READING, // Template is being read and parsed on the loader thread
+    AsyncSceneLoadState_INSTANTIATING, // Nodes are being created on the main thread within the frame budget
+} AsyncSceneLoadState;
+
+typedef struct AsyncSceneLoad {
+    AsyncSceneLoadState state;
+    char scenePath[256];
+    SDL_Thread* thread;
+    SDL_AtomicInt hasThreadFinished;
+    bool hasThreadSucceeded; // Written by the loader thread before 'hasThreadFinished' is set
+    CreSceneTemplate loadedTemplate; // Owned by the loader thread until it's finished
+    CreSceneCacheId cacheId;
+    uint32 nodeCount;
+    uint32 nodesCreated;
+    f32 frameBudgetMilliseconds;
+    CreOnAsyncSceneLoadedFunc onLoadedFunc;
+} AsyncSceneLoad;
+
+static AsyncSceneLoad asyncSceneLoad = { .state = AsyncSceneLoadState_NONE, .cacheId = CRE_SCENE_CACHE_INVALID_ID, .frameBudgetMilliseconds = CRE_SCENE_MANAGER_DEFAULT_ASYNC_LOAD_FRAME_BUDGET_MS };
+static char asyncLoadedActiveScenePath[256];
+// Json templates are flattened in pre-order so nodes can be created one at a time, compiled scenes are already flat
+typedef struct AsyncSceneLoadNode {
+    const JsonSceneNode* jsonNode; // Only set for json templates
+    uint32 parentIndex; // Only set for json templates
+    SceneTreeNode* treeNode;
+} AsyncSceneLoadNode;
+
+// Grown to the largest scene loaded
+static AsyncSceneLoadNode* asyncLoadNodes = NULL;
+static uint32 asyncLoadNodeCapacity = 0;
+
+static void scene_manager_reserve_async_load_nodes(uint32 nodeCount) {
+    if (nodeCount <= asyncLoadNodeCapacity) {
+        return;
+    }
+    asyncLoadNodeCapacity = asyncLoadNodeCapacity > 0 ? asyncLoadNodeCapacity : 64;
+    while (asyncLoadNodeCapacity < nodeCount) {
+        asyncLoadNodeCapacity *= 2;
+    }
+    asyncLoadNodes = (AsyncSceneLoadNode*)realloc(asyncLoadNodes, sizeof(AsyncSceneLoadNode) * asyncLoadNodeCapacity);
+}
+
+static int scene_manager_async_scene_load_thread(void* data) {
+    AsyncSceneLoad* sceneLoad = (AsyncSceneLoad*)data;
+    sceneLoad->hasThreadSucceeded = cre_scene_template_cache_read_scene_template(sceneLoad->scenePath, &sceneLoad->loadedTemplate);
+    SDL_SetAtomicInt(&sceneLoad->hasThreadFinished, 1);
+    return 0;
+}
+
+static void scene_manager_flatten_json_scene_node(const JsonSceneNode* jsonSceneNode, uint32 parentIndex) {
+    SKA_ASSERT_FMT(asyncSceneLoad.nodeCount < SKA_MAX_ENTITIES, "Scene '%s' exceeds the entity limit!", asyncSceneLoad.scenePath);
+    const uint32 nodeIndex = asyncSceneLoad.nodeCount++;
+    scene_manager_reserve_async_load_nodes(asyncSceneLoad.nodeCount);
+    asyncLoadNodes[nodeIndex].jsonNode = jsonSceneNode;
+    asyncLoadNodes[nodeIndex].parentIndex = parentIndex;
+    for (size_t i = 0; i < jsonSceneNode->childrenCount; i++) {
+        scene_manager_flatten_json_scene_node(jsonSceneNode->children[i], nodeIndex);
+    }
+}
+
+static void scene_manager_begin_async_scene_instantiation(CreSceneCacheId cacheId) {
+    // Pinned so other scene loads can't evict it while it's instanced over multiple frames
+    cre_scene_template_cache_pin_scene(cacheId);
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene(cacheId);
+    asyncSceneLoad.cacheId = cacheId;
+    asyncSceneLoad.nodeCount = 0;
+    asyncSceneLoad.nodesCreated = 0;
+    if (sceneTemplate->compiledScene) {
+        asyncSceneLoad.nodeCount = sceneTemplate->compiledScene->header->nodeCount;
+        SKA_ASSERT_FMT(asyncSceneLoad.nodeCount <= SKA_MAX_ENTITIES, "Scene '%s' exceeds the entity limit!", asyncSceneLoad.scenePath);
+        scene_manager_reserve_async_load_nodes(asyncSceneLoad.nodeCount);
+    } else {
+        scene_manager_flatten_json_scene_node(sceneTemplate->rootNode, 0);
+    }
+    asyncSceneLoad.state = AsyncSceneLoadState_INSTANTIATING;
+}
+
+// Nodes stay staged (not in any system) until all of them are created, then the whole scene is swapped in at once
+static void scene_manager_create_async_scene_node(const CreSceneTemplate* sceneTemplate, uint32 nodeIndex) {
+    const uint32 parentIndex = sceneTemplate->compiledScene ? sceneTemplate->compiledScene->nodes[nodeIndex].parentIndex : asyncLoadNodes[nodeIndex].parentIndex;
+    SceneTreeNode* parent = nodeIndex == 0 ? NULL : asyncLoadNodes[parentIndex].treeNode;
+    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+    if (parent) {
+        cre_scene_tree_node_add_child(parent, node);
+    }
+    if (sceneTemplate->compiledScene) {
+        cre_compiled_scene_set_node_components(sceneTemplate->compiledScene, nodeIndex, node->entity);
+        scene_manager_add_entity_to_tag_groups(node->entity, cre_compiled_scene_get_node_tags(sceneTemplate->compiledScene, nodeIndex));
+    } else {
+        scene_manager_set_json_scene_node_components(asyncLoadNodes[nodeIndex].jsonNode, node);
+    }
+    asyncLoadNodes[nodeIndex].treeNode = node;
+}
+
+static void scene_manager_finish_async_scene_load() {
+    if (activeScene != NULL) {
+        cre_queue_destroy_tree_node_entity_all(activeScene->sceneTree->root);
+        SKA_FREE(activeScene);
+    }
+    cre_camera_manager_reset_current_camera();
+
+    ska_strcpy(asyncLoadedActiveScenePath, asyncSceneLoad.scenePath);
+    activeScene = cre_scene_create_scene(asyncLoadedActiveScenePath);
+    SceneTreeNode* rootNode = asyncLoadNodes[0].treeNode;
+    cre_scene_manager_set_active_scene_root(rootNode);
+    cre_scene_manager_add_staged_node_children_to_scene(rootNode);
+
+    cre_scene_template_cache_unpin_scene(asyncSceneLoad.cacheId);
+    asyncSceneLoad.cacheId = CRE_SCENE_CACHE_INVALID_ID;
+    asyncSceneLoad.state = AsyncSceneLoadState_NONE;
+    ska_logger_debug("Finished loading scene '%s' asynchronously", asyncLoadedActiveScenePath);
+    if (asyncSceneLoad.onLoadedFunc) {
+        asyncSceneLoad.onLoadedFunc(asyncLoadedActiveScenePath);
+    }
+}
+
+// Partially created nodes are left as is, only used when shutting down
+static void scene_manager_cancel_async_scene_load() {
+    if (asyncSceneLoad.state == AsyncSceneLoadState_READING) {
+        SDL_WaitThread(asyncSceneLoad.thread, NULL);
+        asyncSceneLoad.thread = NULL;
+        if (asyncSceneLoad.loadedTemplate.compiledScene) {
+            cre_compiled_scene_close(asyncSceneLoad.loadedTemplate.compiledScene);
+        }
+        if (asyncSceneLoad.loadedTemplate.rootNode) {
+            cre_json_delete_json_scene_node(asyncSceneLoad.loadedTemplate.rootNode);
+        }
+        asyncSceneLoad.loadedTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+    } else if (asyncSceneLoad.state == AsyncSceneLoadState_INSTANTIATING) {
+        cre_scene_template_cache_unpin_scene(asyncSceneLoad.cacheId);
+        asyncSceneLoad.cacheId = CRE_SCENE_CACHE_INVALID_ID;
+    }
+    asyncSceneLoad.state = AsyncSceneLoadState_NONE;
+}
+
+void scene_manager_free_scratch_buffers() {
+    free(compiledSceneTreeNodes);
+    compiledSceneTreeNodes = NULL;
+    compiledSceneTreeNodeCapacity = 0;
+    free(prefabNodes);
+    prefabNodes = NULL;
+    prefabNodeCapacity = 0;
+    free(asyncLoadNodes);
+    asyncLoadNodes = NULL;
+    asyncLoadNodeCapacity = 0;
+}
+
+bool cre_scene_manager_change_scene_async(const char* scenePath) {
+    if (cre_scene_manager_is_async_scene_loading() || queuedSceneToChangeTo != NULL) {
+        ska_logger_warn("Scene change already in progress, not loading '%s'", scenePath);
+        return false;
+    }
+    SKA_ASSERT_FMT(strlen(scenePath) < sizeof(asyncSceneLoad.scenePath), "Scene path '%s' is too long!", scenePath);
+    ska_strcpy(asyncSceneLoad.scenePath, scenePath);
+
+    // Nothing to read if the template is already cached
+    const CreSceneCacheId cacheId = cre_scene_template_cache_find_resident_scene(scenePath);
+    if (cacheId != CRE_SCENE_CACHE_INVALID_ID) {
+        scene_manager_begin_async_scene_instantiation(cacheId);
+        return true;
+    }
+
+    asyncSceneLoad.loadedTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+    asyncSceneLoad.hasThreadSucceeded = false;
+    SDL_SetAtomicInt(&asyncSceneLoad.hasThreadFinished, 0);
+    asyncSceneLoad.thread = SDL_CreateThread(scene_manager_async_scene_load_thread, "cre_scene_loader", &asyncSceneLoad);
+    if (asyncSceneLoad.thread == NULL) {
+        ska_logger_error("Failed to create scene loader thread for '%s': %s", scenePath, SDL_GetError());
+        return false;
+    }
+    asyncSceneLoad.state = AsyncSceneLoadState_READING;
+    return true;
+}
+
+void cre_scene_manager_process_async_scene_load() {
+    if (asyncSceneLoad.state == AsyncSceneLoadState_READING) {
+        if (SDL_GetAtomicInt(&asyncSceneLoad.hasThreadFinished) == 0) {
+            return;
+        }
+        SDL_WaitThread(asyncSceneLoad.thread, NULL);
+        asyncSceneLoad.thread = NULL;
+        if (!asyncSceneLoad.hasThreadSucceeded) {
+            ska_logger_error("Failed to load scene '%s' asynchronously!", asyncSceneLoad.scenePath);
+            asyncSceneLoad.state = AsyncSceneLoadState_NONE;
+            return;
+        }
+        scene_manager_begin_async_scene_instantiation(cre_scene_template_cache_add_scene(asyncSceneLoad.scenePath, &asyncSceneLoad.loadedTemplate));
+    }
+    if (asyncSceneLoad.state != AsyncSceneLoadState_INSTANTIATING) {
+        return;
+    }
+
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene(asyncSceneLoad.cacheId);
+    const uint64 budgetTicks = (uint64)((f64)asyncSceneLoad.frameBudgetMilliseconds * (f64)SDL_GetPerformanceFrequency() / 1000.0);
+    const uint64 startTicks = SDL_GetPerformanceCounter();
+    // Always create at least one node so a tiny budget still makes progress
+    do {
+        scene_manager_create_async_scene_node(sceneTemplate, asyncSceneLoad.nodesCreated++);
+    } while (asyncSceneLoad.nodesCreated < asyncSceneLoad.nodeCount && SDL_GetPerformanceCounter() - startTicks < budgetTicks);
+
+    if (asyncSceneLoad.nodesCreated == asyncSceneLoad.nodeCount) {
+        scene_manager_finish_async_scene_load();
+    }
+}
+
+bool cre_scene_manager_is_async_scene_loading() {
+    return asyncSceneLoad.state != AsyncSceneLoadState_NONE;
+}
+
+f32 cre_scene_manager_get_async_scene_load_progress() {
+    switch (asyncSceneLoad.state) {
+        case AsyncSceneLoadState_READING:
+            return 0.0f;
+        case AsyncSceneLoadState_INSTANTIATING:
+            return (f32)asyncSceneLoad.nodesCreated / (f32)asyncSceneLoad.nodeCount;
+        case AsyncSceneLoadState_NONE:
+        default:
+            return 1.0f;
+    }
+}
+
+void cre_scene_manager_set_async_scene_load_frame_budget(f32 frameBudgetMilliseconds) {
+    asyncSceneLoad.frameBudgetMilliseconds = frameBudgetMilliseconds;
+}
+
+void cre_scene_manager_set_async_scene_loaded_callback(CreOnAsyncSceneLoadedFunc onLoadedFunc) {
+    asyncSceneLoad.onLoadedFunc = onLoadedFunc;
+}
@@ -7,7 +7,10 @@ extern "C" {
 #include <seika/math/math.h>
 
 #include "scene_tree.h"
+#include "node_name_table.h"
 #include "../ecs/components/transform2d_component.h"
+#include "../ecs/components/node_component.h"
+#include "scene_template_cache.h"
 #include "../json/json_file_loader.h"
 
 // Scene Tree
@@ -43,6 +46,12 @@ void cre_scene_manager_queue_node_for_creation(SceneTreeNode* treeNode);
 // Will stage a node to be added as a child at a later time (e.g. creating a new node instance)
 void cre_scene_manager_stage_child_node_to_be_added_later(SceneTreeNode* treeNode);
 SceneTreeNode* cre_scene_manager_stage_scene_nodes_from_json(JsonSceneNode* jsonSceneNode);
+// Same as above from a cached scene template (compiled or json)
+SceneTreeNode* cre_scene_manager_stage_scene_nodes_from_template(const CreSceneTemplate* sceneTemplate);
+// Stages 'count' instances of a scene template at once, the template is only set up for the first instance and the rest
+// copy its components while sharing its assets and shader instances.  If 'transforms' isn't NULL it's expected to have
+// 'count' transforms which are set on each root.  Writes the staged roots to 'outRootNodes' and returns the instance count
+size_t cre_scene_manager_instantiate_many(const CreSceneTemplate* sceneTemplate, size_t count, const SkaTransform2D* transforms, SceneTreeNode** outRootNodes);
 void cre_scene_manager_process_queued_creation_entities();
 void cre_scene_manager_queue_entity_for_deletion(SkaEntity entity);
 void cre_queue_destroy_tree_node_entity_all(SceneTreeNode* treeNode);
@@ -50,23 +59,94 @@ void cre_scene_manager_process_queued_deletion_entities();
 void cre_scene_manager_queue_scene_change(const char* scenePath);
 void cre_scene_manager_process_queued_scene_change();
 
+// Async scene change
+// The scene is read and parsed on a loader thread (textures, fonts and audio are loaded up front from the project config),
+// then its nodes are created on the main thread within a per frame time budget.  The current scene keeps running (e.g.
+// as a loading screen) until every node is created, then it's swapped out for the new scene all at once
+#define CRE_SCENE_MANAGER_DEFAULT_ASYNC_LOAD_FRAME_BUDGET_MS 2.0f
+
+typedef void (*CreOnAsyncSceneLoadedFunc) (const char* scenePath);
+
+// Returns false if a scene change is already in progress
+bool cre_scene_manager_change_scene_async(const char* scenePath);
+// Called once per frame
+void cre_scene_manager_process_async_scene_load();
+bool cre_scene_manager_is_async_scene_loading();
+// Ranges from 0.0 to 1.0, 1.0 if nothing is loading
+f32 cre_scene_manager_get_async_scene_load_progress();
+void cre_scene_manager_set_async_scene_load_frame_budget(f32 frameBudgetMilliseconds);
+void cre_scene_manager_set_async_scene_loaded_callback(CreOnAsyncSceneLoadedFunc onLoadedFunc);
+
 // Scene Tree related stuff, may separate into separate functionality later.
 void cre_scene_manager_set_active_scene_root(SceneTreeNode* root);
 SceneTreeNode* cre_scene_manager_get_active_scene_root();
+// Returns the cached global transform, recalculating it (and any dirty ancestors) first if it's dirty
 SkaTransformModel2D* cre_scene_manager_get_scene_node_global_transform(SkaEntity entity, Transform2DComponent* transform2DComponent);
+// Marks the global transforms of the entity and all of its children dirty, call after changing a local transform
+void cre_scene_manager_invalidate_global_transform(SkaEntity entity, Transform2DComponent* transform2DComponent);
+// Recalculates all dirty global transforms in a single top down pass over the invalidated subtrees, called once per frame before rendering
+void cre_scene_manager_update_global_transforms();
 SceneNodeRenderResource cre_scene_manager_get_scene_node_global_render_resource(SkaEntity entity, Transform2DComponent* transform2DComponent, const SkaVector2* origin);
 f32 cre_scene_manager_get_node_full_time_dilation(SkaEntity entity);
+// Name lookups are a hash lookup on the parent entity and interned name (see 'node_name_table.h')
 SkaEntity cre_scene_manager_get_entity_child_by_name(SkaEntity parent, const char* childName);
+SkaEntity cre_scene_manager_get_entity_child_by_name_id(SkaEntity parent, CreNodeNameId childNameId);
+// Resolves a '/' separated path (e.g. "A/B/C") relative to the entity, '..' is the parent and paths starting with '/' begin at the scene root's name
+SkaEntity cre_scene_manager_get_entity_by_path(SkaEntity entity, const char* path);
+// Returns the first node entity from 'startEntity' up that hasn't been deleted, 'SKA_NULL_ENTITY' once there are none left.
+// Only pages with live nodes are visited so walking every node doesn't scale with 'SKA_MAX_ENTITIES'.
+SkaEntity cre_scene_manager_find_next_node_entity(SkaEntity startEntity);
+
+// Groups
+// Nodes join the groups listed in their scene's 'tags' when created and leave all of them when deleted
+#define CRE_SCENE_MANAGER_MAX_GROUPS_PER_NODE 8
+
+// Returns false if the entity is already in the group (or in the max number of groups)
+bool cre_scene_manager_add_entity_to_group(SkaEntity entity, const char* group);
+bool cre_scene_manager_remove_entity_from_group(SkaEntity entity, const char* group);
+bool cre_scene_manager_is_entity_in_group(SkaEntity entity, const char* group);
+// Returns the group's dense entity list (NULL if empty), only valid until an entity joins or leaves the group
+const SkaEntity* cre_scene_manager_get_group_entities(const char* group, size_t* outCount);
 SceneTreeNode* cre_scene_manager_get_entity_tree_node(SkaEntity entity);
 bool cre_scene_manager_has_entity_tree_node(SkaEntity entity);
+// Adds a staged node (or an idle pooled instance) as a child
 void cre_scene_manager_add_node_as_child(SkaEntity parentEntity, SkaEntity childEntity);
+
+// Node pools
+// Detaches an instance from its parent and marks its subtree pooled until it's added as a child again (see 'node_pool.h')
+void cre_scene_manager_detach_pooled_node(SkaEntity entity);
+// Pooled entities are idle, systems skip them
+bool cre_scene_manager_is_entity_pooled(SkaEntity entity);
+
+// Process modes
+// Each node's mode is resolved from the tree into per entity bits when it changes, update systems only test the bits against
+// the paused state.  Disabled nodes are also reported through the callback so their scripts leave the update lists.
+typedef void (*CreOnNodeProcessDisabledChangedFunc) (SkaEntity entity, bool isDisabled);
+
+void cre_scene_manager_set_node_process_mode(SkaEntity entity, NodeProcessMode processMode);
+// Returns the mode resolved from the tree, never 'NodeProcessMode_INHERIT'
+NodeProcessMode cre_scene_manager_get_entity_process_mode(SkaEntity entity);
+void cre_scene_manager_set_paused(bool paused);
+bool cre_scene_manager_is_paused();
+// False if the entity is pooled, disabled, suspended off screen or pausable while the tree is paused
+bool cre_scene_manager_can_entity_process(SkaEntity entity);
+void cre_scene_manager_set_process_disabled_changed_callback(CreOnNodeProcessDisabledChangedFunc onDisabledChangedFunc);
+// Suspends the node and its children like a disabled process mode while its visibility notifier is off screen, children
+// added to a suspended node are suspended too
+void cre_scene_manager_set_node_off_screen_suspended(SkaEntity entity, bool suspended);
+bool cre_scene_manager_is_entity_off_screen_suspended(SkaEntity entity);
+
 EntityArray cre_scene_manager_get_self_and_parent_nodes(SkaEntity entity);
 void cre_scene_manager_invalidate_time_dilation_nodes_with_children(SkaEntity entity);
 
-// Helper function to call notify on entity and children node 'on transform changed' events.  Uses recursion.
-void cre_scene_manager_notify_all_on_transform_events(SkaEntity entity, Transform2DComponent* transformComp);
+// Transform changed events are deferred, writes only queue the entity and each flush notifies every queued entity and its
+// children once (parents first), no matter how many times they were written.  Flushed before collisions and rendering.
+void cre_scene_manager_queue_transform_changed_event(SkaEntity entity);
+void cre_scene_manager_flush_transform_changed_events();
 
 typedef void (*ExecuteOnAllTreeNodesFunc) (SceneTreeNode*);
+// Executes function on all child tree nodes (depth first) followed by the passed in tree node
+void cre_scene_execute_on_all_tree_nodes(SceneTreeNode* treeNode, ExecuteOnAllTreeNodesFunc func);
 void cre_scene_manager_execute_on_root_and_child_nodes(ExecuteOnAllTreeNodesFunc func);
 
 #ifdef __cplusplus
@@ -4,60 +4,312 @@
 
 #include <seika/string.h>
 #include <seika/memory.h>
-#include <seika/asset/asset_file_loader.h>
+#include <seika/assert.h>
+#include <seika/logger.h>
 #include <seika/data_structures/hash_map_string.h>
 
+#include "compiled_scene.h"
 #include "../json/json_file_loader.h"
+#include "../tilemap/tilemap.h"
+#include "../ecs/ecs_globals.h"
+#include "../ecs/components/transform2d_component.h"
+#include "../ecs/components/sprite_component.h"
+#include "../ecs/components/animated_sprite_component.h"
+#include "../ecs/components/text_label_component.h"
+#include "../ecs/components/script_component.h"
+#include "../ecs/components/collider2d_component.h"
+#include "../ecs/components/color_rect_component.h"
+#include "../ecs/components/parallax_component.h"
+#include "../ecs/components/particles2d_component.h"
+#include "../ecs/components/tilemap_component.h"
+#include "../ecs/components/visibility_notifier2d_component.h"
 
 typedef struct SECachedSceneTemplate {
-    char* path;
-    JsonSceneNode* rootNode;
+    char* path; // Interned, also the key in 'cacheIdsByPath'
+    CreSceneTemplate sceneTemplate;
+    size_t memorySize;
+    bool isResident;
+    uint32 pinCount; // Pinned templates aren't evicted
+    // Least recently used list of resident templates
+    CreSceneCacheId prev;
+    CreSceneCacheId next;
 } SECachedSceneTemplate;
 
 static SECachedSceneTemplate cachedSceneTemplates[CRE_SCENE_CACHE_MAX_ITEMS];
-CreSceneCacheId numberOfCachedSceneTemplates = 0;
+static CreSceneCacheId numberOfCachedSceneTemplates = 0;
+static SkaStringHashMap* cacheIdsByPath = NULL;
+// Head is the most recently used
+static CreSceneCacheId lruHead = CRE_SCENE_CACHE_INVALID_ID;
+static CreSceneCacheId lruTail = CRE_SCENE_CACHE_INVALID_ID;
+static CreSceneCacheStats cacheStats = { .memoryBudget = CRE_SCENE_CACHE_DEFAULT_MEMORY_BUDGET };
 
-CreSceneCacheId scene_template_get_cache_id(const char* scenePath);
+static void scene_template_lru_unlink(CreSceneCacheId cacheId) {
+    SECachedSceneTemplate* cachedTemplate = &cachedSceneTemplates[cacheId];
+    if (cachedTemplate->prev != CRE_SCENE_CACHE_INVALID_ID) {
+        cachedSceneTemplates[cachedTemplate->prev].next = cachedTemplate->next;
+    } else {
+        lruHead = cachedTemplate->next;
+    }
+    if (cachedTemplate->next != CRE_SCENE_CACHE_INVALID_ID) {
+        cachedSceneTemplates[cachedTemplate->next].prev = cachedTemplate->prev;
+    } else {
+        lruTail = cachedTemplate->prev;
+    }
+    cachedTemplate->prev = CRE_SCENE_CACHE_INVALID_ID;
+    cachedTemplate->next = CRE_SCENE_CACHE_INVALID_ID;
+}
 
-void cre_scene_template_cache_initialize() {}
+static void scene_template_lru_push_front(CreSceneCacheId cacheId) {
+    SECachedSceneTemplate* cachedTemplate = &cachedSceneTemplates[cacheId];
+    cachedTemplate->prev = CRE_SCENE_CACHE_INVALID_ID;
+    cachedTemplate->next = lruHead;
+    if (lruHead != CRE_SCENE_CACHE_INVALID_ID) {
+        cachedSceneTemplates[lruHead].prev = cacheId;
+    }
+    lruHead = cacheId;
+    if (lruTail == CRE_SCENE_CACHE_INVALID_ID) {
+        lruTail = cacheId;
+    }
+}
 
-void cre_scene_template_cache_finalize() {
-    for (CreSceneCacheId cacheId = 0; cacheId < numberOfCachedSceneTemplates; cacheId++) {
-        if (cachedSceneTemplates[cacheId].path) {
-            SKA_FREE(cachedSceneTemplates[cacheId].path);
+// Rough heap size of a parsed json scene, only used to weigh templates against the memory budget
+static size_t scene_template_get_json_node_memory_size(const JsonSceneNode* node) {
+    size_t memorySize = sizeof(JsonSceneNode);
+    if (node->components[TRANSFORM2D_COMPONENT_INDEX]) { memorySize += sizeof(Transform2DComponent); }
+    if (node->components[SPRITE_COMPONENT_INDEX]) { memorySize += sizeof(SpriteComponent); }
+    if (node->components[ANIMATED_SPRITE_COMPONENT_INDEX]) { memorySize += sizeof(AnimatedSpriteComponentData); }
+    if (node->components[TEXT_LABEL_COMPONENT_INDEX]) { memorySize += sizeof(TextLabelComponent); }
+    if (node->components[SCRIPT_COMPONENT_INDEX]) { memorySize += sizeof(ScriptComponent); }
+    if (node->components[COLLIDER2D_COMPONENT_INDEX]) { memorySize += sizeof(Collider2DComponent); }
+    if (node->components[COLOR_RECT_COMPONENT_INDEX]) { memorySize += sizeof(ColorRectComponent); }
+    if (node->components[PARALLAX_COMPONENT_INDEX]) { memorySize += sizeof(ParallaxComponent); }
+    if (node->components[PARTICLES2D_COMPONENT_INDEX]) { memorySize += sizeof(Particles2DComponent); }
+    if (node->components[VISIBILITY_NOTIFIER2D_COMPONENT_INDEX]) { memorySize += sizeof(VisibilityNotifier2DComponent); }
+    if (node->components[TILEMAP_COMPONENT_INDEX]) {
+        const TilemapComponent* tilemapComponent = (TilemapComponent*)node->components[TILEMAP_COMPONENT_INDEX];
+        memorySize += sizeof(TilemapComponent) + sizeof(CreTilemap);
+        if (tilemapComponent->tilemap->tilesArray) {
+            memorySize += (size_t)tilemapComponent->tilemap->tilesArray->size.w * (size_t)tilemapComponent->tilemap->tilesArray->size.h * sizeof(CreTileData);
         }
-        if (cachedSceneTemplates[cacheId].rootNode) {
-            cre_json_delete_json_scene_node(cachedSceneTemplates[cacheId].rootNode);
+    }
+    for (size_t i = 0; i < node->childrenCount; i++) {
+        memorySize += scene_template_get_json_node_memory_size(node->children[i]);
+    }
+    return memorySize;
+}
+
+static void scene_template_unload(CreSceneCacheId cacheId) {
+    SECachedSceneTemplate* cachedTemplate = &cachedSceneTemplates[cacheId];
+    if (!cachedTemplate->isResident) {
+        return;
+    }
+    if (cachedTemplate->sceneTemplate.compiledScene) {
+        cre_compiled_scene_close(cachedTemplate->sceneTemplate.compiledScene);
+    }
+    if (cachedTemplate->sceneTemplate.rootNode) {
+        cre_json_delete_json_scene_node(cachedTemplate->sceneTemplate.rootNode);
+    }
+    scene_template_lru_unlink(cacheId);
+    cachedTemplate->sceneTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+    cacheStats.memoryUsed -= cachedTemplate->memorySize;
+    cacheStats.residentCount--;
+    cachedTemplate->memorySize = 0;
+    cachedTemplate->isResident = false;
+}
+
+// Evicts least recently used templates until within budget, 'keepCacheId' is never evicted since it's about to be used
+static void scene_template_evict_to_budget(CreSceneCacheId keepCacheId) {
+    CreSceneCacheId cacheId = lruTail;
+    while (cacheStats.memoryUsed > cacheStats.memoryBudget && cacheId != CRE_SCENE_CACHE_INVALID_ID) {
+        const CreSceneCacheId prevCacheId = cachedSceneTemplates[cacheId].prev;
+        if (cacheId != keepCacheId && cachedSceneTemplates[cacheId].pinCount == 0) {
+            ska_logger_debug("Evicting scene template '%s' from the scene cache", cachedSceneTemplates[cacheId].path);
+            scene_template_unload(cacheId);
+            cacheStats.evictions++;
         }
+        cacheId = prevCacheId;
     }
+}
+
+bool cre_scene_template_cache_read_scene_template(const char* scenePath, CreSceneTemplate* outSceneTemplate) {
+    *outSceneTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+    CreCompiledScene* compiledScene = cre_compiled_scene_open_for_scene(scenePath);
+    if (compiledScene) {
+        outSceneTemplate->compiledScene = compiledScene;
+        return true;
+    }
+    outSceneTemplate->rootNode = cre_json_load_scene_file(scenePath);
+    return outSceneTemplate->rootNode != NULL;
+}
+
+// Makes the read template resident and most recently used
+static void scene_template_install(CreSceneCacheId cacheId, const CreSceneTemplate* sceneTemplate) {
+    SECachedSceneTemplate* cachedTemplate = &cachedSceneTemplates[cacheId];
+    SKA_ASSERT(!cachedTemplate->isResident);
+    cachedTemplate->sceneTemplate = *sceneTemplate;
+    cachedTemplate->memorySize = sceneTemplate->compiledScene ? sceneTemplate->compiledScene->dataSize : scene_template_get_json_node_memory_size(sceneTemplate->rootNode);
+    cachedTemplate->isResident = true;
+    scene_template_lru_push_front(cacheId);
+    cacheStats.memoryUsed += cachedTemplate->memorySize;
+    cacheStats.residentCount++;
+    scene_template_evict_to_budget(cacheId);
+}
+
+// Loads the template from disk (or the project archive)
+static bool scene_template_load(CreSceneCacheId cacheId) {
+    CreSceneTemplate sceneTemplate;
+    if (!cre_scene_template_cache_read_scene_template(cachedSceneTemplates[cacheId].path, &sceneTemplate)) {
+        return false;
+    }
+    scene_template_install(cacheId, &sceneTemplate);
+    return true;
+}
+
+// Marks the template as most recently used, loading it if it's not resident
+static bool scene_template_touch(CreSceneCacheId cacheId) {
+    if (cachedSceneTemplates[cacheId].isResident) {
+        cacheStats.hits++;
+        scene_template_lru_unlink(cacheId);
+        scene_template_lru_push_front(cacheId);
+        return true;
+    }
+    cacheStats.misses++;
+    return scene_template_load(cacheId);
+}
+
+void cre_scene_template_cache_initialize() {
+    SKA_ASSERT(cacheIdsByPath == NULL);
+    cacheIdsByPath = ska_string_hash_map_create(CRE_SCENE_CACHE_MAX_ITEMS);
     numberOfCachedSceneTemplates = 0;
+    lruHead = CRE_SCENE_CACHE_INVALID_ID;
+    lruTail = CRE_SCENE_CACHE_INVALID_ID;
+    const size_t memoryBudget = cacheStats.memoryBudget;
+    cacheStats = (CreSceneCacheStats){ .memoryBudget = memoryBudget };
+}
+
+void cre_scene_template_cache_finalize() {
+    for (CreSceneCacheId cacheId = 0; cacheId < numberOfCachedSceneTemplates; cacheId++) {
+        scene_template_unload(cacheId);
+        SKA_FREE(cachedSceneTemplates[cacheId].path);
+        cachedSceneTemplates[cacheId].path = NULL;
+    }
+    numberOfCachedSceneTemplates = 0;
+    ska_string_hash_map_destroy(cacheIdsByPath);
+    cacheIdsByPath = NULL;
+}
+
+static CreSceneCacheId scene_template_find_cache_id(const char* scenePath) {
+    SKA_ASSERT(cacheIdsByPath != NULL);
+    if (ska_string_hash_map_has(cacheIdsByPath, scenePath)) {
+        return *(CreSceneCacheId*)ska_string_hash_map_get(cacheIdsByPath, scenePath);
+    }
+    return CRE_SCENE_CACHE_INVALID_ID;
+}
+
+// Creates a non resident entry, only registered by path once its template is resident
+static CreSceneCacheId scene_template_create_entry(const char* scenePath) {
+    SKA_ASSERT_FMT(numberOfCachedSceneTemplates < CRE_SCENE_CACHE_MAX_ITEMS, "Exceeded max scene cache items '%d' when loading '%s'!", CRE_SCENE_CACHE_MAX_ITEMS, scenePath);
+    const CreSceneCacheId cacheId = numberOfCachedSceneTemplates;
+    cachedSceneTemplates[cacheId] = (SECachedSceneTemplate){
+        .path = ska_strdup(scenePath),
+        .sceneTemplate = { .rootNode = NULL, .compiledScene = NULL },
+        .memorySize = 0,
+        .isResident = false,
+        .pinCount = 0,
+        .prev = CRE_SCENE_CACHE_INVALID_ID,
+        .next = CRE_SCENE_CACHE_INVALID_ID
+    };
+    return cacheId;
+}
+
+static void scene_template_register_entry(CreSceneCacheId cacheId) {
+    SKA_ASSERT(cacheId == numberOfCachedSceneTemplates);
+    numberOfCachedSceneTemplates++;
+    ska_string_hash_map_add(cacheIdsByPath, cachedSceneTemplates[cacheId].path, &cacheId, sizeof(CreSceneCacheId));
 }
 
 CreSceneCacheId cre_scene_template_cache_load_scene(const char* scenePath) {
-    CreSceneCacheId cacheId = CRE_SCENE_CACHE_INVALID_ID;
-    char* sceneText = ska_asset_file_loader_read_file_contents_as_string(scenePath, NULL);
-    if (sceneText) {
-        // Check if we already have the scene cached
-        cacheId = scene_template_get_cache_id(scenePath);
-        if (cacheId == CRE_SCENE_CACHE_INVALID_ID) {
-            // We don't have it cached, so create a new one
-            cacheId = numberOfCachedSceneTemplates++;
-            cachedSceneTemplates[cacheId].path = ska_strdup(scenePath);
-            cachedSceneTemplates[cacheId].rootNode = cre_json_load_scene_file(scenePath);
-        }
+    CreSceneCacheId cacheId = scene_template_find_cache_id(scenePath);
+    if (cacheId != CRE_SCENE_CACHE_INVALID_ID) {
+        return scene_template_touch(cacheId) ? cacheId : CRE_SCENE_CACHE_INVALID_ID;
+    }
+    cacheId = scene_template_create_entry(scenePath);
+    cacheStats.misses++;
+    if (!scene_template_load(cacheId)) {
+        // Don't keep an entry around for paths that failed to load
+        SKA_FREE(cachedSceneTemplates[cacheId].path);
+        cachedSceneTemplates[cacheId].path = NULL;
+        return CRE_SCENE_CACHE_INVALID_ID;
     }
+    scene_template_register_entry(cacheId);
     return cacheId;
 }
 
-JsonSceneNode* cre_scene_template_cache_get_scene(CreSceneCacheId cacheId) {
-    return cachedSceneTemplates[cacheId].rootNode;
+CreSceneCacheId cre_scene_template_cache_find_resident_scene(const char* scenePath) {
+    const CreSceneCacheId cacheId = scene_template_find_cache_id(scenePath);
+    if (cacheId != CRE_SCENE_CACHE_INVALID_ID && cachedSceneTemplates[cacheId].isResident) {
+        return cacheId;
+    }
+    return CRE_SCENE_CACHE_INVALID_ID;
 }
 
-CreSceneCacheId scene_template_get_cache_id(const char* scenePath) {
-    for (CreSceneCacheId cacheId = 0; cacheId < numberOfCachedSceneTemplates; cacheId++) {
-        if (strcmp(cachedSceneTemplates[cacheId].path, scenePath) == 0) {
-            return cacheId;
+CreSceneCacheId cre_scene_template_cache_add_scene(const char* scenePath, CreSceneTemplate* sceneTemplate) {
+    CreSceneCacheId cacheId = scene_template_find_cache_id(scenePath);
+    if (cacheId == CRE_SCENE_CACHE_INVALID_ID) {
+        cacheId = scene_template_create_entry(scenePath);
+        scene_template_register_entry(cacheId);
+    } else if (cachedSceneTemplates[cacheId].isResident) {
+        // Already loaded in the meantime, keep the resident one
+        if (sceneTemplate->compiledScene) {
+            cre_compiled_scene_close(sceneTemplate->compiledScene);
+        }
+        if (sceneTemplate->rootNode) {
+            cre_json_delete_json_scene_node(sceneTemplate->rootNode);
         }
+        *sceneTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+        scene_template_touch(cacheId);
+        return cacheId;
     }
-    return CRE_SCENE_CACHE_INVALID_ID;
+    cacheStats.misses++;
+    scene_template_install(cacheId, sceneTemplate);
+    *sceneTemplate = (CreSceneTemplate){ .rootNode = NULL, .compiledScene = NULL };
+    return cacheId;
+}
+
+void cre_scene_template_cache_pin_scene(CreSceneCacheId cacheId) {
+    SKA_ASSERT_FMT(cacheId >= 0 && cacheId < numberOfCachedSceneTemplates, "Invalid scene cache id '%d'!", cacheId);
+    cachedSceneTemplates[cacheId].pinCount++;
+}
+
+void cre_scene_template_cache_unpin_scene(CreSceneCacheId cacheId) {
+    SKA_ASSERT_FMT(cacheId >= 0 && cacheId < numberOfCachedSceneTemplates, "Invalid scene cache id '%d'!", cacheId);
+    SKA_ASSERT_FMT(cachedSceneTemplates[cacheId].pinCount > 0, "Scene cache id '%d' isn't pinned!", cacheId);
+    cachedSceneTemplates[cacheId].pinCount--;
+    scene_template_evict_to_budget(CRE_SCENE_CACHE_INVALID_ID);
+}
+
+const CreSceneTemplate* cre_scene_template_cache_get_scene(CreSceneCacheId cacheId) {
+    SKA_ASSERT_FMT(cacheId >= 0 && cacheId < numberOfCachedSceneTemplates, "Invalid scene cache id '%d'!", cacheId);
+    if (!scene_template_touch(cacheId)) {
+        ska_logger_error("Failed to reload evicted scene template '%s'!", cachedSceneTemplates[cacheId].path);
+        return NULL;
+    }
+    return &cachedSceneTemplates[cacheId].sceneTemplate;
+}
+
+const CreSceneTemplate* cre_scene_template_cache_get_scene_by_path(const char* scenePath) {
+    const CreSceneCacheId cacheId = cre_scene_template_cache_load_scene(scenePath);
+    if (cacheId == CRE_SCENE_CACHE_INVALID_ID) {
+        return NULL;
+    }
+    return &cachedSceneTemplates[cacheId].sceneTemplate;
+}
+
+void cre_scene_template_cache_set_memory_budget(size_t memoryBudget) {
+    cacheStats.memoryBudget = memoryBudget;
+    scene_template_evict_to_budget(CRE_SCENE_CACHE_INVALID_ID);
+}
+
+CreSceneCacheStats cre_scene_template_cache_get_stats() {
+    return cacheStats;
 }
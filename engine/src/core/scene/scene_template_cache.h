@@ -1,13 +1,50 @@
 #pragma once
 
-#define CRE_SCENE_CACHE_MAX_ITEMS 100
-#define CRE_SCENE_CACHE_INVALID_ID (-1)
+#include <stddef.h>
+#include <stdbool.h>
 
 #include <seika/defines.h>
 
+// Keeps loaded scene templates (compiled scenes when available, parsed json otherwise) keyed by their interned path so
+// instancing or changing to an already visited scene costs no I/O or parsing.  Templates are evicted least recently
+// used first once the memory budget is exceeded, cache ids stay valid and reload the template on their next use.
+
+#define CRE_SCENE_CACHE_MAX_ITEMS 256
+#define CRE_SCENE_CACHE_INVALID_ID (-1)
+#define CRE_SCENE_CACHE_DEFAULT_MEMORY_BUDGET (32 * 1024 * 1024)
+
 typedef int32 CreSceneCacheId;
 
+typedef struct CreSceneTemplate {
+    struct JsonSceneNode* rootNode; // NULL if loaded from a compiled scene
+    struct CreCompiledScene* compiledScene; // NULL if loaded from json
+} CreSceneTemplate;
+
+typedef struct CreSceneCacheStats {
+    uint32 hits;
+    uint32 misses;
+    uint32 evictions;
+    uint32 residentCount;
+    size_t memoryUsed;
+    size_t memoryBudget;
+} CreSceneCacheStats;
+
 void cre_scene_template_cache_initialize();
 void cre_scene_template_cache_finalize();
+// Returns the cache id for the scene, loading its template if it isn't resident.  Returns 'CRE_SCENE_CACHE_INVALID_ID' if it can't be loaded
 CreSceneCacheId cre_scene_template_cache_load_scene(const char* scenePath);
-struct JsonSceneNode* cre_scene_template_cache_get_scene(CreSceneCacheId cacheId);
+// Returns the template for the cache id (reloading it if evicted), only valid until the next cache call
+const CreSceneTemplate* cre_scene_template_cache_get_scene(CreSceneCacheId cacheId);
+// Same as loading then getting the scene, but only counts as a single cache lookup.  Returns NULL if it can't be loaded
+const CreSceneTemplate* cre_scene_template_cache_get_scene_by_path(const char* scenePath);
+// Returns the cache id if the scene's template is resident, doesn't load or count as a lookup
+CreSceneCacheId cre_scene_template_cache_find_resident_scene(const char* scenePath);
+// Reads a template from disk without touching the cache, safe to call from a loader thread
+bool cre_scene_template_cache_read_scene_template(const char* scenePath, CreSceneTemplate* outSceneTemplate);
+// Takes ownership of a template read with the function above (the passed in template is cleared) and returns its cache id
+CreSceneCacheId cre_scene_template_cache_add_scene(const char* scenePath, CreSceneTemplate* sceneTemplate);
+// Pinned templates are never evicted, used while a template is instanced over multiple frames
+void cre_scene_template_cache_pin_scene(CreSceneCacheId cacheId);
+void cre_scene_template_cache_unpin_scene(CreSceneCacheId cacheId);
+void cre_scene_template_cache_set_memory_budget(size_t memoryBudget);
+CreSceneCacheStats cre_scene_template_cache_get_stats();
@@ -0,0 +1,92 @@
+#include "scene_tree.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+
+typedef struct SceneTreeNodePool {
+    SceneTreeNode** chunks;
+    size_t chunkCount;
+    size_t chunkCapacity;
+    SceneTreeNode* freeNodes; // Linked through 'nextSibling'
+    size_t activeCount;
+} SceneTreeNodePool;
+
+static SceneTreeNodePool nodePool = {0};
+
+static void node_pool_add_chunk() {
+    if (nodePool.chunkCount >= nodePool.chunkCapacity) {
+        nodePool.chunkCapacity = nodePool.chunkCapacity > 0 ? nodePool.chunkCapacity * 2 : 8;
+        nodePool.chunks = (SceneTreeNode**)realloc(nodePool.chunks, sizeof(SceneTreeNode*) * nodePool.chunkCapacity);
+        SKA_ASSERT(nodePool.chunks);
+    }
+    SceneTreeNode* chunk = (SceneTreeNode*)malloc(sizeof(SceneTreeNode) * CRE_SCENE_TREE_NODE_POOL_CHUNK_SIZE);
+    SKA_ASSERT_FMT(chunk, "Failed to allocate scene tree node chunk!");
+    nodePool.chunks[nodePool.chunkCount++] = chunk;
+    // Push in reverse so nodes are handed out in memory order
+    for (size_t i = CRE_SCENE_TREE_NODE_POOL_CHUNK_SIZE; i > 0; i--) {
+        chunk[i - 1].nextSibling = nodePool.freeNodes;
+        nodePool.freeNodes = &chunk[i - 1];
+    }
+}
+
+SceneTreeNode* cre_scene_tree_node_pool_allocate() {
+    if (nodePool.freeNodes == NULL) {
+        node_pool_add_chunk();
+    }
+    SceneTreeNode* node = nodePool.freeNodes;
+    nodePool.freeNodes = node->nextSibling;
+    memset(node, 0, sizeof(SceneTreeNode));
+    nodePool.activeCount++;
+    return node;
+}
+
+void cre_scene_tree_node_pool_free(SceneTreeNode* node) {
+    SKA_ASSERT(nodePool.activeCount > 0);
+    node->nextSibling = nodePool.freeNodes;
+    nodePool.freeNodes = node;
+    nodePool.activeCount--;
+}
+
+void cre_scene_tree_node_pool_finalize() {
+    for (size_t i = 0; i < nodePool.chunkCount; i++) {
+        free(nodePool.chunks[i]);
+    }
+    free(nodePool.chunks);
+    nodePool = (SceneTreeNodePool){0};
+}
+
+size_t cre_scene_tree_node_pool_get_active_count() {
+    return nodePool.activeCount;
+}
+
+void cre_scene_tree_node_add_child(SceneTreeNode* parent, SceneTreeNode* child) {
+    child->parent = parent;
+    child->prevSibling = parent->lastChild;
+    child->nextSibling = NULL;
+    if (parent->lastChild != NULL) {
+        parent->lastChild->nextSibling = child;
+    } else {
+        parent->firstChild = child;
+    }
+    parent->lastChild = child;
+    parent->childCount++;
+}
+
+void cre_scene_tree_node_remove_child(SceneTreeNode* parent, SceneTreeNode* child) {
+    SKA_ASSERT_FMT(child->parent == parent, "Entity '%u' isn't a child of entity '%u'!", child->entity, parent->entity);
+    if (child->prevSibling != NULL) {
+        child->prevSibling->nextSibling = child->nextSibling;
+    } else {
+        parent->firstChild = child->nextSibling;
+    }
+    if (child->nextSibling != NULL) {
+        child->nextSibling->prevSibling = child->prevSibling;
+    } else {
+        parent->lastChild = child->prevSibling;
+    }
+    child->prevSibling = NULL;
+    child->nextSibling = NULL;
+    parent->childCount--;
+}
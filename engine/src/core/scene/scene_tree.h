@@ -8,16 +8,33 @@ extern "C" {
 
 #include <seika/ecs/entity.h>
 
-#define SCENE_TREE_NODE_MAX_CHILDREN (SKA_MAX_ENTITIES - 1)
-
-// Maintains parent child relationship between nodes
+// Maintains parent child relationship between nodes.
+// Children are an intrusive doubly linked list (first child/next sibling) so nodes are small and fan-out isn't capped.
 typedef struct SceneTreeNode {
     SkaEntity entity;
     struct SceneTreeNode* parent;
-    struct SceneTreeNode* children[SCENE_TREE_NODE_MAX_CHILDREN];
+    struct SceneTreeNode* firstChild;
+    struct SceneTreeNode* lastChild;
+    struct SceneTreeNode* prevSibling;
+    struct SceneTreeNode* nextSibling;
     size_t childCount;
 } SceneTreeNode;
 
+// Node Pool
+// Nodes are allocated from contiguous chunks and returned to a free list when deleted
+#define CRE_SCENE_TREE_NODE_POOL_CHUNK_SIZE 1024
+
+SceneTreeNode* cre_scene_tree_node_pool_allocate();
+void cre_scene_tree_node_pool_free(SceneTreeNode* node);
+// Frees all chunks, every node allocated from the pool is invalid afterwards
+void cre_scene_tree_node_pool_finalize();
+size_t cre_scene_tree_node_pool_get_active_count();
+
+// Children
+// Appends 'child' to the end of the parent's children and sets its parent
+void cre_scene_tree_node_add_child(SceneTreeNode* parent, SceneTreeNode* child);
+void cre_scene_tree_node_remove_child(SceneTreeNode* parent, SceneTreeNode* child);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,20 +2,29 @@
 
 #include <seika/ecs/ecs.h>
 
-#include "scene_tree.h"
+#include "scene_manager.h"
 #include "../ecs/ecs_globals.h"
-#include "../ecs/component.h"
+#include "../ecs/components/transform2d_component.h"
 #include "../camera/camera.h"
 #include "../camera/camera_manager.h"
 
-SkaTransform2D default_get_local_transform(SkaEntity entity, int32* zIndex, bool* success);
+static SkaEntity default_get_parent_entity(SkaEntity entity);
+static SkaTransform2D default_get_local_transform(SkaEntity entity, int32* zIndex, bool* success);
 
-on_get_self_and_parent_entities onGetSelfAndParentEntitiesFunc = &cre_scene_manager_get_self_and_parent_nodes;
-on_get_local_transform onGetLocalTransformFunc = &default_get_local_transform;
+static on_get_parent_entity onGetParentEntityFunc = &default_get_parent_entity;
+static on_get_local_transform onGetLocalTransformFunc = &default_get_local_transform;
 
 // Default engine callbacks
+SkaEntity default_get_parent_entity(SkaEntity entity) {
+    if (!cre_scene_manager_has_entity_tree_node(entity)) {
+        return SKA_NULL_ENTITY;
+    }
+    const SceneTreeNode* treeNode = cre_scene_manager_get_entity_tree_node(entity);
+    return treeNode->parent != NULL ? treeNode->parent->entity : SKA_NULL_ENTITY;
+}
+
 SkaTransform2D default_get_local_transform(SkaEntity entity, int32* zIndex, bool* success) {
-    Transform2DComponent* transform2DComponent = ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
+    Transform2DComponent* transform2DComponent = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
     if (transform2DComponent == NULL) {
         *success = false;
         return SKA_TRANSFORM_IDENTITY;
@@ -25,39 +34,50 @@ SkaTransform2D default_get_local_transform(SkaEntity entity, int32* zIndex, bool
     return transform2DComponent->localTransform;
 }
 
-void cre_scene_utils_update_global_transform_model(SkaEntity entity, SkaTransformModel2D* globalTransform) {
+void cre_scene_utils_compose_global_transform(SkaTransformModel2D* globalTransform, const SkaTransformModel2D* parentGlobalTransform, const SkaTransform2D* localTransform, int32 localZIndex) {
+    // Local position is scaled then rotated by the parent before being offset by the parent's position
+    const f32 parentRadians = glm_rad(parentGlobalTransform->rotation);
+    const f32 parentCos = cosf(parentRadians);
+    const f32 parentSin = sinf(parentRadians);
+    const f32 scaledX = localTransform->position.x * parentGlobalTransform->scale.x;
+    const f32 scaledY = localTransform->position.y * parentGlobalTransform->scale.y;
+    globalTransform->position.x = parentGlobalTransform->position.x + scaledX * parentCos - scaledY * parentSin;
+    globalTransform->position.y = parentGlobalTransform->position.y + scaledX * parentSin + scaledY * parentCos;
+    globalTransform->rotation = parentGlobalTransform->rotation + localTransform->rotation;
+    globalTransform->scale.x = parentGlobalTransform->scale.x * localTransform->scale.x;
+    globalTransform->scale.y = parentGlobalTransform->scale.y * localTransform->scale.y;
+    globalTransform->scaleSign = ska_math_signvec2(&globalTransform->scale);
+    globalTransform->zIndex = parentGlobalTransform->zIndex + localZIndex;
+
+    // Rebuild trs model matrix (column major)
+    const f32 radians = glm_rad(globalTransform->rotation);
+    const f32 cosRotation = cosf(radians);
+    const f32 sinRotation = sinf(radians);
     glm_mat4_identity(globalTransform->model);
-    EntityArray combineModelResult = onGetSelfAndParentEntitiesFunc(entity);
-    SkaVector2 scaleTotal = SKA_VECTOR2_ONE;
-    globalTransform->zIndex = 0;
-    for (int32 i = combineModelResult.entityCount - 1; i >= 0; i--) {
-        SkaEntity currentEntity = combineModelResult.entities[i];
-        bool hasLocalTransform = false;
-        int localZIndex = 0;
-        const SkaTransform2D localTransform = onGetLocalTransformFunc(currentEntity, &localZIndex, &hasLocalTransform);
-        if (!hasLocalTransform) {
-            continue;
-        }
-        globalTransform->zIndex += localZIndex;
-        scaleTotal.x *= localTransform.scale.x;
-        scaleTotal.y *= localTransform.scale.y;
-        mat4 newModel;
-        transform2d_component_get_local_model_matrix(newModel, &localTransform);
-        glm_mat4_mul(globalTransform->model, newModel, globalTransform->model);
+    globalTransform->model[0][0] = cosRotation * globalTransform->scale.x;
+    globalTransform->model[0][1] = sinRotation * globalTransform->scale.x;
+    globalTransform->model[1][0] = -sinRotation * globalTransform->scale.y;
+    globalTransform->model[1][1] = cosRotation * globalTransform->scale.y;
+    globalTransform->model[3][0] = globalTransform->position.x;
+    globalTransform->model[3][1] = globalTransform->position.y;
+}
+
+void cre_scene_utils_update_global_transform_model(SkaEntity entity, SkaTransformModel2D* globalTransform) {
+    // Parents are composed first (recursing up to the root), nodes without a local transform pass their parent's through
+    const SkaEntity parentEntity = onGetParentEntityFunc(entity);
+    SkaTransformModel2D parentGlobalTransform = { .position = SKA_VECTOR2_ZERO, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f, .zIndex = 0, .scaleSign = SKA_VECTOR2_ONE };
+    glm_mat4_identity(parentGlobalTransform.model);
+    if (parentEntity != SKA_NULL_ENTITY) {
+        cre_scene_utils_update_global_transform_model(parentEntity, &parentGlobalTransform);
+    }
+    bool hasLocalTransform = false;
+    int32 localZIndex = 0;
+    const SkaTransform2D localTransform = onGetLocalTransformFunc(entity, &localZIndex, &hasLocalTransform);
+    if (hasLocalTransform) {
+        cre_scene_utils_compose_global_transform(globalTransform, &parentGlobalTransform, &localTransform, localZIndex);
+    } else {
+        *globalTransform = parentGlobalTransform;
     }
-    globalTransform->scaleSign = ska_math_signvec2(&scaleTotal);
-    // Decompose trs matrix
-    vec4 translation;
-    mat4 rotation;
-    vec3 scale;
-    glm_decompose(globalTransform->model, translation, rotation, scale);
-    // Update global transform
-    globalTransform->position.x = translation[0];
-    globalTransform->position.y = translation[1];
-    // Scale sign is used to fix sign of scale not being properly decomposed in trs matrix
-    globalTransform->scale.x = fabsf(scale[0]) * globalTransform->scaleSign.x;
-    globalTransform->scale.y = fabsf(scale[1]) * globalTransform->scaleSign.y;
-    globalTransform->rotation = transform2d_component_get_rotation_deg_from_model(rotation);
 }
 
 void cre_scene_utils_apply_camera_and_origin_translation(SkaTransformModel2D* globalTransform, const SkaVector2* origin, bool ignoreCamera) {
@@ -69,19 +89,15 @@ void cre_scene_utils_apply_camera_and_origin_translation(SkaTransformModel2D* gl
     });
 }
 
-void cre_scene_utils_override_on_get_self_and_parent_entities_func(on_get_self_and_parent_entities func) {
-    onGetSelfAndParentEntitiesFunc = func;
+void cre_scene_utils_override_on_get_parent_entity_func(on_get_parent_entity func) {
+    onGetParentEntityFunc = func;
 }
 
 void cre_scene_utils_override_on_get_local_transform_func(on_get_local_transform func) {
     onGetLocalTransformFunc = func;
 }
 
-EntityArray cre_scene_utils_get_self_and_parent_entities(SkaEntity entity) {
-    return onGetSelfAndParentEntitiesFunc(entity);
-}
-
 void cre_scene_utils_reset_callback_func_overrides() {
-    onGetSelfAndParentEntitiesFunc = &cre_scene_manager_get_self_and_parent_nodes;
+    onGetParentEntityFunc = &default_get_parent_entity;
     onGetLocalTransformFunc = &default_get_local_transform;
 }
@@ -5,19 +5,22 @@ extern "C" {
 #endif
 
 #include <seika/math/math.h>
+#include <seika/ecs/entity.h>
 
-#include "scene_manager.h"
-
-struct SkaTransformModel2D;
-
-typedef EntityArray (*on_get_self_and_parent_entities) (SkaEntity);
+// Providers used to compose global transforms outside of the scene manager's cached propagation.  The defaults read the
+// engine's scene tree and 'Transform2DComponent', tools (e.g. the editor) override them with their own node hierarchy.
+typedef SkaEntity (*on_get_parent_entity) (SkaEntity); // 'SKA_NULL_ENTITY' for roots
 typedef SkaTransform2D (*on_get_local_transform) (SkaEntity, int32*, bool*);
 
+// Composes a node's global transform from its parent's (already up to date) global transform and its local transform.
+// 2D transforms are composed directly (rotate and scale the local position by the parent, add rotations, multiply scales)
+// and the model matrix is rebuilt from the result, no 4x4 multiply or decompose needed.
+void cre_scene_utils_compose_global_transform(SkaTransformModel2D* globalTransform, const SkaTransformModel2D* parentGlobalTransform, const SkaTransform2D* localTransform, int32 localZIndex);
+// Composes the entity's global transform top down from its root through the providers, nothing is cached
 void cre_scene_utils_update_global_transform_model(SkaEntity entity, SkaTransformModel2D* globalTransform);
 void cre_scene_utils_apply_camera_and_origin_translation(SkaTransformModel2D* globalTransform, const SkaVector2* offset, bool ignoreCamera);
-void cre_scene_utils_override_on_get_self_and_parent_entities_func(on_get_self_and_parent_entities func);
+void cre_scene_utils_override_on_get_parent_entity_func(on_get_parent_entity func);
 void cre_scene_utils_override_on_get_local_transform_func(on_get_local_transform func);
-EntityArray cre_scene_utils_get_self_and_parent_entities(SkaEntity entity);
 void cre_scene_utils_reset_callback_func_overrides();
 
 #ifdef __cplusplus
@@ -95,21 +95,8 @@ void native_on_create_instance(SkaEntity entity, const char* classPath, const ch
 void native_on_delete_instance(SkaEntity entity) {
     CRENativeScriptClass* scriptClassRef = (CRENativeScriptClass*) *(CRENativeScriptClass**)ska_hash_map_get(entityToClassName, &entity);
 
-    if (scriptClassRef->update_func != NULL) {
-        ska_array_utils_remove_item_uint32(
-            native_script_context->updateEntities,
-            &native_script_context->updateEntityCount,
-            entity,
-            SKA_NULL_ENTITY
-        );
-    }
-    if (scriptClassRef->fixed_update_func != NULL) {
-        ska_array_utils_remove_item_uint32(
-            native_script_context->fixedUpdateEntities,
-            &native_script_context->fixedUpdateEntityCount,
-            entity,
-            SKA_NULL_ENTITY
-        );
+    if (scriptClassRef->update_func != NULL || scriptClassRef->fixed_update_func != NULL) {
+        cre_script_context_remove_entity(native_script_context, entity);
     }
 
     SKA_FREE(scriptClassRef);
@@ -122,10 +109,10 @@ void native_on_start(SkaEntity entity) {
     scriptClassRef->on_start_func(scriptClassRef);
     // Check if entity has update functions
     if (scriptClassRef->update_func != NULL) {
-        native_script_context->updateEntities[native_script_context->updateEntityCount++] = entity;
+        cre_script_context_add_update_entity(native_script_context, entity);
     }
     if (scriptClassRef->fixed_update_func != NULL) {
-        native_script_context->fixedUpdateEntities[native_script_context->fixedUpdateEntityCount++] = entity;
+        cre_script_context_add_fixed_update_entity(native_script_context, entity);
     }
 }
 
@@ -60,13 +60,21 @@ void cre_pkpy_api_load_internal_modules() {
             {.signature = "node_get_name(entity_id: int) -> str", .function = cre_pkpy_api_node_get_name},
             {.signature = "node_add_child(parent_entity_id: int, child_entity_id: int) -> None", .function = cre_pkpy_api_node_add_child},
             {.signature = "node_get_child(parent_entity_id: int, child_entity_name: str) -> Optional[\"Node\"]", .function = cre_pkpy_api_node_get_child},
+            {.signature = "node_get_node(entity_id: int, node_path: str) -> Optional[\"Node\"]", .function = cre_pkpy_api_node_get_node},
+            {.signature = "node_add_to_group(entity_id: int, group: str) -> None", .function = cre_pkpy_api_node_add_to_group},
+            {.signature = "node_remove_from_group(entity_id: int, group: str) -> None", .function = cre_pkpy_api_node_remove_from_group},
+            {.signature = "node_is_in_group(entity_id: int, group: str) -> bool", .function = cre_pkpy_api_node_is_in_group},
             {.signature = "node_get_children(entity_id: int) -> Tuple[\"Node\", ...]", .function = cre_pkpy_api_node_get_children},
             {.signature = "node_get_parent(child_entity_id: int) -> Optional[\"Node\"]", .function = cre_pkpy_api_node_get_parent},
             {.signature = "node_queue_deletion(entity_id: int) -> None", .function = cre_pkpy_api_node_queue_deletion},
             {.signature = "node_is_queued_for_deletion(entity_id: int) -> bool", .function = cre_pkpy_api_node_is_queued_for_deletion},
+            {.signature = "node_release_to_pool(entity_id: int) -> bool", .function = cre_pkpy_api_node_release_to_pool},
             {.signature = "node_set_time_dilation(entity_id: int, dilation: float) -> None", .function = cre_pkpy_api_node_set_time_dilation},
             {.signature = "node_get_time_dilation(entity_id: int) -> float", .function = cre_pkpy_api_node_get_time_dilation},
             {.signature = "node_get_total_time_dilation(entity_id: int) -> float", .function = cre_pkpy_api_node_get_total_time_dilation},
+            {.signature = "node_set_process_mode(entity_id: int, mode: int) -> None", .function = cre_pkpy_api_node_set_process_mode},
+            {.signature = "node_get_process_mode(entity_id: int) -> int", .function = cre_pkpy_api_node_get_process_mode},
+            {.signature = "node_can_process(entity_id: int) -> bool", .function = cre_pkpy_api_node_can_process},
             // Node2D
             {.signature = "node2d_set_position(entity_id: int, x: float, y: float) -> None", .function = cre_pkpy_api_node2d_set_position},
             {.signature = "node2d_add_to_position(entity_id: int, x: float, y: float) -> None", .function = cre_pkpy_api_node2d_add_to_position},
@@ -150,9 +158,22 @@ void cre_pkpy_api_load_internal_modules() {
             {.signature = "particles2d_set_initial_velocity(entity_id: int, min_x: float, min_y: float, max_x: float, max_y: float) -> None", .function = cre_pkpy_api_particles2d_set_initial_velocity},
             {.signature = "particles2d_get_spread(entity_id: int) -> float", .function = cre_pkpy_api_particles2d_get_spread},
             {.signature = "particles2d_set_spread(entity_id: int, spread: float) -> None", .function = cre_pkpy_api_particles2d_set_spread},
+            // Visibility Notifier 2D
+            {.signature = "visibility_notifier2d_get_rect(entity_id: int) -> Tuple[float, float, float, float]", .function = cre_pkpy_api_visibility_notifier2d_get_rect},
+            {.signature = "visibility_notifier2d_set_rect(entity_id: int, x: float, y: float, w: float, h: float) -> None", .function = cre_pkpy_api_visibility_notifier2d_set_rect},
+            {.signature = "visibility_notifier2d_get_suspend_when_off_screen(entity_id: int) -> bool", .function = cre_pkpy_api_visibility_notifier2d_get_suspend_when_off_screen},
+            {.signature = "visibility_notifier2d_set_suspend_when_off_screen(entity_id: int, suspend: bool) -> None", .function = cre_pkpy_api_visibility_notifier2d_set_suspend_when_off_screen},
+            {.signature = "visibility_notifier2d_is_on_screen(entity_id: int) -> bool", .function = cre_pkpy_api_visibility_notifier2d_is_on_screen},
             // Scene Tree
             {.signature = "scene_tree_change_scene(path: str) -> None", .function = cre_pkpy_api_scene_tree_change_scene},
+            {.signature = "scene_tree_change_scene_async(path: str) -> bool", .function = cre_pkpy_api_scene_tree_change_scene_async},
+            {.signature = "scene_tree_get_async_load_progress() -> float", .function = cre_pkpy_api_scene_tree_get_async_load_progress},
+            {.signature = "scene_tree_is_async_loading() -> bool", .function = cre_pkpy_api_scene_tree_is_async_loading},
+            {.signature = "scene_tree_set_async_load_frame_budget(budget_ms: float) -> None", .function = cre_pkpy_api_scene_tree_set_async_load_frame_budget},
+            {.signature = "scene_tree_set_paused(paused: bool) -> None", .function = cre_pkpy_api_scene_tree_set_paused},
+            {.signature = "scene_tree_is_paused() -> bool", .function = cre_pkpy_api_scene_tree_is_paused},
             {.signature = "scene_tree_get_root()", .function = cre_pkpy_api_scene_tree_get_root},
+            {.signature = "scene_tree_get_nodes_in_group(group: str) -> List[\"Node\"]", .function = cre_pkpy_api_scene_tree_get_nodes_in_group},
             // Scene Manager
             {.signature = "_scene_manager_process_queued_creation_entities() -> None", .function = cre_pkpy_api_scene_manager_process_queued_creation_entities},
             {.signature = "_scene_manager_process_queued_scene_change() -> None", .function = cre_pkpy_api_scene_manager_process_queued_scene_change},
@@ -188,7 +209,12 @@ void cre_pkpy_api_load_internal_modules() {
             {.signature = "game_config_load(path, encryption_key) -> str", .function = cre_pkpy_api_game_config_load},
             // Packed Scene
             {.signature = "packed_scene_create_instance(scene_cache_id: int) -> \"Node\"", .function = cre_pkpy_api_packed_scene_create_instance},
+            {.signature = "packed_scene_create_instances(scene_cache_id: int, count: int, positions: List[\"Vector2\"]) -> List[\"Node\"]", .function = cre_pkpy_api_packed_scene_create_instances},
+            {.signature = "packed_scene_acquire(scene_cache_id: int) -> \"Node\"", .function = cre_pkpy_api_packed_scene_acquire},
+            {.signature = "packed_scene_get_pool_stats(scene_cache_id: int) -> Tuple[int, int, int, int]", .function = cre_pkpy_api_packed_scene_get_pool_stats},
             {.signature = "packed_scene_load(path: str) -> int", .function = cre_pkpy_api_packed_scene_load},
+            {.signature = "packed_scene_get_cache_stats() -> Tuple[int, int, int, int, int, int]", .function = cre_pkpy_api_packed_scene_get_cache_stats},
+            {.signature = "packed_scene_set_cache_memory_budget(memory_budget: int) -> None", .function = cre_pkpy_api_packed_scene_set_cache_memory_budget},
             // Collision Handler
             {.signature = "collision_handler_process_collisions(entity_id: float) -> Tuple[\"Node\", ...]", .function = cre_pkpy_api_collision_handler_process_collisions},
             {.signature = "collision_handler_process_mouse_collisions(pos_offset_x: float, pos_offset_y: float, collision_size_w: float, collision_size_h: float) -> Tuple[\"Node\", ...]", .function = cre_pkpy_api_collision_handler_process_mouse_collisions},
@@ -202,6 +228,13 @@ void cre_pkpy_api_load_internal_modules() {
             {.signature = "client_start(host: str, port: int) -> None", .function = cre_pkpy_api_client_start},
             {.signature = "client_stop() -> None", .function = cre_pkpy_api_client_stop},
             {.signature = "client_send(message: str) -> None", .function = cre_pkpy_api_client_send},
+            // Replay
+            {.signature = "replay_seek(frame: int) -> bool", .function = cre_pkpy_api_replay_seek},
+            {.signature = "replay_get_frame() -> int", .function = cre_pkpy_api_replay_get_frame},
+            {.signature = "replay_get_frame_count() -> int", .function = cre_pkpy_api_replay_get_frame_count},
+            {.signature = "replay_is_playing() -> bool", .function = cre_pkpy_api_replay_is_playing},
+            {.signature = "replay_get_stats() -> Tuple[int, int, int, int, int, int]", .function = cre_pkpy_api_replay_get_stats},
+            {.signature = "replay_get_action_rollback_count(name: str) -> int", .function = cre_pkpy_api_replay_get_action_rollback_count},
 
             { NULL, NULL },
         }
@@ -1,5 +1,7 @@
 #include "pkpy_api_impl.h"
 
+#include <stdlib.h>
+
 #include <seika/assert.h>
 #include <seika/file_system.h>
 #include <seika/flag_utils.h>
@@ -27,6 +29,9 @@
 #include "core/camera/camera_manager.h"
 #include "core/ecs/ecs_globals.h"
 #include "core/ecs/ecs_manager.h"
+#include "core/ecs/component_pool.h"
+#include "core/ecs/component_versions.h"
+#include "core/ecs/entity_builder.h"
 #include "core/ecs/components/animated_sprite_component.h"
 #include "core/ecs/components/color_rect_component.h"
 #include "core/ecs/components/parallax_component.h"
@@ -35,10 +40,15 @@
 #include "core/ecs/components/sprite_component.h"
 #include "core/ecs/components/text_label_component.h"
 #include "core/ecs/components/tilemap_component.h"
+#include "core/ecs/components/visibility_notifier2d_component.h"
+#include "core/ecs/systems/visibility_notifier_ec_system.h"
 #include "core/physics/collision/collision.h"
+#include "core/replay/replay.h"
+#include "core/scene/node_pool.h"
 #include "core/scene/scene_manager.h"
 #include "core/scene/scene_template_cache.h"
 #include "core/scripting/python/pocketpy/pkpy_instance_cache.h"
+#include "core/scripting/python/pocketpy/pkpy_util.h"
 
 // Helper functions
 static inline SkaVector2 cre_pkpy_api_helper_mouse_get_global_position(const SkaVector2* offset) {
@@ -519,6 +529,11 @@ bool cre_pkpy_api_input_is_action_pressed(int argc, py_StackRef argv) {
 
     // TODO: Probably should take device index as a param
     const SkaInputDeviceIndex deviceIndex = SKA_INPUT_FIRST_PLAYER_DEVICE_INDEX;
+    CreReplayActionState replayActionState;
+    if (cre_replay_get_action_state(actionName, (int32)deviceIndex, &replayActionState)) {
+        py_newbool(py_retval(), replayActionState.pressed);
+        return true;
+    }
     const SkaInputActionHandle handle = ska_input_find_input_action_handle(actionName, deviceIndex);
     const bool isPressed = handle != SKA_INPUT_INVALID_INPUT_ACTION_HANDLE ? ska_input_is_input_action_pressed(handle, deviceIndex) : false;
     py_newbool(py_retval(), isPressed);
@@ -531,6 +546,11 @@ bool cre_pkpy_api_input_is_action_just_pressed(int argc, py_StackRef argv) {
     const char* actionName = py_tostr(py_arg(0));
 
     const SkaInputDeviceIndex deviceIndex = SKA_INPUT_FIRST_PLAYER_DEVICE_INDEX;
+    CreReplayActionState replayActionState;
+    if (cre_replay_get_action_state(actionName, (int32)deviceIndex, &replayActionState)) {
+        py_newbool(py_retval(), replayActionState.justPressed);
+        return true;
+    }
     const SkaInputActionHandle handle = ska_input_find_input_action_handle(actionName, deviceIndex);
     const bool isPressed = handle != SKA_INPUT_INVALID_INPUT_ACTION_HANDLE ? ska_input_is_input_action_just_pressed(handle, deviceIndex) : false;
     py_newbool(py_retval(), isPressed);
@@ -543,6 +563,11 @@ bool cre_pkpy_api_input_is_action_just_released(int argc, py_StackRef argv) {
     const char* actionName = py_tostr(py_arg(0));
 
     const SkaInputDeviceIndex deviceIndex = SKA_INPUT_FIRST_PLAYER_DEVICE_INDEX;
+    CreReplayActionState replayActionState;
+    if (cre_replay_get_action_state(actionName, (int32)deviceIndex, &replayActionState)) {
+        py_newbool(py_retval(), replayActionState.justReleased);
+        return true;
+    }
     const SkaInputActionHandle handle = ska_input_find_input_action_handle(actionName, deviceIndex);
     const bool isReleased = handle != SKA_INPUT_INVALID_INPUT_ACTION_HANDLE ? ska_input_is_input_action_just_released(handle, deviceIndex) : false;
     py_newbool(py_retval(), isReleased);
@@ -606,6 +631,56 @@ bool cre_pkpy_api_scene_tree_change_scene(int argc, py_StackRef argv) {
     return true;
 }
 
+static void pkpy_on_async_scene_loaded(const char* scenePath) {
+    py_exec("import crescent\ncrescent.SceneTree._on_async_scene_loaded()", "<main>", EXEC_MODE, NULL);
+    PY_ASSERT_NO_EXC();
+}
+
+bool cre_pkpy_api_scene_tree_change_scene_async(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_str);
+    const char* scenePath = py_tostr(py_arg(0));
+
+    cre_scene_manager_set_async_scene_loaded_callback(pkpy_on_async_scene_loaded);
+    py_newbool(py_retval(), cre_scene_manager_change_scene_async(scenePath));
+    return true;
+}
+
+bool cre_pkpy_api_scene_tree_get_async_load_progress(int argc, py_StackRef argv) {
+    py_newfloat(py_retval(), (f64)cre_scene_manager_get_async_scene_load_progress());
+    return true;
+}
+
+bool cre_pkpy_api_scene_tree_is_async_loading(int argc, py_StackRef argv) {
+    py_newbool(py_retval(), cre_scene_manager_is_async_scene_loading());
+    return true;
+}
+
+bool cre_pkpy_api_scene_tree_set_async_load_frame_budget(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_float);
+    const f64 frameBudgetMilliseconds = py_tofloat(py_arg(0));
+
+    cre_scene_manager_set_async_scene_load_frame_budget((f32)frameBudgetMilliseconds);
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_scene_tree_set_paused(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_bool);
+    const bool paused = py_tobool(py_arg(0));
+
+    cre_scene_manager_set_paused(paused);
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_scene_tree_is_paused(int argc, py_StackRef argv) {
+    py_newbool(py_retval(), cre_scene_manager_is_paused());
+    return true;
+}
+
 bool cre_pkpy_api_scene_tree_get_root(int argc, py_StackRef argv) {
     SceneTreeNode* rootNode = cre_scene_manager_get_active_scene_root();
     SKA_ASSERT(rootNode != NULL);
@@ -614,6 +689,20 @@ bool cre_pkpy_api_scene_tree_get_root(int argc, py_StackRef argv) {
     return true;
 }
 
+bool cre_pkpy_api_scene_tree_get_nodes_in_group(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_str);
+    const char* group = py_tostr(py_arg(0));
+
+    size_t entityCount = 0;
+    const SkaEntity* entities = cre_scene_manager_get_group_entities(group, &entityCount);
+    py_newlistn(py_retval(), (int)entityCount);
+    for (size_t i = 0; i < entityCount; i++) {
+        py_list_setitem(py_retval(), (int)i, cre_pkpy_instance_cache_add2(entities[i]));
+    }
+    return true;
+}
+
 // Scene Manager
 
 bool cre_pkpy_api_scene_manager_process_queued_creation_entities(int argc, py_StackRef argv) {
@@ -945,22 +1034,102 @@ bool cre_pkpy_api_game_config_load(int argc, py_StackRef argv) {
 
 // Packed Scene
 
+static py_Ref pkpy_api_get_packed_scene_root_instance(SkaEntity rootEntity) {
+    const ScriptComponent* scriptComp = (ScriptComponent*)ska_ecs_component_manager_get_component_unchecked(rootEntity, SCRIPT_COMPONENT_INDEX);
+    if (scriptComp != NULL) {
+        return cre_pkpy_instance_cache_add(rootEntity, scriptComp->classPath, scriptComp->className);
+    }
+    return cre_pkpy_instance_cache_add2(rootEntity);
+}
+
 bool cre_pkpy_api_packed_scene_create_instance(int argc, py_StackRef argv) {
     PY_CHECK_ARGC(1);
     PY_CHECK_ARG_TYPE(0, tp_int);
     const py_i64 cacheId = py_toint(py_arg(0));
 
-    JsonSceneNode* sceneNode = cre_scene_template_cache_get_scene((CreSceneCacheId)cacheId);
-    SceneTreeNode* rootNode = cre_scene_manager_stage_scene_nodes_from_json(sceneNode);
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene((CreSceneCacheId)cacheId);
+    if (sceneTemplate == NULL) {
+        py_newnone(py_retval());
+        return true;
+    }
+    SceneTreeNode* rootNode = cre_scene_manager_stage_scene_nodes_from_template(sceneTemplate);
+    py_assign(py_retval(), pkpy_api_get_packed_scene_root_instance(rootNode->entity));
+    return true;
+}
 
-    py_Ref newInstance;
-    if (sceneNode->components[SCRIPT_COMPONENT_INDEX] != NULL) {
-        ScriptComponent* scriptComp = (ScriptComponent*)sceneNode->components[SCRIPT_COMPONENT_INDEX];
-        newInstance = cre_pkpy_instance_cache_add(rootNode->entity, scriptComp->classPath, scriptComp->className);
-    } else {
-        newInstance = cre_pkpy_instance_cache_add2(rootNode->entity);
+bool cre_pkpy_api_packed_scene_acquire(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 cacheId = py_toint(py_arg(0));
+
+    const SceneTreeNode* rootNode = cre_node_pool_acquire((CreSceneCacheId)cacheId);
+    if (rootNode == NULL) {
+        py_newnone(py_retval());
+        return true;
     }
-    py_assign(py_retval(), newInstance);
+    // Reused instances already have a script instance which is returned as is
+    py_assign(py_retval(), pkpy_api_get_packed_scene_root_instance(rootNode->entity));
+    return true;
+}
+
+bool cre_pkpy_api_packed_scene_get_pool_stats(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 cacheId = py_toint(py_arg(0));
+
+    const CreNodePoolStats stats = cre_node_pool_get_stats((CreSceneCacheId)cacheId);
+    py_newtuple(py_retval(), 4);
+    py_newint(py_tuple_getitem(py_retval(), 0), (py_i64)stats.activeCount);
+    py_newint(py_tuple_getitem(py_retval(), 1), (py_i64)stats.idleCount);
+    py_newint(py_tuple_getitem(py_retval(), 2), (py_i64)stats.createdCount);
+    py_newint(py_tuple_getitem(py_retval(), 3), (py_i64)stats.reusedCount);
+    return true;
+}
+
+bool cre_pkpy_api_packed_scene_create_instances(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(3);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_int); PY_CHECK_ARG_TYPE(2, tp_list);
+    const py_i64 cacheId = py_toint(py_arg(0));
+    const py_i64 count = py_toint(py_arg(1));
+    const py_Ref pyPositionsList = py_arg(2);
+
+    const int positionCount = py_list_len(pyPositionsList);
+    SKA_ASSERT_FMT(count >= 0 && count <= SKA_MAX_ENTITIES, "Invalid packed scene instance count '%d'!", (int32)count);
+    SKA_ASSERT_FMT(positionCount == 0 || positionCount == (int)count, "Expected '%d' positions for packed scene instances, got '%d'!", (int32)count, positionCount);
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene((CreSceneCacheId)cacheId);
+    if (sceneTemplate == NULL || count == 0) {
+        py_newlist(py_retval());
+        return true;
+    }
+    SceneTreeNode** packedSceneInstanceRootNodes = (SceneTreeNode**)malloc(sizeof(SceneTreeNode*) * (size_t)count);
+    SKA_ASSERT(packedSceneInstanceRootNodes);
+    const size_t instanceCount = cre_scene_manager_instantiate_many(sceneTemplate, (size_t)count, NULL, packedSceneInstanceRootNodes);
+
+    // Instances are staged so positions are set directly, they're applied once the instances enter the scene
+    for (int i = 0; i < positionCount; i++) {
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(packedSceneInstanceRootNodes[i]->entity, TRANSFORM2D_COMPONENT_INDEX);
+        if (transformComp == NULL) {
+            continue;
+        }
+        py_Ref pyPosition = py_list_getitem(pyPositionsList, i);
+        bool hasAttribute = py_getattr(pyPosition, py_name("x"));
+        SKA_ASSERT(hasAttribute);
+        transformComp->localTransform.position.x = (f32)py_tofloat(py_retval());
+        hasAttribute = py_getattr(pyPosition, py_name("y"));
+        SKA_ASSERT(hasAttribute);
+        transformComp->localTransform.position.y = (f32)py_tofloat(py_retval());
+    }
+
+    const ScriptComponent* scriptComp = (ScriptComponent*)ska_ecs_component_manager_get_component_unchecked(packedSceneInstanceRootNodes[0]->entity, SCRIPT_COMPONENT_INDEX);
+    py_newlistn(py_retval(), (int)instanceCount);
+    for (size_t i = 0; i < instanceCount; i++) {
+        const SkaEntity rootEntity = packedSceneInstanceRootNodes[i]->entity;
+        py_Ref newInstance = scriptComp != NULL
+            ? cre_pkpy_instance_cache_add(rootEntity, scriptComp->classPath, scriptComp->className)
+            : cre_pkpy_instance_cache_add2(rootEntity);
+        py_list_setitem(py_retval(), (int)i, newInstance);
+    }
+    free(packedSceneInstanceRootNodes);
     return true;
 }
 
@@ -974,6 +1143,27 @@ bool cre_pkpy_api_packed_scene_load(int argc, py_StackRef argv) {
     return true;
 }
 
+bool cre_pkpy_api_packed_scene_get_cache_stats(int argc, py_StackRef argv) {
+    const CreSceneCacheStats stats = cre_scene_template_cache_get_stats();
+    py_newtuple(py_retval(), 6);
+    py_newint(py_tuple_getitem(py_retval(), 0), (py_i64)stats.hits);
+    py_newint(py_tuple_getitem(py_retval(), 1), (py_i64)stats.misses);
+    py_newint(py_tuple_getitem(py_retval(), 2), (py_i64)stats.evictions);
+    py_newint(py_tuple_getitem(py_retval(), 3), (py_i64)stats.residentCount);
+    py_newint(py_tuple_getitem(py_retval(), 4), (py_i64)stats.memoryUsed);
+    py_newint(py_tuple_getitem(py_retval(), 5), (py_i64)stats.memoryBudget);
+    return true;
+}
+
+bool cre_pkpy_api_packed_scene_set_cache_memory_budget(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 memoryBudget = py_toint(py_arg(0));
+
+    cre_scene_template_cache_set_memory_budget((size_t)memoryBudget);
+    return true;
+}
+
 // Collision Handler
 
 bool cre_pkpy_api_collision_handler_process_collisions(int argc, py_StackRef argv) {
@@ -1075,43 +1265,108 @@ bool cre_pkpy_api_client_send(int argc, py_StackRef argv) {
     return true;
 }
 
+// Replay
+
+bool cre_pkpy_api_replay_seek(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 frame = py_toint(py_arg(0));
+
+    const bool canSeek = frame >= 0 && cre_replay_get_mode() == CreReplayMode_PLAYBACK;
+    if (canSeek) {
+        cre_replay_queue_seek((uint32)frame);
+    }
+    py_newbool(py_retval(), canSeek);
+    return true;
+}
+
+bool cre_pkpy_api_replay_get_frame(int argc, py_StackRef argv) {
+    py_newint(py_retval(), (py_i64)cre_replay_get_current_frame());
+    return true;
+}
+
+bool cre_pkpy_api_replay_get_frame_count(int argc, py_StackRef argv) {
+    py_newint(py_retval(), (py_i64)cre_replay_get_frame_count());
+    return true;
+}
+
+bool cre_pkpy_api_replay_is_playing(int argc, py_StackRef argv) {
+    py_newbool(py_retval(), cre_replay_get_mode() == CreReplayMode_PLAYBACK);
+    return true;
+}
+
+bool cre_pkpy_api_replay_get_stats(int argc, py_StackRef argv) {
+    const CreReplayStats stats = cre_replay_get_stats();
+    py_newtuple(py_retval(), 6);
+    py_newint(py_tuple_getitem(py_retval(), 0), (py_i64)stats.keyframeCount);
+    py_newint(py_tuple_getitem(py_retval(), 1), (py_i64)stats.snapshotMemoryBytes);
+    py_newint(py_tuple_getitem(py_retval(), 2), (py_i64)stats.lastSeekFramesSimulated);
+    py_newint(py_tuple_getitem(py_retval(), 3), (py_i64)stats.lastSeekTimeMilliseconds);
+    py_newint(py_tuple_getitem(py_retval(), 4), (py_i64)stats.rollbackCount);
+    py_newint(py_tuple_getitem(py_retval(), 5), (py_i64)stats.rollbackFramesResimulated);
+    return true;
+}
+
+bool cre_pkpy_api_replay_get_action_rollback_count(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_str);
+    const char* actionName = py_tostr(py_arg(0));
+
+    const uint32 rollbackCount = cre_replay_get_action_rollback_count(actionName, (int32)SKA_INPUT_FIRST_PLAYER_DEVICE_INDEX);
+    py_newint(py_retval(), (py_i64)rollbackCount);
+    return true;
+}
+
 // Node
 
 static void set_node_component_from_type(SkaEntity entity, const char* classPath, const char* className, NodeBaseType baseType) {
+    CreEntityBuilder builder;
+    cre_entity_builder_begin(&builder, entity);
 
     // Set components that should be set for a base node (that has invoked .new() from scripting)
-    ska_ecs_component_manager_set_component(entity, NODE_COMPONENT_INDEX, node_component_create_ex(className, baseType));
-    ska_ecs_component_manager_set_component(entity, SCRIPT_COMPONENT_INDEX, script_component_create_ex(classPath, className, CreScriptContextType_PYTHON));
+    NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
+    ska_strcpy(nodeComponent->name, className);
+    nodeComponent->type = baseType;
+    cre_entity_builder_set_component(&builder, NODE_COMPONENT_INDEX, nodeComponent);
+    ScriptComponent* scriptComponent = (ScriptComponent*)cre_component_pool_create(SCRIPT_COMPONENT_INDEX);
+    ska_strcpy(scriptComponent->classPath, classPath);
+    ska_strcpy(scriptComponent->className, className);
+    scriptComponent->contextType = CreScriptContextType_PYTHON;
+    cre_entity_builder_set_component(&builder, SCRIPT_COMPONENT_INDEX, scriptComponent);
 
     const NodeBaseInheritanceType inheritanceType = node_get_type_inheritance(baseType);
 
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_NODE2D)) {
-        ska_ecs_component_manager_set_component(entity, TRANSFORM2D_COMPONENT_INDEX, transform2d_component_create());
+        cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_SPRITE)) {
-        ska_ecs_component_manager_set_component(entity, SPRITE_COMPONENT_INDEX, sprite_component_create());
+        cre_entity_builder_set_component(&builder, SPRITE_COMPONENT_INDEX, cre_component_pool_create(SPRITE_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_ANIMATED_SPRITE)) {
-        ska_ecs_component_manager_set_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX, animated_sprite_component_create());
+        cre_entity_builder_set_component(&builder, ANIMATED_SPRITE_COMPONENT_INDEX, cre_component_pool_create(ANIMATED_SPRITE_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_TEXT_LABEL)) {
-        ska_ecs_component_manager_set_component(entity, TEXT_LABEL_COMPONENT_INDEX, text_label_component_create());
+        cre_entity_builder_set_component(&builder, TEXT_LABEL_COMPONENT_INDEX, cre_component_pool_create(TEXT_LABEL_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_COLLIDER2D)) {
-        ska_ecs_component_manager_set_component(entity, COLLIDER2D_COMPONENT_INDEX, collider2d_component_create());
+        cre_entity_builder_set_component(&builder, COLLIDER2D_COMPONENT_INDEX, cre_component_pool_create(COLLIDER2D_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_COLOR_RECT)) {
-        ska_ecs_component_manager_set_component(entity, COLOR_RECT_COMPONENT_INDEX, color_rect_component_create());
+        cre_entity_builder_set_component(&builder, COLOR_RECT_COMPONENT_INDEX, cre_component_pool_create(COLOR_RECT_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_PARALLAX)) {
-        ska_ecs_component_manager_set_component(entity, PARALLAX_COMPONENT_INDEX, parallax_component_create());
+        cre_entity_builder_set_component(&builder, PARALLAX_COMPONENT_INDEX, cre_component_pool_create(PARALLAX_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_PARTICLES2D)) {
-        ska_ecs_component_manager_set_component(entity, PARTICLES2D_COMPONENT_INDEX, particles2d_component_create());
+        cre_entity_builder_set_component(&builder, PARTICLES2D_COMPONENT_INDEX, cre_component_pool_create(PARTICLES2D_COMPONENT_INDEX));
     }
     if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_TILEMAP)) {
-        ska_ecs_component_manager_set_component(entity, TILEMAP_COMPONENT_INDEX, tilemap_component_create());
+        cre_entity_builder_set_component(&builder, TILEMAP_COMPONENT_INDEX, tilemap_component_create());
     }
+    if (SKA_FLAG_CONTAINS(inheritanceType, NodeBaseInheritanceType_VISIBILITY_NOTIFIER2D)) {
+        cre_entity_builder_set_component(&builder, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX, cre_component_pool_create(VISIBILITY_NOTIFIER2D_COMPONENT_INDEX));
+    }
+    cre_entity_builder_build(&builder);
 }
 
 bool cre_pkpy_api_node_new(int argc, py_StackRef argv) {
@@ -1168,6 +1423,54 @@ bool cre_pkpy_api_node_get_child(int argc, py_StackRef argv) {
     return true;
 }
 
+bool cre_pkpy_api_node_get_node(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_str);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const char* nodePath = py_tostr(py_arg(1));
+
+    const SkaEntity nodeEntity = cre_scene_manager_get_entity_by_path((SkaEntity)entityId, nodePath);
+    if (nodeEntity != SKA_NULL_ENTITY) {
+        py_assign(py_retval(), cre_pkpy_instance_cache_add2(nodeEntity));
+    } else {
+        ska_logger_warn("Unable to find node '%s' from entity '%u'", nodePath, entityId);
+        py_newnone(py_retval());
+    }
+    return true;
+}
+
+bool cre_pkpy_api_node_add_to_group(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_str);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const char* group = py_tostr(py_arg(1));
+
+    cre_scene_manager_add_entity_to_group((SkaEntity)entityId, group);
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_node_remove_from_group(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_str);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const char* group = py_tostr(py_arg(1));
+
+    cre_scene_manager_remove_entity_from_group((SkaEntity)entityId, group);
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_node_is_in_group(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_str);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const char* group = py_tostr(py_arg(1));
+
+    py_newbool(py_retval(), cre_scene_manager_is_entity_in_group((SkaEntity)entityId, group));
+    return true;
+}
+
 bool cre_pkpy_api_node_get_children(int argc, py_StackRef argv) {
     PY_CHECK_ARGC(1);
     PY_CHECK_ARG_TYPE(0, tp_int);
@@ -1177,9 +1480,9 @@ bool cre_pkpy_api_node_get_children(int argc, py_StackRef argv) {
     if (cre_scene_manager_has_entity_tree_node(entity)) {
         const SceneTreeNode* parentTreeNode = cre_scene_manager_get_entity_tree_node(entity);
         py_newlistn(py_retval(), (int)parentTreeNode->childCount);
-        for (size_t i = 0; i < parentTreeNode->childCount; i++) {
-            const SceneTreeNode* childTreeNode = parentTreeNode->children[i];
-            py_list_setitem(py_retval(), (int)i, cre_pkpy_instance_cache_add2(childTreeNode->entity));
+        int childIndex = 0;
+        for (const SceneTreeNode* childTreeNode = parentTreeNode->firstChild; childTreeNode != NULL; childTreeNode = childTreeNode->nextSibling) {
+            py_list_setitem(py_retval(), childIndex++, cre_pkpy_instance_cache_add2(childTreeNode->entity));
         }
     } else {
         ska_logger_warn("Doesn't have tree node when trying to get children from %u", entity);
@@ -1238,6 +1541,20 @@ bool cre_pkpy_api_node_is_queued_for_deletion(int argc, py_StackRef argv) {
     return true;
 }
 
+bool cre_pkpy_api_node_release_to_pool(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    const bool wasReleased = cre_node_pool_release(entity);
+    if (!wasReleased) {
+        ska_logger_warn("Entity '%u' isn't an acquired pooled instance in the scene tree, not releasing to pool!", entity);
+    }
+    py_newbool(py_retval(), wasReleased);
+    return true;
+}
+
 bool cre_pkpy_api_node_set_time_dilation(int argc, py_StackRef argv) {
     PY_CHECK_ARGC(2);
     PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_float);
@@ -1248,6 +1565,7 @@ bool cre_pkpy_api_node_set_time_dilation(int argc, py_StackRef argv) {
     NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component(entity, NODE_COMPONENT_INDEX);
     nodeComponent->timeDilation.value = (f32)timeDilation;
     cre_scene_manager_invalidate_time_dilation_nodes_with_children(entity);
+    cre_component_versions_mark_changed(entity, NODE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1275,6 +1593,40 @@ bool cre_pkpy_api_node_get_total_time_dilation(int argc, py_StackRef argv) {
     return true;
 }
 
+bool cre_pkpy_api_node_set_process_mode(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const py_i64 processMode = py_toint(py_arg(1));
+
+    if (processMode >= NodeProcessMode_INHERIT && processMode <= NodeProcessMode_DISABLED) {
+        cre_scene_manager_set_node_process_mode((SkaEntity)entityId, (NodeProcessMode)processMode);
+    } else {
+        ska_logger_warn("Invalid process mode '%d' for entity '%u'!", (int)processMode, (SkaEntity)entityId);
+    }
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_node_get_process_mode(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component((SkaEntity)entityId, NODE_COMPONENT_INDEX);
+    py_newint(py_retval(), (py_i64)nodeComponent->processMode);
+    return true;
+}
+
+bool cre_pkpy_api_node_can_process(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    py_newbool(py_retval(), cre_scene_manager_can_entity_process((SkaEntity)entityId));
+    return true;
+}
+
 // Node2D
 
 static void pkpy_update_entity_local_position(SkaEntity entity, SkaVector2* position) {
@@ -1282,9 +1634,9 @@ static void pkpy_update_entity_local_position(SkaEntity entity, SkaVector2* posi
     const SkaVector2 prevPosition = transformComp->localTransform.position;
     transformComp->localTransform.position.x = position->x;
     transformComp->localTransform.position.y = position->y;
-    transformComp->isGlobalTransformDirty = true;
+    cre_scene_manager_invalidate_global_transform(entity, transformComp);
     if (transformComp->localTransform.position.x != prevPosition.x || transformComp->localTransform.position.y != prevPosition.y) {
-        cre_scene_manager_notify_all_on_transform_events(entity, transformComp);
+        cre_scene_manager_queue_transform_changed_event(entity);
     }
 }
 
@@ -1293,9 +1645,9 @@ static void pkpy_update_entity_local_scale(SkaEntity entity, SkaVector2 * scale)
     const SkaVector2 prevScale = transformComp->localTransform.scale;
     transformComp->localTransform.scale.x = scale->x;
     transformComp->localTransform.scale.y = scale->y;
-    transformComp->isGlobalTransformDirty = true;
+    cre_scene_manager_invalidate_global_transform(entity, transformComp);
     if (transformComp->localTransform.scale.x != prevScale.x || transformComp->localTransform.scale.y != prevScale.y) {
-        cre_scene_manager_notify_all_on_transform_events(entity, transformComp);
+        cre_scene_manager_queue_transform_changed_event(entity);
     }
 }
 
@@ -1303,9 +1655,9 @@ static void pkpy_update_entity_local_rotation(SkaEntity entity, f32 rotation) {
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     const f32 prevRotation = transformComp->localTransform.rotation;
     transformComp->localTransform.rotation = rotation;
-    transformComp->isGlobalTransformDirty = true;
+    cre_scene_manager_invalidate_global_transform(entity, transformComp);
     if (transformComp->localTransform.rotation != prevRotation) {
-        cre_scene_manager_notify_all_on_transform_events(entity, transformComp);
+        cre_scene_manager_queue_transform_changed_event(entity);
     }
 }
 
@@ -1457,6 +1809,8 @@ bool cre_pkpy_api_node2d_set_z_index(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     transformComp->zIndex = (int32)zIndex;
+    // Global z index is cached with the global transform
+    cre_scene_manager_invalidate_global_transform(entity, transformComp);
     py_newnone(py_retval());
     return true;
 }
@@ -1481,6 +1835,7 @@ bool cre_pkpy_api_node2d_set_z_index_relative_to_parent(int argc, py_StackRef ar
     const SkaEntity entity = (SkaEntity)entityId;
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     transformComp->isZIndexRelativeToParent = zIndexRelativeToParent;
+    cre_component_versions_mark_changed(entity, TRANSFORM2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1505,6 +1860,7 @@ bool cre_pkpy_api_node2d_set_ignore_camera(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
     transformComp->ignoreCamera = ignoreCamera;
+    cre_component_versions_mark_changed(entity, TRANSFORM2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1569,6 +1925,7 @@ bool cre_pkpy_api_sprite_set_texture(int argc, py_StackRef argv) {
     if (texture) {
         SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
         spriteComponent->texture = texture;
+        cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     } else {
         ska_logger_warn("Failed to find texture at path '%s'", texturePath);
     }
@@ -1608,6 +1965,7 @@ bool cre_pkpy_api_sprite_set_draw_source(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
     spriteComponent->drawSource = (SkaRect2){ (f32)x, (f32)y, (f32)w, (f32)h };
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1632,6 +1990,7 @@ bool cre_pkpy_api_sprite_set_flip_h(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
     spriteComponent->flipH = flipH;
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1656,6 +2015,7 @@ bool cre_pkpy_api_sprite_set_flip_v(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
     spriteComponent->flipV = flipV;
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1692,6 +2052,7 @@ bool cre_pkpy_api_sprite_set_modulate(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
     spriteComponent->modulate = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1721,6 +2082,7 @@ bool cre_pkpy_api_sprite_set_origin(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     SpriteComponent* spriteComponent = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
     spriteComponent->origin = (SkaVector2){ (f32)x, (f32)y };
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1752,6 +2114,7 @@ bool cre_pkpy_api_sprite_set_shader_instance(int argc, py_StackRef argv) {
     spriteComponent->shaderInstanceId = instanceId;
     SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(instanceId);
     ska_renderer_set_sprite_shader_default_params(shaderInstance->shader);
+    cre_component_versions_mark_changed(entity, SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1767,6 +2130,7 @@ bool cre_pkpy_api_animated_sprite_play(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     const bool hasSuccessfullyPlayed = animated_sprite_component_play_animation(animatedSpriteComponent, animationName);
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newbool(py_retval(), hasSuccessfullyPlayed);
     return true;
 }
@@ -1779,6 +2143,7 @@ bool cre_pkpy_api_animated_sprite_stop(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->isPlaying = false;
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1792,6 +2157,7 @@ bool cre_pkpy_api_animated_sprite_set_current_animation_frame(int argc, py_Stack
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->currentAnimation->currentFrame = ska_math_clamp_int((int32)frame, 0, animatedSpriteComponent->currentAnimation->frameCount - 1);
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1844,6 +2210,7 @@ bool cre_pkpy_api_animated_sprite_add_animation(int argc, py_StackRef argv) {
     if (isFirstAnim) {
         animated_sprite_component_set_animation(animatedSpriteComponent, newAnim.name);
     }
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1868,6 +2235,7 @@ bool cre_pkpy_api_animated_sprite_set_stagger_animation_start_times(int argc, py
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->staggerStartAnimationTimes = staggerAnimationsStartTimes;
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1892,6 +2260,7 @@ bool cre_pkpy_api_animated_sprite_set_flip_h(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->flipH = flipH;
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1916,6 +2285,7 @@ bool cre_pkpy_api_animated_sprite_set_flip_v(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->flipV = flipV;
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1952,6 +2322,7 @@ bool cre_pkpy_api_animated_sprite_set_modulate(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->modulate = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -1981,6 +2352,7 @@ bool cre_pkpy_api_animated_sprite_set_origin(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     AnimatedSpriteComponent* animatedSpriteComponent = (AnimatedSpriteComponent*)ska_ecs_component_manager_get_component(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     animatedSpriteComponent->origin = (SkaVector2){ (f32)x, (f32)y };
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2012,6 +2384,7 @@ bool cre_pkpy_api_animated_sprite_set_shader_instance(int argc, py_StackRef argv
     animatedSpriteComponent->shaderInstanceId = instanceId;
     SkaShaderInstance* shaderInstance = ska_shader_cache_get_instance(instanceId);
     ska_renderer_set_sprite_shader_default_params(shaderInstance->shader);
+    cre_component_versions_mark_changed(entity, ANIMATED_SPRITE_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2038,6 +2411,7 @@ bool cre_pkpy_api_text_label_set_text(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     TextLabelComponent* textLabelComponent = (TextLabelComponent*)ska_ecs_component_manager_get_component(entity, TEXT_LABEL_COMPONENT_INDEX);
     ska_strcpy(textLabelComponent->text, text);
+    cre_component_versions_mark_changed(entity, TEXT_LABEL_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2074,6 +2448,7 @@ bool cre_pkpy_api_text_label_set_color(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     TextLabelComponent* textLabelComponent = (TextLabelComponent*)ska_ecs_component_manager_get_component(entity, TEXT_LABEL_COMPONENT_INDEX);
     textLabelComponent->color = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, TEXT_LABEL_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2089,6 +2464,7 @@ bool cre_pkpy_api_text_label_set_font_uid(int argc, py_StackRef argv) {
     if (font) {
         TextLabelComponent* textLabelComponent = (TextLabelComponent*)ska_ecs_component_manager_get_component(entity, TEXT_LABEL_COMPONENT_INDEX);
         textLabelComponent->font = font;
+        cre_component_versions_mark_changed(entity, TEXT_LABEL_COMPONENT_INDEX);
     } else {
         ska_logger_warn("Failed to set font to '%s' as it doesn't exist in the asset manager!", fontUID);
     }
@@ -2123,6 +2499,7 @@ bool cre_pkpy_api_collider2d_set_extents(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Collider2DComponent* collider2DComponent = (Collider2DComponent*)ska_ecs_component_manager_get_component(entity, COLLIDER2D_COMPONENT_INDEX);
     collider2DComponent->extents = (SkaSize2D){ (f32)w, (f32)h };
+    cre_component_versions_mark_changed(entity, COLLIDER2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2159,6 +2536,7 @@ bool cre_pkpy_api_collider2d_set_color(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Collider2DComponent* collider2DComponent = (Collider2DComponent*)ska_ecs_component_manager_get_component(entity, COLLIDER2D_COMPONENT_INDEX);
     collider2DComponent->color = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, COLLIDER2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2190,6 +2568,7 @@ bool cre_pkpy_api_color_rect_set_size(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     ColorRectComponent* colorRectComponent = (ColorRectComponent*)ska_ecs_component_manager_get_component(entity, COLOR_RECT_COMPONENT_INDEX);
     colorRectComponent->size = (SkaSize2D){ (f32)w, (f32)h };
+    cre_component_versions_mark_changed(entity, COLOR_RECT_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2226,6 +2605,7 @@ bool cre_pkpy_api_color_rect_set_color(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     ColorRectComponent* colorRectComponent = (ColorRectComponent*)ska_ecs_component_manager_get_component(entity, COLOR_RECT_COMPONENT_INDEX);
     colorRectComponent->color = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, COLOR_RECT_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2257,6 +2637,7 @@ bool cre_pkpy_api_parallax_set_scroll_speed(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     ParallaxComponent* parallaxComponent = (ParallaxComponent*)ska_ecs_component_manager_get_component(entity, PARALLAX_COMPONENT_INDEX);
     parallaxComponent->scrollSpeed = (SkaVector2){ (f32)x, (f32)y };
+    cre_component_versions_mark_changed(entity, PARALLAX_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2283,6 +2664,7 @@ bool cre_pkpy_api_particles2d_set_amount(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->amount = (int32)amount;
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2307,6 +2689,7 @@ bool cre_pkpy_api_particles2d_set_life_time(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->lifeTime = (f32)lifeTime;
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2331,6 +2714,7 @@ bool cre_pkpy_api_particles2d_set_damping(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->damping = (f32)damping;
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2355,6 +2739,7 @@ bool cre_pkpy_api_particles2d_set_explosiveness(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->lifeTime = (f32)explosiveness;
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2391,6 +2776,7 @@ bool cre_pkpy_api_particles2d_set_color(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->color = ska_color_get_normalized_color((uint32)r, (uint32)g, (uint32)b, (uint32)a);
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2429,6 +2815,7 @@ bool cre_pkpy_api_particles2d_set_initial_velocity(int argc, py_StackRef argv) {
         .min = { .x = (f32)minX, .y = (f32)minY },
         .max = { .x = (f32)maxX, .y = (f32)maxY }
     };
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
@@ -2453,6 +2840,84 @@ bool cre_pkpy_api_particles2d_set_spread(int argc, py_StackRef argv) {
     const SkaEntity entity = (SkaEntity)entityId;
     Particles2DComponent* particles2dComponent = (Particles2DComponent*)ska_ecs_component_manager_get_component(entity, PARTICLES2D_COMPONENT_INDEX);
     particles2dComponent->spread = (f32)spread;
+    cre_component_versions_mark_changed(entity, PARTICLES2D_COMPONENT_INDEX);
+    py_newnone(py_retval());
+    return true;
+}
+
+// Visibility Notifier 2D
+
+bool cre_pkpy_api_visibility_notifier2d_get_rect(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    const VisibilityNotifier2DComponent* visibilityNotifierComponent = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    const SkaRect2* rect = &visibilityNotifierComponent->rect;
+    py_newtuple(py_retval(), 4);
+    py_Ref pyX = py_tuple_getitem(py_retval(), 0);
+    py_Ref pyY = py_tuple_getitem(py_retval(), 1);
+    py_Ref pyW = py_tuple_getitem(py_retval(), 2);
+    py_Ref pyH = py_tuple_getitem(py_retval(), 3);
+    py_newfloat(pyX, rect->x);
+    py_newfloat(pyY, rect->y);
+    py_newfloat(pyW, rect->w);
+    py_newfloat(pyH, rect->h);
+    return true;
+}
+
+bool cre_pkpy_api_visibility_notifier2d_set_rect(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(5);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_float); PY_CHECK_ARG_TYPE(2, tp_float); PY_CHECK_ARG_TYPE(3, tp_float); PY_CHECK_ARG_TYPE(4, tp_float);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const f64 x = py_tofloat(py_arg(1));
+    const f64 y = py_tofloat(py_arg(2));
+    const f64 w = py_tofloat(py_arg(3));
+    const f64 h = py_tofloat(py_arg(4));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    VisibilityNotifier2DComponent* visibilityNotifierComponent = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    visibilityNotifierComponent->rect = (SkaRect2){ (f32)x, (f32)y, (f32)w, (f32)h };
+    cre_visibility_notifier_ec_system_refresh_notifier(entity);
+    cre_component_versions_mark_changed(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
     py_newnone(py_retval());
     return true;
 }
+
+bool cre_pkpy_api_visibility_notifier2d_get_suspend_when_off_screen(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    const VisibilityNotifier2DComponent* visibilityNotifierComponent = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    py_newbool(py_retval(), visibilityNotifierComponent->suspendWhenOffScreen);
+    return true;
+}
+
+bool cre_pkpy_api_visibility_notifier2d_set_suspend_when_off_screen(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(2);
+    PY_CHECK_ARG_TYPE(0, tp_int); PY_CHECK_ARG_TYPE(1, tp_bool);
+    const py_i64 entityId = py_toint(py_arg(0));
+    const bool suspendWhenOffScreen = py_tobool(py_arg(1));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    VisibilityNotifier2DComponent* visibilityNotifierComponent = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    visibilityNotifierComponent->suspendWhenOffScreen = suspendWhenOffScreen;
+    cre_visibility_notifier_ec_system_refresh_notifier(entity);
+    cre_component_versions_mark_changed(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    py_newnone(py_retval());
+    return true;
+}
+
+bool cre_pkpy_api_visibility_notifier2d_is_on_screen(int argc, py_StackRef argv) {
+    PY_CHECK_ARGC(1);
+    PY_CHECK_ARG_TYPE(0, tp_int);
+    const py_i64 entityId = py_toint(py_arg(0));
+
+    const SkaEntity entity = (SkaEntity)entityId;
+    const VisibilityNotifier2DComponent* visibilityNotifierComponent = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    py_newbool(py_retval(), visibilityNotifierComponent->isOnScreen);
+    return true;
+}
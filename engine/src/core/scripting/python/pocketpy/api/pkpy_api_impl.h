@@ -55,7 +55,14 @@ bool cre_pkpy_api_input_mouse_get_world_position(int argc, py_StackRef argv);
 
 // Scene Tree
 bool cre_pkpy_api_scene_tree_change_scene(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_change_scene_async(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_get_async_load_progress(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_is_async_loading(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_set_async_load_frame_budget(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_set_paused(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_is_paused(int argc, py_StackRef argv);
 bool cre_pkpy_api_scene_tree_get_root(int argc, py_StackRef argv);
+bool cre_pkpy_api_scene_tree_get_nodes_in_group(int argc, py_StackRef argv);
 
 // Scene Manager
 bool cre_pkpy_api_scene_manager_process_queued_creation_entities(int argc, py_StackRef argv);
@@ -99,7 +106,12 @@ bool cre_pkpy_api_game_config_load(int argc, py_StackRef argv);
 
 // Packed Scene
 bool cre_pkpy_api_packed_scene_create_instance(int argc, py_StackRef argv);
+bool cre_pkpy_api_packed_scene_create_instances(int argc, py_StackRef argv);
+bool cre_pkpy_api_packed_scene_acquire(int argc, py_StackRef argv);
+bool cre_pkpy_api_packed_scene_get_pool_stats(int argc, py_StackRef argv);
 bool cre_pkpy_api_packed_scene_load(int argc, py_StackRef argv);
+bool cre_pkpy_api_packed_scene_get_cache_stats(int argc, py_StackRef argv);
+bool cre_pkpy_api_packed_scene_set_cache_memory_budget(int argc, py_StackRef argv);
 
 // Collision Handler
 bool cre_pkpy_api_collision_handler_process_collisions(int argc, py_StackRef argv);
@@ -115,19 +127,34 @@ bool cre_pkpy_api_server_send(int argc, py_StackRef argv);
 bool cre_pkpy_api_client_start(int argc, py_StackRef argv);
 bool cre_pkpy_api_client_stop(int argc, py_StackRef argv);
 bool cre_pkpy_api_client_send(int argc, py_StackRef argv);
+// Replay
+bool cre_pkpy_api_replay_seek(int argc, py_StackRef argv);
+bool cre_pkpy_api_replay_get_frame(int argc, py_StackRef argv);
+bool cre_pkpy_api_replay_get_frame_count(int argc, py_StackRef argv);
+bool cre_pkpy_api_replay_is_playing(int argc, py_StackRef argv);
+bool cre_pkpy_api_replay_get_stats(int argc, py_StackRef argv);
+bool cre_pkpy_api_replay_get_action_rollback_count(int argc, py_StackRef argv);
 
 // Node
 bool cre_pkpy_api_node_new(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_name(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_add_child(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_child(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_get_node(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_add_to_group(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_remove_from_group(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_is_in_group(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_children(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_parent(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_queue_deletion(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_is_queued_for_deletion(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_release_to_pool(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_set_time_dilation(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_time_dilation(int argc, py_StackRef argv);
 bool cre_pkpy_api_node_get_total_time_dilation(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_set_process_mode(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_get_process_mode(int argc, py_StackRef argv);
+bool cre_pkpy_api_node_can_process(int argc, py_StackRef argv);
 
 // Node2D
 bool cre_pkpy_api_node2d_set_position(int argc, py_StackRef argv);
@@ -219,3 +246,10 @@ bool cre_pkpy_api_particles2d_get_initial_velocity(int argc, py_StackRef argv);
 bool cre_pkpy_api_particles2d_set_initial_velocity(int argc, py_StackRef argv);
 bool cre_pkpy_api_particles2d_get_spread(int argc, py_StackRef argv);
 bool cre_pkpy_api_particles2d_set_spread(int argc, py_StackRef argv);
+
+// Visibility Notifier 2D
+bool cre_pkpy_api_visibility_notifier2d_get_rect(int argc, py_StackRef argv);
+bool cre_pkpy_api_visibility_notifier2d_set_rect(int argc, py_StackRef argv);
+bool cre_pkpy_api_visibility_notifier2d_get_suspend_when_off_screen(int argc, py_StackRef argv);
+bool cre_pkpy_api_visibility_notifier2d_set_suspend_when_off_screen(int argc, py_StackRef argv);
+bool cre_pkpy_api_visibility_notifier2d_is_on_screen(int argc, py_StackRef argv);
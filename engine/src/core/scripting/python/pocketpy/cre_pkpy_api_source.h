@@ -466,10 +466,12 @@
 "\n"\
 "\n"\
 "class InputAction:\n"\
-"    def __init__(self, name: str, values: list, device_id=0):\n"\
+"    def __init__(self, name: str, values: list, device_id=0, prediction=\"repeat_last\", input_delay=0):\n"\
 "        self.name = name\n"\
 "        self.values = values\n"\
 "        self.device_id = device_id\n"\
+"        self.prediction = prediction\n"\
+"        self.input_delay = input_delay\n"\
 "\n"\
 "\n"\
 "class AnimationFrame:\n"\
@@ -834,6 +836,15 @@
 "    Parallax = 128\n"\
 "    Particles2D = 256\n"\
 "    Tilemap = 512\n"\
+"    VisibilityNotifier2D = 1024\n"\
+"\n"\
+"\n"\
+"# Whether a node's '_process', '_fixed_process', animations and particles run, nodes are still drawn either way\n"\
+"class ProcessMode:\n"\
+"    INHERIT = 0  # Same as the parent, roots are pausable\n"\
+"    PAUSABLE = 1\n"\
+"    ALWAYS = 2  # Keeps running while the scene tree is paused\n"\
+"    DISABLED = 3\n"\
 "\n"\
 "\n"\
 "class NodeEventSubscriber:\n"\
@@ -901,6 +912,18 @@
 "    def get_child(self, child_name: str) -> Optional[\"Node\"]:\n"\
 "        return crescent_internal.node_get_child(self.entity_id, child_name)\n"\
 "\n"\
+"    def get_node(self, node_path: str) -> Optional[\"Node\"]:\n"\
+"        return crescent_internal.node_get_node(self.entity_id, node_path)\n"\
+"\n"\
+"    def add_to_group(self, group: str) -> None:\n"\
+"        crescent_internal.node_add_to_group(self.entity_id, group)\n"\
+"\n"\
+"    def remove_from_group(self, group: str) -> None:\n"\
+"        crescent_internal.node_remove_from_group(self.entity_id, group)\n"\
+"\n"\
+"    def is_in_group(self, group: str) -> bool:\n"\
+"        return crescent_internal.node_is_in_group(self.entity_id, group)\n"\
+"\n"\
 "    def get_children(self) -> List[\"Node\"]:\n"\
 "        return crescent_internal.node_get_children(self.entity_id)\n"\
 "\n"\
@@ -913,6 +936,10 @@
 "    def is_queued_for_deletion(self) -> bool:\n"\
 "        return crescent_internal.node_is_queued_for_deletion(self.entity_id)\n"\
 "\n"\
+"    # Only for nodes from 'PackedScene.acquire', returns the instance to its pool instead of deleting it\n"\
+"    def release_to_pool(self) -> bool:\n"\
+"        return crescent_internal.node_release_to_pool(self.entity_id)\n"\
+"\n"\
 "    def get_time_dilation(self) -> float:\n"\
 "        return crescent_internal.node_get_time_dilation(self.entity_id)\n"\
 "\n"\
@@ -930,6 +957,24 @@
 "    def get_total_time_dilation(self) -> float:\n"\
 "        return crescent_internal.node_get_total_time_dilation(self.entity_id)\n"\
 "\n"\
+"    def get_process_mode(self) -> int:\n"\
+"        return crescent_internal.node_get_process_mode(self.entity_id)\n"\
+"\n"\
+"    def set_process_mode(self, mode: int) -> None:\n"\
+"        crescent_internal.node_set_process_mode(self.entity_id, mode)\n"\
+"\n"\
+"    @property\n"\
+"    def process_mode(self) -> int:\n"\
+"        return crescent_internal.node_get_process_mode(self.entity_id)\n"\
+"\n"\
+"    @process_mode.setter\n"\
+"    def process_mode(self, value: int) -> None:\n"\
+"        crescent_internal.node_set_process_mode(self.entity_id, value)\n"\
+"\n"\
+"    # False while pooled, disabled or pausable and the scene tree is paused\n"\
+"    def can_process(self) -> bool:\n"\
+"        return crescent_internal.node_can_process(self.entity_id)\n"\
+"\n"\
 "    def __eq__(self, other: \"Node\") -> bool:\n"\
 "        return self.entity_id == other.entity_id\n"\
 "\n"\
@@ -1383,15 +1428,101 @@
 "        return crescent_internal.node_new(cls.__module__, cls.__name__, NodeType.Tilemap)\n"\
 "\n"\
 "\n"\
+"# Tests its rect (relative to the node's global position) against the camera every frame.  When 'suspend_when_off_screen'\n"\
+"# is set the node and its children stop processing while the rect is off screen.\n"\
+"class VisibilityNotifier2D(Node2D):\n"\
+"\n"\
+"    def __init__(self, entity_id: int) -> None:\n"\
+"        super().__init__(entity_id)\n"\
+"        self.screen_entered = NodeEvent(self)\n"\
+"        self.screen_exited = NodeEvent(self)\n"\
+"\n"\
+"    @classmethod\n"\
+"    def new(cls) -> \"VisibilityNotifier2D\":\n"\
+"        return crescent_internal.node_new(cls.__module__, cls.__name__, NodeType.VisibilityNotifier2D)\n"\
+"\n"\
+"    @property\n"\
+"    def rect(self) -> Rect2:\n"\
+"        x, y, w, h = crescent_internal.visibility_notifier2d_get_rect(self.entity_id)\n"\
+"        return Rect2(x=x, y=y, w=w, h=h)\n"\
+"\n"\
+"    @rect.setter\n"\
+"    def rect(self, value: Rect2) -> None:\n"\
+"        crescent_internal.visibility_notifier2d_set_rect(self.entity_id, float(value.x), float(value.y), float(value.w), float(value.h))\n"\
+"\n"\
+"    @property\n"\
+"    def suspend_when_off_screen(self) -> bool:\n"\
+"        return crescent_internal.visibility_notifier2d_get_suspend_when_off_screen(self.entity_id)\n"\
+"\n"\
+"    @suspend_when_off_screen.setter\n"\
+"    def suspend_when_off_screen(self, value: bool) -> None:\n"\
+"        crescent_internal.visibility_notifier2d_set_suspend_when_off_screen(self.entity_id, value)\n"\
+"\n"\
+"    def is_on_screen(self) -> bool:\n"\
+"        return crescent_internal.visibility_notifier2d_is_on_screen(self.entity_id)\n"\
+"\n"\
+"\n"\
 "class SceneTree:\n"\
+"    _on_async_scene_loaded_func: Optional[Callable[[], None]] = None\n"\
+"\n"\
 "    @staticmethod\n"\
 "    def change_scene(path: str) -> None:\n"\
 "        crescent_internal.scene_tree_change_scene(path)\n"\
 "\n"\
+"    # Loads the scene in the background while the current scene keeps running, then changes to it once fully loaded\n"\
+"    # Returns False if a scene change is already in progress\n"\
+"    @staticmethod\n"\
+"    def change_scene_async(path: str, on_loaded: Optional[Callable[[], None]] = None) -> bool:\n"\
+"        if crescent_internal.scene_tree_change_scene_async(path):\n"\
+"            SceneTree._on_async_scene_loaded_func = on_loaded\n"\
+"            return True\n"\
+"        return False\n"\
+"\n"\
+"    # From 0.0 to 1.0, 1.0 if there is no scene loading\n"\
+"    @staticmethod\n"\
+"    def get_async_load_progress() -> float:\n"\
+"        return crescent_internal.scene_tree_get_async_load_progress()\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def is_async_loading() -> bool:\n"\
+"        return crescent_internal.scene_tree_is_async_loading()\n"\
+"\n"\
+"    # Max time spent creating nodes of the loading scene each frame\n"\
+"    @staticmethod\n"\
+"    def set_async_load_frame_budget(budget_ms: float) -> None:\n"\
+"        crescent_internal.scene_tree_set_async_load_frame_budget(float(budget_ms))\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def _on_async_scene_loaded() -> None:\n"\
+"        on_loaded_func = SceneTree._on_async_scene_loaded_func\n"\
+"        SceneTree._on_async_scene_loaded_func = None\n"\
+"        if on_loaded_func:\n"\
+"            on_loaded_func()\n"\
+"\n"\
+"    # Pausable nodes stop processing until the tree is unpaused, see 'ProcessMode'\n"\
+"    @staticmethod\n"\
+"    def set_paused(paused: bool) -> None:\n"\
+"        crescent_internal.scene_tree_set_paused(paused)\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def is_paused() -> bool:\n"\
+"        return crescent_internal.scene_tree_is_paused()\n"\
+"\n"\
 "    @staticmethod\n"\
 "    def get_root() -> Optional[Node]:\n"\
 "        return crescent_internal.scene_tree_get_root()\n"\
 "\n"\
+"    @staticmethod\n"\
+"    def get_nodes_in_group(group: str) -> List[Node]:\n"\
+"        return crescent_internal.scene_tree_get_nodes_in_group(group)\n"\
+"\n"\
+"    # Calls the method on every node in the group that has it\n"\
+"    @staticmethod\n"\
+"    def call_group(group: str, method_name: str, *args) -> None:\n"\
+"        for node in crescent_internal.scene_tree_get_nodes_in_group(group):\n"\
+"            if hasattr(node, method_name):\n"\
+"                getattr(node, method_name)(*args)\n"\
+"\n"\
 "\n"\
 "class World:\n"\
 "    @staticmethod\n"\
@@ -1562,6 +1693,36 @@
 "        return json_dict\n"\
 "\n"\
 "\n"\
+"class SceneCacheStats:\n"\
+"    def __init__(self, hits: int, misses: int, evictions: int, resident_count: int, memory_used: int, memory_budget: int):\n"\
+"        self.hits = hits\n"\
+"        self.misses = misses\n"\
+"        self.evictions = evictions\n"\
+"        self.resident_count = resident_count\n"\
+"        self.memory_used = memory_used\n"\
+"        self.memory_budget = memory_budget\n"\
+"\n"\
+"    def __str__(self):\n"\
+"        return f\"SceneCacheStats(hits: {self.hits}, misses: {self.misses}, evictions: {self.evictions}, resident_count: {self.resident_count}, memory_used: {self.memory_used}, memory_budget: {self.memory_budget})\"\n"\
+"\n"\
+"    def __repr__(self):\n"\
+"        return f\"SceneCacheStats(hits: {self.hits}, misses: {self.misses}, evictions: {self.evictions}, resident_count: {self.resident_count}, memory_used: {self.memory_used}, memory_budget: {self.memory_budget})\"\n"\
+"\n"\
+"\n"\
+"class NodePoolStats:\n"\
+"    def __init__(self, active_count: int, idle_count: int, created_count: int, reused_count: int):\n"\
+"        self.active_count = active_count\n"\
+"        self.idle_count = idle_count\n"\
+"        self.created_count = created_count\n"\
+"        self.reused_count = reused_count\n"\
+"\n"\
+"    def __str__(self):\n"\
+"        return f\"NodePoolStats(active_count: {self.active_count}, idle_count: {self.idle_count}, created_count: {self.created_count}, reused_count: {self.reused_count})\"\n"\
+"\n"\
+"    def __repr__(self):\n"\
+"        return f\"NodePoolStats(active_count: {self.active_count}, idle_count: {self.idle_count}, created_count: {self.created_count}, reused_count: {self.reused_count})\"\n"\
+"\n"\
+"\n"\
 "class PackedScene:\n"\
 "    def __init__(self, scene_cache_id: int, path: str):\n"\
 "        self.scene_cache_id = scene_cache_id\n"\
@@ -1570,6 +1731,20 @@
 "    def create_instance(self) -> Node:\n"\
 "        return crescent_internal.packed_scene_create_instance(self.scene_cache_id)\n"\
 "\n"\
+"    # Creates 'count' instances at once, cheaper than calling 'create_instance' in a loop (e.g. spawning projectiles)\n"\
+"    # If 'positions' are passed there must be one for each instance\n"\
+"    def create_instances(self, count: int, positions: Optional[List[Vector2]] = None) -> List[Node]:\n"\
+"        return crescent_internal.packed_scene_create_instances(self.scene_cache_id, count, positions if positions else [])\n"\
+"\n"\
+"    # Reuses an instance released with 'Node.release_to_pool' if there is one, reset to the scene's values but keeping its\n"\
+"    # script state ('_start' is only called once per instance).  Add it as a child like a new instance\n"\
+"    def acquire(self) -> Node:\n"\
+"        return crescent_internal.packed_scene_acquire(self.scene_cache_id)\n"\
+"\n"\
+"    def get_pool_stats(self) -> NodePoolStats:\n"\
+"        active_count, idle_count, created_count, reused_count = crescent_internal.packed_scene_get_pool_stats(self.scene_cache_id)\n"\
+"        return NodePoolStats(active_count, idle_count, created_count, reused_count)\n"\
+"\n"\
 "    @staticmethod\n"\
 "    def load(path: str) -> Optional[\"PackedScene\"]:\n"\
 "        scene_cache_id = crescent_internal.packed_scene_load(path)\n"\
@@ -1577,6 +1752,16 @@
 "            return None\n"\
 "        return PackedScene(scene_cache_id, path)\n"\
 "\n"\
+"    # Scene templates are shared by scene changes and packed scenes, least recently used ones are evicted past the memory budget\n"\
+"    @staticmethod\n"\
+"    def get_cache_stats() -> SceneCacheStats:\n"\
+"        hits, misses, evictions, resident_count, memory_used, memory_budget = crescent_internal.packed_scene_get_cache_stats()\n"\
+"        return SceneCacheStats(hits, misses, evictions, resident_count, memory_used, memory_budget)\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def set_cache_memory_budget(memory_budget: int) -> None:\n"\
+"        crescent_internal.packed_scene_set_cache_memory_budget(memory_budget)\n"\
+"\n"\
 "\n"\
 "class Network:\n"\
 "    @staticmethod\n"\
@@ -1618,5 +1803,50 @@
 "    @staticmethod\n"\
 "    def subscribe(event_name: str, listener_node: Node, listener_func: Callable) -> None:\n"\
 "        _node_event_manager.subscribe_to_event(-100, event_name, listener_node.entity_id, listener_func)\n"\
+"\n"\
+"\n"\
+"class ReplayStats:\n"\
+"    def __init__(self, keyframe_count: int, snapshot_memory_bytes: int, last_seek_frames_simulated: int, last_seek_time_ms: int, rollback_count: int, rollback_frames_resimulated: int):\n"\
+"        self.keyframe_count = keyframe_count\n"\
+"        self.snapshot_memory_bytes = snapshot_memory_bytes\n"\
+"        self.last_seek_frames_simulated = last_seek_frames_simulated\n"\
+"        self.last_seek_time_ms = last_seek_time_ms\n"\
+"        self.rollback_count = rollback_count\n"\
+"        self.rollback_frames_resimulated = rollback_frames_resimulated\n"\
+"\n"\
+"    def __str__(self):\n"\
+"        return f\"ReplayStats(keyframe_count: {self.keyframe_count}, snapshot_memory_bytes: {self.snapshot_memory_bytes}, last_seek_frames_simulated: {self.last_seek_frames_simulated}, last_seek_time_ms: {self.last_seek_time_ms}, rollback_count: {self.rollback_count}, rollback_frames_resimulated: {self.rollback_frames_resimulated})\"\n"\
+"\n"\
+"    def __repr__(self):\n"\
+"        return f\"ReplayStats(keyframe_count: {self.keyframe_count}, snapshot_memory_bytes: {self.snapshot_memory_bytes}, last_seek_frames_simulated: {self.last_seek_frames_simulated}, last_seek_time_ms: {self.last_seek_time_ms}, rollback_count: {self.rollback_count}, rollback_frames_resimulated: {self.rollback_frames_resimulated})\"\n"\
+"\n"\
+"\n"\
+"class Replay:\n"\
+"    # Seeks are processed at the start of the next frame, returns False if no replay is being played back\n"\
+"    @staticmethod\n"\
+"    def seek(frame: int) -> bool:\n"\
+"        return crescent_internal.replay_seek(frame)\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def get_frame() -> int:\n"\
+"        return crescent_internal.replay_get_frame()\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def get_frame_count() -> int:\n"\
+"        return crescent_internal.replay_get_frame_count()\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def is_playing() -> bool:\n"\
+"        return crescent_internal.replay_is_playing()\n"\
+"\n"\
+"    @staticmethod\n"\
+"    def get_stats() -> ReplayStats:\n"\
+"        keyframe_count, snapshot_memory_bytes, last_seek_frames_simulated, last_seek_time_ms, rollback_count, rollback_frames_resimulated = crescent_internal.replay_get_stats()\n"\
+"        return ReplayStats(keyframe_count, snapshot_memory_bytes, last_seek_frames_simulated, last_seek_time_ms, rollback_count, rollback_frames_resimulated)\n"\
+"\n"\
+"    # Rollbacks caused by mispredicting the action during stream playback, for tuning its 'prediction' policy\n"\
+"    @staticmethod\n"\
+"    def get_action_rollback_count(name: str) -> int:\n"\
+"        return crescent_internal.replay_get_action_rollback_count(name)\n"\
 "\n"
 
@@ -3,26 +3,28 @@
 #include <stdio.h>
 
 #include <seika/logger.h>
+#include <seika/string.h>
 #include <seika/ecs/component.h>
 
 #include "cre_pkpy.h"
 #include "pkpy_util.h"
 #include "core/scripting/script_context.h"
 #include "core/ecs/ecs_globals.h"
+#include "core/ecs/component_pool.h"
 #include "core/ecs/components/node_component.h"
 #include "core/ecs/components/script_component.h"
+#include "core/utils/entity_paged_array.h"
 
-typedef struct CreEntityInstanceCache {
-    py_Ref instances[SKA_MAX_ENTITIES];
-} CreEntityInstanceCache;
-
-static CreEntityInstanceCache entityInstanceCache = {0};
+// Entity to its 'py_Ref' instance, NULL if the entity doesn't have one
+static CreEntityPagedArray entityInstances = { .elementSize = sizeof(py_Ref) };
 static char entityCacheStringBuffer[48];
 
-void cre_pkpy_instance_cache_init() {}
+void cre_pkpy_instance_cache_init() {
+    cre_entity_paged_array_initialize(&entityInstances, sizeof(py_Ref), NULL);
+}
 
 void cre_pkpy_instance_cache_finalize() {
-    memset(entityInstanceCache.instances, 0, sizeof(entityInstanceCache.instances));
+    cre_entity_paged_array_finalize(&entityInstances);
 }
 
 py_Ref cre_pkpy_instance_cache_add(SkaEntity entity,const char* classPath, const char* className) {
@@ -44,7 +46,7 @@ py_Ref cre_pkpy_instance_cache_add(SkaEntity entity,const char* classPath, const
     PY_ASSERT_NO_EXC();
 
     SKA_ASSERT_FMT(instanceRef, "Unable to create instance from '%s.%s'!", classPath, className);
-    entityInstanceCache.instances[entity] = instanceRef;
+    *(py_Ref*)cre_entity_paged_array_get_or_create(&entityInstances, entity) = instanceRef;
 
     return instanceRef;
 }
@@ -64,18 +66,21 @@ py_Ref cre_pkpy_instance_cache_add2(SkaEntity entity) {
         // Since that is the case, just create a script component so that we can clean up within the script context when the entity
         // needs to leave the instance cache.
         const char* baseClassName = node_get_base_type_string(nodeComponent->type);
-        scriptComponent = script_component_create_ex(CRE_PKPY_MODULE_NAME_CRESCENT, baseClassName, CreScriptContextType_PYTHON);
+        scriptComponent = (ScriptComponent*)cre_component_pool_create(SCRIPT_COMPONENT_INDEX);
+        ska_strcpy(scriptComponent->classPath, CRE_PKPY_MODULE_NAME_CRESCENT);
+        ska_strcpy(scriptComponent->className, baseClassName);
+        scriptComponent->contextType = CreScriptContextType_PYTHON;
         ska_ecs_component_manager_set_component(entity, SCRIPT_COMPONENT_INDEX, scriptComponent);
     }
     return cre_pkpy_instance_cache_add(entity, scriptComponent->classPath, scriptComponent->className);
 }
 
 void cre_pkpy_instance_cache_remove(SkaEntity entity) {
-    if (entityInstanceCache.instances[entity]) {
+    if (cre_pkpy_instance_cache_has(entity)) {
         snprintf(entityCacheStringBuffer, sizeof(entityCacheStringBuffer), "_e_%u", entity);
         py_setglobal(py_name(entityCacheStringBuffer), py_None);
         PY_ASSERT_NO_EXC();
-        entityInstanceCache.instances[entity] = NULL;
+        cre_entity_paged_array_release(&entityInstances, entity);
     }
 }
 
@@ -92,5 +97,6 @@ py_Ref cre_pkpy_instance_cache_get_checked(SkaEntity entity) {
 }
 
 bool cre_pkpy_instance_cache_has(SkaEntity entity) {
-    return entityInstanceCache.instances[entity] != NULL;
+    const py_Ref* instance = (py_Ref*)cre_entity_paged_array_get(&entityInstances, entity);
+    return instance != NULL && *instance != NULL;
 }
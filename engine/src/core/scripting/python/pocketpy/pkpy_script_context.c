@@ -6,11 +6,12 @@
 
 #include <seika/logger.h>
 #include <seika/asset/asset_file_loader.h>
-#include <seika/data_structures/array_utils.h>
 
 #include "pkpy_util.h"
 #include "pkpy_instance_cache.h"
 #include "api/pkpy_api.h"
+#include "../../../ecs/ecs_globals.h"
+#include "../../../ecs/components/visibility_notifier2d_component.h"
 
 static CREScriptContext* scriptContext = NULL;
 static py_Name startFunctionName;
@@ -31,7 +32,11 @@ static void pkpy_on_end(SkaEntity entity);
 static void pkpy_on_update(SkaEntity entity, f32 deltaTime);
 static void pkpy_on_fixed_update(SkaEntity entity, f32 deltaTime);
 static void pkpy_network_callback(const char* message);
+static void pkpy_on_screen_entered(SkaSubjectNotifyPayload* payload);
+static void pkpy_on_screen_exited(SkaSubjectNotifyPayload* payload);
 
+static SkaObserver onScreenEnteredObserver = { .on_notify = pkpy_on_screen_entered };
+static SkaObserver onScreenExitedObserver = { .on_notify = pkpy_on_screen_exited };
 
 CREScriptContextTemplate cre_pkpy_get_script_context_template() {
     return (CREScriptContextTemplate) {
@@ -79,12 +84,12 @@ void pkpy_create_instance(SkaEntity entity, const char* classPath, const char* c
     if (cre_pkpy_instance_cache_has(entity)) { return; }
     py_Ref newInstance = cre_pkpy_instance_cache_add(entity, classPath, className);
     if (py_getattr(newInstance, processFunctionName)) {
-        scriptContext->updateEntities[scriptContext->updateEntityCount++] = entity;
+        cre_script_context_add_update_entity(scriptContext, entity);
     } else {
         py_clearexc(NULL);
     }
     if (py_getattr(newInstance, fixedProcessFunctionName)) {
-        scriptContext->fixedUpdateEntities[scriptContext->fixedUpdateEntityCount++] = entity;
+        cre_script_context_add_fixed_update_entity(scriptContext, entity);
     } else {
         py_clearexc(NULL);
     }
@@ -92,18 +97,7 @@ void pkpy_create_instance(SkaEntity entity, const char* classPath, const char* c
 
 void pkpy_delete_instance(SkaEntity entity) {
     cre_pkpy_instance_cache_remove(entity);
-    ska_array_utils_remove_item_uint32(
-        scriptContext->updateEntities,
-        &scriptContext->updateEntityCount,
-        entity,
-        SKA_NULL_ENTITY
-    );
-    ska_array_utils_remove_item_uint32(
-        scriptContext->fixedUpdateEntities,
-        &scriptContext->fixedUpdateEntityCount,
-        entity,
-        SKA_NULL_ENTITY
-    );
+    cre_script_context_remove_entity(scriptContext, entity);
 }
 
 static void broadcast_internal_event(SkaEntity entity, py_Ref self, const char* eventName) {
@@ -123,6 +117,12 @@ void pkpy_on_start(SkaEntity entity) {
     } else {
         py_clearexc(NULL);
     }
+    // Forward visibility notifier events to the python node's 'screen_entered' and 'screen_exited' events
+    VisibilityNotifier2DComponent* visibilityNotifierComp = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    if (visibilityNotifierComp != NULL) {
+        ska_event_register_observer(&visibilityNotifierComp->onScreenEntered, &onScreenEnteredObserver);
+        ska_event_register_observer(&visibilityNotifierComp->onScreenExited, &onScreenExitedObserver);
+    }
     broadcast_internal_event(entity, self, "scene_entered");
 }
 
@@ -136,6 +136,11 @@ void pkpy_on_end(SkaEntity entity) {
     } else {
         py_clearexc(NULL);
     }
+    VisibilityNotifier2DComponent* visibilityNotifierComp = (VisibilityNotifier2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, VISIBILITY_NOTIFIER2D_COMPONENT_INDEX);
+    if (visibilityNotifierComp != NULL) {
+        ska_event_unregister_observer(&visibilityNotifierComp->onScreenEntered, &onScreenEnteredObserver);
+        ska_event_unregister_observer(&visibilityNotifierComp->onScreenExited, &onScreenExitedObserver);
+    }
     broadcast_internal_event(entity, self, "scene_exited");
 }
 
@@ -171,6 +176,20 @@ void pkpy_on_fixed_update(SkaEntity entity, f32 deltaTime) {
     }
 }
 
+void pkpy_on_screen_entered(SkaSubjectNotifyPayload* payload) {
+    const SkaEntity entity = *(SkaEntity*)payload->data;
+    if (cre_pkpy_instance_cache_has(entity)) {
+        broadcast_internal_event(entity, cre_pkpy_instance_cache_get(entity), "screen_entered");
+    }
+}
+
+void pkpy_on_screen_exited(SkaSubjectNotifyPayload* payload) {
+    const SkaEntity entity = *(SkaEntity*)payload->data;
+    if (cre_pkpy_instance_cache_has(entity)) {
+        broadcast_internal_event(entity, cre_pkpy_instance_cache_get(entity), "screen_exited");
+    }
+}
+
 void pkpy_network_callback(const char* message) {
     SKA_ASSERT_FMT(false, "TODO: Implement!");
 }
@@ -1,6 +1,10 @@
 #include "script_context.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #include <seika/memory.h>
+#include <seika/assert.h>
 
 CREScriptContext* cre_script_context_create() {
     return SKA_ALLOC_ZEROED(CREScriptContext);
@@ -23,5 +27,65 @@ CREScriptContext* cre_script_context_create_from_template(const CREScriptContext
 }
 
 void cre_script_context_destroy(CREScriptContext* scriptContext) {
+    free(scriptContext->updateEntities);
+    free(scriptContext->fixedUpdateEntities);
+    free(scriptContext->parkedUpdateEntities);
+    free(scriptContext->parkedFixedUpdateEntities);
     SKA_FREE(scriptContext);
 }
+
+static void script_context_push_entity(SkaEntity** entities, size_t* count, size_t* capacity, SkaEntity entity) {
+    if (*count >= *capacity) {
+        *capacity = *capacity > 0 ? *capacity * 2 : 64;
+        *entities = (SkaEntity*)realloc(*entities, sizeof(SkaEntity) * *capacity);
+        SKA_ASSERT(*entities);
+    }
+    (*entities)[(*count)++] = entity;
+}
+
+void cre_script_context_add_update_entity(CREScriptContext* scriptContext, SkaEntity entity) {
+    script_context_push_entity(&scriptContext->updateEntities, &scriptContext->updateEntityCount, &scriptContext->updateEntityCapacity, entity);
+}
+
+void cre_script_context_add_fixed_update_entity(CREScriptContext* scriptContext, SkaEntity entity) {
+    script_context_push_entity(&scriptContext->fixedUpdateEntities, &scriptContext->fixedUpdateEntityCount, &scriptContext->fixedUpdateEntityCapacity, entity);
+}
+
+// Shifts the entities after it down to keep update order, returns false if the entity isn't in the list
+static bool script_context_remove_entity(SkaEntity* entities, size_t* count, SkaEntity entity) {
+    for (size_t i = 0; i < *count; i++) {
+        if (entities[i] == entity) {
+            memmove(&entities[i], &entities[i + 1], sizeof(SkaEntity) * (*count - i - 1));
+            (*count)--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void cre_script_context_remove_entity(CREScriptContext* scriptContext, SkaEntity entity) {
+    if (!script_context_remove_entity(scriptContext->updateEntities, &scriptContext->updateEntityCount, entity)) {
+        script_context_remove_entity(scriptContext->parkedUpdateEntities, &scriptContext->parkedUpdateEntityCount, entity);
+    }
+    if (!script_context_remove_entity(scriptContext->fixedUpdateEntities, &scriptContext->fixedUpdateEntityCount, entity)) {
+        script_context_remove_entity(scriptContext->parkedFixedUpdateEntities, &scriptContext->parkedFixedUpdateEntityCount, entity);
+    }
+}
+
+void cre_script_context_set_entity_update_enabled(CREScriptContext* scriptContext, SkaEntity entity, bool enabled) {
+    if (enabled) {
+        if (script_context_remove_entity(scriptContext->parkedUpdateEntities, &scriptContext->parkedUpdateEntityCount, entity)) {
+            cre_script_context_add_update_entity(scriptContext, entity);
+        }
+        if (script_context_remove_entity(scriptContext->parkedFixedUpdateEntities, &scriptContext->parkedFixedUpdateEntityCount, entity)) {
+            cre_script_context_add_fixed_update_entity(scriptContext, entity);
+        }
+    } else {
+        if (script_context_remove_entity(scriptContext->updateEntities, &scriptContext->updateEntityCount, entity)) {
+            script_context_push_entity(&scriptContext->parkedUpdateEntities, &scriptContext->parkedUpdateEntityCount, &scriptContext->parkedUpdateEntityCapacity, entity);
+        }
+        if (script_context_remove_entity(scriptContext->fixedUpdateEntities, &scriptContext->fixedUpdateEntityCount, entity)) {
+            script_context_push_entity(&scriptContext->parkedFixedUpdateEntities, &scriptContext->parkedFixedUpdateEntityCount, &scriptContext->parkedFixedUpdateEntityCapacity, entity);
+        }
+    }
+}
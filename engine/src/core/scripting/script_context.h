@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdbool.h>
 
 #include <seika/ecs/entity.h>
 
@@ -56,11 +57,20 @@ typedef struct CREScriptContext {
     OnNetworkCallback on_network_callback;
     // We could have a validation step on the script contexts to check if the update, fixed_update, etc... funcs exists
     // in the class within the scripting language.  For now, the script context is responsible for entity and entity count
-    // even though it's not used in the script ec system
+    // even though it's not used in the script ec system.  The lists grow as entities are added to them.
     size_t updateEntityCount;
     size_t fixedUpdateEntityCount;
-    SkaEntity updateEntities[SKA_MAX_ENTITIES];
-    SkaEntity fixedUpdateEntities[SKA_MAX_ENTITIES];
+    size_t updateEntityCapacity;
+    size_t fixedUpdateEntityCapacity;
+    SkaEntity* updateEntities;
+    SkaEntity* fixedUpdateEntities;
+    // Entities of disabled nodes are parked here instead of being iterated (see 'cre_script_context_set_entity_update_enabled')
+    size_t parkedUpdateEntityCount;
+    size_t parkedFixedUpdateEntityCount;
+    size_t parkedUpdateEntityCapacity;
+    size_t parkedFixedUpdateEntityCapacity;
+    SkaEntity* parkedUpdateEntities;
+    SkaEntity* parkedFixedUpdateEntities;
 } CREScriptContext;
 
 typedef void (*OnScriptContextInit) (struct CREScriptContext*);
@@ -84,6 +94,12 @@ typedef struct CREScriptContextTemplate {
 CREScriptContext* cre_script_context_create();
 CREScriptContext* cre_script_context_create_from_template(const CREScriptContextTemplate* temp);
 void cre_script_context_destroy(CREScriptContext* scriptContext);
+void cre_script_context_add_update_entity(CREScriptContext* scriptContext, SkaEntity entity);
+void cre_script_context_add_fixed_update_entity(CREScriptContext* scriptContext, SkaEntity entity);
+// Removes the entity from the update lists, parked or not
+void cre_script_context_remove_entity(CREScriptContext* scriptContext, SkaEntity entity);
+// Moves the entity between the update lists and the parked lists, entities not in either are ignored
+void cre_script_context_set_entity_update_enabled(CREScriptContext* scriptContext, SkaEntity entity, bool enabled);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,135 @@
+#include "snapshot_delta.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/memory.h>
+#include <seika/assert.h>
+
+#define CRE_SNAPSHOT_DELTA_MAX_RUN 0xFFFF
+// Zero runs shorter than this are cheaper to keep inside a literal run than to start a new token
+#define CRE_SNAPSHOT_DELTA_MIN_ZERO_RUN 4
+
+static void delta_reserve(CreSnapshotDelta* delta, size_t additionalSize);
+static void delta_write_u16(CreSnapshotDelta* delta, uint16 value);
+static uint16 delta_read_u16(const uint8* data);
+
+static inline uint8 delta_get_base_byte(const CreWorldSnapshot* base, size_t index) {
+    return base != NULL && index < base->size ? base->data[index] : 0;
+}
+
+CreSnapshotDelta* cre_snapshot_delta_create() {
+    CreSnapshotDelta* delta = SKA_ALLOC_ZEROED(CreSnapshotDelta);
+    return delta;
+}
+
+void cre_snapshot_delta_delete(CreSnapshotDelta* delta) {
+    free(delta->data);
+    SKA_FREE(delta);
+}
+
+void cre_snapshot_delta_encode(CreSnapshotDelta* delta, const CreWorldSnapshot* base, const CreWorldSnapshot* current) {
+    delta->size = 0;
+    delta->decodedSize = current->size;
+    delta->frame = current->frame;
+    delta->baseFrame = base != NULL ? base->frame : 0;
+    delta->entityCount = current->entityCount;
+    delta->randomState = current->randomState;
+
+    const size_t totalSize = current->size;
+    size_t index = 0;
+    while (index < totalSize) {
+        // Zero run (bytes equal to base)
+        size_t zeroCount = 0;
+        while (index + zeroCount < totalSize && zeroCount < CRE_SNAPSHOT_DELTA_MAX_RUN
+            && (current->data[index + zeroCount] ^ delta_get_base_byte(base, index + zeroCount)) == 0) {
+            zeroCount++;
+        }
+        index += zeroCount;
+        // Literal run, ends once a long enough zero run is found
+        const size_t literalStart = index;
+        size_t literalCount = 0;
+        size_t pendingZeroes = 0;
+        while (index + literalCount < totalSize && literalCount < CRE_SNAPSHOT_DELTA_MAX_RUN) {
+            const uint8 diff = current->data[index + literalCount] ^ delta_get_base_byte(base, index + literalCount);
+            pendingZeroes = diff == 0 ? pendingZeroes + 1 : 0;
+            literalCount++;
+            if (pendingZeroes >= CRE_SNAPSHOT_DELTA_MIN_ZERO_RUN) {
+                literalCount -= pendingZeroes;
+                break;
+            }
+        }
+        delta_write_u16(delta, (uint16)zeroCount);
+        delta_write_u16(delta, (uint16)literalCount);
+        delta_reserve(delta, literalCount);
+        for (size_t i = 0; i < literalCount; i++) {
+            delta->data[delta->size + i] = current->data[literalStart + i] ^ delta_get_base_byte(base, literalStart + i);
+        }
+        delta->size += literalCount;
+        index += literalCount;
+    }
+}
+
+bool cre_snapshot_delta_decode(const CreSnapshotDelta* delta, const CreWorldSnapshot* base, CreWorldSnapshot* dest) {
+    SKA_ASSERT(base != dest);
+    cre_world_snapshot_resize(dest, delta->decodedSize);
+    const size_t baseCopySize = base != NULL ? (base->size < delta->decodedSize ? base->size : delta->decodedSize) : 0;
+    if (baseCopySize > 0) {
+        memcpy(dest->data, base->data, baseCopySize);
+    }
+    if (baseCopySize < delta->decodedSize) {
+        memset(dest->data + baseCopySize, 0, delta->decodedSize - baseCopySize);
+    }
+
+    // Deltas can come from the network, so runs are checked against both buffers before touching them
+    size_t readIndex = 0;
+    size_t writeIndex = 0;
+    while (readIndex < delta->size) {
+        if (readIndex + sizeof(uint16) * 2 > delta->size) {
+            return false;
+        }
+        const uint16 zeroCount = delta_read_u16(delta->data + readIndex);
+        const uint16 literalCount = delta_read_u16(delta->data + readIndex + sizeof(uint16));
+        readIndex += sizeof(uint16) * 2;
+        if (readIndex + literalCount > delta->size || writeIndex + zeroCount + literalCount > dest->size) {
+            return false;
+        }
+        writeIndex += zeroCount;
+        for (uint16 i = 0; i < literalCount; i++) {
+            dest->data[writeIndex + i] ^= delta->data[readIndex + i];
+        }
+        readIndex += literalCount;
+        writeIndex += literalCount;
+    }
+    dest->frame = delta->frame;
+    dest->entityCount = delta->entityCount;
+    dest->randomState = delta->randomState;
+    return true;
+}
+
+void delta_reserve(CreSnapshotDelta* delta, size_t additionalSize) {
+    const size_t requiredCapacity = delta->size + additionalSize;
+    if (requiredCapacity <= delta->capacity) {
+        return;
+    }
+    size_t newCapacity = delta->capacity > 0 ? delta->capacity : 256;
+    while (newCapacity < requiredCapacity) {
+        newCapacity *= 2;
+    }
+    uint8* newData = (uint8*)realloc(delta->data, newCapacity);
+    SKA_ASSERT_FMT(newData, "Failed to allocate '%zu' bytes for snapshot delta!", newCapacity);
+    delta->data = newData;
+    delta->capacity = newCapacity;
+}
+
+void delta_write_u16(CreSnapshotDelta* delta, uint16 value) {
+    delta_reserve(delta, sizeof(uint16));
+    memcpy(delta->data + delta->size, &value, sizeof(uint16));
+    delta->size += sizeof(uint16);
+}
+
+uint16 delta_read_u16(const uint8* data) {
+    uint16 value;
+    memcpy(&value, data, sizeof(uint16));
+    return value;
+}
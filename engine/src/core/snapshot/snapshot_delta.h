@@ -0,0 +1,37 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+#include "world_snapshot.h"
+
+// Delta encoded world snapshot.  The snapshot bytes are XOR'd against a base snapshot so unchanged component state
+// becomes zero, then zero runs are run-length encoded as a list of [uint16 zeroCount][uint16 literalCount][literals...]
+
+typedef struct CreSnapshotDelta {
+    uint8* data;
+    size_t size;
+    size_t capacity;
+    size_t decodedSize;
+    uint32 frame;
+    uint32 baseFrame;
+    uint32 entityCount;
+    uint32 randomState;
+} CreSnapshotDelta;
+
+CreSnapshotDelta* cre_snapshot_delta_create();
+void cre_snapshot_delta_delete(CreSnapshotDelta* delta);
+// 'base' can be NULL to encode against all zeroes
+void cre_snapshot_delta_encode(CreSnapshotDelta* delta, const CreWorldSnapshot* base, const CreWorldSnapshot* current);
+// Rebuilds the snapshot encoded in 'delta' into 'dest', 'base' must be the same snapshot used to encode.
+// Returns false if the delta is malformed, 'dest' is left with undefined contents in that case.
+bool cre_snapshot_delta_decode(const CreSnapshotDelta* delta, const CreWorldSnapshot* base, CreWorldSnapshot* dest);
+
+#ifdef __cplusplus
+}
+#endif
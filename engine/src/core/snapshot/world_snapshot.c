@@ -0,0 +1,464 @@
+#include "world_snapshot.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/memory.h>
+#include <seika/assert.h>
+#include <seika/ecs/ecs.h>
+
+#include "../ecs/ecs_globals.h"
+#include "../ecs/component_versions.h"
+#include "../ecs/components/animated_sprite_component.h"
+#include "../ecs/components/collider2d_component.h"
+#include "../ecs/components/color_rect_component.h"
+#include "../ecs/components/node_component.h"
+#include "../ecs/components/parallax_component.h"
+#include "../ecs/components/particles2d_component.h"
+#include "../ecs/components/sprite_component.h"
+#include "../ecs/components/text_label_component.h"
+#include "../ecs/components/transform2d_component.h"
+#include "../math/random.h"
+#include "../scene/scene_manager.h"
+
+#define CRE_WORLD_SNAPSHOT_INITIAL_CAPACITY 4096
+
+#define CRE_WORLD_SNAPSHOT_CHECKSUM_SEED 0xCBF29CE484222325ull
+#define CRE_WORLD_SNAPSHOT_CHECKSUM_PRIME 0x100000001B3ull
+
+typedef void (*CreSnapshotWriteStateFunc)(const void* component, uint8* outState);
+typedef void (*CreSnapshotReadStateFunc)(void* component, const uint8* state);
+typedef uint64 (*CreSnapshotChecksumFunc)(uint64 hash, const uint8* state);
+typedef bool (*CreSnapshotValidateStateFunc)(const uint8* state);
+
+// Describes which part of a component is considered rollback state.  Snapshots are sent over the network and compared
+// between peers, so asset pointers (textures, fonts) and other addresses are never part of it, restored components keep
+// the ones they already have.
+typedef struct CreSnapshotComponentLayout {
+    SkaComponentIndex* index;
+    // Copied as is from 'stateOffset', unless the component has pointers in between its state and provides 'writeFunc'/'readFunc'
+    size_t stateOffset;
+    size_t stateSize;
+    // Leading part of the state that is deterministic simulation state, derived/render data is excluded so checksums can
+    // be compared between peers.  Components with bytes that aren't state in there (string tails, platform sized fields)
+    // hash themselves with 'checksumFunc' instead.
+    size_t checksumSize;
+    CreSnapshotChecksumFunc checksumFunc;
+    CreSnapshotWriteStateFunc writeFunc;
+    CreSnapshotReadStateFunc readFunc;
+    // Checks state values the component uses as array bounds, only needed for snapshots that come from the network
+    CreSnapshotValidateStateFunc validateFunc;
+} CreSnapshotComponentLayout;
+
+// Animations (and their frames' textures) are configuration, only the current animation and each animation's current
+// frame change along with the fields from 'modulate' on
+#define CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE (sizeof(int32) * (ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS + 1))
+#define CRE_SNAPSHOT_ANIMATED_SPRITE_VALUES_SIZE (offsetof(AnimatedSpriteComponent, onFrameChanged) - offsetof(AnimatedSpriteComponent, modulate))
+// Everything except the texture of textured particles
+#define CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE offsetof(Particles2DComponent, typeTexture)
+#define CRE_SNAPSHOT_PARTICLES2D_TAIL_OFFSET offsetof(Particles2DComponent, typeTexture.drawSource)
+#define CRE_SNAPSHOT_PARTICLES2D_TAIL_SIZE (sizeof(Particles2DComponent) - CRE_SNAPSHOT_PARTICLES2D_TAIL_OFFSET)
+
+static void snapshot_read_node_state(void* component, const uint8* state);
+static void snapshot_restore_node_tree_state(SkaEntity entity, const uint8* state);
+static void snapshot_write_animated_sprite_state(const void* component, uint8* outState);
+static void snapshot_read_animated_sprite_state(void* component, const uint8* state);
+static void snapshot_write_particles2d_state(const void* component, uint8* outState);
+static void snapshot_read_particles2d_state(void* component, const uint8* state);
+static uint64 snapshot_checksum_node_state(uint64 hash, const uint8* state);
+static uint64 snapshot_checksum_collider2d_state(uint64 hash, const uint8* state);
+static bool snapshot_validate_collider2d_state(const uint8* state);
+static bool snapshot_validate_particles2d_state(const uint8* state);
+
+// Script and tilemap components are left out as they are either immutable at runtime or own heap memory, visibility
+// notifiers are left out as their state is recomputed from the camera every update
+static CreSnapshotComponentLayout componentLayouts[] = {
+    { .index = &NODE_COMPONENT_INDEX, .stateSize = offsetof(NodeComponent, onSceneTreeEnter), .checksumFunc = snapshot_checksum_node_state, .readFunc = snapshot_read_node_state },
+    { .index = &TRANSFORM2D_COMPONENT_INDEX, .stateSize = offsetof(Transform2DComponent, onTransformChanged), .checksumSize = offsetof(Transform2DComponent, globalTransform) },
+    { .index = &SPRITE_COMPONENT_INDEX, .stateOffset = offsetof(SpriteComponent, drawSource), .stateSize = sizeof(SpriteComponent) - offsetof(SpriteComponent, drawSource) },
+    {
+        .index = &ANIMATED_SPRITE_COMPONENT_INDEX,
+        .stateSize = CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE + CRE_SNAPSHOT_ANIMATED_SPRITE_VALUES_SIZE,
+        .writeFunc = snapshot_write_animated_sprite_state,
+        .readFunc = snapshot_read_animated_sprite_state
+    },
+    { .index = &TEXT_LABEL_COMPONENT_INDEX, .stateOffset = offsetof(TextLabelComponent, color), .stateSize = sizeof(TextLabelComponent) - offsetof(TextLabelComponent, color) },
+    { .index = &COLLIDER2D_COMPONENT_INDEX, .stateSize = sizeof(Collider2DComponent), .checksumFunc = snapshot_checksum_collider2d_state, .validateFunc = snapshot_validate_collider2d_state },
+    { .index = &COLOR_RECT_COMPONENT_INDEX, .stateSize = sizeof(ColorRectComponent) },
+    { .index = &PARALLAX_COMPONENT_INDEX, .stateSize = sizeof(ParallaxComponent) },
+    {
+        .index = &PARTICLES2D_COMPONENT_INDEX,
+        .stateSize = CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE + CRE_SNAPSHOT_PARTICLES2D_TAIL_SIZE,
+        .writeFunc = snapshot_write_particles2d_state,
+        .readFunc = snapshot_read_particles2d_state,
+        .validateFunc = snapshot_validate_particles2d_state
+    },
+};
+
+#define CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT (sizeof(componentLayouts) / sizeof(CreSnapshotComponentLayout))
+
+static void snapshot_reserve(CreWorldSnapshot* snapshot, size_t additionalSize);
+static void snapshot_write(CreWorldSnapshot* snapshot, const void* data, size_t size);
+static void snapshot_write_component_state(CreWorldSnapshot* snapshot, const CreSnapshotComponentLayout* layout, const void* component);
+static uint64 snapshot_checksum_mix(uint64 hash, const uint8* data, size_t size);
+static uint64 snapshot_checksum_mix_u32(uint64 hash, uint32 value);
+
+CreWorldSnapshot* cre_world_snapshot_create() {
+    CreWorldSnapshot* snapshot = SKA_ALLOC_ZEROED(CreWorldSnapshot);
+    snapshot_reserve(snapshot, CRE_WORLD_SNAPSHOT_INITIAL_CAPACITY);
+    return snapshot;
+}
+
+void cre_world_snapshot_delete(CreWorldSnapshot* snapshot) {
+    free(snapshot->data);
+    SKA_FREE(snapshot);
+}
+
+void cre_world_snapshot_capture(CreWorldSnapshot* snapshot, uint32 frame) {
+    snapshot->size = 0;
+    snapshot->frame = frame;
+    snapshot->entityCount = 0;
+    snapshot->randomState = cre_random_get_state();
+    for (SkaEntity entity = cre_scene_manager_find_next_node_entity(0); entity != SKA_NULL_ENTITY; entity = cre_scene_manager_find_next_node_entity(entity + 1)) {
+        if (!ska_ecs_component_manager_has_component(entity, NODE_COMPONENT_INDEX)) {
+            continue;
+        }
+        uint32 componentMask = 0;
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if (ska_ecs_component_manager_has_component(entity, *componentLayouts[i].index)) {
+                componentMask |= (1u << i);
+            }
+        }
+        snapshot_write(snapshot, &entity, sizeof(SkaEntity));
+        snapshot_write(snapshot, &componentMask, sizeof(uint32));
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if ((componentMask & (1u << i)) != 0) {
+                const void* component = ska_ecs_component_manager_get_component_unchecked(entity, *componentLayouts[i].index);
+                snapshot_write_component_state(snapshot, &componentLayouts[i], component);
+            }
+        }
+        snapshot->entityCount++;
+    }
+}
+
+uint32 cre_world_snapshot_restore(const CreWorldSnapshot* snapshot) {
+    uint32 restoredCount = 0;
+    size_t offset = 0;
+    while (offset < snapshot->size) {
+        SkaEntity entity;
+        uint32 componentMask;
+        memcpy(&entity, snapshot->data + offset, sizeof(SkaEntity));
+        offset += sizeof(SkaEntity);
+        memcpy(&componentMask, snapshot->data + offset, sizeof(uint32));
+        offset += sizeof(uint32);
+        // Node state always comes first
+        const uint8* nodeState = snapshot->data + offset;
+        const bool isEntityAlive = ska_ecs_component_manager_has_component(entity, NODE_COMPONENT_INDEX);
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if ((componentMask & (1u << i)) == 0) {
+                continue;
+            }
+            const SkaComponentIndex componentIndex = *componentLayouts[i].index;
+            if (isEntityAlive && ska_ecs_component_manager_has_component(entity, componentIndex)) {
+                void* component = ska_ecs_component_manager_get_component_unchecked(entity, componentIndex);
+                if (componentLayouts[i].readFunc) {
+                    componentLayouts[i].readFunc(component, snapshot->data + offset);
+                } else {
+                    memcpy((uint8*)component + componentLayouts[i].stateOffset, snapshot->data + offset, componentLayouts[i].stateSize);
+                }
+                cre_component_versions_mark_changed(entity, componentIndex);
+            }
+            offset += componentLayouts[i].stateSize;
+        }
+        if (isEntityAlive) {
+            snapshot_restore_node_tree_state(entity, nodeState);
+            // Global transforms are derived data, force them to be recalculated from restored local transforms
+            Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX);
+            if (transformComp) {
+                // Dirty flag was restored too, clear it so the invalidation reaches children and queues the entity
+                transformComp->isGlobalTransformDirty = false;
+                cre_scene_manager_invalidate_global_transform(entity, transformComp);
+            }
+            restoredCount++;
+        }
+    }
+    SKA_ASSERT_FMT(offset == snapshot->size, "Snapshot data is corrupted, read '%zu' bytes but size is '%zu'", offset, snapshot->size);
+    cre_random_set_state(snapshot->randomState);
+    return restoredCount;
+}
+
+bool cre_world_snapshot_has_same_entities(const CreWorldSnapshot* snapshot) {
+    uint32 liveEntityCount = 0;
+    for (SkaEntity entity = cre_scene_manager_find_next_node_entity(0); entity != SKA_NULL_ENTITY; entity = cre_scene_manager_find_next_node_entity(entity + 1)) {
+        if (ska_ecs_component_manager_has_component(entity, NODE_COMPONENT_INDEX)) {
+            liveEntityCount++;
+        }
+    }
+    if (liveEntityCount != snapshot->entityCount) {
+        return false;
+    }
+    size_t offset = 0;
+    while (offset < snapshot->size) {
+        SkaEntity entity;
+        uint32 componentMask;
+        memcpy(&entity, snapshot->data + offset, sizeof(SkaEntity));
+        offset += sizeof(SkaEntity);
+        memcpy(&componentMask, snapshot->data + offset, sizeof(uint32));
+        offset += sizeof(uint32);
+        const NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX);
+        if (nodeComponent == NULL) {
+            return false;
+        }
+        // Node state is always the first component, an id reused by a different node doesn't count
+        char name[sizeof(nodeComponent->name)];
+        NodeBaseType type;
+        memcpy(name, snapshot->data + offset + offsetof(NodeComponent, name), sizeof(name));
+        memcpy(&type, snapshot->data + offset + offsetof(NodeComponent, type), sizeof(NodeBaseType));
+        if (type != nodeComponent->type || strncmp(name, nodeComponent->name, sizeof(name)) != 0) {
+            return false;
+        }
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if ((componentMask & (1u << i)) != 0) {
+                offset += componentLayouts[i].stateSize;
+            }
+        }
+    }
+    return true;
+}
+
+bool cre_world_snapshot_validate(const CreWorldSnapshot* snapshot) {
+    const uint32 validComponentMask = (1u << CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT) - 1;
+    uint32 entityCount = 0;
+    SkaEntity prevEntity = SKA_NULL_ENTITY;
+    size_t offset = 0;
+    while (offset < snapshot->size) {
+        if (snapshot->size - offset < sizeof(SkaEntity) + sizeof(uint32)) {
+            return false;
+        }
+        SkaEntity entity;
+        uint32 componentMask;
+        memcpy(&entity, snapshot->data + offset, sizeof(SkaEntity));
+        offset += sizeof(SkaEntity);
+        memcpy(&componentMask, snapshot->data + offset, sizeof(uint32));
+        offset += sizeof(uint32);
+        // Records are captured in ascending entity order and always start with the node state (first layout)
+        if (entity >= SKA_MAX_ENTITIES || (entityCount > 0 && entity <= prevEntity)
+            || (componentMask & ~validComponentMask) != 0 || (componentMask & 1u) == 0) {
+            return false;
+        }
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if ((componentMask & (1u << i)) == 0) {
+                continue;
+            }
+            if (snapshot->size - offset < componentLayouts[i].stateSize
+                || (componentLayouts[i].validateFunc && !componentLayouts[i].validateFunc(snapshot->data + offset))) {
+                return false;
+            }
+            offset += componentLayouts[i].stateSize;
+        }
+        prevEntity = entity;
+        entityCount++;
+    }
+    return entityCount == snapshot->entityCount;
+}
+
+void cre_world_snapshot_copy(CreWorldSnapshot* dest, const CreWorldSnapshot* src) {
+    dest->size = 0;
+    snapshot_write(dest, src->data, src->size);
+    dest->frame = src->frame;
+    dest->entityCount = src->entityCount;
+    dest->randomState = src->randomState;
+}
+
+void cre_world_snapshot_resize(CreWorldSnapshot* snapshot, size_t size) {
+    if (size > snapshot->size) {
+        snapshot_reserve(snapshot, size - snapshot->size);
+    }
+    snapshot->size = size;
+}
+
+uint32 cre_world_snapshot_checksum(const CreWorldSnapshot* snapshot) {
+    uint64 hash = CRE_WORLD_SNAPSHOT_CHECKSUM_SEED;
+    size_t offset = 0;
+    while (offset < snapshot->size) {
+        uint32 componentMask;
+        memcpy(&componentMask, snapshot->data + offset + sizeof(SkaEntity), sizeof(uint32));
+        // Entity and component mask
+        hash = snapshot_checksum_mix(hash, snapshot->data + offset, sizeof(SkaEntity) + sizeof(uint32));
+        offset += sizeof(SkaEntity) + sizeof(uint32);
+        for (size_t i = 0; i < CRE_SNAPSHOT_COMPONENT_LAYOUT_COUNT; i++) {
+            if ((componentMask & (1u << i)) != 0) {
+                if (componentLayouts[i].checksumFunc) {
+                    hash = componentLayouts[i].checksumFunc(hash, snapshot->data + offset);
+                } else {
+                    hash = snapshot_checksum_mix(hash, snapshot->data + offset, componentLayouts[i].checksumSize);
+                }
+                offset += componentLayouts[i].stateSize;
+            }
+        }
+    }
+    return (uint32)(hash ^ (hash >> 32));
+}
+
+bool cre_world_snapshot_save_file(const CreWorldSnapshot* snapshot, const char* filePath) {
+    FILE* file = fopen(filePath, "wb");
+    if (!file) {
+        return false;
+    }
+    const bool success = fwrite(&snapshot->frame, sizeof(uint32), 1, file) == 1
+        && fwrite(&snapshot->entityCount, sizeof(uint32), 1, file) == 1
+        && fwrite(&snapshot->randomState, sizeof(uint32), 1, file) == 1
+        && fwrite(snapshot->data, 1, snapshot->size, file) == snapshot->size;
+    fclose(file);
+    return success;
+}
+
+void snapshot_reserve(CreWorldSnapshot* snapshot, size_t additionalSize) {
+    const size_t requiredCapacity = snapshot->size + additionalSize;
+    if (requiredCapacity <= snapshot->capacity) {
+        return;
+    }
+    size_t newCapacity = snapshot->capacity > 0 ? snapshot->capacity : CRE_WORLD_SNAPSHOT_INITIAL_CAPACITY;
+    while (newCapacity < requiredCapacity) {
+        newCapacity *= 2;
+    }
+    uint8* newData = (uint8*)realloc(snapshot->data, newCapacity);
+    SKA_ASSERT_FMT(newData, "Failed to allocate '%zu' bytes for world snapshot!", newCapacity);
+    snapshot->data = newData;
+    snapshot->capacity = newCapacity;
+}
+
+void snapshot_write(CreWorldSnapshot* snapshot, const void* data, size_t size) {
+    snapshot_reserve(snapshot, size);
+    memcpy(snapshot->data + snapshot->size, data, size);
+    snapshot->size += size;
+}
+
+void snapshot_write_component_state(CreWorldSnapshot* snapshot, const CreSnapshotComponentLayout* layout, const void* component) {
+    if (!layout->writeFunc) {
+        snapshot_write(snapshot, (const uint8*)component + layout->stateOffset, layout->stateSize);
+        return;
+    }
+    snapshot_reserve(snapshot, layout->stateSize);
+    layout->writeFunc(component, snapshot->data + snapshot->size);
+    snapshot->size += layout->stateSize;
+}
+
+// Name and type only, 'queuedForDeletion' belongs to the scene manager's deletion queue and the tree resolved state is
+// restored once the whole record is read
+void snapshot_read_node_state(void* component, const uint8* state) {
+    NodeComponent* nodeComponent = (NodeComponent*)component;
+    memcpy(nodeComponent->name, state + offsetof(NodeComponent, name), sizeof(nodeComponent->name));
+    memcpy(&nodeComponent->type, state + offsetof(NodeComponent, type), sizeof(NodeBaseType));
+}
+
+// Time dilation and process modes are resolved down the tree, changes go through the scene manager so children follow
+void snapshot_restore_node_tree_state(SkaEntity entity, const uint8* state) {
+    NodeComponent* nodeComponent = (NodeComponent*)ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX);
+    NodeTimeDilation timeDilation;
+    NodeProcessMode processMode;
+    memcpy(&timeDilation, state + offsetof(NodeComponent, timeDilation), sizeof(NodeTimeDilation));
+    memcpy(&processMode, state + offsetof(NodeComponent, processMode), sizeof(NodeProcessMode));
+    if (nodeComponent->timeDilation.value != timeDilation.value) {
+        nodeComponent->timeDilation.value = timeDilation.value;
+        cre_scene_manager_invalidate_time_dilation_nodes_with_children(entity);
+    }
+    cre_scene_manager_set_node_process_mode(entity, processMode);
+}
+
+// State is '[int32 currentFrame per animation slot][int32 currentAnimationIndex][fields from 'modulate' on]'
+void snapshot_write_animated_sprite_state(const void* component, uint8* outState) {
+    const AnimatedSpriteComponent* animatedSpriteComp = (const AnimatedSpriteComponent*)component;
+    int32 frames[ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS + 1] = {0};
+    for (size_t i = 0; i < animatedSpriteComp->animationCount && i < ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS; i++) {
+        frames[i] = animatedSpriteComp->animations[i].currentFrame;
+    }
+    frames[ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS] = animatedSpriteComp->currentAnimation != NULL ? (int32)(animatedSpriteComp->currentAnimation - animatedSpriteComp->animations) : -1;
+    memcpy(outState, frames, CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE);
+    memcpy(outState + CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE, &animatedSpriteComp->modulate, CRE_SNAPSHOT_ANIMATED_SPRITE_VALUES_SIZE);
+}
+
+void snapshot_read_animated_sprite_state(void* component, const uint8* state) {
+    AnimatedSpriteComponent* animatedSpriteComp = (AnimatedSpriteComponent*)component;
+    int32 frames[ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS + 1];
+    memcpy(frames, state, CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE);
+    for (size_t i = 0; i < animatedSpriteComp->animationCount && i < ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS; i++) {
+        CreAnimation* animation = &animatedSpriteComp->animations[i];
+        animation->currentFrame = frames[i] >= 0 && frames[i] < animation->frameCount ? frames[i] : 0;
+    }
+    const int32 currentAnimationIndex = frames[ANIMATED_SPRITE_COMPONENT_MAX_ANIMATIONS];
+    if (currentAnimationIndex >= 0 && (size_t)currentAnimationIndex < animatedSpriteComp->animationCount) {
+        animatedSpriteComp->currentAnimation = &animatedSpriteComp->animations[currentAnimationIndex];
+    }
+    memcpy(&animatedSpriteComp->modulate, state + CRE_SNAPSHOT_ANIMATED_SPRITE_FRAMES_SIZE, CRE_SNAPSHOT_ANIMATED_SPRITE_VALUES_SIZE);
+}
+
+void snapshot_write_particles2d_state(const void* component, uint8* outState) {
+    memcpy(outState, component, CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE);
+    memcpy(outState + CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE, (const uint8*)component + CRE_SNAPSHOT_PARTICLES2D_TAIL_OFFSET, CRE_SNAPSHOT_PARTICLES2D_TAIL_SIZE);
+}
+
+void snapshot_read_particles2d_state(void* component, const uint8* state) {
+    memcpy(component, state, CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE);
+    memcpy((uint8*)component + CRE_SNAPSHOT_PARTICLES2D_TAIL_OFFSET, state + CRE_SNAPSHOT_PARTICLES2D_HEAD_SIZE, CRE_SNAPSHOT_PARTICLES2D_TAIL_SIZE);
+}
+
+// Word at a time FNV-1a style mix, only needs to be cheap and sensitive to any changed byte
+uint64 snapshot_checksum_mix(uint64 hash, const uint8* data, size_t size) {
+    size_t i = 0;
+    for (; i + sizeof(uint64) <= size; i += sizeof(uint64)) {
+        uint64 word;
+        memcpy(&word, data + i, sizeof(uint64));
+        hash = (hash ^ word) * CRE_WORLD_SNAPSHOT_CHECKSUM_PRIME;
+        hash ^= hash >> 29;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ data[i]) * CRE_WORLD_SNAPSHOT_CHECKSUM_PRIME;
+    }
+    return hash;
+}
+
+uint64 snapshot_checksum_mix_u32(uint64 hash, uint32 value) {
+    return snapshot_checksum_mix(hash, (const uint8*)&value, sizeof(uint32));
+}
+
+// Name up to its terminator (bytes after it are whatever a previous name left there) and type
+uint64 snapshot_checksum_node_state(uint64 hash, const uint8* state) {
+    const uint8* name = state + offsetof(NodeComponent, name);
+    const size_t nameCapacity = sizeof(((NodeComponent*)NULL)->name);
+    const uint8* nameEnd = (const uint8*)memchr(name, '\0', nameCapacity);
+    const size_t nameLength = nameEnd != NULL ? (size_t)(nameEnd - name) : nameCapacity;
+    NodeBaseType type;
+    memcpy(&type, state + offsetof(NodeComponent, type), sizeof(NodeBaseType));
+    hash = snapshot_checksum_mix_u32(hash, (uint32)nameLength);
+    hash = snapshot_checksum_mix(hash, name, nameLength);
+    return snapshot_checksum_mix_u32(hash, (uint32)type);
+}
+
+// Exception count is a 'size_t', hashed as a fixed width count so 32 and 64 bit peers agree.  Unused exception slots are skipped.
+uint64 snapshot_checksum_collider2d_state(uint64 hash, const uint8* state) {
+    Collider2DComponent collider;
+    memcpy(&collider, state, sizeof(Collider2DComponent));
+    const size_t maxExceptionCount = sizeof(collider.collisionExceptions) / sizeof(SkaEntity);
+    const uint32 exceptionCount = (uint32)(collider.collisionExceptionCount < maxExceptionCount ? collider.collisionExceptionCount : maxExceptionCount);
+    hash = snapshot_checksum_mix(hash, (const uint8*)&collider.extents, sizeof(SkaSize2D));
+    hash = snapshot_checksum_mix_u32(hash, exceptionCount);
+    for (uint32 i = 0; i < exceptionCount; i++) {
+        hash = snapshot_checksum_mix_u32(hash, (uint32)collider.collisionExceptions[i]);
+    }
+    return hash;
+}
+
+bool snapshot_validate_collider2d_state(const uint8* state) {
+    Collider2DComponent collider;
+    memcpy(&collider, state, sizeof(Collider2DComponent));
+    return collider.collisionExceptionCount <= sizeof(collider.collisionExceptions) / sizeof(SkaEntity);
+}
+
+bool snapshot_validate_particles2d_state(const uint8* state) {
+    int32 amount;
+    memcpy(&amount, state + offsetof(Particles2DComponent, amount), sizeof(int32));
+    return amount >= 0 && amount <= CRE_PARTICLES_2D_MAX;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/defines.h>
+
+// A world snapshot is a flat byte buffer holding the mutable state of every live node's components.
+// Layout is a list of entity records: [SkaEntity entity][uint32 componentMask][component state...]
+// Only the value 'state' part of each component is stored, events/observers and asset pointers (textures, fonts) are
+// left untouched on restore so snapshots can be sent to other processes.
+
+typedef struct CreWorldSnapshot {
+    uint8* data;
+    size_t size;
+    size_t capacity;
+    uint32 frame;
+    uint32 entityCount;
+    uint32 randomState; // Engine random number generator state, see 'math/random.h'
+} CreWorldSnapshot;
+
+CreWorldSnapshot* cre_world_snapshot_create();
+void cre_world_snapshot_delete(CreWorldSnapshot* snapshot);
+// Captures the current component state of all live nodes into the snapshot (reuses the existing buffer)
+void cre_world_snapshot_capture(CreWorldSnapshot* snapshot, uint32 frame);
+// Writes snapshot state back into components of entities that are still alive and restores the random number generator
+// state, returns number of entities restored.  Process modes and time dilation are set through the scene manager so
+// children resolve them again, 'queuedForDeletion' is left as is.
+// Expects a well formed snapshot, check ones that come from outside the process with 'cre_world_snapshot_validate()' first.
+uint32 cre_world_snapshot_restore(const CreWorldSnapshot* snapshot);
+// True if the records fit the snapshot's size, entity ids and component masks are in range and the entity count matches.
+// Doesn't touch the world, walking the snapshot afterwards can't read out of bounds.
+bool cre_world_snapshot_validate(const CreWorldSnapshot* snapshot);
+// True if the nodes alive now are the ones the snapshot was captured from (same entities, names and types), expects a
+// well formed snapshot like 'cre_world_snapshot_restore()'
+bool cre_world_snapshot_has_same_entities(const CreWorldSnapshot* snapshot);
+void cre_world_snapshot_copy(CreWorldSnapshot* dest, const CreWorldSnapshot* src);
+// Grows the buffer if needed and sets the size, contents past the previous size are undefined
+void cre_world_snapshot_resize(CreWorldSnapshot* snapshot, size_t size);
+// Checksum of the deterministic part of the snapshot (node names/types, local transforms, colliders), comparable across peers
+uint32 cre_world_snapshot_checksum(const CreWorldSnapshot* snapshot);
+// Writes '[uint32 frame][uint32 entityCount][uint32 randomState][data]' to a file, used for offline diffing of desynced frames
+bool cre_world_snapshot_save_file(const CreWorldSnapshot* snapshot, const char* filePath);
+
+#ifdef __cplusplus
+}
+#endif
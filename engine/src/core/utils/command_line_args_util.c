@@ -1,5 +1,6 @@
 #include "command_line_args_util.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <seika/logger.h>
@@ -15,6 +16,12 @@ CommandLineFlagResult cre_command_line_args_parse(int32 argv, char** args) {
     memset(flagResult.workingDirOverride, 0, CRE_DIR_OVERRIDE_CAPACITY);
     memset(flagResult.internalAssetsDirOverride, 0, CRE_DIR_OVERRIDE_CAPACITY);
     memset(flagResult.logLevel, 0, CRE_LOG_LEVEL_CAPACITY);
+    memset(flagResult.recordReplayPath, 0, CRE_DIR_OVERRIDE_CAPACITY);
+    memset(flagResult.playReplayPath, 0, CRE_DIR_OVERRIDE_CAPACITY);
+    memset(flagResult.spectateAddress, 0, CRE_DIR_OVERRIDE_CAPACITY);
+    memset(flagResult.compileScenePath, 0, CRE_DIR_OVERRIDE_CAPACITY);
+    flagResult.replaySeekFrame = -1;
+    flagResult.spectatorServerPort = -1;
     flagResult.flagCount = 0;
     if (argv <= 1) {
         ska_logger_debug("No command line arguments passed!  single arg = '%s'", args[0]);
@@ -43,6 +50,34 @@ CommandLineFlagResult cre_command_line_args_parse(int32 argv, char** args) {
             ska_strcpy(flagResult.logLevel, logLevelOverride);
             argumentIndex++;
             flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_RECORD_REPLAY) == 0) {
+            const char* recordReplayPath = args[nextArgumentIndex];
+            ska_strcpy(flagResult.recordReplayPath, recordReplayPath);
+            argumentIndex++;
+            flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_PLAY_REPLAY) == 0) {
+            const char* playReplayPath = args[nextArgumentIndex];
+            ska_strcpy(flagResult.playReplayPath, playReplayPath);
+            argumentIndex++;
+            flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_REPLAY_SEEK) == 0) {
+            flagResult.replaySeekFrame = atoi(args[nextArgumentIndex]);
+            argumentIndex++;
+            flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_SPECTATOR_SERVER) == 0) {
+            flagResult.spectatorServerPort = atoi(args[nextArgumentIndex]);
+            argumentIndex++;
+            flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_SPECTATE) == 0) {
+            const char* spectateAddress = args[nextArgumentIndex];
+            ska_strcpy(flagResult.spectateAddress, spectateAddress);
+            argumentIndex++;
+            flagResult.flagCount++;
+        } else if (strcmp(argument, CRE_COMMAND_LINE_FLAG_COMPILE_SCENE) == 0) {
+            const char* compileScenePath = args[nextArgumentIndex];
+            ska_strcpy(flagResult.compileScenePath, compileScenePath);
+            argumentIndex++;
+            flagResult.flagCount++;
         }
     }
     return flagResult;
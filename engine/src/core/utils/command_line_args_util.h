@@ -5,11 +5,23 @@
 #define CRE_COMMAND_LINE_FLAG_WORK_DIR "-d"
 #define CRE_COMMAND_LINE_FLAG_INTERNAL_ASSETS_DIR "-ia"
 #define CRE_COMMAND_LINE_FLAG_LOG_LEVEL "-l"
+#define CRE_COMMAND_LINE_FLAG_RECORD_REPLAY "-record"
+#define CRE_COMMAND_LINE_FLAG_PLAY_REPLAY "-replay"
+#define CRE_COMMAND_LINE_FLAG_REPLAY_SEEK "-seek"
+#define CRE_COMMAND_LINE_FLAG_SPECTATOR_SERVER "-spectator-server"
+#define CRE_COMMAND_LINE_FLAG_SPECTATE "-spectate"
+#define CRE_COMMAND_LINE_FLAG_COMPILE_SCENE "-compile-scene"
 
 typedef struct CommandLineFlagResult {
     char workingDirOverride[256];
     char internalAssetsDirOverride[256];
     char logLevel[8];
+    char recordReplayPath[256];
+    char playReplayPath[256];
+    int32 replaySeekFrame; // -1 if not set
+    int32 spectatorServerPort; // -1 if not set
+    char spectateAddress[256]; // 'host:port'
+    char compileScenePath[256]; // Compiles the json scene next to itself and exits
     int32 flagCount;
 } CommandLineFlagResult;
 
@@ -0,0 +1,145 @@
+#include "entity_paged_array.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <seika/assert.h>
+
+// Each page ends with a bit per element that's been created, so creating or releasing an element twice is only counted once
+#define ENTITY_PAGED_ARRAY_CREATED_BITS_SIZE (CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE / 32 * sizeof(uint32))
+
+static inline uint32* entity_paged_array_get_created_bits(const CreEntityPagedArray* array, uint8* page) {
+    return (uint32*)(page + array->elementSize * CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE);
+}
+
+static inline void entity_paged_array_set_default(const CreEntityPagedArray* array, uint8* element) {
+    if (array->defaultElement == NULL) {
+        memset(element, 0, array->elementSize);
+    } else {
+        memcpy(element, array->defaultElement, array->elementSize);
+    }
+}
+
+static void entity_paged_array_fill_page(const CreEntityPagedArray* array, uint8* page) {
+    if (array->defaultElement == NULL) {
+        memset(page, 0, array->elementSize * CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE);
+    } else {
+        for (size_t i = 0; i < CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE; i++) {
+            memcpy(page + i * array->elementSize, array->defaultElement, array->elementSize);
+        }
+    }
+    memset(entity_paged_array_get_created_bits(array, page), 0, ENTITY_PAGED_ARRAY_CREATED_BITS_SIZE);
+}
+
+static void entity_paged_array_free_page(CreEntityPagedArray* array, uint32 pageIndex) {
+    free(array->pages[pageIndex]);
+    array->pages[pageIndex] = NULL;
+    array->pageElementCounts[pageIndex] = 0;
+    array->allocatedPageCount--;
+}
+
+void cre_entity_paged_array_initialize(CreEntityPagedArray* array, size_t elementSize, const void* defaultElement) {
+    *array = (CreEntityPagedArray){ .elementSize = elementSize };
+    if (defaultElement != NULL) {
+        array->defaultElement = malloc(elementSize);
+        SKA_ASSERT(array->defaultElement);
+        memcpy(array->defaultElement, defaultElement, elementSize);
+    }
+}
+
+void cre_entity_paged_array_finalize(CreEntityPagedArray* array) {
+    for (uint32 i = 0; i < array->pageCount; i++) {
+        free(array->pages[i]);
+    }
+    free(array->pages);
+    free(array->pageElementCounts);
+    free(array->defaultElement);
+    *array = (CreEntityPagedArray){0};
+}
+
+void* cre_entity_paged_array_get_or_create(CreEntityPagedArray* array, SkaEntity entity) {
+    const uint32 pageIndex = entity / CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+    if (pageIndex >= array->pageCount) {
+        uint32 newPageCount = array->pageCount > 0 ? array->pageCount : 8;
+        while (newPageCount <= pageIndex) {
+            newPageCount *= 2;
+        }
+        array->pages = (uint8**)realloc(array->pages, sizeof(uint8*) * newPageCount);
+        array->pageElementCounts = (uint32*)realloc(array->pageElementCounts, sizeof(uint32) * newPageCount);
+        SKA_ASSERT(array->pages && array->pageElementCounts);
+        memset(array->pages + array->pageCount, 0, sizeof(uint8*) * (newPageCount - array->pageCount));
+        memset(array->pageElementCounts + array->pageCount, 0, sizeof(uint32) * (newPageCount - array->pageCount));
+        array->pageCount = newPageCount;
+    }
+    if (array->pages[pageIndex] == NULL) {
+        uint8* page = (uint8*)malloc(array->elementSize * CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE + ENTITY_PAGED_ARRAY_CREATED_BITS_SIZE);
+        SKA_ASSERT_FMT(page, "Failed to allocate entity page '%u'!", pageIndex);
+        entity_paged_array_fill_page(array, page);
+        array->pages[pageIndex] = page;
+        array->allocatedPageCount++;
+    }
+    uint8* page = array->pages[pageIndex];
+    const uint32 elementIndex = entity % CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+    uint32* createdBits = entity_paged_array_get_created_bits(array, page);
+    if ((createdBits[elementIndex / 32] & (1u << (elementIndex % 32))) == 0) {
+        createdBits[elementIndex / 32] |= 1u << (elementIndex % 32);
+        array->pageElementCounts[pageIndex]++;
+    }
+    return page + (size_t)elementIndex * array->elementSize;
+}
+
+void cre_entity_paged_array_release(CreEntityPagedArray* array, SkaEntity entity) {
+    const uint32 pageIndex = entity / CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+    if (pageIndex >= array->pageCount || array->pages[pageIndex] == NULL) {
+        return;
+    }
+    uint8* page = array->pages[pageIndex];
+    const uint32 elementIndex = entity % CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+    entity_paged_array_set_default(array, page + (size_t)elementIndex * array->elementSize);
+    uint32* createdBits = entity_paged_array_get_created_bits(array, page);
+    if ((createdBits[elementIndex / 32] & (1u << (elementIndex % 32))) == 0) {
+        return;
+    }
+    createdBits[elementIndex / 32] &= ~(1u << (elementIndex % 32));
+    if (--array->pageElementCounts[pageIndex] == 0) {
+        entity_paged_array_free_page(array, pageIndex);
+    }
+}
+
+void cre_entity_paged_array_reset(CreEntityPagedArray* array) {
+    for (uint32 i = 0; i < array->pageCount; i++) {
+        if (array->pages[i] != NULL) {
+            entity_paged_array_free_page(array, i);
+        }
+    }
+}
+
+SkaEntity cre_entity_paged_array_find_next_created(const CreEntityPagedArray* array, SkaEntity startEntity) {
+    for (uint32 pageIndex = startEntity / CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE; pageIndex < array->pageCount; pageIndex++) {
+        if (array->pages[pageIndex] == NULL) {
+            continue;
+        }
+        const uint32* createdBits = entity_paged_array_get_created_bits(array, array->pages[pageIndex]);
+        const uint32 pageStart = pageIndex * CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+        uint32 elementIndex = startEntity > pageStart ? startEntity - pageStart : 0;
+        while (elementIndex < CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE) {
+            // Clears the bits below the element so whole words of released elements are skipped
+            uint32 bits = createdBits[elementIndex / 32] & (0xFFFFFFFFu << (elementIndex % 32));
+            if (bits != 0) {
+                elementIndex &= ~31u;
+                while ((bits & 1u) == 0) {
+                    bits >>= 1;
+                    elementIndex++;
+                }
+                return (SkaEntity)(pageStart + elementIndex);
+            }
+            elementIndex = (elementIndex & ~31u) + 32;
+        }
+    }
+    return SKA_NULL_ENTITY;
+}
+
+size_t cre_entity_paged_array_get_memory_size(const CreEntityPagedArray* array) {
+    return (size_t)array->allocatedPageCount * (array->elementSize * CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE + ENTITY_PAGED_ARRAY_CREATED_BITS_SIZE)
+        + (sizeof(uint8*) + sizeof(uint32)) * array->pageCount;
+}
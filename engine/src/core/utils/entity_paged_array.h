@@ -0,0 +1,52 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include <seika/ecs/entity.h>
+
+// Per entity storage split into fixed size pages that are only allocated once an entity in their range is written to, so
+// memory follows the highest live entity id instead of 'SKA_MAX_ENTITIES'.  Elements in an unallocated page have the
+// array's default value.  Pages count the elements created in them and are freed once the last one is released, so
+// memory also shrinks back after a burst of entities is deleted.
+
+#define CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE 1024
+
+typedef struct CreEntityPagedArray {
+    uint8** pages;
+    uint32* pageElementCounts; // Created and not yet released elements per page
+    uint32 pageCount;
+    uint32 allocatedPageCount;
+    size_t elementSize;
+    void* defaultElement; // NULL if elements are zeroed
+} CreEntityPagedArray;
+
+// 'defaultElement' is copied into every element of a new page, elements are zeroed if NULL
+void cre_entity_paged_array_initialize(CreEntityPagedArray* array, size_t elementSize, const void* defaultElement);
+void cre_entity_paged_array_finalize(CreEntityPagedArray* array);
+// Returns the entity's element, allocating its page if needed
+void* cre_entity_paged_array_get_or_create(CreEntityPagedArray* array, SkaEntity entity);
+// Resets the entity's element to the default value, its page is freed if no other element in it was created
+void cre_entity_paged_array_release(CreEntityPagedArray* array, SkaEntity entity);
+// Releases every element, freeing all pages
+void cre_entity_paged_array_reset(CreEntityPagedArray* array);
+// Returns the first created (and not released) entity from 'startEntity' up, 'SKA_NULL_ENTITY' if there are none.
+// Unallocated pages are skipped so walking every created element only touches the live pages.
+SkaEntity cre_entity_paged_array_find_next_created(const CreEntityPagedArray* array, SkaEntity startEntity);
+size_t cre_entity_paged_array_get_memory_size(const CreEntityPagedArray* array);
+
+// Returns NULL if the entity's page isn't allocated (the element has the default value)
+static inline void* cre_entity_paged_array_get(const CreEntityPagedArray* array, SkaEntity entity) {
+    const uint32 pageIndex = entity / CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE;
+    if (pageIndex >= array->pageCount || array->pages[pageIndex] == NULL) {
+        return NULL;
+    }
+    return array->pages[pageIndex] + (size_t)(entity % CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE) * array->elementSize;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,166 @@
+#include "spatial_grid.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <seika/assert.h>
+
+typedef struct SpatialGridCellKey {
+    int32 x;
+    int32 y;
+} SpatialGridCellKey;
+
+typedef struct SpatialGridEntry {
+    SkaRect2 rect;
+    SpatialGridCellKey minCell;
+    SpatialGridCellKey maxCell;
+    uint32 queryStamp;
+    bool isInGrid;
+} SpatialGridEntry;
+
+static inline SpatialGridCellKey spatial_grid_get_cell_key(const CreSpatialGrid* grid, f32 x, f32 y) {
+    return (SpatialGridCellKey){ .x = (int32)floorf(x / grid->cellSize), .y = (int32)floorf(y / grid->cellSize) };
+}
+
+static inline bool spatial_grid_do_rects_overlap(const SkaRect2* a, const SkaRect2* b) {
+    return a->x <= b->x + b->w && a->x + a->w >= b->x && a->y <= b->y + b->h && a->y + a->h >= b->y;
+}
+
+static CreSpatialGridCell* spatial_grid_get_cell(const CreSpatialGrid* grid, SpatialGridCellKey key) {
+    const uint32* cellIndex = (uint32*)ska_hash_map_get(grid->cellIndices, &key);
+    return cellIndex != NULL ? &grid->cells[*cellIndex] : NULL;
+}
+
+static CreSpatialGridCell* spatial_grid_get_or_create_cell(CreSpatialGrid* grid, SpatialGridCellKey key) {
+    CreSpatialGridCell* cell = spatial_grid_get_cell(grid, key);
+    if (cell != NULL) {
+        return cell;
+    }
+    if (grid->cellCount >= grid->cellCapacity) {
+        grid->cellCapacity = grid->cellCapacity > 0 ? grid->cellCapacity * 2 : 64;
+        grid->cells = (CreSpatialGridCell*)realloc(grid->cells, sizeof(CreSpatialGridCell) * grid->cellCapacity);
+        SKA_ASSERT(grid->cells);
+    }
+    const uint32 cellIndex = grid->cellCount++;
+    grid->cells[cellIndex] = (CreSpatialGridCell){0};
+    ska_hash_map_add(grid->cellIndices, &key, &cellIndex);
+    return &grid->cells[cellIndex];
+}
+
+static void spatial_grid_cell_add_entity(CreSpatialGridCell* cell, SkaEntity entity) {
+    if (cell->entityCount >= cell->entityCapacity) {
+        cell->entityCapacity = cell->entityCapacity > 0 ? cell->entityCapacity * 2 : 8;
+        cell->entities = (SkaEntity*)realloc(cell->entities, sizeof(SkaEntity) * cell->entityCapacity);
+        SKA_ASSERT(cell->entities);
+    }
+    cell->entities[cell->entityCount++] = entity;
+}
+
+static void spatial_grid_cell_remove_entity(CreSpatialGridCell* cell, SkaEntity entity) {
+    for (uint32 i = 0; i < cell->entityCount; i++) {
+        if (cell->entities[i] == entity) {
+            cell->entities[i] = cell->entities[--cell->entityCount];
+            return;
+        }
+    }
+}
+
+static void spatial_grid_add_entry_to_cells(CreSpatialGrid* grid, SkaEntity entity, const SpatialGridEntry* entry) {
+    for (int32 y = entry->minCell.y; y <= entry->maxCell.y; y++) {
+        for (int32 x = entry->minCell.x; x <= entry->maxCell.x; x++) {
+            spatial_grid_cell_add_entity(spatial_grid_get_or_create_cell(grid, (SpatialGridCellKey){ x, y }), entity);
+        }
+    }
+}
+
+static void spatial_grid_remove_entry_from_cells(CreSpatialGrid* grid, SkaEntity entity, const SpatialGridEntry* entry) {
+    for (int32 y = entry->minCell.y; y <= entry->maxCell.y; y++) {
+        for (int32 x = entry->minCell.x; x <= entry->maxCell.x; x++) {
+            CreSpatialGridCell* cell = spatial_grid_get_cell(grid, (SpatialGridCellKey){ x, y });
+            if (cell != NULL) {
+                spatial_grid_cell_remove_entity(cell, entity);
+            }
+        }
+    }
+}
+
+void cre_spatial_grid_initialize(CreSpatialGrid* grid, f32 cellSize) {
+    SKA_ASSERT_FMT(cellSize > 0.0f, "Spatial grid cell size must be positive, got '%f'!", cellSize);
+    *grid = (CreSpatialGrid){ .cellSize = cellSize };
+    grid->cellIndices = ska_hash_map_create(sizeof(SpatialGridCellKey), sizeof(uint32), SKA_HASH_MAP_MIN_CAPACITY);
+    cre_entity_paged_array_initialize(&grid->entries, sizeof(SpatialGridEntry), NULL);
+}
+
+void cre_spatial_grid_finalize(CreSpatialGrid* grid) {
+    for (uint32 i = 0; i < grid->cellCount; i++) {
+        free(grid->cells[i].entities);
+    }
+    free(grid->cells);
+    ska_hash_map_destroy(grid->cellIndices);
+    cre_entity_paged_array_finalize(&grid->entries);
+    *grid = (CreSpatialGrid){0};
+}
+
+void cre_spatial_grid_insert_or_update(CreSpatialGrid* grid, SkaEntity entity, const SkaRect2* rect) {
+    SpatialGridEntry* entry = (SpatialGridEntry*)cre_entity_paged_array_get_or_create(&grid->entries, entity);
+    const SpatialGridCellKey minCell = spatial_grid_get_cell_key(grid, rect->x, rect->y);
+    const SpatialGridCellKey maxCell = spatial_grid_get_cell_key(grid, rect->x + rect->w, rect->y + rect->h);
+    entry->rect = *rect;
+    if (entry->isInGrid) {
+        // Most updates are small moves that stay in the same cells
+        if (entry->minCell.x == minCell.x && entry->minCell.y == minCell.y && entry->maxCell.x == maxCell.x && entry->maxCell.y == maxCell.y) {
+            return;
+        }
+        spatial_grid_remove_entry_from_cells(grid, entity, entry);
+    } else {
+        entry->isInGrid = true;
+        grid->entityCount++;
+    }
+    entry->minCell = minCell;
+    entry->maxCell = maxCell;
+    spatial_grid_add_entry_to_cells(grid, entity, entry);
+}
+
+void cre_spatial_grid_remove(CreSpatialGrid* grid, SkaEntity entity) {
+    SpatialGridEntry* entry = (SpatialGridEntry*)cre_entity_paged_array_get(&grid->entries, entity);
+    if (entry == NULL || !entry->isInGrid) {
+        return;
+    }
+    spatial_grid_remove_entry_from_cells(grid, entity, entry);
+    cre_entity_paged_array_release(&grid->entries, entity);
+    grid->entityCount--;
+}
+
+bool cre_spatial_grid_has_entity(const CreSpatialGrid* grid, SkaEntity entity) {
+    const SpatialGridEntry* entry = (SpatialGridEntry*)cre_entity_paged_array_get(&grid->entries, entity);
+    return entry != NULL && entry->isInGrid;
+}
+
+void cre_spatial_grid_query(CreSpatialGrid* grid, const SkaRect2* rect, CreSpatialGridQueryFunc func, void* userData) {
+    if (grid->entityCount == 0) {
+        return;
+    }
+    // Stamp 0 is what new entries start with, skip it when wrapping around
+    grid->queryStamp = grid->queryStamp + 1 != 0 ? grid->queryStamp + 1 : 1;
+    const SpatialGridCellKey minCell = spatial_grid_get_cell_key(grid, rect->x, rect->y);
+    const SpatialGridCellKey maxCell = spatial_grid_get_cell_key(grid, rect->x + rect->w, rect->y + rect->h);
+    for (int32 y = minCell.y; y <= maxCell.y; y++) {
+        for (int32 x = minCell.x; x <= maxCell.x; x++) {
+            const CreSpatialGridCell* cell = spatial_grid_get_cell(grid, (SpatialGridCellKey){ x, y });
+            if (cell == NULL) {
+                continue;
+            }
+            for (uint32 i = 0; i < cell->entityCount; i++) {
+                const SkaEntity entity = cell->entities[i];
+                SpatialGridEntry* entry = (SpatialGridEntry*)cre_entity_paged_array_get(&grid->entries, entity);
+                if (entry->queryStamp == grid->queryStamp) {
+                    continue;
+                }
+                entry->queryStamp = grid->queryStamp;
+                if (spatial_grid_do_rects_overlap(&entry->rect, rect)) {
+                    func(entity, userData);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include <seika/ecs/entity.h>
+#include <seika/math/math.h>
+#include <seika/data_structures/hash_map.h>
+
+#include "entity_paged_array.h"
+
+// Uniform grid of square cells that entities are bucketed into by their rect, used to find the entities overlapping an
+// area without testing every entity.  Cells are created on demand and kept (empty) after their last entity leaves so
+// moving entities don't keep allocating them.
+
+typedef void (*CreSpatialGridQueryFunc)(SkaEntity entity, void* userData);
+
+typedef struct CreSpatialGridCell {
+    SkaEntity* entities;
+    uint32 entityCount;
+    uint32 entityCapacity;
+} CreSpatialGridCell;
+
+typedef struct CreSpatialGrid {
+    f32 cellSize;
+    SkaHashMap* cellIndices; // Cell coordinates to index in 'cells'
+    CreSpatialGridCell* cells;
+    uint32 cellCount;
+    uint32 cellCapacity;
+    CreEntityPagedArray entries; // Per entity rect and covered cell range
+    uint32 entityCount;
+    uint32 queryStamp; // Bumped every query so entities spanning multiple cells are only returned once
+} CreSpatialGrid;
+
+void cre_spatial_grid_initialize(CreSpatialGrid* grid, f32 cellSize);
+void cre_spatial_grid_finalize(CreSpatialGrid* grid);
+void cre_spatial_grid_insert_or_update(CreSpatialGrid* grid, SkaEntity entity, const SkaRect2* rect);
+void cre_spatial_grid_remove(CreSpatialGrid* grid, SkaEntity entity);
+bool cre_spatial_grid_has_entity(const CreSpatialGrid* grid, SkaEntity entity);
+// Calls 'func' once for every entity whose rect overlaps 'rect', in no particular order.  The grid must not be modified
+// from 'func'.
+void cre_spatial_grid_query(CreSpatialGrid* grid, const SkaRect2* rect, CreSpatialGridQueryFunc func, void* userData);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,6 +1,8 @@
 #include "unity.h"
 
+#include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <SDL3/SDL_main.h>
 
@@ -9,18 +11,41 @@
 #include <seika/string.h>
 #include <seika/asset/asset_manager.h>
 #include <seika/rendering/texture.h>
+#include <seika/ecs/ecs.h>
 
 #include "core/node_event.h"
 #include "core/ecs/ecs_globals.h"
+#include "core/ecs/component_pool.h"
+#include "core/ecs/component_view.h"
+#include "core/ecs/component_versions.h"
+#include "core/ecs/entity_builder.h"
 #include "core/ecs/components/collider2d_component.h"
+#include "core/ecs/components/sprite_component.h"
 #include "core/ecs/components/text_label_component.h"
+#include "core/ecs/components/node_component.h"
+#include "core/ecs/components/script_component.h"
 #include "core/ecs/components/transform2d_component.h"
 #include "core/ecs/ecs_manager.h"
+#include "core/ecs/systems/script_ec_system.h"
 #include "core/json/json_file_loader.h"
+#include "core/math/random.h"
+#include "core/networking/keyframe_stream.h"
 #include "core/game_properties.h"
+#include "core/replay/replay.h"
 #include "core/engine_context.h"
 #include "core/scene/scene_manager.h"
+#include "core/scene/compiled_scene.h"
+#include "core/scene/node_pool.h"
+#include "core/scene/scene_template_cache.h"
+#include "core/scene/scene_utils.h"
+#include "core/snapshot/world_snapshot.h"
+#include "core/snapshot/snapshot_delta.h"
 #include "core/tilemap/tilemap.h"
+#include "core/utils/entity_paged_array.h"
+#include "core/utils/spatial_grid.h"
+#include "core/scripting/script_context.h"
+#include "core/scripting/native/native_script_class.h"
+#include "core/scripting/native/native_script_context.h"
 #include "core/scripting/python/pocketpy/pkpy_util.h"
 
 inline static SkaTexture* create_mock_texture() {
@@ -47,6 +72,32 @@ void cre_node_event_test(void);
 void cre_json_file_loader_scene_test(void);
 void cre_pocketpy_api_test(void);
 void cre_tilemap_test(void);
+void cre_world_snapshot_test(void);
+void cre_snapshot_delta_test(void);
+void cre_keyframe_stream_test(void);
+void cre_replay_prediction_test(void);
+void cre_replay_seek_test(void);
+void cre_replay_script_seek_test(void);
+void cre_replay_rollback_spawn_test(void);
+void cre_scene_manager_tree_node_lookup_test(void);
+void cre_scene_tree_node_pool_test(void);
+void cre_scene_manager_global_transform_test(void);
+void cre_scene_manager_tree_deletion_test(void);
+void cre_compiled_scene_test(void);
+void cre_scene_template_cache_test(void);
+void cre_scene_manager_instantiate_many_test(void);
+void cre_scene_manager_async_scene_load_test(void);
+void cre_scene_manager_child_name_index_test(void);
+void cre_scene_manager_group_test(void);
+void cre_scene_manager_transform_changed_event_test(void);
+void cre_component_pool_test(void);
+void cre_component_view_test(void);
+void cre_scene_manager_entity_stress_test(void);
+void cre_node_pool_test(void);
+void cre_scene_manager_process_mode_test(void);
+void cre_visibility_notifier_test(void);
+void cre_component_versions_test(void);
+void cre_entity_builder_test(void);
 
 int32 main(int argv, char** args) {
     UNITY_BEGIN();
@@ -54,6 +105,32 @@ int32 main(int argv, char** args) {
     RUN_TEST(cre_json_file_loader_scene_test);
     RUN_TEST(cre_pocketpy_api_test);
     RUN_TEST(cre_tilemap_test);
+    RUN_TEST(cre_world_snapshot_test);
+    RUN_TEST(cre_snapshot_delta_test);
+    RUN_TEST(cre_keyframe_stream_test);
+    RUN_TEST(cre_replay_prediction_test);
+    RUN_TEST(cre_replay_seek_test);
+    RUN_TEST(cre_replay_script_seek_test);
+    RUN_TEST(cre_replay_rollback_spawn_test);
+    RUN_TEST(cre_scene_manager_tree_node_lookup_test);
+    RUN_TEST(cre_scene_tree_node_pool_test);
+    RUN_TEST(cre_scene_manager_global_transform_test);
+    RUN_TEST(cre_scene_manager_tree_deletion_test);
+    RUN_TEST(cre_compiled_scene_test);
+    RUN_TEST(cre_scene_template_cache_test);
+    RUN_TEST(cre_scene_manager_instantiate_many_test);
+    RUN_TEST(cre_scene_manager_async_scene_load_test);
+    RUN_TEST(cre_scene_manager_child_name_index_test);
+    RUN_TEST(cre_scene_manager_group_test);
+    RUN_TEST(cre_scene_manager_transform_changed_event_test);
+    RUN_TEST(cre_component_pool_test);
+    RUN_TEST(cre_component_view_test);
+    RUN_TEST(cre_scene_manager_entity_stress_test);
+    RUN_TEST(cre_node_pool_test);
+    RUN_TEST(cre_scene_manager_process_mode_test);
+    RUN_TEST(cre_visibility_notifier_test);
+    RUN_TEST(cre_component_versions_test);
+    RUN_TEST(cre_entity_builder_test);
     return UNITY_END();
 }
 
@@ -76,6 +153,7 @@ void cre_node_event_test(void) {
     const SkaEntity eventEntity = 1;
     const SkaEntity observerEntity = 2;
     const char* eventId = "walk";
+    node_event_initialize();
 
     // Test Empty
     TEST_ASSERT_EQUAL_UINT(0, node_event_get_event_count(eventEntity));
@@ -118,12 +196,21 @@ void cre_node_event_test(void) {
     TEST_ASSERT_EQUAL_UINT(0, node_event_get_event_observer_count(eventEntity, eventId));
     TEST_ASSERT_EQUAL_UINT(0, node_event_get_entity_observer_count(observerEntity));
     TEST_ASSERT_EQUAL_UINT(0, node_event_get_entity_observer_count(anotherObserverEntity));
+
+    // Finalizing destroys what's left
+    node_event_subscribe_to_event(eventEntity, eventId, observerEntity, node_event_callback, NULL, NULL);
+    node_event_finalize();
+    node_event_initialize();
+    TEST_ASSERT_EQUAL_UINT(0, node_event_get_event_count(eventEntity));
+    TEST_ASSERT_EQUAL_UINT(0, node_event_get_entity_observer_count(observerEntity));
+    node_event_finalize();
 }
 
 //--- Json File Loader Tests ---//
 // Note: If making changes to scene file make sure cmake runs steps to copy test dependency resources
 
 #define TEST_SCENE_1_PATH "engine/test/resources/test_scene1.cscn"
+#define TEST_BALL_SCENE_PATH "engine/test/resources/ball.cscn"
 
 void cre_json_file_loader_scene_test(void) {
     // ROOT NODE
@@ -171,7 +258,10 @@ void cre_json_file_loader_scene_test(void) {
     TEST_ASSERT_NOT_NULL(ballNode);
     TEST_ASSERT_EQUAL_STRING("TestBall", ballNode->name);
     TEST_ASSERT_EQUAL_INT(NodeBaseType_NODE2D, ballNode->type);
-    TEST_ASSERT_NULL(ballNode->tags);
+    TEST_ASSERT_NOT_NULL(ballNode->tags);
+    TEST_ASSERT_EQUAL_UINT(2, ballNode->tags->size);
+    TEST_ASSERT_EQUAL_STRING("ball", *(char**)ska_array_list_get(ballNode->tags, 0));
+    TEST_ASSERT_EQUAL_STRING("physics", *(char**)ska_array_list_get(ballNode->tags, 1));
     TEST_ASSERT_EQUAL_STRING("engine/test/resources/ball.cscn", ballNode->externalNodeSource);
     TEST_ASSERT_EQUAL_INT(2, ballNode->childrenCount);
     // Ball components
@@ -279,3 +369,1811 @@ void cre_tilemap_test(void) {
 
     cre_tilemap_finalize(&tilemap);
 }
+
+//--- World Snapshot Test ---//
+void cre_world_snapshot_test(void) {
+    // Snapshots walk the nodes the scene manager knows about
+    cre_scene_manager_initialize();
+    const SkaEntity entity = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL)->entity;
+    ska_ecs_component_manager_set_component(entity, NODE_COMPONENT_INDEX, node_component_create_ex("SnapshotNode", NodeBaseType_NODE2D));
+    Transform2DComponent* transformComp = transform2d_component_create();
+    transformComp->localTransform.position = (SkaVector2){ .x = 10.0f, .y = 20.0f };
+    ska_ecs_component_manager_set_component(entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX);
+    // Only the address matters, asset pointers are never part of snapshots
+    static uint8 textureA = 0;
+    static uint8 textureB = 0;
+    SpriteComponent* spriteComp = sprite_component_create();
+    spriteComp->texture = (SkaTexture*)&textureA;
+    spriteComp->modulate = (SkaColor){ .r = 0.5f, .g = 0.25f, .b = 1.0f, .a = 1.0f };
+    ska_ecs_component_manager_set_component(entity, SPRITE_COMPONENT_INDEX, spriteComp);
+    spriteComp = (SpriteComponent*)ska_ecs_component_manager_get_component(entity, SPRITE_COMPONENT_INDEX);
+
+    CreWorldSnapshot* snapshot = cre_world_snapshot_create();
+    cre_world_snapshot_capture(snapshot, 5);
+    TEST_ASSERT_EQUAL_UINT(5, snapshot->frame);
+    TEST_ASSERT_EQUAL_UINT(1, snapshot->entityCount);
+
+    // Modify state then restore
+    transformComp->localTransform.position = (SkaVector2){ .x = -3.0f, .y = 99.0f };
+    transformComp->isGlobalTransformDirty = false;
+    TEST_ASSERT_EQUAL_UINT(1, cre_world_snapshot_restore(snapshot));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, transformComp->localTransform.position.x);
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, transformComp->localTransform.position.y);
+    TEST_ASSERT_TRUE(transformComp->isGlobalTransformDirty);
+
+    // Value fields are restored, the texture loaded by this process is kept
+    spriteComp->texture = (SkaTexture*)&textureB;
+    spriteComp->modulate = SKA_COLOR_WHITE;
+    cre_world_snapshot_restore(snapshot);
+    TEST_ASSERT_EQUAL_PTR(&textureB, spriteComp->texture);
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, spriteComp->modulate.g);
+
+    // Random numbers drawn after the capture come out again once it's restored
+    cre_world_snapshot_capture(snapshot, 5);
+    const uint32 randomValue = cre_random_next();
+    cre_random_next();
+    cre_world_snapshot_restore(snapshot);
+    TEST_ASSERT_EQUAL_UINT(randomValue, cre_random_next());
+
+    // Leftover bytes after a node name's terminator aren't part of the checksum
+    const uint32 checksum = cre_world_snapshot_checksum(snapshot);
+    NodeComponent* nodeComp = (NodeComponent*)ska_ecs_component_manager_get_component(entity, NODE_COMPONENT_INDEX);
+    memset(nodeComp->name + strlen(nodeComp->name) + 1, 'x', sizeof(nodeComp->name) - strlen(nodeComp->name) - 2);
+    cre_world_snapshot_capture(snapshot, 5);
+    TEST_ASSERT_EQUAL_UINT(checksum, cre_world_snapshot_checksum(snapshot));
+    nodeComp->name[0] = 'X';
+    cre_world_snapshot_capture(snapshot, 5);
+    TEST_ASSERT_NOT_EQUAL(checksum, cre_world_snapshot_checksum(snapshot));
+
+    // Malformed records (e.g. from the network) are rejected before anything walks them
+    TEST_ASSERT_TRUE(cre_world_snapshot_validate(snapshot));
+    CreWorldSnapshot* corruptSnapshot = cre_world_snapshot_create();
+    cre_world_snapshot_copy(corruptSnapshot, snapshot);
+    corruptSnapshot->size--;
+    TEST_ASSERT_FALSE(cre_world_snapshot_validate(corruptSnapshot));
+    cre_world_snapshot_copy(corruptSnapshot, snapshot);
+    corruptSnapshot->entityCount++;
+    TEST_ASSERT_FALSE(cre_world_snapshot_validate(corruptSnapshot));
+    cre_world_snapshot_copy(corruptSnapshot, snapshot);
+    const SkaEntity invalidEntity = SKA_MAX_ENTITIES;
+    memcpy(corruptSnapshot->data, &invalidEntity, sizeof(SkaEntity));
+    TEST_ASSERT_FALSE(cre_world_snapshot_validate(corruptSnapshot));
+    cre_world_snapshot_copy(corruptSnapshot, snapshot);
+    const uint32 invalidComponentMask = 0xFFFFFFFFu;
+    memcpy(corruptSnapshot->data + sizeof(SkaEntity), &invalidComponentMask, sizeof(uint32));
+    TEST_ASSERT_FALSE(cre_world_snapshot_validate(corruptSnapshot));
+    cre_world_snapshot_delete(corruptSnapshot);
+
+    cre_world_snapshot_delete(snapshot);
+    ska_ecs_component_manager_remove_all_components(entity);
+    ska_ecs_entity_return(entity);
+    cre_scene_manager_finalize();
+}
+
+//--- Snapshot Delta Test ---//
+#define SNAPSHOT_DELTA_TEST_ENTITY_COUNT 1000
+
+void cre_snapshot_delta_test(void) {
+    static SkaEntity entities[SNAPSHOT_DELTA_TEST_ENTITY_COUNT];
+    cre_scene_manager_initialize();
+    for (int32 i = 0; i < SNAPSHOT_DELTA_TEST_ENTITY_COUNT; i++) {
+        entities[i] = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL)->entity;
+        ska_ecs_component_manager_set_component(entities[i], NODE_COMPONENT_INDEX, node_component_create_ex("Node", NodeBaseType_NODE2D));
+        Transform2DComponent* transformComp = transform2d_component_create();
+        transformComp->localTransform.position = (SkaVector2){ .x = (f32)i, .y = (f32)(i * 2) };
+        ska_ecs_component_manager_set_component(entities[i], TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    }
+
+    CreWorldSnapshot* baseSnapshot = cre_world_snapshot_create();
+    CreWorldSnapshot* currentSnapshot = cre_world_snapshot_create();
+    CreWorldSnapshot* decodedSnapshot = cre_world_snapshot_create();
+    CreSnapshotDelta* delta = cre_snapshot_delta_create();
+    cre_world_snapshot_capture(baseSnapshot, 0);
+
+    // Move 10% of the entities, the rest of the stage is static
+    for (int32 i = 0; i < SNAPSHOT_DELTA_TEST_ENTITY_COUNT; i += 10) {
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(entities[i], TRANSFORM2D_COMPONENT_INDEX);
+        transformComp->localTransform.position.x += 1.5f;
+    }
+    cre_world_snapshot_capture(currentSnapshot, 1);
+
+    cre_snapshot_delta_encode(delta, baseSnapshot, currentSnapshot);
+    TEST_ASSERT_TRUE(cre_snapshot_delta_decode(delta, baseSnapshot, decodedSnapshot));
+    TEST_ASSERT_EQUAL_UINT(currentSnapshot->size, decodedSnapshot->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(currentSnapshot->data, decodedSnapshot->data, currentSnapshot->size));
+    TEST_ASSERT_LESS_THAN(currentSnapshot->size / 10, delta->size);
+    // Checksum matches for identical state and catches a single moved entity
+    TEST_ASSERT_EQUAL_UINT(cre_world_snapshot_checksum(currentSnapshot), cre_world_snapshot_checksum(decodedSnapshot));
+    TEST_ASSERT_NOT_EQUAL(cre_world_snapshot_checksum(baseSnapshot), cre_world_snapshot_checksum(currentSnapshot));
+
+    // Malformed deltas are rejected instead of reading or writing out of bounds, runs are '[zeroCount][literalCount]'
+    const uint16 runs[4] = { 8, 8, 10, 8 };
+    memset(delta->data, 0xAB, 12);
+    memcpy(delta->data, runs, sizeof(uint16) * 2);
+    delta->decodedSize = 16;
+    delta->size = 12;
+    TEST_ASSERT_TRUE(cre_snapshot_delta_decode(delta, NULL, decodedSnapshot));
+    TEST_ASSERT_EQUAL_UINT(0xAB, decodedSnapshot->data[15]);
+    delta->size = 3;
+    TEST_ASSERT_FALSE(cre_snapshot_delta_decode(delta, NULL, decodedSnapshot));
+    delta->size = 6;
+    TEST_ASSERT_FALSE(cre_snapshot_delta_decode(delta, NULL, decodedSnapshot));
+    memcpy(delta->data, &runs[2], sizeof(uint16) * 2);
+    delta->size = 12;
+    TEST_ASSERT_FALSE(cre_snapshot_delta_decode(delta, NULL, decodedSnapshot));
+
+    cre_snapshot_delta_delete(delta);
+    cre_world_snapshot_delete(decodedSnapshot);
+    cre_world_snapshot_delete(currentSnapshot);
+    cre_world_snapshot_delete(baseSnapshot);
+    for (int32 i = 0; i < SNAPSHOT_DELTA_TEST_ENTITY_COUNT; i++) {
+        ska_ecs_component_manager_remove_all_components(entities[i]);
+        ska_ecs_entity_return(entities[i]);
+    }
+    cre_scene_manager_finalize();
+}
+
+//--- Replay Prediction Test ---//
+static CreReplayActionState replayTestMoveLeftState;
+static CreReplayActionState replayTestAttackState;
+
+static void replay_prediction_test_step() {
+    if (!cre_replay_is_waiting_for_input()) {
+        cre_replay_pre_fixed_update();
+        // What scripts would see during the fixed update
+        cre_replay_get_action_state("move_left", 0, &replayTestMoveLeftState);
+        cre_replay_get_action_state("attack", 0, &replayTestAttackState);
+        cre_replay_post_fixed_update();
+    }
+}
+
+void cre_replay_prediction_test(void) {
+    CREGameProperties* gameProps = cre_game_props_get();
+    gameProps->inputActions[0] = (CREInputAction){ .name = "move_left", .deviceId = 0, .predictionPolicy = CREInputPredictionPolicy_REPEAT_LAST };
+    gameProps->inputActions[1] = (CREInputAction){ .name = "attack", .deviceId = 0, .predictionPolicy = CREInputPredictionPolicy_NEUTRAL };
+    gameProps->inputActionCount = 2;
+    const uint64 moveLeftBit = 1 << 0;
+    const uint64 attackBit = 1 << 1;
+
+    cre_replay_initialize(replay_prediction_test_step, NULL, CRE_REPLAY_DEFAULT_KEYFRAME_INTERVAL);
+    TEST_ASSERT_TRUE(cre_replay_start_stream_playback());
+    TEST_ASSERT_TRUE(cre_replay_is_waiting_for_input());
+    for (uint32 frame = 0; frame < 4; frame++) {
+        TEST_ASSERT_TRUE(cre_replay_append_frame_input(frame, moveLeftBit));
+    }
+    TEST_ASSERT_FALSE(cre_replay_append_frame_input(10, moveLeftBit));
+
+    // Runs ahead of the confirmed input up to the prediction limit
+    while (!cre_replay_is_waiting_for_input()) {
+        replay_prediction_test_step();
+    }
+    TEST_ASSERT_EQUAL_UINT(4 + CRE_REPLAY_MAX_PREDICTION_FRAMES, cre_replay_get_current_frame());
+    TEST_ASSERT_TRUE(replayTestMoveLeftState.pressed);
+    TEST_ASSERT_FALSE(replayTestAttackState.pressed);
+
+    // Correct prediction doesn't roll back
+    TEST_ASSERT_TRUE(cre_replay_append_frame_input(4, moveLeftBit));
+    cre_replay_process_queued_seek();
+    TEST_ASSERT_EQUAL_UINT(0, cre_replay_get_stats().rollbackCount);
+
+    // Attack is predicted as released, pressing it rolls back and resimulates to the current frame
+    TEST_ASSERT_TRUE(cre_replay_append_frame_input(5, moveLeftBit | attackBit));
+    cre_replay_process_queued_seek();
+    const CreReplayStats stats = cre_replay_get_stats();
+    TEST_ASSERT_EQUAL_UINT(1, stats.rollbackCount);
+    TEST_ASSERT_EQUAL_UINT(CRE_REPLAY_MAX_PREDICTION_FRAMES, stats.rollbackFramesResimulated);
+    TEST_ASSERT_EQUAL_UINT(4 + CRE_REPLAY_MAX_PREDICTION_FRAMES, cre_replay_get_current_frame());
+    TEST_ASSERT_EQUAL_UINT(1, cre_replay_get_action_rollback_count("attack", 0));
+    TEST_ASSERT_EQUAL_UINT(0, cre_replay_get_action_rollback_count("move_left", 0));
+    // Later frames are still predicted from the neutral policy
+    TEST_ASSERT_FALSE(replayTestAttackState.pressed);
+
+    cre_replay_finalize();
+    gameProps->inputActionCount = 0;
+}
+
+//--- Scene Manager Tree Node Lookup Test ---//
+#define TREE_NODE_LOOKUP_TEST_ENTITY_COUNT 1000
+
+void cre_scene_manager_tree_node_lookup_test(void) {
+    static SceneTreeNode* treeNodes[TREE_NODE_LOOKUP_TEST_ENTITY_COUNT];
+    cre_scene_manager_initialize();
+    for (int32 i = 0; i < TREE_NODE_LOOKUP_TEST_ENTITY_COUNT; i++) {
+        treeNodes[i] = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
+        cre_scene_manager_queue_node_for_creation(treeNodes[i]);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    for (int32 i = 0; i < TREE_NODE_LOOKUP_TEST_ENTITY_COUNT; i++) {
+        TEST_ASSERT_TRUE(cre_scene_manager_has_entity_tree_node(treeNodes[i]->entity));
+        TEST_ASSERT_EQUAL_PTR(treeNodes[i], cre_scene_manager_get_entity_tree_node(treeNodes[i]->entity));
+    }
+    const SkaEntity firstEntity = treeNodes[0]->entity;
+    for (int32 i = 0; i < TREE_NODE_LOOKUP_TEST_ENTITY_COUNT; i++) {
+        cre_scene_manager_queue_entity_for_deletion(treeNodes[i]->entity);
+    }
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_FALSE(cre_scene_manager_has_entity_tree_node(firstEntity));
+    cre_scene_manager_finalize();
+}
+
+//--- Scene Tree Node Pool Test ---//
+#define TREE_NODE_POOL_TEST_BRANCH_COUNT 100
+#define TREE_NODE_POOL_TEST_LEAVES_PER_BRANCH 99
+
+static size_t treeNodePoolTestVisitCount = 0;
+
+static void tree_node_pool_test_visit(SceneTreeNode* treeNode) {
+    treeNodePoolTestVisitCount++;
+}
+
+static void tree_node_pool_test_free(SceneTreeNode* treeNode) {
+    cre_scene_tree_node_pool_free(treeNode);
+}
+
+void cre_scene_tree_node_pool_test(void) {
+    const size_t nodeCount = 1 + TREE_NODE_POOL_TEST_BRANCH_COUNT * (1 + TREE_NODE_POOL_TEST_LEAVES_PER_BRANCH);
+    SkaEntity nextEntity = 0;
+
+    SceneTreeNode* root = cre_scene_tree_node_pool_allocate();
+    root->entity = nextEntity++;
+    for (int32 branchIndex = 0; branchIndex < TREE_NODE_POOL_TEST_BRANCH_COUNT; branchIndex++) {
+        SceneTreeNode* branch = cre_scene_tree_node_pool_allocate();
+        branch->entity = nextEntity++;
+        cre_scene_tree_node_add_child(root, branch);
+        for (int32 leafIndex = 0; leafIndex < TREE_NODE_POOL_TEST_LEAVES_PER_BRANCH; leafIndex++) {
+            SceneTreeNode* leaf = cre_scene_tree_node_pool_allocate();
+            leaf->entity = nextEntity++;
+            cre_scene_tree_node_add_child(branch, leaf);
+        }
+    }
+    cre_scene_execute_on_all_tree_nodes(root, tree_node_pool_test_visit);
+
+    TEST_ASSERT_EQUAL_UINT(nodeCount, treeNodePoolTestVisitCount);
+    TEST_ASSERT_EQUAL_UINT(nodeCount, cre_scene_tree_node_pool_get_active_count());
+    TEST_ASSERT_EQUAL_UINT(TREE_NODE_POOL_TEST_BRANCH_COUNT, root->childCount);
+
+    // Unlinking keeps sibling order
+    SceneTreeNode* firstBranch = root->firstChild;
+    SceneTreeNode* secondBranch = firstBranch->nextSibling;
+    SceneTreeNode* thirdBranch = secondBranch->nextSibling;
+    cre_scene_tree_node_remove_child(root, secondBranch);
+    TEST_ASSERT_EQUAL_PTR(thirdBranch, firstBranch->nextSibling);
+    TEST_ASSERT_EQUAL_PTR(firstBranch, thirdBranch->prevSibling);
+    TEST_ASSERT_EQUAL_UINT(TREE_NODE_POOL_TEST_BRANCH_COUNT - 1, root->childCount);
+
+    // Deleted nodes go back to the free list and get reused
+    cre_scene_execute_on_all_tree_nodes(secondBranch, tree_node_pool_test_free);
+    cre_scene_execute_on_all_tree_nodes(root, tree_node_pool_test_free);
+    TEST_ASSERT_EQUAL_UINT(0, cre_scene_tree_node_pool_get_active_count());
+    SceneTreeNode* reusedNode = cre_scene_tree_node_pool_allocate();
+    TEST_ASSERT_NULL(reusedNode->firstChild);
+    TEST_ASSERT_EQUAL_UINT(1, cre_scene_tree_node_pool_get_active_count());
+
+    cre_scene_tree_node_pool_finalize();
+}
+
+//--- Global Transform Test ---//
+#define GLOBAL_TRANSFORM_TEST_CHAIN_COUNT 10
+#define GLOBAL_TRANSFORM_TEST_CHAIN_DEPTH 64
+#define GLOBAL_TRANSFORM_TEST_ITERATIONS 3
+
+static SceneTreeNode* global_transform_test_create_node(SceneTreeNode* parent, SkaTransform2D localTransform) {
+    SceneTreeNode* treeNode = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+    if (parent) {
+        cre_scene_tree_node_add_child(parent, treeNode);
+    }
+    Transform2DComponent* transformComp = transform2d_component_create();
+    transformComp->localTransform = localTransform;
+    ska_ecs_component_manager_set_component(treeNode->entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    cre_scene_manager_queue_node_for_creation(treeNode);
+    return treeNode;
+}
+
+static Transform2DComponent* global_transform_test_get_transform(const SceneTreeNode* treeNode) {
+    return (Transform2DComponent*)ska_ecs_component_manager_get_component(treeNode->entity, TRANSFORM2D_COMPONENT_INDEX);
+}
+
+static void global_transform_test_delete_node(SceneTreeNode* treeNode) {
+    cre_scene_manager_queue_entity_for_deletion(treeNode->entity);
+}
+
+void cre_scene_manager_global_transform_test(void) {
+    cre_scene_manager_initialize();
+
+    // Parent is rotated 90 degrees and scaled by 2, so the child's local x offset ends up on the y axis
+    SceneTreeNode* parentNode = global_transform_test_create_node(NULL, (SkaTransform2D){ .position = { 10.0f, 0.0f }, .scale = { 2.0f, 2.0f }, .rotation = 90.0f });
+    SceneTreeNode* childNode = global_transform_test_create_node(parentNode, (SkaTransform2D){ .position = { 5.0f, 0.0f }, .scale = { 1.0f, -1.0f }, .rotation = 0.0f });
+    SceneTreeNode* grandChildNode = global_transform_test_create_node(childNode, (SkaTransform2D){ .position = { 1.0f, 0.0f }, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f });
+    cre_scene_manager_process_queued_creation_entities();
+    cre_scene_manager_update_global_transforms();
+
+    Transform2DComponent* parentComp = global_transform_test_get_transform(parentNode);
+    Transform2DComponent* childComp = global_transform_test_get_transform(childNode);
+    Transform2DComponent* grandChildComp = global_transform_test_get_transform(grandChildNode);
+    TEST_ASSERT_FALSE(grandChildComp->isGlobalTransformDirty);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, childComp->globalTransform.position.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, childComp->globalTransform.position.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 90.0f, childComp->globalTransform.rotation);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -2.0f, childComp->globalTransform.scale.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -1.0f, childComp->globalTransform.scaleSign.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, grandChildComp->globalTransform.position.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 12.0f, grandChildComp->globalTransform.position.y);
+
+    // Uncached composition through the (editor overridable) providers matches the propagated cache
+    SkaTransformModel2D providerGlobalTransform;
+    cre_scene_utils_update_global_transform_model(grandChildNode->entity, &providerGlobalTransform);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, grandChildComp->globalTransform.position.x, providerGlobalTransform.position.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, grandChildComp->globalTransform.position.y, providerGlobalTransform.position.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, grandChildComp->globalTransform.scale.y, providerGlobalTransform.scale.y);
+
+    // Moving the parent invalidates the whole subtree, render resources don't dirty the cache anymore
+    parentComp->localTransform.position.x = 20.0f;
+    cre_scene_manager_invalidate_global_transform(parentNode->entity, parentComp);
+    TEST_ASSERT_TRUE(grandChildComp->isGlobalTransformDirty);
+    cre_scene_manager_update_global_transforms();
+    TEST_ASSERT_FALSE(childComp->isGlobalTransformDirty);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 20.0f, grandChildComp->globalTransform.position.x);
+    cre_scene_manager_get_scene_node_global_render_resource(grandChildNode->entity, grandChildComp, &SKA_VECTOR2_ZERO);
+    TEST_ASSERT_FALSE(grandChildComp->isGlobalTransformDirty);
+    cre_scene_execute_on_all_tree_nodes(parentNode, global_transform_test_delete_node);
+    cre_scene_manager_process_queued_deletion_entities();
+
+    // Deep hierarchy, every frame the roots move and all transforms are recalculated
+    static SceneTreeNode* chainRoots[GLOBAL_TRANSFORM_TEST_CHAIN_COUNT];
+    SceneTreeNode* leafNode = NULL;
+    for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_TEST_CHAIN_COUNT; chainIndex++) {
+        chainRoots[chainIndex] = global_transform_test_create_node(NULL, SKA_TRANSFORM_IDENTITY);
+        leafNode = chainRoots[chainIndex];
+        for (int32 depth = 1; depth < GLOBAL_TRANSFORM_TEST_CHAIN_DEPTH; depth++) {
+            leafNode = global_transform_test_create_node(leafNode, (SkaTransform2D){ .position = { 1.0f, 0.0f }, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f });
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+    for (int32 iteration = 0; iteration < GLOBAL_TRANSFORM_TEST_ITERATIONS; iteration++) {
+        for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_TEST_CHAIN_COUNT; chainIndex++) {
+            Transform2DComponent* rootComp = global_transform_test_get_transform(chainRoots[chainIndex]);
+            rootComp->localTransform.position.y = (f32)iteration;
+            cre_scene_manager_invalidate_global_transform(chainRoots[chainIndex]->entity, rootComp);
+        }
+        cre_scene_manager_update_global_transforms();
+    }
+    const Transform2DComponent* leafComp = global_transform_test_get_transform(leafNode);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, (f32)(GLOBAL_TRANSFORM_TEST_CHAIN_DEPTH - 1), leafComp->globalTransform.position.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, (f32)(GLOBAL_TRANSFORM_TEST_ITERATIONS - 1), leafComp->globalTransform.position.y);
+
+    for (int32 chainIndex = 0; chainIndex < GLOBAL_TRANSFORM_TEST_CHAIN_COUNT; chainIndex++) {
+        cre_scene_execute_on_all_tree_nodes(chainRoots[chainIndex], global_transform_test_delete_node);
+    }
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Tree Deletion Test ---//
+#define TREE_DELETION_TEST_BRANCH_COUNT 99
+#define TREE_DELETION_TEST_LEAVES_PER_BRANCH 100
+
+void cre_scene_manager_tree_deletion_test(void) {
+    const size_t nodeCount = 1 + TREE_DELETION_TEST_BRANCH_COUNT * (1 + TREE_DELETION_TEST_LEAVES_PER_BRANCH);
+    static SkaEntity entities[1 + TREE_DELETION_TEST_BRANCH_COUNT * (1 + TREE_DELETION_TEST_LEAVES_PER_BRANCH)];
+    size_t entityCount = 0;
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
+    entities[entityCount++] = root->entity;
+    ska_ecs_component_manager_set_component(root->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Root", NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(root);
+    for (int32 branchIndex = 0; branchIndex < TREE_DELETION_TEST_BRANCH_COUNT; branchIndex++) {
+        SceneTreeNode* branch = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), root);
+        entities[entityCount++] = branch->entity;
+        cre_scene_tree_node_add_child(root, branch);
+        ska_ecs_component_manager_set_component(branch->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Branch", NodeBaseType_NODE));
+        cre_scene_manager_queue_node_for_creation(branch);
+        for (int32 leafIndex = 0; leafIndex < TREE_DELETION_TEST_LEAVES_PER_BRANCH; leafIndex++) {
+            SceneTreeNode* leaf = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), branch);
+            entities[entityCount++] = leaf->entity;
+            cre_scene_tree_node_add_child(branch, leaf);
+            ska_ecs_component_manager_set_component(leaf->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Leaf", NodeBaseType_NODE));
+            cre_scene_manager_queue_node_for_creation(leaf);
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_EQUAL_UINT(nodeCount, entityCount);
+
+    // Entities that are already queued aren't queued again
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_queue_entity_for_deletion(entities[1]);
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+
+    for (size_t i = 0; i < entityCount; i++) {
+        TEST_ASSERT_FALSE(cre_scene_manager_has_entity_tree_node(entities[i]));
+    }
+    TEST_ASSERT_EQUAL_UINT(0, cre_scene_tree_node_pool_get_active_count());
+    cre_scene_manager_finalize();
+}
+
+//--- Compiled Scene Test ---//
+#define TEST_COMPILED_SCENE_1_PATH "engine/test/resources/test_scene1.cscnb"
+#define TEST_CORRUPT_COMPILED_SCENE_PATH "engine/test/resources/corrupt_test_scene.cscnb"
+
+void cre_compiled_scene_test(void) {
+    char compiledScenePath[256];
+    cre_compiled_scene_get_path(TEST_SCENE_1_PATH, compiledScenePath, sizeof(compiledScenePath));
+    TEST_ASSERT_EQUAL_STRING(TEST_COMPILED_SCENE_1_PATH, compiledScenePath);
+    TEST_ASSERT_TRUE(cre_compiled_scene_compile_next_to_source(TEST_SCENE_1_PATH));
+
+    // Nodes are in pre-order with the external 'ball.cscn' children resolved at compile time
+    CreCompiledScene* compiledScene = cre_compiled_scene_open(TEST_COMPILED_SCENE_1_PATH);
+    TEST_ASSERT_NOT_NULL(compiledScene);
+    TEST_ASSERT_EQUAL_UINT(5, compiledScene->header->nodeCount);
+    const char* expectedNames[] = { "Main", "Player", "TestBall", "Collider2D", "BallLabel" };
+    const uint32 expectedParents[] = { CRE_COMPILED_SCENE_NO_PARENT, 0, 0, 2, 2 };
+    for (uint32 i = 0; i < compiledScene->header->nodeCount; i++) {
+        TEST_ASSERT_EQUAL_STRING(expectedNames[i], cre_compiled_scene_get_string(compiledScene, compiledScene->nodes[i].name));
+        TEST_ASSERT_EQUAL_UINT(expectedParents[i], compiledScene->nodes[i].parentIndex);
+    }
+    TEST_ASSERT_EQUAL_INT(NodeBaseType_TEXT_LABEL, compiledScene->nodes[4].type);
+
+    // Node records that don't match their component blob reject the whole file
+    const size_t nodeOffset = compiledScene->header->nodesOffset + sizeof(CreCompiledSceneNode) * 4;
+    uint8* corruptData = (uint8*)malloc(compiledScene->dataSize);
+    memcpy(corruptData, compiledScene->data, compiledScene->dataSize);
+    ((CreCompiledSceneNode*)(corruptData + nodeOffset))->componentsSize += 8;
+    FILE* corruptFile = fopen(TEST_CORRUPT_COMPILED_SCENE_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(corruptFile);
+    fwrite(corruptData, 1, compiledScene->dataSize, corruptFile);
+    fclose(corruptFile);
+    TEST_ASSERT_NULL(cre_compiled_scene_open(TEST_CORRUPT_COMPILED_SCENE_PATH));
+    ((CreCompiledSceneNode*)(corruptData + nodeOffset))->componentsSize -= 8;
+    ((CreCompiledSceneNode*)(corruptData + nodeOffset))->componentMask |= 1u << 31;
+    corruptFile = fopen(TEST_CORRUPT_COMPILED_SCENE_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(corruptFile);
+    fwrite(corruptData, 1, compiledScene->dataSize, corruptFile);
+    fclose(corruptFile);
+    TEST_ASSERT_NULL(cre_compiled_scene_open(TEST_CORRUPT_COMPILED_SCENE_PATH));
+    remove(TEST_CORRUPT_COMPILED_SCENE_PATH);
+    free(corruptData);
+    cre_compiled_scene_close(compiledScene);
+
+    // Scene changes pick up the compiled file next to the json scene
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    cre_scene_manager_queue_scene_change(TEST_SCENE_1_PATH);
+    cre_scene_manager_process_queued_scene_change();
+    cre_scene_manager_process_queued_creation_entities();
+    SceneTreeNode* rootNode = cre_scene_manager_get_active_scene_root();
+    TEST_ASSERT_NOT_NULL(rootNode);
+    NodeComponent* rootNodeComp = (NodeComponent*)ska_ecs_component_manager_get_component(rootNode->entity, NODE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_STRING("Main", rootNodeComp->name);
+    const SkaEntity ballEntity = cre_scene_manager_get_entity_child_by_name(rootNode->entity, "TestBall");
+    TEST_ASSERT_NOT_EQUAL(SKA_NULL_ENTITY, ballEntity);
+    Transform2DComponent* ballTransformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(ballEntity, TRANSFORM2D_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, ballTransformComp->localTransform.position.x);
+    TEST_ASSERT_EQUAL_FLOAT(110.0f, ballTransformComp->localTransform.position.y);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, ballTransformComp->localTransform.scale.x);
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_in_group(ballEntity, "ball"));
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_in_group(ballEntity, "physics"));
+    const SkaEntity colliderEntity = cre_scene_manager_get_entity_child_by_name(ballEntity, "Collider2D");
+    TEST_ASSERT_NOT_EQUAL(SKA_NULL_ENTITY, colliderEntity);
+    TEST_ASSERT_NOT_NULL(ska_ecs_component_manager_get_component_unchecked(colliderEntity, COLLIDER2D_COMPONENT_INDEX));
+    const SkaEntity labelEntity = cre_scene_manager_get_entity_child_by_name(ballEntity, "BallLabel");
+    TEST_ASSERT_NOT_EQUAL(SKA_NULL_ENTITY, labelEntity);
+    TEST_ASSERT_NOT_NULL(ska_ecs_component_manager_get_component_unchecked(labelEntity, TEXT_LABEL_COMPONENT_INDEX));
+
+    cre_queue_destroy_tree_node_entity_all(rootNode);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+    remove(TEST_COMPILED_SCENE_1_PATH);
+}
+
+//--- Scene Template Cache Test ---//
+
+void cre_scene_template_cache_test(void) {
+    cre_scene_template_cache_initialize();
+
+    // First load parses the scene, loading the same path again is a hit with the same id
+    const CreSceneCacheId sceneId = cre_scene_template_cache_load_scene(TEST_SCENE_1_PATH);
+    TEST_ASSERT_NOT_EQUAL(CRE_SCENE_CACHE_INVALID_ID, sceneId);
+    TEST_ASSERT_EQUAL_INT(sceneId, cre_scene_template_cache_load_scene(TEST_SCENE_1_PATH));
+    CreSceneCacheStats stats = cre_scene_template_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT(1, stats.misses);
+    TEST_ASSERT_EQUAL_UINT(1, stats.hits);
+    TEST_ASSERT_EQUAL_UINT(1, stats.residentCount);
+    TEST_ASSERT_TRUE(stats.memoryUsed > 0);
+
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene(sceneId);
+    TEST_ASSERT_NOT_NULL(sceneTemplate);
+    TEST_ASSERT_NOT_NULL(sceneTemplate->rootNode);
+    TEST_ASSERT_EQUAL_STRING("Main", sceneTemplate->rootNode->name);
+    TEST_ASSERT_EQUAL_UINT(2, cre_scene_template_cache_get_stats().hits);
+
+    // Going over budget evicts templates least recently used first, their ids stay valid and reload on next use
+    const CreSceneCacheId ballId = cre_scene_template_cache_load_scene(TEST_BALL_SCENE_PATH);
+    TEST_ASSERT_NOT_EQUAL(CRE_SCENE_CACHE_INVALID_ID, ballId);
+    TEST_ASSERT_NOT_EQUAL(sceneId, ballId);
+    TEST_ASSERT_EQUAL_UINT(2, cre_scene_template_cache_get_stats().residentCount);
+    cre_scene_template_cache_set_memory_budget(1);
+    stats = cre_scene_template_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT(2, stats.evictions);
+    TEST_ASSERT_EQUAL_UINT(0, stats.residentCount);
+    TEST_ASSERT_TRUE(stats.memoryUsed == 0);
+    sceneTemplate = cre_scene_template_cache_get_scene(sceneId);
+    TEST_ASSERT_NOT_NULL(sceneTemplate);
+    TEST_ASSERT_EQUAL_STRING("Main", sceneTemplate->rootNode->name);
+    stats = cre_scene_template_cache_get_stats();
+    TEST_ASSERT_EQUAL_UINT(3, stats.misses);
+    TEST_ASSERT_EQUAL_UINT(2, stats.evictions);
+    TEST_ASSERT_EQUAL_UINT(1, stats.residentCount);
+
+    TEST_ASSERT_NULL(cre_scene_template_cache_get_scene_by_path("not_a_real_scene.cscn"));
+
+    cre_scene_template_cache_set_memory_budget(CRE_SCENE_CACHE_DEFAULT_MEMORY_BUDGET);
+    cre_scene_template_cache_finalize();
+}
+
+//--- Scene Manager Instantiate Many Test ---//
+
+#define INSTANTIATE_MANY_TEST_COUNT 200
+
+void cre_scene_manager_instantiate_many_test(void) {
+    static SkaTransform2D transforms[INSTANTIATE_MANY_TEST_COUNT];
+    static SceneTreeNode* instanceRootNodes[INSTANTIATE_MANY_TEST_COUNT];
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
+    ska_ecs_component_manager_set_component(root->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Root", NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(root);
+    cre_scene_manager_process_queued_creation_entities();
+
+    const CreSceneTemplate* sceneTemplate = cre_scene_template_cache_get_scene_by_path(TEST_BALL_SCENE_PATH);
+    TEST_ASSERT_NOT_NULL(sceneTemplate);
+    for (int32 i = 0; i < INSTANTIATE_MANY_TEST_COUNT; i++) {
+        transforms[i] = (SkaTransform2D){ .position = { .x = (f32)i, .y = (f32)(i * 2) }, .scale = SKA_VECTOR2_ONE, .rotation = 0.0f };
+    }
+
+    TEST_ASSERT_EQUAL_UINT(INSTANTIATE_MANY_TEST_COUNT, cre_scene_manager_instantiate_many(sceneTemplate, INSTANTIATE_MANY_TEST_COUNT, transforms, instanceRootNodes));
+
+    // Every instance is its own tree with copied components and the passed in root transform
+    for (int32 i = 0; i < INSTANTIATE_MANY_TEST_COUNT; i++) {
+        SceneTreeNode* instanceRoot = instanceRootNodes[i];
+        TEST_ASSERT_NULL(instanceRoot->parent);
+        TEST_ASSERT_EQUAL_UINT(1, instanceRoot->childCount);
+        TEST_ASSERT_TRUE(i == 0 || instanceRoot->entity != instanceRootNodes[i - 1]->entity);
+        NodeComponent* nodeComp = (NodeComponent*)ska_ecs_component_manager_get_component(instanceRoot->entity, NODE_COMPONENT_INDEX);
+        TEST_ASSERT_EQUAL_STRING("Ball", nodeComp->name);
+        Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(instanceRoot->entity, TRANSFORM2D_COMPONENT_INDEX);
+        TEST_ASSERT_EQUAL_FLOAT(transforms[i].position.x, transformComp->localTransform.position.x);
+        TEST_ASSERT_EQUAL_FLOAT(transforms[i].position.y, transformComp->localTransform.position.y);
+        SceneTreeNode* colliderNode = instanceRoot->firstChild;
+        TEST_ASSERT_EQUAL_PTR(instanceRoot, colliderNode->parent);
+        TEST_ASSERT_NOT_NULL(ska_ecs_component_manager_get_component_unchecked(colliderNode->entity, COLLIDER2D_COMPONENT_INDEX));
+        nodeComp = (NodeComponent*)ska_ecs_component_manager_get_component(colliderNode->entity, NODE_COMPONENT_INDEX);
+        TEST_ASSERT_EQUAL_STRING("Collider2D", nodeComp->name);
+    }
+
+    for (int32 i = 0; i < INSTANTIATE_MANY_TEST_COUNT; i++) {
+        cre_scene_manager_add_node_as_child(root->entity, instanceRootNodes[i]->entity);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_TRUE(cre_scene_manager_has_entity_tree_node(instanceRootNodes[INSTANTIATE_MANY_TEST_COUNT - 1]->firstChild->entity));
+    const SkaEntity colliderEntity = cre_scene_manager_get_entity_child_by_name(instanceRootNodes[1]->entity, "Collider2D");
+    TEST_ASSERT_EQUAL_UINT(instanceRootNodes[1]->firstChild->entity, colliderEntity);
+
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT(0, cre_scene_tree_node_pool_get_active_count());
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
+
+//--- Scene Manager Async Scene Load Test ---//
+
+static int32 asyncSceneLoadedCount = 0;
+
+static void async_scene_load_test_on_loaded(const char* scenePath) {
+    TEST_ASSERT_EQUAL_STRING(TEST_SCENE_1_PATH, scenePath);
+    asyncSceneLoadedCount++;
+}
+
+void cre_scene_manager_async_scene_load_test(void) {
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    cre_scene_manager_set_async_scene_loaded_callback(async_scene_load_test_on_loaded);
+
+    // No budget creates a single node per frame
+    cre_scene_manager_set_async_scene_load_frame_budget(0.0f);
+    TEST_ASSERT_TRUE(cre_scene_manager_change_scene_async(TEST_SCENE_1_PATH));
+    TEST_ASSERT_TRUE(cre_scene_manager_is_async_scene_loading());
+    TEST_ASSERT_FALSE(cre_scene_manager_change_scene_async(TEST_SCENE_1_PATH));
+    int32 frameCount = 0;
+    f32 prevProgress = 0.0f;
+    while (cre_scene_manager_is_async_scene_loading()) {
+        // Nothing is swapped in until the whole scene is created
+        TEST_ASSERT_NULL(cre_scene_manager_get_active_scene_root());
+        cre_scene_manager_process_async_scene_load();
+        const f32 progress = cre_scene_manager_get_async_scene_load_progress();
+        TEST_ASSERT_TRUE(progress >= prevProgress);
+        prevProgress = progress;
+        frameCount++;
+        TEST_ASSERT_TRUE(frameCount < 1000000);
+    }
+    TEST_ASSERT_TRUE(frameCount >= 5);
+    TEST_ASSERT_EQUAL_INT(1, asyncSceneLoadedCount);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, cre_scene_manager_get_async_scene_load_progress());
+    cre_scene_manager_process_queued_creation_entities();
+    SceneTreeNode* rootNode = cre_scene_manager_get_active_scene_root();
+    TEST_ASSERT_NOT_NULL(rootNode);
+    NodeComponent* rootNodeComp = (NodeComponent*)ska_ecs_component_manager_get_component(rootNode->entity, NODE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_STRING("Main", rootNodeComp->name);
+    const SkaEntity ballEntity = cre_scene_manager_get_entity_child_by_name(rootNode->entity, "TestBall");
+    TEST_ASSERT_NOT_EQUAL(SKA_NULL_ENTITY, ballEntity);
+    TEST_ASSERT_NOT_EQUAL(SKA_NULL_ENTITY, cre_scene_manager_get_entity_child_by_name(ballEntity, "BallLabel"));
+
+    // The template is cached now so there is nothing to read, the default budget creates the whole scene in a frame
+    cre_scene_manager_set_async_scene_load_frame_budget(CRE_SCENE_MANAGER_DEFAULT_ASYNC_LOAD_FRAME_BUDGET_MS);
+    TEST_ASSERT_TRUE(cre_scene_manager_change_scene_async(TEST_SCENE_1_PATH));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, cre_scene_manager_get_async_scene_load_progress());
+    cre_scene_manager_process_async_scene_load();
+    TEST_ASSERT_FALSE(cre_scene_manager_is_async_scene_loading());
+    TEST_ASSERT_EQUAL_INT(2, asyncSceneLoadedCount);
+    TEST_ASSERT_TRUE(cre_scene_manager_get_active_scene_root() != rootNode);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_FALSE(cre_scene_manager_has_entity_tree_node(ballEntity));
+
+    cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_active_scene_root());
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_set_async_scene_loaded_callback(NULL);
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
+
+//--- Child Name Index Test ---//
+#define CHILD_NAME_INDEX_TEST_CHILD_COUNT 1000
+
+static SceneTreeNode* child_name_index_test_add_node(SceneTreeNode* parent, const char* name) {
+    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+    if (parent) {
+        cre_scene_tree_node_add_child(parent, node);
+    }
+    ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, node_component_create_ex(name, NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(node);
+    return node;
+}
+
+void cre_scene_manager_child_name_index_test(void) {
+    static char childNames[CHILD_NAME_INDEX_TEST_CHILD_COUNT][32];
+    static SkaEntity childEntities[CHILD_NAME_INDEX_TEST_CHILD_COUNT];
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = child_name_index_test_add_node(NULL, "Root");
+    for (int32 i = 0; i < CHILD_NAME_INDEX_TEST_CHILD_COUNT; i++) {
+        snprintf(childNames[i], sizeof(childNames[i]), "Child_%d", i);
+        SceneTreeNode* child = child_name_index_test_add_node(root, childNames[i]);
+        childEntities[i] = child->entity;
+        child_name_index_test_add_node(child, "Leaf");
+    }
+    SceneTreeNode* firstDuplicate = child_name_index_test_add_node(root, "Duplicate");
+    SceneTreeNode* secondDuplicate = child_name_index_test_add_node(root, "Duplicate");
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Interned ids are shared between nodes with the same name
+    TEST_ASSERT_EQUAL_UINT(cre_node_name_table_find("Leaf"), cre_node_name_table_intern("Leaf"));
+    TEST_ASSERT_EQUAL_STRING("Leaf", cre_node_name_table_get_name(cre_node_name_table_find("Leaf")));
+    TEST_ASSERT_EQUAL_UINT(CRE_NODE_NAME_INVALID_ID, cre_node_name_table_find("NotANode"));
+
+    for (int32 i = 0; i < CHILD_NAME_INDEX_TEST_CHILD_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(childEntities[i], cre_scene_manager_get_entity_child_by_name(root->entity, childNames[i]));
+    }
+
+    // Paths
+    const SkaEntity leafEntity = cre_scene_manager_get_entity_child_by_name(childEntities[500], "Leaf");
+    TEST_ASSERT_NOT_EQUAL_UINT32(SKA_NULL_ENTITY, leafEntity);
+    TEST_ASSERT_EQUAL_UINT32(leafEntity, cre_scene_manager_get_entity_by_path(root->entity, "Child_500/Leaf"));
+    TEST_ASSERT_EQUAL_UINT32(leafEntity, cre_scene_manager_get_entity_by_path(childEntities[3], "../Child_500/./Leaf"));
+    TEST_ASSERT_EQUAL_UINT32(root->entity, cre_scene_manager_get_entity_by_path(leafEntity, "../.."));
+    TEST_ASSERT_EQUAL_UINT32(SKA_NULL_ENTITY, cre_scene_manager_get_entity_by_path(root->entity, "Child_500/NotANode"));
+    TEST_ASSERT_EQUAL_UINT32(SKA_NULL_ENTITY, cre_scene_manager_get_entity_by_path(root->entity, ".."));
+
+    // The first sibling with a name is returned, the next one takes over once it's deleted
+    TEST_ASSERT_EQUAL_UINT32(firstDuplicate->entity, cre_scene_manager_get_entity_child_by_name(root->entity, "Duplicate"));
+    const SkaEntity secondDuplicateEntity = secondDuplicate->entity;
+    cre_queue_destroy_tree_node_entity_all(firstDuplicate);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT32(secondDuplicateEntity, cre_scene_manager_get_entity_child_by_name(root->entity, "Duplicate"));
+    cre_queue_destroy_tree_node_entity_all(secondDuplicate);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT32(SKA_NULL_ENTITY, cre_scene_manager_get_entity_child_by_name(root->entity, "Duplicate"));
+
+    // Deleting a subtree removes it (and its children) from the index
+    cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_entity_tree_node(childEntities[500]));
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT32(SKA_NULL_ENTITY, cre_scene_manager_get_entity_child_by_name(root->entity, "Child_500"));
+    TEST_ASSERT_EQUAL_UINT32(childEntities[501], cre_scene_manager_get_entity_child_by_name(root->entity, "Child_501"));
+
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT(0, cre_scene_tree_node_pool_get_active_count());
+    cre_scene_manager_finalize();
+}
+
+//--- Group Test ---//
+#define GROUP_TEST_NODE_COUNT 1000
+
+void cre_scene_manager_group_test(void) {
+    static SkaEntity nodeEntities[GROUP_TEST_NODE_COUNT];
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+
+    // Tags from scene files
+    cre_scene_manager_queue_scene_change(TEST_SCENE_1_PATH);
+    cre_scene_manager_process_queued_scene_change();
+    cre_scene_manager_process_queued_creation_entities();
+    SceneTreeNode* rootNode = cre_scene_manager_get_active_scene_root();
+    TEST_ASSERT_NOT_NULL(rootNode);
+    const SkaEntity ballEntity = cre_scene_manager_get_entity_child_by_name(rootNode->entity, "TestBall");
+    size_t groupCount = 0;
+    const SkaEntity* groupEntities = cre_scene_manager_get_group_entities("ball", &groupCount);
+    TEST_ASSERT_EQUAL_UINT(1, groupCount);
+    TEST_ASSERT_EQUAL_UINT32(ballEntity, groupEntities[0]);
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_in_group(ballEntity, "physics"));
+    TEST_ASSERT_FALSE(cre_scene_manager_is_entity_in_group(rootNode->entity, "ball"));
+    TEST_ASSERT_NULL(cre_scene_manager_get_group_entities("not_a_group", &groupCount));
+    TEST_ASSERT_EQUAL_UINT(0, groupCount);
+
+    // Every other node is an enemy
+    for (int32 i = 0; i < GROUP_TEST_NODE_COUNT; i++) {
+        SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), rootNode);
+        cre_scene_tree_node_add_child(rootNode, node);
+        ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Node", NodeBaseType_NODE));
+        cre_scene_manager_queue_node_for_creation(node);
+        nodeEntities[i] = node->entity;
+        if (i % 2 == 0) {
+            TEST_ASSERT_TRUE(cre_scene_manager_add_entity_to_group(node->entity, "enemy"));
+        }
+    }
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_FALSE(cre_scene_manager_add_entity_to_group(nodeEntities[0], "enemy"));
+    cre_scene_manager_get_group_entities("enemy", &groupCount);
+    TEST_ASSERT_EQUAL_UINT(GROUP_TEST_NODE_COUNT / 2, groupCount);
+
+    // Removing swaps the last entity in, the rest stay in the group
+    TEST_ASSERT_TRUE(cre_scene_manager_remove_entity_from_group(nodeEntities[0], "enemy"));
+    TEST_ASSERT_FALSE(cre_scene_manager_remove_entity_from_group(nodeEntities[0], "enemy"));
+    TEST_ASSERT_FALSE(cre_scene_manager_is_entity_in_group(nodeEntities[0], "enemy"));
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_in_group(nodeEntities[GROUP_TEST_NODE_COUNT - 2], "enemy"));
+    TEST_ASSERT_TRUE(cre_scene_manager_remove_entity_from_group(nodeEntities[GROUP_TEST_NODE_COUNT - 2], "enemy"));
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_in_group(nodeEntities[2], "enemy"));
+    cre_scene_manager_get_group_entities("enemy", &groupCount);
+    TEST_ASSERT_EQUAL_UINT(GROUP_TEST_NODE_COUNT / 2 - 2, groupCount);
+
+    // Deleted nodes leave their groups
+    cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_entity_tree_node(nodeEntities[2]));
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_get_group_entities("enemy", &groupCount);
+    TEST_ASSERT_EQUAL_UINT(GROUP_TEST_NODE_COUNT / 2 - 3, groupCount);
+    cre_queue_destroy_tree_node_entity_all(rootNode);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_NULL(cre_scene_manager_get_group_entities("enemy", &groupCount));
+    TEST_ASSERT_NULL(cre_scene_manager_get_group_entities("ball", &groupCount));
+
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
+
+//--- Transform Changed Event Test ---//
+#define TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT 3
+#define TRANSFORM_CHANGED_EVENT_TEST_WRITES 5
+
+static SkaEntity transformChangedEventTestNotified[TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT * TRANSFORM_CHANGED_EVENT_TEST_WRITES];
+static size_t transformChangedEventTestNotifiedCount = 0;
+
+static void transform_changed_event_test_on_notify(SkaSubjectNotifyPayload* payload) {
+    const CreComponentEntityUpdatePayload* updatePayload = (CreComponentEntityUpdatePayload*)payload->data;
+    transformChangedEventTestNotified[transformChangedEventTestNotifiedCount++] = updatePayload->entity;
+}
+
+void cre_scene_manager_transform_changed_event_test(void) {
+    static SkaObserver transformChangedObserver = { .on_notify = transform_changed_event_test_on_notify };
+    cre_scene_manager_initialize();
+    // root -> child -> grandchild, all with transforms
+    SceneTreeNode* nodes[TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT];
+    for (int32 i = 0; i < TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT; i++) {
+        SceneTreeNode* parent = i > 0 ? nodes[i - 1] : NULL;
+        nodes[i] = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+        if (parent) {
+            cre_scene_tree_node_add_child(parent, nodes[i]);
+        }
+        Transform2DComponent* transformComp = transform2d_component_create();
+        ska_event_register_observer(&transformComp->onTransformChanged, &transformChangedObserver);
+        ska_ecs_component_manager_set_component(nodes[i]->entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+        cre_scene_manager_queue_node_for_creation(nodes[i]);
+    }
+    cre_scene_manager_process_queued_creation_entities();
+
+    // Writes are only queued, children queued along with an ancestor are still notified once and after their parent
+    for (int32 i = 0; i < TRANSFORM_CHANGED_EVENT_TEST_WRITES; i++) {
+        cre_scene_manager_queue_transform_changed_event(nodes[2]->entity);
+        cre_scene_manager_queue_transform_changed_event(nodes[0]->entity);
+        cre_scene_manager_queue_transform_changed_event(nodes[1]->entity);
+    }
+    TEST_ASSERT_EQUAL_UINT(0, transformChangedEventTestNotifiedCount);
+    cre_scene_manager_flush_transform_changed_events();
+    TEST_ASSERT_EQUAL_UINT(TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT, transformChangedEventTestNotifiedCount);
+    for (int32 i = 0; i < TRANSFORM_CHANGED_EVENT_TEST_NODE_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(nodes[i]->entity, transformChangedEventTestNotified[i]);
+    }
+
+    // Nothing queued, nothing notified
+    transformChangedEventTestNotifiedCount = 0;
+    cre_scene_manager_flush_transform_changed_events();
+    TEST_ASSERT_EQUAL_UINT(0, transformChangedEventTestNotifiedCount);
+
+    // Only the written subtree is notified
+    cre_scene_manager_queue_transform_changed_event(nodes[1]->entity);
+    cre_scene_manager_flush_transform_changed_events();
+    TEST_ASSERT_EQUAL_UINT(2, transformChangedEventTestNotifiedCount);
+    TEST_ASSERT_EQUAL_UINT32(nodes[1]->entity, transformChangedEventTestNotified[0]);
+    TEST_ASSERT_EQUAL_UINT32(nodes[2]->entity, transformChangedEventTestNotified[1]);
+
+    // Deleted entities drop their queued event
+    transformChangedEventTestNotifiedCount = 0;
+    cre_scene_manager_queue_transform_changed_event(nodes[2]->entity);
+    cre_queue_destroy_tree_node_entity_all(nodes[2]);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_flush_transform_changed_events();
+    TEST_ASSERT_EQUAL_UINT(0, transformChangedEventTestNotifiedCount);
+
+    cre_queue_destroy_tree_node_entity_all(nodes[0]);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Component Pool Test ---//
+#define COMPONENT_POOL_TEST_COMPONENT_COUNT (CRE_COMPONENT_POOL_CHUNK_SIZE * 8)
+
+void cre_component_pool_test(void) {
+    static SpriteComponent* sprites[COMPONENT_POOL_TEST_COMPONENT_COUNT];
+    TEST_ASSERT_TRUE(cre_component_pool_is_registered(SPRITE_COMPONENT_INDEX));
+    TEST_ASSERT_FALSE(cre_component_pool_is_registered(TILEMAP_COMPONENT_INDEX));
+
+    // Created components start with the values from the component's create function
+    SpriteComponent* spriteComponent = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, spriteComponent->modulate.a);
+    TEST_ASSERT_EQUAL_UINT32(SKA_SHADER_INSTANCE_INVALID_ID, spriteComponent->shaderInstanceId);
+    TEST_ASSERT_EQUAL_UINT32(0, cre_component_pool_get_slot(SPRITE_COMPONENT_INDEX, spriteComponent));
+    spriteComponent->origin.x = 8.0f;
+    SpriteComponent* copiedSprite = (SpriteComponent*)cre_component_pool_copy(SPRITE_COMPONENT_INDEX, spriteComponent);
+    TEST_ASSERT_EQUAL_FLOAT(8.0f, copiedSprite->origin.x);
+    TEST_ASSERT_EQUAL_UINT32(1, cre_component_pool_get_slot(SPRITE_COMPONENT_INDEX, copiedSprite));
+    TEST_ASSERT_EQUAL_PTR(copiedSprite, cre_component_pool_get_component_from_slot(SPRITE_COMPONENT_INDEX, 1));
+    CreComponentPoolStats stats = cre_component_pool_get_stats(SPRITE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.activeCount);
+    TEST_ASSERT_EQUAL_UINT32(CRE_COMPONENT_POOL_CHUNK_SIZE, stats.capacity);
+
+    // Freed slots are reused first and other slots don't move
+    cre_component_pool_free(SPRITE_COMPONENT_INDEX, spriteComponent);
+    SpriteComponent* reusedSprite = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_PTR(spriteComponent, reusedSprite);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, reusedSprite->origin.x);
+    TEST_ASSERT_EQUAL_UINT32(1, cre_component_pool_get_slot(SPRITE_COMPONENT_INDEX, copiedSprite));
+    cre_component_pool_free(SPRITE_COMPONENT_INDEX, reusedSprite);
+    cre_component_pool_free(SPRITE_COMPONENT_INDEX, copiedSprite);
+
+    // Heap components aren't owned by the pool
+    SpriteComponent* heapSprite = sprite_component_create();
+    TEST_ASSERT_FALSE(cre_component_pool_owns(SPRITE_COMPONENT_INDEX, heapSprite));
+    TEST_ASSERT_EQUAL_UINT32(CRE_COMPONENT_POOL_INVALID_SLOT, cre_component_pool_get_slot(SPRITE_COMPONENT_INDEX, heapSprite));
+
+    // Releasing an entity only hands back its pooled components
+    const SkaEntity entity = ska_ecs_entity_create();
+    ska_ecs_component_manager_set_component(entity, NODE_COMPONENT_INDEX, cre_component_pool_create(NODE_COMPONENT_INDEX));
+    ska_ecs_component_manager_set_component(entity, SPRITE_COMPONENT_INDEX, heapSprite);
+    TEST_ASSERT_EQUAL_UINT32(1, cre_component_pool_get_stats(NODE_COMPONENT_INDEX).activeCount);
+    cre_component_pool_release_entity_components(entity);
+    TEST_ASSERT_EQUAL_UINT32(0, cre_component_pool_get_stats(NODE_COMPONENT_INDEX).activeCount);
+    TEST_ASSERT_NULL(ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX));
+    TEST_ASSERT_EQUAL_PTR(heapSprite, ska_ecs_component_manager_get_component_unchecked(entity, SPRITE_COMPONENT_INDEX));
+    ska_ecs_component_manager_remove_all_components(entity);
+    ska_ecs_entity_return(entity);
+
+    // Chunks are added as needed, every slot (past the first chunk too) maps back to its component
+    for (int32 i = 0; i < COMPONENT_POOL_TEST_COMPONENT_COUNT; i++) {
+        sprites[i] = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+    }
+    for (int32 i = 0; i < COMPONENT_POOL_TEST_COMPONENT_COUNT; i++) {
+        const uint32 slot = cre_component_pool_get_slot(SPRITE_COMPONENT_INDEX, sprites[i]);
+        TEST_ASSERT_NOT_EQUAL_UINT32(CRE_COMPONENT_POOL_INVALID_SLOT, slot);
+        TEST_ASSERT_EQUAL_PTR(sprites[i], cre_component_pool_get_component_from_slot(SPRITE_COMPONENT_INDEX, slot));
+        cre_component_pool_free(SPRITE_COMPONENT_INDEX, sprites[i]);
+    }
+    stats = cre_component_pool_get_stats(SPRITE_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.activeCount);
+    TEST_ASSERT_EQUAL_UINT32(COMPONENT_POOL_TEST_COMPONENT_COUNT, stats.capacity);
+}
+
+//--- Component View Test ---//
+#define COMPONENT_VIEW_TEST_SPRITE_COUNT 100
+
+void cre_component_view_test(void) {
+    static SkaEntity spriteEntities[COMPONENT_VIEW_TEST_SPRITE_COUNT];
+    CreComponentView view;
+    cre_component_view_initialize(&view, (SkaComponentIndex[]){ TRANSFORM2D_COMPONENT_INDEX, SPRITE_COMPONENT_INDEX }, 2);
+    for (int32 i = 0; i < COMPONENT_VIEW_TEST_SPRITE_COUNT; i++) {
+        const SkaEntity entity = ska_ecs_entity_create();
+        Transform2DComponent* transformComp = (Transform2DComponent*)cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX);
+        transformComp->localTransform.position.x = 1.0f;
+        ska_ecs_component_manager_set_component(entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+        SpriteComponent* spriteComponent = (SpriteComponent*)cre_component_pool_create(SPRITE_COMPONENT_INDEX);
+        spriteComponent->drawSource.w = 2.0f;
+        ska_ecs_component_manager_set_component(entity, SPRITE_COMPONENT_INDEX, spriteComponent);
+        cre_component_view_add_entity(&view, entity);
+        spriteEntities[i] = entity;
+    }
+    TEST_ASSERT_EQUAL_UINT32(COMPONENT_VIEW_TEST_SPRITE_COUNT, view.entryCount);
+    const CreComponentViewEntry* firstEntry = cre_component_view_get_entry(&view, spriteEntities[0]);
+    TEST_ASSERT_NOT_NULL(firstEntry);
+    TEST_ASSERT_EQUAL_PTR(ska_ecs_component_manager_get_component(spriteEntities[0], SPRITE_COMPONENT_INDEX), firstEntry->components[1]);
+
+    // Entries are in registration order and point at the entity's components
+    int32 entryIndex = 0;
+    CRE_COMPONENT_VIEW_FOR(&view, entry) {
+        TEST_ASSERT_EQUAL_UINT32(spriteEntities[entryIndex], entry->entity);
+        TEST_ASSERT_EQUAL_PTR(ska_ecs_component_manager_get_component(entry->entity, TRANSFORM2D_COMPONENT_INDEX), entry->components[0]);
+        TEST_ASSERT_EQUAL_PTR(ska_ecs_component_manager_get_component(entry->entity, SPRITE_COMPONENT_INDEX), entry->components[1]);
+        entryIndex++;
+    }
+    TEST_ASSERT_EQUAL_INT(COMPONENT_VIEW_TEST_SPRITE_COUNT, entryIndex);
+
+    // Removing leaves a tombstone, compacting keeps the registration order
+    cre_component_view_remove_entity(&view, spriteEntities[1]);
+    TEST_ASSERT_FALSE(cre_component_view_has_entity(&view, spriteEntities[1]));
+    TEST_ASSERT_EQUAL_UINT32(COMPONENT_VIEW_TEST_SPRITE_COUNT - 1, cre_component_view_get_entity_count(&view));
+    TEST_ASSERT_EQUAL_UINT32(SKA_NULL_ENTITY, view.entries[1].entity);
+    uint32 iteratedCount = 0;
+    CRE_COMPONENT_VIEW_FOR(&view, entry) {
+        TEST_ASSERT_NOT_EQUAL(spriteEntities[1], entry->entity);
+        iteratedCount++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(COMPONENT_VIEW_TEST_SPRITE_COUNT - 1, iteratedCount);
+    TEST_ASSERT_EQUAL_UINT32(COMPONENT_VIEW_TEST_SPRITE_COUNT - 1, view.entryCount);
+    TEST_ASSERT_EQUAL_UINT32(spriteEntities[0], view.entries[0].entity);
+    TEST_ASSERT_EQUAL_UINT32(spriteEntities[2], view.entries[1].entity);
+    TEST_ASSERT_EQUAL_PTR(&view.entries[1], cre_component_view_get_entry(&view, spriteEntities[2]));
+
+    cre_component_view_finalize(&view);
+    for (int32 i = 0; i < COMPONENT_VIEW_TEST_SPRITE_COUNT; i++) {
+        cre_component_pool_release_entity_components(spriteEntities[i]);
+        ska_ecs_component_manager_remove_all_components(spriteEntities[i]);
+        ska_ecs_entity_return(spriteEntities[i]);
+    }
+}
+
+//--- Scene Manager Entity Stress Test ---//
+#define ENTITY_STRESS_TEST_TOTAL_NODES 100000
+#define ENTITY_STRESS_TEST_BATCH_SIZE (SKA_MAX_ENTITIES / 2 < 25000 ? SKA_MAX_ENTITIES / 2 : 25000)
+
+void cre_scene_manager_entity_stress_test(void) {
+    // Pages are only allocated for entities that are written to
+    CreEntityPagedArray pagedArray;
+    const uint32 defaultValue = 7;
+    cre_entity_paged_array_initialize(&pagedArray, sizeof(uint32), &defaultValue);
+    TEST_ASSERT_NULL(cre_entity_paged_array_get(&pagedArray, 5));
+    *(uint32*)cre_entity_paged_array_get_or_create(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1) = 42;
+    TEST_ASSERT_EQUAL_UINT32(1, pagedArray.allocatedPageCount);
+    TEST_ASSERT_NULL(cre_entity_paged_array_get(&pagedArray, 5));
+    TEST_ASSERT_EQUAL_UINT32(7, *(uint32*)cre_entity_paged_array_get(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3));
+    TEST_ASSERT_EQUAL_UINT32(42, *(uint32*)cre_entity_paged_array_get(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1));
+    TEST_ASSERT_EQUAL_UINT(CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1, cre_entity_paged_array_find_next_created(&pagedArray, 0));
+    TEST_ASSERT_EQUAL_UINT(SKA_NULL_ENTITY, cre_entity_paged_array_find_next_created(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 2));
+    // Pages are freed once their last element is released
+    cre_entity_paged_array_get_or_create(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 40);
+    cre_entity_paged_array_release(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1);
+    TEST_ASSERT_EQUAL_UINT32(7, *(uint32*)cre_entity_paged_array_get(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1));
+    TEST_ASSERT_EQUAL_UINT(CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 40, cre_entity_paged_array_find_next_created(&pagedArray, 0));
+    cre_entity_paged_array_release(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 40);
+    TEST_ASSERT_EQUAL_UINT32(0, pagedArray.allocatedPageCount);
+    TEST_ASSERT_NULL(cre_entity_paged_array_get(&pagedArray, CRE_ENTITY_PAGED_ARRAY_PAGE_SIZE * 3 + 1));
+    cre_entity_paged_array_get_or_create(&pagedArray, 5);
+    cre_entity_paged_array_reset(&pagedArray);
+    TEST_ASSERT_EQUAL_UINT32(0, pagedArray.allocatedPageCount);
+    TEST_ASSERT_NULL(cre_entity_paged_array_get(&pagedArray, 5));
+    cre_entity_paged_array_finalize(&pagedArray);
+
+    // Create and destroy nodes in batches until the total is reached, batches stay under the entity limit
+    static SceneTreeNode* batchNodes[ENTITY_STRESS_TEST_BATCH_SIZE];
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
+    ska_ecs_component_manager_set_component(root->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Root", NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(root);
+    cre_scene_manager_process_queued_creation_entities();
+    int32 createdNodeCount = 0;
+    while (createdNodeCount < ENTITY_STRESS_TEST_TOTAL_NODES) {
+        for (int32 i = 0; i < ENTITY_STRESS_TEST_BATCH_SIZE; i++) {
+            SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), root);
+            cre_scene_tree_node_add_child(root, node);
+            NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
+            nodeComponent->type = NodeBaseType_NODE2D;
+            ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, nodeComponent);
+            ska_ecs_component_manager_set_component(node->entity, TRANSFORM2D_COMPONENT_INDEX, cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX));
+            cre_scene_manager_queue_node_for_creation(node);
+            batchNodes[i] = node;
+        }
+        cre_scene_manager_process_queued_creation_entities();
+        for (int32 i = 0; i < ENTITY_STRESS_TEST_BATCH_SIZE; i++) {
+            cre_queue_destroy_tree_node_entity_all(batchNodes[i]);
+        }
+        cre_scene_manager_process_queued_deletion_entities();
+        createdNodeCount += ENTITY_STRESS_TEST_BATCH_SIZE;
+    }
+    TEST_ASSERT_NULL(root->firstChild);
+    TEST_ASSERT_EQUAL_UINT(1, cre_scene_tree_node_pool_get_active_count());
+    TEST_ASSERT_EQUAL_UINT32(0, cre_component_pool_get_stats(TRANSFORM2D_COMPONENT_INDEX).activeCount);
+    // Deleted nodes released their scene state, only the root is left to walk
+    TEST_ASSERT_EQUAL_UINT(root->entity, cre_scene_manager_find_next_node_entity(0));
+    TEST_ASSERT_EQUAL_UINT(SKA_NULL_ENTITY, cre_scene_manager_find_next_node_entity(root->entity + 1));
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Node Pool Test ---//
+#define NODE_POOL_TEST_ITERATIONS 200
+
+void cre_node_pool_test(void) {
+    ska_asset_manager_initialize();
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL);
+    ska_ecs_component_manager_set_component(root->entity, NODE_COMPONENT_INDEX, node_component_create_ex("Root", NodeBaseType_NODE));
+    cre_scene_manager_queue_node_for_creation(root);
+    cre_scene_manager_process_queued_creation_entities();
+    const CreSceneCacheId cacheId = cre_scene_template_cache_load_scene(TEST_BALL_SCENE_PATH);
+    TEST_ASSERT_NOT_EQUAL(CRE_SCENE_CACHE_INVALID_ID, cacheId);
+
+    // First acquire creates an instance
+    SceneTreeNode* ballNode = cre_node_pool_acquire(cacheId);
+    TEST_ASSERT_NOT_NULL(ballNode);
+    const SkaEntity ballEntity = ballNode->entity;
+    const SkaEntity colliderEntity = ballNode->firstChild->entity;
+    cre_scene_manager_add_node_as_child(root->entity, ballEntity);
+    cre_scene_manager_process_queued_creation_entities();
+    CreNodePoolStats stats = cre_node_pool_get_stats(cacheId);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.activeCount);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.createdCount);
+    TEST_ASSERT_TRUE(cre_node_pool_is_instance_root(ballEntity));
+    TEST_ASSERT_FALSE(cre_node_pool_is_instance_root(colliderEntity));
+
+    // Released instances are detached, skipped by systems and reset to the template's values
+    Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(ballEntity, TRANSFORM2D_COMPONENT_INDEX);
+    const SkaVector2 templatePosition = transformComp->localTransform.position;
+    transformComp->localTransform.position.x += 50.0f;
+    TEST_ASSERT_TRUE(cre_node_pool_release(ballEntity));
+    TEST_ASSERT_FALSE(cre_node_pool_release(ballEntity));
+    TEST_ASSERT_NULL(ballNode->parent);
+    TEST_ASSERT_NULL(root->firstChild);
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_pooled(ballEntity));
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_pooled(colliderEntity));
+    TEST_ASSERT_EQUAL_FLOAT(templatePosition.x, transformComp->localTransform.position.x);
+    TEST_ASSERT_EQUAL_UINT(SKA_NULL_ENTITY, cre_scene_manager_get_entity_child_by_name(root->entity, "Ball"));
+    stats = cre_node_pool_get_stats(cacheId);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.activeCount);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.idleCount);
+
+    // Acquiring again hands back the same entities
+    TEST_ASSERT_EQUAL_PTR(ballNode, cre_node_pool_acquire(cacheId));
+    cre_scene_manager_add_node_as_child(root->entity, ballEntity);
+    TEST_ASSERT_FALSE(cre_scene_manager_is_entity_pooled(ballEntity));
+    TEST_ASSERT_FALSE(cre_scene_manager_is_entity_pooled(colliderEntity));
+    TEST_ASSERT_EQUAL_PTR(root, ballNode->parent);
+    TEST_ASSERT_EQUAL_UINT(ballEntity, cre_scene_manager_get_entity_child_by_name(root->entity, "Ball"));
+    stats = cre_node_pool_get_stats(cacheId);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.activeCount);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reusedCount);
+
+    // Spawning and freeing over and over keeps reusing the one instance
+    for (int32 i = 0; i < NODE_POOL_TEST_ITERATIONS; i++) {
+        TEST_ASSERT_TRUE(cre_node_pool_release(ballEntity));
+        cre_node_pool_acquire(cacheId);
+        cre_scene_manager_add_node_as_child(root->entity, ballEntity);
+        cre_scene_manager_process_queued_creation_entities();
+    }
+    stats = cre_node_pool_get_stats(cacheId);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.createdCount);
+    TEST_ASSERT_EQUAL_UINT32(NODE_POOL_TEST_ITERATIONS + 1, stats.reusedCount);
+
+    // Clearing deletes idle instances
+    TEST_ASSERT_TRUE(cre_node_pool_release(ballEntity));
+    cre_node_pool_clear();
+    cre_scene_manager_process_queued_deletion_entities();
+    stats = cre_node_pool_get_stats(cacheId);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.idleCount);
+    TEST_ASSERT_FALSE(cre_scene_manager_has_entity_tree_node(ballEntity));
+    TEST_ASSERT_FALSE(cre_scene_manager_is_entity_pooled(colliderEntity));
+
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_EQUAL_UINT(0, cre_scene_tree_node_pool_get_active_count());
+    cre_scene_manager_finalize();
+    ska_asset_manager_finalize();
+}
+
+//--- Process Mode Test ---//
+static SceneTreeNode* process_mode_test_create_node(SceneTreeNode* parent, const char* name, NodeProcessMode processMode) {
+    SceneTreeNode* node = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), parent);
+    if (parent != NULL) {
+        cre_scene_tree_node_add_child(parent, node);
+    }
+    NodeComponent* nodeComponent = node_component_create_ex(name, NodeBaseType_NODE);
+    nodeComponent->processMode = processMode;
+    ska_ecs_component_manager_set_component(node->entity, NODE_COMPONENT_INDEX, nodeComponent);
+    cre_scene_manager_queue_node_for_creation(node);
+    return node;
+}
+
+void cre_scene_manager_process_mode_test(void) {
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = process_mode_test_create_node(NULL, "Root", NodeProcessMode_INHERIT);
+    SceneTreeNode* menuNode = process_mode_test_create_node(root, "Menu", NodeProcessMode_ALWAYS);
+    SceneTreeNode* stageNode = process_mode_test_create_node(root, "Stage", NodeProcessMode_INHERIT);
+    SceneTreeNode* enemyNode = process_mode_test_create_node(stageNode, "Enemy", NodeProcessMode_INHERIT);
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_EQUAL_INT(NodeProcessMode_PAUSABLE, cre_scene_manager_get_entity_process_mode(root->entity));
+    TEST_ASSERT_EQUAL_INT(NodeProcessMode_ALWAYS, cre_scene_manager_get_entity_process_mode(menuNode->entity));
+    TEST_ASSERT_EQUAL_INT(NodeProcessMode_PAUSABLE, cre_scene_manager_get_entity_process_mode(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(enemyNode->entity));
+
+    // Pausing stops pausable nodes, 'always' nodes keep going
+    cre_scene_manager_set_paused(true);
+    TEST_ASSERT_TRUE(cre_scene_manager_is_paused());
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(root->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(stageNode->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(menuNode->entity));
+    cre_scene_manager_set_paused(false);
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(enemyNode->entity));
+
+    // Disabling a node disables the subtree that inherits from it until it's enabled again
+    cre_scene_manager_set_node_process_mode(stageNode->entity, NodeProcessMode_DISABLED);
+    TEST_ASSERT_EQUAL_INT(NodeProcessMode_DISABLED, cre_scene_manager_get_entity_process_mode(enemyNode->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(root->entity));
+    SceneTreeNode* lateEnemyNode = process_mode_test_create_node(stageNode, "LateEnemy", NodeProcessMode_INHERIT);
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(lateEnemyNode->entity));
+    cre_scene_manager_set_node_process_mode(stageNode->entity, NodeProcessMode_INHERIT);
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(lateEnemyNode->entity));
+
+    // Restoring a snapshot resolves the restored modes down the tree again
+    CreWorldSnapshot* snapshot = cre_world_snapshot_create();
+    cre_world_snapshot_capture(snapshot, 0);
+    cre_scene_manager_set_node_process_mode(stageNode->entity, NodeProcessMode_DISABLED);
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    cre_world_snapshot_restore(snapshot);
+    TEST_ASSERT_EQUAL_INT(NodeProcessMode_PAUSABLE, cre_scene_manager_get_entity_process_mode(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(lateEnemyNode->entity));
+    cre_world_snapshot_delete(snapshot);
+
+    // Disabled entities are parked outside of the script update lists
+    CREScriptContext* scriptContext = cre_script_context_create();
+    cre_script_context_add_update_entity(scriptContext, 1);
+    cre_script_context_add_update_entity(scriptContext, 2);
+    cre_script_context_add_update_entity(scriptContext, 3);
+    cre_script_context_add_fixed_update_entity(scriptContext, 2);
+    cre_script_context_set_entity_update_enabled(scriptContext, 2, false);
+    TEST_ASSERT_EQUAL_UINT(2, scriptContext->updateEntityCount);
+    TEST_ASSERT_EQUAL_UINT(1, scriptContext->updateEntities[0]);
+    TEST_ASSERT_EQUAL_UINT(3, scriptContext->updateEntities[1]);
+    TEST_ASSERT_EQUAL_UINT(0, scriptContext->fixedUpdateEntityCount);
+    TEST_ASSERT_EQUAL_UINT(1, scriptContext->parkedUpdateEntityCount);
+    cre_script_context_set_entity_update_enabled(scriptContext, 2, true);
+    TEST_ASSERT_EQUAL_UINT(3, scriptContext->updateEntityCount);
+    TEST_ASSERT_EQUAL_UINT(1, scriptContext->fixedUpdateEntityCount);
+    TEST_ASSERT_EQUAL_UINT(0, scriptContext->parkedUpdateEntityCount);
+    cre_script_context_set_entity_update_enabled(scriptContext, 3, false);
+    cre_script_context_remove_entity(scriptContext, 3);
+    TEST_ASSERT_EQUAL_UINT(2, scriptContext->updateEntityCount);
+    TEST_ASSERT_EQUAL_UINT(0, scriptContext->parkedUpdateEntityCount);
+    cre_script_context_destroy(scriptContext);
+
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Visibility Notifier Test ---//
+typedef struct VisibilityNotifierTestQueryResult {
+    uint32 count;
+    uint32 entityHits[8];
+} VisibilityNotifierTestQueryResult;
+
+static void visibility_notifier_test_on_query(SkaEntity entity, void* userData) {
+    VisibilityNotifierTestQueryResult* result = (VisibilityNotifierTestQueryResult*)userData;
+    result->count++;
+    result->entityHits[entity]++;
+}
+
+static VisibilityNotifierTestQueryResult visibility_notifier_test_query(CreSpatialGrid* grid, SkaRect2 rect) {
+    VisibilityNotifierTestQueryResult result = {0};
+    cre_spatial_grid_query(grid, &rect, visibility_notifier_test_on_query, &result);
+    return result;
+}
+
+void cre_visibility_notifier_test(void) {
+    // Spatial grid, entities spanning multiple cells are only returned once per query
+    CreSpatialGrid grid;
+    cre_spatial_grid_initialize(&grid, 32.0f);
+    cre_spatial_grid_insert_or_update(&grid, 1, &(SkaRect2){ 0.0f, 0.0f, 10.0f, 10.0f });
+    cre_spatial_grid_insert_or_update(&grid, 2, &(SkaRect2){ 100.0f, 100.0f, 80.0f, 80.0f });
+    cre_spatial_grid_insert_or_update(&grid, 3, &(SkaRect2){ -40.0f, -40.0f, 10.0f, 10.0f });
+    TEST_ASSERT_EQUAL_UINT(3, grid.entityCount);
+    VisibilityNotifierTestQueryResult result = visibility_notifier_test_query(&grid, (SkaRect2){ 0.0f, 0.0f, 64.0f, 64.0f });
+    TEST_ASSERT_EQUAL_UINT(1, result.count);
+    TEST_ASSERT_EQUAL_UINT(1, result.entityHits[1]);
+    result = visibility_notifier_test_query(&grid, (SkaRect2){ -50.0f, -50.0f, 300.0f, 300.0f });
+    TEST_ASSERT_EQUAL_UINT(3, result.count);
+    TEST_ASSERT_EQUAL_UINT(1, result.entityHits[2]);
+    // Rects sharing a cell with the query but not overlapping it aren't returned
+    result = visibility_notifier_test_query(&grid, (SkaRect2){ 12.0f, 12.0f, 4.0f, 4.0f });
+    TEST_ASSERT_EQUAL_UINT(0, result.count);
+
+    cre_spatial_grid_insert_or_update(&grid, 2, &(SkaRect2){ 5.0f, 5.0f, 80.0f, 80.0f });
+    result = visibility_notifier_test_query(&grid, (SkaRect2){ 0.0f, 0.0f, 20.0f, 20.0f });
+    TEST_ASSERT_EQUAL_UINT(2, result.count);
+    result = visibility_notifier_test_query(&grid, (SkaRect2){ 150.0f, 150.0f, 20.0f, 20.0f });
+    TEST_ASSERT_EQUAL_UINT(0, result.count);
+    cre_spatial_grid_remove(&grid, 1);
+    TEST_ASSERT_FALSE(cre_spatial_grid_has_entity(&grid, 1));
+    TEST_ASSERT_TRUE(cre_spatial_grid_has_entity(&grid, 2));
+    result = visibility_notifier_test_query(&grid, (SkaRect2){ 0.0f, 0.0f, 20.0f, 20.0f });
+    TEST_ASSERT_EQUAL_UINT(1, result.count);
+    TEST_ASSERT_EQUAL_UINT(1, result.entityHits[2]);
+    cre_spatial_grid_finalize(&grid);
+
+    // Off screen suspension is inherited by children, including ones added while suspended
+    cre_scene_manager_initialize();
+    SceneTreeNode* root = process_mode_test_create_node(NULL, "Root", NodeProcessMode_INHERIT);
+    SceneTreeNode* enemyNode = process_mode_test_create_node(root, "Enemy", NodeProcessMode_INHERIT);
+    SceneTreeNode* weaponNode = process_mode_test_create_node(enemyNode, "Weapon", NodeProcessMode_INHERIT);
+    cre_scene_manager_process_queued_creation_entities();
+    cre_scene_manager_set_node_off_screen_suspended(enemyNode->entity, true);
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(root->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(weaponNode->entity));
+    SceneTreeNode* lateNode = process_mode_test_create_node(enemyNode, "Late", NodeProcessMode_INHERIT);
+    cre_scene_manager_process_queued_creation_entities();
+    TEST_ASSERT_TRUE(cre_scene_manager_is_entity_off_screen_suspended(lateNode->entity));
+
+    // A child with its own suspended notifier stays suspended when its parent comes back on screen
+    cre_scene_manager_set_node_off_screen_suspended(weaponNode->entity, true);
+    cre_scene_manager_set_node_off_screen_suspended(enemyNode->entity, false);
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(enemyNode->entity));
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(lateNode->entity));
+    TEST_ASSERT_FALSE(cre_scene_manager_can_entity_process(weaponNode->entity));
+    cre_scene_manager_set_node_off_screen_suspended(weaponNode->entity, false);
+    TEST_ASSERT_TRUE(cre_scene_manager_can_entity_process(weaponNode->entity));
+
+    cre_queue_destroy_tree_node_entity_all(root);
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_finalize();
+}
+
+//--- Component Versions Test ---//
+
+void cre_component_versions_test(void) {
+    const SkaEntity entity = 900;
+    const SkaEntity otherEntity = 901;
+
+    // Components that were never marked have no version and aren't reported as changed
+    const uint32 startFrame = cre_component_versions_get_frame();
+    TEST_ASSERT_EQUAL_UINT(0, cre_component_versions_get(entity, COLLIDER2D_COMPONENT_INDEX).version);
+    TEST_ASSERT_FALSE(cre_component_versions_has_changed_since(entity, COLLIDER2D_COMPONENT_INDEX, 0));
+
+    const uint32 startTypeVersion = cre_component_versions_get_type_version(COLLIDER2D_COMPONENT_INDEX);
+    cre_component_versions_mark_changed(entity, COLLIDER2D_COMPONENT_INDEX);
+    cre_component_versions_mark_changed(entity, COLLIDER2D_COMPONENT_INDEX);
+    TEST_ASSERT_EQUAL_UINT(2, cre_component_versions_get(entity, COLLIDER2D_COMPONENT_INDEX).version);
+    TEST_ASSERT_EQUAL_UINT(startFrame, cre_component_versions_get(entity, COLLIDER2D_COMPONENT_INDEX).changedFrame);
+    TEST_ASSERT_EQUAL_UINT(startTypeVersion + 2, cre_component_versions_get_type_version(COLLIDER2D_COMPONENT_INDEX));
+    TEST_ASSERT_TRUE(cre_component_versions_has_changed_since(entity, COLLIDER2D_COMPONENT_INDEX, startFrame));
+    TEST_ASSERT_FALSE(cre_component_versions_has_changed_since(entity, SPRITE_COMPONENT_INDEX, startFrame));
+    TEST_ASSERT_FALSE(cre_component_versions_has_changed_since(otherEntity, COLLIDER2D_COMPONENT_INDEX, startFrame));
+
+    // A system that last ran in 'startFrame' sees the change, one that ran after it doesn't
+    cre_component_versions_advance_frame();
+    const uint32 nextFrame = cre_component_versions_get_frame();
+    TEST_ASSERT_EQUAL_UINT(startFrame + 1, nextFrame);
+    TEST_ASSERT_TRUE(cre_component_versions_has_changed_since(entity, COLLIDER2D_COMPONENT_INDEX, startFrame));
+    TEST_ASSERT_FALSE(cre_component_versions_has_changed_since(entity, COLLIDER2D_COMPONENT_INDEX, nextFrame));
+
+    // Deleting bumps only the component types that were marked for the entity
+    const uint32 spriteTypeVersion = cre_component_versions_get_type_version(SPRITE_COMPONENT_INDEX);
+    cre_component_versions_mark_all_changed(entity);
+    TEST_ASSERT_EQUAL_UINT(3, cre_component_versions_get(entity, COLLIDER2D_COMPONENT_INDEX).version);
+    TEST_ASSERT_TRUE(cre_component_versions_has_changed_since(entity, COLLIDER2D_COMPONENT_INDEX, nextFrame));
+    TEST_ASSERT_EQUAL_UINT(0, cre_component_versions_get(entity, SPRITE_COMPONENT_INDEX).version);
+    TEST_ASSERT_EQUAL_UINT(spriteTypeVersion, cre_component_versions_get_type_version(SPRITE_COMPONENT_INDEX));
+}
+
+//--- Entity Builder Test ---//
+
+void cre_entity_builder_test(void) {
+    const SkaEntity entity = ska_ecs_entity_create();
+    CreEntityBuilder builder;
+    cre_entity_builder_begin(&builder, entity);
+    NodeComponent* nodeComponent = (NodeComponent*)cre_component_pool_create(NODE_COMPONENT_INDEX);
+    Transform2DComponent* transformComp = (Transform2DComponent*)cre_component_pool_create(TRANSFORM2D_COMPONENT_INDEX);
+    cre_entity_builder_set_component(&builder, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    cre_entity_builder_set_component(&builder, NODE_COMPONENT_INDEX, nodeComponent);
+
+    // Components are only handed to the component manager when the entity is built
+    TEST_ASSERT_NULL(ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX));
+    cre_entity_builder_build(&builder);
+    TEST_ASSERT_EQUAL_PTR(nodeComponent, ska_ecs_component_manager_get_component_unchecked(entity, NODE_COMPONENT_INDEX));
+    TEST_ASSERT_EQUAL_PTR(transformComp, ska_ecs_component_manager_get_component_unchecked(entity, TRANSFORM2D_COMPONENT_INDEX));
+    TEST_ASSERT_NULL(ska_ecs_component_manager_get_component_unchecked(entity, SPRITE_COMPONENT_INDEX));
+    TEST_ASSERT_EQUAL_UINT(NODE_COMPONENT_TYPE | TRANSFORM2D_COMPONENT_TYPE, ska_ecs_component_manager_get_component_signature(entity));
+
+    cre_component_pool_release_entity_components(entity);
+    ska_ecs_component_manager_remove_all_components(entity);
+    ska_ecs_entity_return(entity);
+}
+
+//--- Replay Seek Test ---//
+#define REPLAY_SEEK_TEST_PATH "engine/test/resources/test_replay_seek.crrp"
+#define REPLAY_SEEK_TEST_TRUNCATED_PATH "engine/test/resources/test_replay_truncated.crrp"
+#define REPLAY_SEEK_TEST_FRAME_COUNT 100
+#define REPLAY_SEEK_TEST_KEYFRAME_INTERVAL 10
+#define REPLAY_SEEK_TEST_SPAWN_FRAME 25
+#define REPLAY_SEEK_TEST_DELETE_FRAME 55
+
+typedef struct ReplaySeekTestState {
+    f32 playerX;
+    bool hasBullet;
+    f32 bulletX;
+} ReplaySeekTestState;
+
+static SceneTreeNode* replaySeekTestRoot = NULL;
+
+static SceneTreeNode* replay_seek_test_create_node(SceneTreeNode* parent, const char* name, f32 x) {
+    SceneTreeNode* node = process_mode_test_create_node(parent, name, NodeProcessMode_INHERIT);
+    Transform2DComponent* transformComp = transform2d_component_create();
+    transformComp->localTransform.position.x = x;
+    ska_ecs_component_manager_set_component(node->entity, TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    return node;
+}
+
+static Transform2DComponent* replay_seek_test_get_child_transform(const char* name) {
+    const SkaEntity entity = cre_scene_manager_get_entity_child_by_name(replaySeekTestRoot->entity, name);
+    return entity != SKA_NULL_ENTITY ? (Transform2DComponent*)ska_ecs_component_manager_get_component(entity, TRANSFORM2D_COMPONENT_INDEX) : NULL;
+}
+
+// Same as reloading the initial scene
+static void replay_seek_test_restart() {
+    if (replaySeekTestRoot != NULL) {
+        cre_queue_destroy_tree_node_entity_all(replaySeekTestRoot);
+        cre_scene_manager_process_queued_deletion_entities();
+    }
+    replaySeekTestRoot = replay_seek_test_create_node(NULL, "Root", 0.0f);
+    replay_seek_test_create_node(replaySeekTestRoot, "Player", 0.0f);
+    cre_scene_manager_process_queued_creation_entities();
+}
+
+// Game logic only looks nodes up by name so it works the same after keyframe restores and restarts
+static void replay_seek_test_step() {
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_process_queued_creation_entities();
+    cre_replay_pre_fixed_update();
+    const uint32 frame = cre_replay_get_current_frame();
+    CreReplayActionState moveState;
+    cre_replay_get_action_state("move", 0, &moveState);
+    Transform2DComponent* playerTransformComp = replay_seek_test_get_child_transform("Player");
+    playerTransformComp->localTransform.position.x += moveState.pressed ? 2.0f : 1.0f;
+    if (frame == REPLAY_SEEK_TEST_SPAWN_FRAME) {
+        replay_seek_test_create_node(replaySeekTestRoot, "Bullet", playerTransformComp->localTransform.position.x);
+    }
+    Transform2DComponent* bulletTransformComp = replay_seek_test_get_child_transform("Bullet");
+    if (bulletTransformComp != NULL) {
+        bulletTransformComp->localTransform.position.x += 3.0f;
+        if (frame == REPLAY_SEEK_TEST_DELETE_FRAME) {
+            const SkaEntity bulletEntity = cre_scene_manager_get_entity_child_by_name(replaySeekTestRoot->entity, "Bullet");
+            cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_entity_tree_node(bulletEntity));
+        }
+    }
+    cre_replay_post_fixed_update();
+}
+
+static ReplaySeekTestState replay_seek_test_get_state() {
+    const Transform2DComponent* bulletTransformComp = replay_seek_test_get_child_transform("Bullet");
+    return (ReplaySeekTestState){
+        .playerX = replay_seek_test_get_child_transform("Player")->localTransform.position.x,
+        .hasBullet = bulletTransformComp != NULL,
+        .bulletX = bulletTransformComp != NULL ? bulletTransformComp->localTransform.position.x : 0.0f
+    };
+}
+
+static void replay_seek_test_assert_state(const ReplaySeekTestState* expected) {
+    const ReplaySeekTestState state = replay_seek_test_get_state();
+    TEST_ASSERT_EQUAL_FLOAT(expected->playerX, state.playerX);
+    TEST_ASSERT_EQUAL(expected->hasBullet, state.hasBullet);
+    TEST_ASSERT_EQUAL_FLOAT(expected->bulletX, state.bulletX);
+}
+
+void cre_replay_seek_test(void) {
+    // Write a replay file by hand with a single 'move' action that is held every few frames
+    FILE* file = fopen(REPLAY_SEEK_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    const uint32 version = 1;
+    const uint32 actionCount = 1;
+    const uint32 frameCount = REPLAY_SEEK_TEST_FRAME_COUNT;
+    char actionName[32] = "move";
+    const int32 deviceId = 0;
+    fwrite("CRRP", 1, 4, file);
+    fwrite(&version, sizeof(uint32), 1, file);
+    fwrite(&actionCount, sizeof(uint32), 1, file);
+    fwrite(&frameCount, sizeof(uint32), 1, file);
+    fwrite(actionName, 1, sizeof(actionName), file);
+    fwrite(&deviceId, sizeof(int32), 1, file);
+    for (uint32 frame = 0; frame < REPLAY_SEEK_TEST_FRAME_COUNT; frame++) {
+        const uint64 input = frame % 7 < 3 ? 1 : 0;
+        fwrite(&input, sizeof(uint64), 1, file);
+    }
+    fclose(file);
+
+    cre_scene_manager_initialize();
+    cre_replay_initialize(replay_seek_test_step, replay_seek_test_restart, REPLAY_SEEK_TEST_KEYFRAME_INTERVAL);
+    replay_seek_test_restart();
+    TEST_ASSERT_TRUE(cre_replay_start_playback(REPLAY_SEEK_TEST_PATH));
+
+    // Straight playback is what every seek is compared against
+    ReplaySeekTestState expectedStates[REPLAY_SEEK_TEST_FRAME_COUNT + 1];
+    expectedStates[0] = replay_seek_test_get_state();
+    while (cre_replay_get_current_frame() < REPLAY_SEEK_TEST_FRAME_COUNT) {
+        replay_seek_test_step();
+        expectedStates[cre_replay_get_current_frame()] = replay_seek_test_get_state();
+    }
+    TEST_ASSERT_TRUE(expectedStates[40].hasBullet);
+    TEST_ASSERT_FALSE(expectedStates[REPLAY_SEEK_TEST_FRAME_COUNT].hasBullet);
+
+    // Keyframe at 30 still has the deleted bullet, falls back to the one at 20
+    TEST_ASSERT_TRUE(cre_replay_seek(30));
+    TEST_ASSERT_EQUAL_UINT(10, cre_replay_get_stats().lastSeekFramesSimulated);
+    replay_seek_test_assert_state(&expectedStates[30]);
+
+    TEST_ASSERT_TRUE(cre_replay_seek(40));
+    TEST_ASSERT_EQUAL_UINT(40, cre_replay_get_current_frame());
+    replay_seek_test_assert_state(&expectedStates[40]);
+
+    // No keyframe before the bullet spawned matches the nodes alive now, the replay restarts from the first frame
+    TEST_ASSERT_TRUE(cre_replay_seek(10));
+    TEST_ASSERT_EQUAL_UINT(10, cre_replay_get_stats().lastSeekFramesSimulated);
+    replay_seek_test_assert_state(&expectedStates[10]);
+
+    // Forward past the spawn and deletion
+    TEST_ASSERT_TRUE(cre_replay_seek(70));
+    TEST_ASSERT_EQUAL_UINT(60, cre_replay_get_stats().lastSeekFramesSimulated);
+    replay_seek_test_assert_state(&expectedStates[70]);
+
+    // Keyframe at 60 was taken after the deletion so it can be restored directly
+    TEST_ASSERT_TRUE(cre_replay_seek(60));
+    TEST_ASSERT_EQUAL_UINT(0, cre_replay_get_stats().lastSeekFramesSimulated);
+    replay_seek_test_assert_state(&expectedStates[60]);
+
+    // A replay that fails to load keeps the callbacks for the next one
+    TEST_ASSERT_FALSE(cre_replay_start_playback("engine/test/resources/missing_replay.crrp"));
+    // Frame count past the end of the file is rejected before anything is allocated for it
+    file = fopen(REPLAY_SEEK_TEST_TRUNCATED_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    const uint32 truncatedFrameCount = UINT32_MAX;
+    const uint64 truncatedInput = 1;
+    fwrite("CRRP", 1, 4, file);
+    fwrite(&version, sizeof(uint32), 1, file);
+    fwrite(&actionCount, sizeof(uint32), 1, file);
+    fwrite(&truncatedFrameCount, sizeof(uint32), 1, file);
+    fwrite(actionName, 1, sizeof(actionName), file);
+    fwrite(&deviceId, sizeof(int32), 1, file);
+    fwrite(&truncatedInput, sizeof(uint64), 1, file);
+    fclose(file);
+    TEST_ASSERT_FALSE(cre_replay_start_playback(REPLAY_SEEK_TEST_TRUNCATED_PATH));
+    remove(REPLAY_SEEK_TEST_TRUNCATED_PATH);
+    TEST_ASSERT_TRUE(cre_replay_start_playback(REPLAY_SEEK_TEST_PATH));
+    replay_seek_test_restart();
+    TEST_ASSERT_TRUE(cre_replay_seek(40));
+    replay_seek_test_assert_state(&expectedStates[40]);
+
+    cre_replay_finalize();
+    cre_queue_destroy_tree_node_entity_all(replaySeekTestRoot);
+    cre_scene_manager_process_queued_deletion_entities();
+    replaySeekTestRoot = NULL;
+    cre_scene_manager_finalize();
+    remove(REPLAY_SEEK_TEST_PATH);
+}
+
+//--- Replay Script Seek Test ---//
+#define REPLAY_SCRIPT_SEEK_TEST_PATH "engine/test/resources/test_replay_script_seek.crrp"
+#define REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT 50
+#define REPLAY_SCRIPT_SEEK_TEST_RANDOM_SEED 1234
+
+typedef struct ReplayScriptSeekTestClassData {
+    uint32 fixedUpdateCount;
+} ReplayScriptSeekTestClassData;
+
+static SceneTreeNode* replayScriptSeekTestRoot = NULL;
+
+static void replay_script_seek_test_on_start(CRENativeScriptClass* nativeScriptClass) {}
+
+static void replay_script_seek_test_on_end(CRENativeScriptClass* nativeScriptClass) {
+    SKA_FREE(nativeScriptClass->instance_data);
+}
+
+// Moves further every frame from a counter only the script instance holds, plus a random step
+static void replay_script_seek_test_fixed_update(CRENativeScriptClass* nativeScriptClass, f32 deltaTime) {
+    ReplayScriptSeekTestClassData* data = (ReplayScriptSeekTestClassData*)nativeScriptClass->instance_data;
+    data->fixedUpdateCount++;
+    Transform2DComponent* transformComp = (Transform2DComponent*)ska_ecs_component_manager_get_component(nativeScriptClass->entity, TRANSFORM2D_COMPONENT_INDEX);
+    transformComp->localTransform.position.x += (f32)data->fixedUpdateCount + (f32)cre_random_range(4);
+}
+
+static CRENativeScriptClass* replay_script_seek_test_create_instance(SkaEntity entity) {
+    CRENativeScriptClass* scriptClass = cre_native_class_create_new(entity, "test", "ReplayScriptSeekTest");
+    scriptClass->create_new_instance_func = replay_script_seek_test_create_instance;
+    scriptClass->on_start_func = replay_script_seek_test_on_start;
+    scriptClass->on_end_func = replay_script_seek_test_on_end;
+    scriptClass->fixed_update_func = replay_script_seek_test_fixed_update;
+    scriptClass->instance_data = SKA_ALLOC_ZEROED(ReplayScriptSeekTestClassData);
+    scriptClass->class_instance_size = sizeof(CRENativeScriptClass*);
+    return scriptClass;
+}
+
+static void replay_script_seek_test_restart() {
+    if (replayScriptSeekTestRoot != NULL) {
+        cre_queue_destroy_tree_node_entity_all(replayScriptSeekTestRoot);
+        cre_scene_manager_process_queued_deletion_entities();
+    }
+    replayScriptSeekTestRoot = replay_seek_test_create_node(NULL, "Root", 0.0f);
+    ska_ecs_component_manager_set_component(replayScriptSeekTestRoot->entity, SCRIPT_COMPONENT_INDEX,
+                                            script_component_create_ex("test", "ReplayScriptSeekTest", CreScriptContextType_NATIVE));
+    cre_scene_manager_process_queued_creation_entities();
+}
+
+static void replay_script_seek_test_step() {
+    cre_scene_manager_process_queued_deletion_entities();
+    cre_scene_manager_process_queued_creation_entities();
+    cre_replay_pre_fixed_update();
+    ska_ecs_system_event_fixed_update_systems(CRE_GLOBAL_PHYSICS_DELTA_TIME);
+    cre_replay_post_fixed_update();
+}
+
+static f32 replay_script_seek_test_get_x() {
+    return ((Transform2DComponent*)ska_ecs_component_manager_get_component(replayScriptSeekTestRoot->entity, TRANSFORM2D_COMPONENT_INDEX))->localTransform.position.x;
+}
+
+void cre_replay_script_seek_test(void) {
+    // No actions, only the seed matters
+    FILE* file = fopen(REPLAY_SCRIPT_SEEK_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    const uint32 version = 2;
+    const uint32 actionCount = 0;
+    const uint32 frameCount = REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT;
+    const uint32 randomSeed = REPLAY_SCRIPT_SEEK_TEST_RANDOM_SEED;
+    const uint64 input = 0;
+    fwrite("CRRP", 1, 4, file);
+    fwrite(&version, sizeof(uint32), 1, file);
+    fwrite(&actionCount, sizeof(uint32), 1, file);
+    fwrite(&frameCount, sizeof(uint32), 1, file);
+    fwrite(&randomSeed, sizeof(uint32), 1, file);
+    for (uint32 frame = 0; frame < REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT; frame++) {
+        fwrite(&input, sizeof(uint64), 1, file);
+    }
+    fclose(file);
+
+    cre_scene_manager_initialize();
+    cre_native_class_register_new_class(replay_script_seek_test_create_instance(SKA_NULL_ENTITY));
+    cre_replay_initialize(replay_script_seek_test_step, replay_script_seek_test_restart, 10);
+    replay_script_seek_test_restart();
+    TEST_ASSERT_EQUAL_size_t(1, cre_script_ec_system_get_instance_count());
+    TEST_ASSERT_TRUE(cre_replay_start_playback(REPLAY_SCRIPT_SEEK_TEST_PATH));
+
+    f32 expectedX[REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT + 1];
+    expectedX[0] = replay_script_seek_test_get_x();
+    while (cre_replay_get_current_frame() < REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT) {
+        replay_script_seek_test_step();
+        expectedX[cre_replay_get_current_frame()] = replay_script_seek_test_get_x();
+    }
+
+    // The keyframe at 30 would bring back the position but not the script's counter, the replay restarts instead
+    TEST_ASSERT_TRUE(cre_replay_seek(35));
+    TEST_ASSERT_EQUAL_UINT(35, cre_replay_get_stats().lastSeekFramesSimulated);
+    TEST_ASSERT_EQUAL_FLOAT(expectedX[35], replay_script_seek_test_get_x());
+
+    // Forward seeks keep simulating from the current frame
+    TEST_ASSERT_TRUE(cre_replay_seek(REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT));
+    TEST_ASSERT_EQUAL_UINT(REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT - 35, cre_replay_get_stats().lastSeekFramesSimulated);
+    TEST_ASSERT_EQUAL_FLOAT(expectedX[REPLAY_SCRIPT_SEEK_TEST_FRAME_COUNT], replay_script_seek_test_get_x());
+
+    cre_replay_finalize();
+    cre_queue_destroy_tree_node_entity_all(replayScriptSeekTestRoot);
+    cre_scene_manager_process_queued_deletion_entities();
+    replayScriptSeekTestRoot = NULL;
+    TEST_ASSERT_EQUAL_size_t(0, cre_script_ec_system_get_instance_count());
+    cre_scene_manager_finalize();
+    remove(REPLAY_SCRIPT_SEEK_TEST_PATH);
+}
+
+//--- Replay Rollback Spawn Test ---//
+#define REPLAY_ROLLBACK_SPAWN_TEST_CHARGE_FRAMES 6
+
+typedef struct ReplayRollbackSpawnTestClassData {
+    uint32 chargeFrames;
+} ReplayRollbackSpawnTestClassData;
+
+static SceneTreeNode* replayRollbackSpawnTestRoot = NULL;
+
+static void replay_rollback_spawn_test_on_start(CRENativeScriptClass* nativeScriptClass) {}
+
+static void replay_rollback_spawn_test_on_end(CRENativeScriptClass* nativeScriptClass) {
+    SKA_FREE(nativeScriptClass->instance_data);
+}
+
+// Fires a charge shot once 'attack' has been held long enough
+static void replay_rollback_spawn_test_fixed_update(CRENativeScriptClass* nativeScriptClass, f32 deltaTime) {
+    ReplayRollbackSpawnTestClassData* data = (ReplayRollbackSpawnTestClassData*)nativeScriptClass->instance_data;
+    CreReplayActionState attackState;
+    cre_replay_get_action_state("attack", 0, &attackState);
+    data->chargeFrames = attackState.pressed ? data->chargeFrames + 1 : 0;
+    if (data->chargeFrames == REPLAY_ROLLBACK_SPAWN_TEST_CHARGE_FRAMES) {
+        replay_seek_test_create_node(replayRollbackSpawnTestRoot, "ChargeShot", 0.0f);
+    }
+}
+
+static CRENativeScriptClass* replay_rollback_spawn_test_create_instance(SkaEntity entity) {
+    CRENativeScriptClass* scriptClass = cre_native_class_create_new(entity, "test", "ReplayRollbackSpawnTest");
+    scriptClass->create_new_instance_func = replay_rollback_spawn_test_create_instance;
+    scriptClass->on_start_func = replay_rollback_spawn_test_on_start;
+    scriptClass->on_end_func = replay_rollback_spawn_test_on_end;
+    scriptClass->fixed_update_func = replay_rollback_spawn_test_fixed_update;
+    scriptClass->instance_data = SKA_ALLOC_ZEROED(ReplayRollbackSpawnTestClassData);
+    scriptClass->class_instance_size = sizeof(CRENativeScriptClass*);
+    return scriptClass;
+}
+
+static void replay_rollback_spawn_test_step() {
+    if (!cre_replay_is_waiting_for_input()) {
+        replay_script_seek_test_step();
+    }
+}
+
+static bool replay_rollback_spawn_test_has_charge_shot() {
+    return cre_scene_manager_get_entity_child_by_name(replayRollbackSpawnTestRoot->entity, "ChargeShot") != SKA_NULL_ENTITY;
+}
+
+void cre_replay_rollback_spawn_test(void) {
+    CREGameProperties* gameProps = cre_game_props_get();
+    gameProps->inputActions[0] = (CREInputAction){ .name = "attack", .deviceId = 0, .predictionPolicy = CREInputPredictionPolicy_REPEAT_LAST };
+    gameProps->inputActionCount = 1;
+    const uint64 attackBit = 1 << 0;
+
+    cre_scene_manager_initialize();
+    cre_native_class_register_new_class(replay_rollback_spawn_test_create_instance(SKA_NULL_ENTITY));
+    replayRollbackSpawnTestRoot = replay_seek_test_create_node(NULL, "Root", 0.0f);
+    ska_ecs_component_manager_set_component(replayRollbackSpawnTestRoot->entity, SCRIPT_COMPONENT_INDEX,
+                                            script_component_create_ex("test", "ReplayRollbackSpawnTest", CreScriptContextType_NATIVE));
+    cre_scene_manager_process_queued_creation_entities();
+    cre_replay_initialize(replay_rollback_spawn_test_step, NULL, CRE_REPLAY_DEFAULT_KEYFRAME_INTERVAL);
+    TEST_ASSERT_TRUE(cre_replay_start_stream_playback());
+    for (uint32 frame = 0; frame < 4; frame++) {
+        TEST_ASSERT_TRUE(cre_replay_append_frame_input(frame, attackBit));
+    }
+    // What the broadcaster has at the first predicted frame
+    while (cre_replay_get_current_frame() < 4) {
+        replay_rollback_spawn_test_step();
+    }
+    CreWorldSnapshot* broadcasterSnapshot = cre_world_snapshot_create();
+    cre_world_snapshot_capture(broadcasterSnapshot, 4);
+
+    // Attack is predicted as still held, the script fires during the predicted frames
+    while (!cre_replay_is_waiting_for_input()) {
+        replay_rollback_spawn_test_step();
+    }
+    TEST_ASSERT_TRUE(replay_rollback_spawn_test_has_charge_shot());
+
+    // Attack was released, the rollback snapshot doesn't have the charge shot and neither does any keyframe
+    TEST_ASSERT_TRUE(cre_replay_append_frame_input(4, 0));
+    cre_replay_process_queued_seek();
+    TEST_ASSERT_TRUE(cre_replay_is_waiting_for_resync());
+    TEST_ASSERT_EQUAL_UINT(0, cre_replay_get_stats().rollbackCount);
+    TEST_ASSERT_EQUAL_UINT(4 + CRE_REPLAY_MAX_PREDICTION_FRAMES, cre_replay_get_current_frame());
+    // Later mispredictions are ignored until the keyframe arrives
+    TEST_ASSERT_TRUE(cre_replay_append_frame_input(5, 0));
+    cre_replay_process_queued_seek();
+    TEST_ASSERT_TRUE(cre_replay_is_waiting_for_resync());
+
+    // Spectators only load keyframes with the same nodes, the charge shot is gone by the time it arrives
+    const SkaEntity chargeShotEntity = cre_scene_manager_get_entity_child_by_name(replayRollbackSpawnTestRoot->entity, "ChargeShot");
+    cre_queue_destroy_tree_node_entity_all(cre_scene_manager_get_entity_tree_node(chargeShotEntity));
+    cre_scene_manager_process_queued_deletion_entities();
+    TEST_ASSERT_TRUE(cre_world_snapshot_has_same_entities(broadcasterSnapshot));
+    cre_replay_restore_stream_keyframe(broadcasterSnapshot);
+    TEST_ASSERT_FALSE(cre_replay_is_waiting_for_resync());
+    TEST_ASSERT_EQUAL_UINT(4, cre_replay_get_current_frame());
+
+    cre_world_snapshot_delete(broadcasterSnapshot);
+    cre_replay_finalize();
+    cre_queue_destroy_tree_node_entity_all(replayRollbackSpawnTestRoot);
+    cre_scene_manager_process_queued_deletion_entities();
+    replayRollbackSpawnTestRoot = NULL;
+    cre_scene_manager_finalize();
+    gameProps->inputActionCount = 0;
+}
+
+//--- Keyframe Stream Test ---//
+#define KEYFRAME_STREAM_TEST_ENTITY_COUNT 200
+#define KEYFRAME_STREAM_TEST_PREFIX "@spec:kf"
+
+void cre_keyframe_stream_test(void) {
+    static SkaEntity entities[KEYFRAME_STREAM_TEST_ENTITY_COUNT];
+    cre_scene_manager_initialize();
+    for (int32 i = 0; i < KEYFRAME_STREAM_TEST_ENTITY_COUNT; i++) {
+        entities[i] = cre_scene_tree_create_tree_node(ska_ecs_entity_create(), NULL)->entity;
+        ska_ecs_component_manager_set_component(entities[i], NODE_COMPONENT_INDEX, node_component_create_ex("Node", NodeBaseType_NODE2D));
+        Transform2DComponent* transformComp = transform2d_component_create();
+        transformComp->localTransform.position = (SkaVector2){ .x = (f32)i + 0.5f, .y = (f32)(i * 3) };
+        ska_ecs_component_manager_set_component(entities[i], TRANSFORM2D_COMPONENT_INDEX, transformComp);
+    }
+    CreWorldSnapshot* snapshot = cre_world_snapshot_create();
+    CreWorldSnapshot* decodedSnapshot = cre_world_snapshot_create();
+    CreSnapshotDelta* encoded = cre_snapshot_delta_create();
+    CreKeyframeAssembler* assembler = cre_keyframe_assembler_create();
+    cre_world_snapshot_capture(snapshot, 600);
+    cre_snapshot_delta_encode(encoded, NULL, snapshot);
+    const uint32 chunkCount = cre_keyframe_stream_get_chunk_count(encoded);
+    TEST_ASSERT_GREATER_THAN_UINT(2, chunkCount);
+
+    // Loopback, chunks go straight from the broadcaster's writer into the spectator's assembler in reverse order
+    static char messages[CRE_KEYFRAME_STREAM_MAX_CHUNKS][1024];
+    for (uint32 chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+        TEST_ASSERT_TRUE(cre_keyframe_stream_write_chunk(encoded, chunkIndex, KEYFRAME_STREAM_TEST_PREFIX, messages[chunkIndex], sizeof(messages[chunkIndex])));
+    }
+    const size_t prefixLength = strlen(KEYFRAME_STREAM_TEST_PREFIX);
+    for (uint32 i = 0; i < chunkCount - 1; i++) {
+        const char* chunk = messages[chunkCount - 1 - i] + prefixLength;
+        TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INCOMPLETE, cre_keyframe_assembler_add_chunk(assembler, chunk));
+        // Duplicates are ignored
+        TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INCOMPLETE, cre_keyframe_assembler_add_chunk(assembler, chunk));
+    }
+    TEST_ASSERT_TRUE(cre_keyframe_assembler_is_in_progress(assembler));
+
+    // Bad chunks are rejected without touching the keyframe being put together
+    char badChunk[1024];
+    snprintf(badChunk, sizeof(badChunk), "600 %u %u %zu %zu 0 %u AAAA", encoded->entityCount, encoded->randomState, encoded->decodedSize, encoded->size + CRE_KEYFRAME_STREAM_CHUNK_SIZE, chunkCount + 1);
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INVALID, cre_keyframe_assembler_add_chunk(assembler, badChunk));
+    snprintf(badChunk, sizeof(badChunk), "600 %u %u %zu %zu %u %u AAAA", encoded->entityCount, encoded->randomState, encoded->decodedSize, encoded->size, chunkCount, chunkCount);
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INVALID, cre_keyframe_assembler_add_chunk(assembler, badChunk));
+    snprintf(badChunk, sizeof(badChunk), "600 %u %u %zu %zu 0 %u AAAA", encoded->entityCount, encoded->randomState, encoded->decodedSize, encoded->size, chunkCount);
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INVALID, cre_keyframe_assembler_add_chunk(assembler, badChunk));
+    snprintf(badChunk, sizeof(badChunk), "601 1 0 %u %u 0 %u AAAA", (uint32)CRE_KEYFRAME_STREAM_MAX_DECODED_SIZE + 1, (uint32)CRE_KEYFRAME_STREAM_MAX_ENCODED_SIZE + 1, CRE_KEYFRAME_STREAM_MAX_CHUNKS + 1);
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INVALID, cre_keyframe_assembler_add_chunk(assembler, badChunk));
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_INVALID, cre_keyframe_assembler_add_chunk(assembler, "600 garbage"));
+
+    TEST_ASSERT_EQUAL_INT(CreKeyframeChunkResult_COMPLETE, cre_keyframe_assembler_add_chunk(assembler, messages[0] + prefixLength));
+    TEST_ASSERT_FALSE(cre_keyframe_assembler_is_in_progress(assembler));
+    TEST_ASSERT_EQUAL_UINT(encoded->size, assembler->keyframe->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(encoded->data, assembler->keyframe->data, encoded->size));
+    TEST_ASSERT_TRUE(cre_snapshot_delta_decode(assembler->keyframe, NULL, decodedSnapshot));
+    TEST_ASSERT_EQUAL_UINT(600, decodedSnapshot->frame);
+    TEST_ASSERT_EQUAL_UINT(snapshot->randomState, decodedSnapshot->randomState);
+    TEST_ASSERT_EQUAL_UINT(snapshot->size, decodedSnapshot->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(snapshot->data, decodedSnapshot->data, snapshot->size));
+
+    cre_keyframe_assembler_delete(assembler);
+    cre_snapshot_delta_delete(encoded);
+    cre_world_snapshot_delete(decodedSnapshot);
+    cre_world_snapshot_delete(snapshot);
+    for (int32 i = 0; i < KEYFRAME_STREAM_TEST_ENTITY_COUNT; i++) {
+        ska_ecs_component_manager_remove_all_components(entities[i]);
+        ska_ecs_entity_return(entities[i]);
+    }
+    cre_scene_manager_finalize();
+}